@@ -9,9 +9,86 @@
 #include "GundamTCG/Subsystems/GCGZoneSubsystem.h"
 #include "GundamTCG/Subsystems/GCGCombatSubsystem.h"
 #include "GundamTCG/Subsystems/GCGLinkUnitSubsystem.h"
+#include "GundamTCG/Subsystems/GCGPlayerActionSubsystem.h"
 #include "GundamTCG/GameModes/GCGGameMode_1v1.h"
+#include "GundamTCG/AI/GCGAIWeights.h"
+#include "GundamTCG/AI/GCGHeuristicPolicy.h"
+#include "GundamTCG/AI/GCGMonteCarloSearch.h"
+#include "GundamTCG/Core/GCGMatchSnapshot.h"
+#include "GundamTCG/Core/GCGRules.h"
+#include "GundamTCG/Core/GCGZobrist.h"
 #include "Kismet/GameplayStatics.h"
 
+// Reasons and thinking logs are for the debug log only; skip formatting them when it's off
+#define GCG_AI_REASON(Format, ...) (bDebugLogging ? FString::Printf(Format, ##__VA_ARGS__) : FString())
+
+namespace
+{
+	/**
+	 * Decide for a player on a headless copy of a captured match (any thread)
+	 * @return Main Phase action, Block (TargetInstanceID = 0, the pending attack) or PassPriority
+	 */
+	FGCGAIAction DecideOnSnapshot(const FGCGCardCatalogPtr& Catalog, const FGCGMatchSnapshot& Snapshot, int32 PlayerID,
+		EGCGAIDifficulty Difficulty, const FGCGSearchSettings& SearchSettings, const FGCGAIWeights& Weights, uint64 Seed,
+		const std::atomic<bool>* bCancel, bool bDebugLogging)
+	{
+		const FGCGRulesEngine Engine(Catalog);
+		FGCGMatchState State;
+		for (int32 PlayerIndex = 0; PlayerIndex < GCGRules::NumPlayers; ++PlayerIndex)
+		{
+			State.Players[PlayerIndex].PlayerID = PlayerIndex;
+		}
+		Snapshot.Restore(State);
+
+		if (FGCGMoveGenerator::GetDecidingPlayer(State) != PlayerID)
+		{
+			return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, GCG_AI_REASON(TEXT("Not our decision")));
+		}
+
+		FGCGAIAction Action;
+		if (Difficulty == EGCGAIDifficulty::Expert)
+		{
+			const FGCGMonteCarloSearch Search(Engine, SearchSettings);
+			const FGCGSearchResult Result = Search.Search(State, Seed, bCancel);
+
+			Action = Result.Move.ToAIAction();
+			Action.Priority = Result.MoveValue * 100.0f;
+			Action.Reason = GCG_AI_REASON(TEXT("Search: %s (%d iterations on %d threads, %d visits, value %.2f, %.2fs)"),
+				*Result.Move.ToString(), Result.Iterations, Result.Threads, Result.MoveVisits, Result.MoveValue, Result.Seconds);
+		}
+		else
+		{
+			// The copy's AI stream would repeat itself every decision; seed it from the live one
+			State.Random.GetStream(EGCGRandomStream::AI, PlayerID).Initialize(Seed);
+
+			const FGCGHeuristicPolicy Policy(Engine, Difficulty, nullptr, &Weights);
+			if (State.IsAttackInProgress())
+			{
+				const int32 BlockerID = Policy.DecideBlocker(State);
+				Action = BlockerID != 0
+					? FGCGAIAction(EGCGAIActionType::Block, BlockerID, 0.0f, GCG_AI_REASON(TEXT("Block")))
+					: FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, GCG_AI_REASON(TEXT("Let attack through")));
+			}
+			else
+			{
+				Action = Policy.DecideMainPhaseAction(State);
+			}
+		}
+
+		// Live requests name the attacked player and the blocked attack
+		if (Action.ActionType == EGCGAIActionType::Attack && Action.TargetInstanceID <= 0)
+		{
+			Action.TargetPlayerID = FGCGMatchState::GetOpponentID(PlayerID);
+		}
+		else if (Action.ActionType == EGCGAIActionType::Block)
+		{
+			Action.TargetInstanceID = 0;
+		}
+
+		return Action;
+	}
+}
+
 AGCGAIController::AGCGAIController()
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -30,11 +107,6 @@ void AGCGAIController::BeginPlay()
 	AIPlayerState = Cast<AGCGPlayerState>(PlayerState);
 	GameState = Cast<AGCGGameState>(UGameplayStatics::GetGameState(this));
 
-	if (UGameInstance* GameInstance = GetGameInstance())
-	{
-		CardDatabase = GameInstance->GetSubsystem<UGCGCardDatabase>();
-	}
-
 	if (bDebugLogging)
 	{
 		UE_LOG(LogTemp, Log, TEXT("AI Controller initialized for Player %d with difficulty: %d"),
@@ -42,10 +114,63 @@ void AGCGAIController::BeginPlay()
 	}
 }
 
+void AGCGAIController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	CancelDecision();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AGCGAIController::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	// Background decision: execute once it is ready and the thinking delay is over
+	if (DecisionTask.IsValid())
+	{
+		ThinkingTimer -= DeltaTime;
+
+		if (GetDecisionStateHash() != DecisionStateHash)
+		{
+			// Decided on a match that no longer exists; think again, keeping the delay left
+			LogAIThinking(TEXT("Match changed while thinking - deciding again"));
+			const float RemainingDelay = ThinkingTimer;
+			if (RequestDecision())
+			{
+				ThinkingTimer = RemainingDelay;
+			}
+		}
+		else if (ThinkingTimer <= 0.0f && DecisionTask.IsCompleted())
+		{
+			FGCGAIAction Action = DecisionTask.GetResult();
+			CancelDecision();
+
+			if (!IsActionLegalLive(Action))
+			{
+				// The headless copy allowed a move the live match won't. Never decide in place here:
+				// an Expert search would stall the frame. Think again in the background, then pass.
+				if (IllegalDecisionRetries < 1)
+				{
+					++IllegalDecisionRetries;
+					LogAIThinking(TEXT("Decided action is not legal on the live match - deciding again"));
+					if (RequestDecision())
+					{
+						ThinkingTimer = 0.0f;
+						return;
+					}
+				}
+
+				LogAIThinking(TEXT("Decided action is still not legal on the live match - passing"));
+				Action = FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, GCG_AI_REASON(TEXT("No legal decision")));
+			}
+
+			IllegalDecisionRetries = 0;
+			LogAIThinking(GCG_AI_REASON(TEXT("AI decided: %s - %s"), *UEnum::GetValueAsString(Action.ActionType), *Action.Reason));
+			ExecuteAction(Action);
+		}
+		return;
+	}
+
 	// Handle thinking delay
 	if (bIsThinking && ThinkingTimer > 0.0f)
 	{
@@ -95,8 +220,14 @@ FGCGAIAction AGCGAIController::DecideAction()
 		return MakeRandomAction();
 	}
 
+	// Expert difficulty: search instead of heuristics
+	if (Difficulty == EGCGAIDifficulty::Expert)
+	{
+		return DecideSearchAction();
+	}
+
 	// Otherwise, use heuristic-based decision making
-	FGCGAIAction BestAction(EGCGAIActionType::PassPriority, -1, 0.0f, TEXT("Default pass"));
+	FGCGAIAction BestAction(EGCGAIActionType::PassPriority, -1, 0.0f, GCG_AI_REASON(TEXT("Default pass")));
 
 	// Phase-specific decisions
 	switch (GameState->CurrentPhase)
@@ -135,7 +266,7 @@ FGCGAIAction AGCGAIController::DecideAction()
 			break;
 	}
 
-	LogAIThinking(FString::Printf(TEXT("AI decided: %s (Priority: %.2f) - %s"),
+	LogAIThinking(GCG_AI_REASON(TEXT("AI decided: %s (Priority: %.2f) - %s"),
 		*UEnum::GetValueAsString(BestAction.ActionType), BestAction.Priority, *BestAction.Reason));
 
 	return BestAction;
@@ -154,18 +285,28 @@ bool AGCGAIController::ExecuteAction(const FGCGAIAction& Action)
 		return false;
 	}
 
-	LogAIThinking(FString::Printf(TEXT("Executing action: %s"), *UEnum::GetValueAsString(Action.ActionType)));
+	LogAIThinking(GCG_AI_REASON(TEXT("Executing action: %s"), *UEnum::GetValueAsString(Action.ActionType)));
 
 	switch (Action.ActionType)
 	{
 		case EGCGAIActionType::PlayCard:
+		{
+			// A Pilot is played onto the Unit the decision paired it with
+			const FGCGCardInstance* Card = AIPlayerState->FindCardInZone(Action.CardInstanceID, EGCGCardZone::Hand);
+			const FGCGCardData* CardData = Card ? GameMode->GetCardDataForInstance(*Card) : nullptr;
+			if (CardData && CardData->CardType == EGCGCardType::Pilot && Action.TargetInstanceID > 0)
+			{
+				return GameMode->RequestPlayPilot(AIPlayerState->PlayerID, Action.CardInstanceID, Action.TargetInstanceID);
+			}
 			return GameMode->RequestPlayCard(AIPlayerState->PlayerID, Action.CardInstanceID);
+		}
 
 		case EGCGAIActionType::PlaceResource:
 			return GameMode->RequestPlaceResource(AIPlayerState->PlayerID, Action.CardInstanceID);
 
 		case EGCGAIActionType::Attack:
-			return GameMode->RequestDeclareAttack(AIPlayerState->PlayerID, Action.CardInstanceID, Action.TargetPlayerID);
+			// TargetInstanceID names a rested enemy Unit; otherwise the attack goes at the opponent
+			return GameMode->RequestDeclareAttack(AIPlayerState->PlayerID, Action.CardInstanceID, FMath::Max(Action.TargetInstanceID, 0));
 
 		case EGCGAIActionType::Block:
 			// Block actions need attack index stored in TargetInstanceID
@@ -192,7 +333,7 @@ FGCGAIAction AGCGAIController::DecideCardToPlay()
 
 	if (PlayableCards.Num() == 0)
 	{
-		return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, TEXT("No playable cards"));
+		return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, GCG_AI_REASON(TEXT("No playable cards")));
 	}
 
 	// Evaluate each playable card
@@ -207,12 +348,12 @@ FGCGAIAction AGCGAIController::DecideCardToPlay()
 		if (Difficulty == EGCGAIDifficulty::Easy)
 		{
 			// Easy AI: Add random noise, sometimes makes mistakes
-			Score += FMath::RandRange(-20.0f, 10.0f);
+			Score += GetRandomStream().FRandRange(-20.0f, 10.0f);
 		}
 		else if (Difficulty == EGCGAIDifficulty::Medium)
 		{
 			// Medium AI: Small random noise
-			Score += FMath::RandRange(-5.0f, 5.0f);
+			Score += GetRandomStream().FRandRange(-5.0f, 5.0f);
 		}
 
 		if (Score > BestScore)
@@ -222,15 +363,15 @@ FGCGAIAction AGCGAIController::DecideCardToPlay()
 				EGCGAIActionType::PlayCard,
 				Card.InstanceID,
 				Score,
-				FString::Printf(TEXT("Play %s (Score: %.1f)"), *Card.CardName.ToString(), Score)
+				GCG_AI_REASON(TEXT("Play %s (Score: %.1f)"), *Card.CardNumber.ToString(), Score)
 			);
 		}
 	}
 
 	// Check if we should pass instead
-	if (ShouldPassPriority() || BestScore < 10.0f)
+	if (ShouldPassPriority() || BestScore < GetWeights().PlayThreshold)
 	{
-		return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, TEXT("Decided to pass"));
+		return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, GCG_AI_REASON(TEXT("Decided to pass")));
 	}
 
 	return BestAction;
@@ -246,13 +387,13 @@ FGCGAIAction AGCGAIController::DecidePlaceResource()
 	// Check if we already placed resource this turn (tracked in player state)
 	if (AIPlayerState->bPlacedResourceThisTurn)
 	{
-		return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, TEXT("Already placed resource"));
+		return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, GCG_AI_REASON(TEXT("Already placed resource")));
 	}
 
 	// Check if we have cards in hand to place as resource
 	if (AIPlayerState->Hand.Num() == 0)
 	{
-		return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, TEXT("No cards in hand"));
+		return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, GCG_AI_REASON(TEXT("No cards in hand")));
 	}
 
 	// Find lowest value card to place as resource
@@ -307,11 +448,11 @@ FGCGAIAction AGCGAIController::DecidePlaceResource()
 			EGCGAIActionType::PlaceResource,
 			BestCardToPlace.InstanceID,
 			50.0f,
-			FString::Printf(TEXT("Place %s as resource (Value: %.1f)"), *BestCardToPlace.CardName.ToString(), LowestValue)
+			GCG_AI_REASON(TEXT("Place %s as resource (Value: %.1f)"), *BestCardToPlace.CardNumber.ToString(), LowestValue)
 		);
 	}
 
-	return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, TEXT("Keep hand for plays"));
+	return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, GCG_AI_REASON(TEXT("Keep hand for plays")));
 }
 
 FGCGAIAction AGCGAIController::DecideAttack()
@@ -320,7 +461,7 @@ FGCGAIAction AGCGAIController::DecideAttack()
 
 	if (AttackableUnits.Num() == 0)
 	{
-		return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, TEXT("No attackable units"));
+		return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, GCG_AI_REASON(TEXT("No attackable units")));
 	}
 
 	// Evaluate each potential attack
@@ -338,12 +479,12 @@ FGCGAIAction AGCGAIController::DecideAttack()
 		if (Difficulty == EGCGAIDifficulty::Easy)
 		{
 			// Easy AI: Random attacks, doesn't evaluate well
-			Score = FMath::RandRange(0.0f, 50.0f);
+			Score = GetRandomStream().FRandRange(0.0f, 50.0f);
 		}
 		else if (Difficulty == EGCGAIDifficulty::Medium)
 		{
 			// Medium AI: Small random noise
-			Score += FMath::RandRange(-10.0f, 10.0f);
+			Score += GetRandomStream().FRandRange(-10.0f, 10.0f);
 		}
 
 		if (Score > BestScore)
@@ -353,19 +494,19 @@ FGCGAIAction AGCGAIController::DecideAttack()
 				EGCGAIActionType::Attack,
 				Attacker.InstanceID,
 				Score,
-				FString::Printf(TEXT("Attack with %s (Score: %.1f)"), *Attacker.CardName.ToString(), Score)
+				GCG_AI_REASON(TEXT("Attack with %s (Score: %.1f)"), *Attacker.CardNumber.ToString(), Score)
 			);
 			BestAction.TargetPlayerID = OpponentID;
 		}
 	}
 
 	// Check if we should attack
-	if (BestScore > 20.0f)
+	if (BestScore > GetWeights().AttackThreshold)
 	{
 		return BestAction;
 	}
 
-	return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, TEXT("No good attacks"));
+	return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, GCG_AI_REASON(TEXT("No good attacks")));
 }
 
 FGCGAIAction AGCGAIController::DecideBlock(int32 AttackIndex)
@@ -375,12 +516,23 @@ FGCGAIAction AGCGAIController::DecideBlock(int32 AttackIndex)
 		return FGCGAIAction(EGCGAIActionType::PassPriority);
 	}
 
+	if (Difficulty == EGCGAIDifficulty::Expert)
+	{
+		FGCGAIAction SearchAction = DecideSearchAction();
+		if (SearchAction.ActionType != EGCGAIActionType::Block)
+		{
+			return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, GCG_AI_REASON(TEXT("Let attack through")));
+		}
+		SearchAction.TargetInstanceID = AttackIndex;
+		return SearchAction;
+	}
+
 	const FGCGAttackInfo& Attack = GameState->PendingAttacks[AttackIndex];
 	TArray<FGCGCardInstance> BlockerUnits = GetBlockerUnits();
 
 	if (BlockerUnits.Num() == 0)
 	{
-		return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, TEXT("No blockers available"));
+		return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, GCG_AI_REASON(TEXT("No blockers available")));
 	}
 
 	// Get attacker info
@@ -423,12 +575,12 @@ FGCGAIAction AGCGAIController::DecideBlock(int32 AttackIndex)
 		if (Difficulty == EGCGAIDifficulty::Easy)
 		{
 			// Easy AI: Random blocking decisions
-			Score = FMath::RandRange(-20.0f, 40.0f);
+			Score = GetRandomStream().FRandRange(-20.0f, 40.0f);
 		}
 		else if (Difficulty == EGCGAIDifficulty::Medium)
 		{
 			// Medium AI: Small random noise
-			Score += FMath::RandRange(-5.0f, 5.0f);
+			Score += GetRandomStream().FRandRange(-5.0f, 5.0f);
 		}
 
 		if (Score > BestScore)
@@ -438,7 +590,7 @@ FGCGAIAction AGCGAIController::DecideBlock(int32 AttackIndex)
 				EGCGAIActionType::Block,
 				Blocker.InstanceID,
 				Score,
-				FString::Printf(TEXT("Block with %s (Score: %.1f)"), *Blocker.CardName.ToString(), Score)
+				GCG_AI_REASON(TEXT("Block with %s (Score: %.1f)"), *Blocker.CardNumber.ToString(), Score)
 			);
 			BestAction.TargetInstanceID = AttackIndex; // Store attack index
 		}
@@ -447,22 +599,12 @@ FGCGAIAction AGCGAIController::DecideBlock(int32 AttackIndex)
 	// Check if we should block
 	// Hard AI: Always blocks if favorable
 	// Medium/Easy: Sometimes doesn't block even when favorable
-	float BlockThreshold = 20.0f;
-	if (Difficulty == EGCGAIDifficulty::Easy)
-	{
-		BlockThreshold = 40.0f; // Easy AI rarely blocks
-	}
-	else if (Difficulty == EGCGAIDifficulty::Medium)
-	{
-		BlockThreshold = 30.0f;
-	}
-
-	if (BestScore > BlockThreshold)
+	if (BestScore > GetWeights().GetBlockThreshold(Difficulty))
 	{
 		return BestAction;
 	}
 
-	return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, TEXT("Let attack through"));
+	return FGCGAIAction(EGCGAIActionType::PassPriority, -1, 0.0f, GCG_AI_REASON(TEXT("Let attack through")));
 }
 
 TArray<int32> AGCGAIController::DecideDiscard(int32 DiscardCount)
@@ -509,6 +651,8 @@ FGCGAIGameEvaluation AGCGAIController::EvaluateGameState()
 		return Eval;
 	}
 
+	const FGCGAIWeights& Weights = GetWeights();
+
 	// Get opponent
 	AGCGPlayerState* OpponentState = nullptr;
 	for (APlayerState* PS : GameState->PlayerArray)
@@ -529,79 +673,75 @@ FGCGAIGameEvaluation AGCGAIController::EvaluateGameState()
 	// Board Control (Units on field)
 	int32 OurUnits = AIPlayerState->BattleArea.Num();
 	int32 TheirUnits = OpponentState->BattleArea.Num();
-	Eval.BoardControl = 50.0f + (OurUnits - TheirUnits) * 10.0f;
+	Eval.BoardControl = 50.0f + (OurUnits - TheirUnits) * Weights.BoardControlPerUnit;
 	Eval.BoardControl = FMath::Clamp(Eval.BoardControl, 0.0f, 100.0f);
 
 	// Resource Advantage
 	int32 OurResources = AIPlayerState->ResourceArea.Num();
 	int32 TheirResources = OpponentState->ResourceArea.Num();
-	Eval.ResourceAdvantage = 50.0f + (OurResources - TheirResources) * 5.0f;
+	Eval.ResourceAdvantage = 50.0f + (OurResources - TheirResources) * Weights.ResourceAdvantagePerResource;
 	Eval.ResourceAdvantage = FMath::Clamp(Eval.ResourceAdvantage, 0.0f, 100.0f);
 
 	// Card Advantage (hand + deck)
 	int32 OurCards = AIPlayerState->Hand.Num() + AIPlayerState->Deck.Num();
 	int32 TheirCards = OpponentState->Hand.Num() + OpponentState->Deck.Num();
-	Eval.CardAdvantage = 50.0f + (OurCards - TheirCards) * 2.0f;
+	Eval.CardAdvantage = 50.0f + (OurCards - TheirCards) * Weights.CardAdvantagePerCard;
 	Eval.CardAdvantage = FMath::Clamp(Eval.CardAdvantage, 0.0f, 100.0f);
 
 	// Tempo Advantage (total AP on board)
 	int32 OurAP = 0;
 	for (const FGCGCardInstance& Unit : AIPlayerState->BattleArea)
 	{
-		OurAP += Unit.AP;
+		OurAP += Unit.GetTotalAP(GetCardData(Unit));
 	}
 
 	int32 TheirAP = 0;
 	for (const FGCGCardInstance& Unit : OpponentState->BattleArea)
 	{
-		TheirAP += Unit.AP;
+		TheirAP += Unit.GetTotalAP(GetCardData(Unit));
 	}
 
-	Eval.TempoAdvantage = 50.0f + (OurAP - TheirAP) * 3.0f;
+	Eval.TempoAdvantage = 50.0f + (OurAP - TheirAP) * Weights.TempoAdvantagePerAP;
 	Eval.TempoAdvantage = FMath::Clamp(Eval.TempoAdvantage, 0.0f, 100.0f);
 
 	// Threat Level (opponent's board strength)
-	Eval.ThreatLevel = FMath::Clamp(TheirAP * 2.0f, 0.0f, 100.0f);
+	Eval.ThreatLevel = FMath::Clamp(TheirAP * Weights.ThreatPerAP, 0.0f, 100.0f);
 
 	// Overall Advantage Score
-	Eval.AdvantageScore = (Eval.BoardControl - 50.0f) +
-	                      (Eval.ResourceAdvantage - 50.0f) * 0.5f +
-	                      (Eval.CardAdvantage - 50.0f) * 0.5f +
-	                      (Eval.TempoAdvantage - 50.0f) * 1.5f;
+	Eval.AdvantageScore = (Eval.BoardControl - 50.0f) * Weights.AdvantageBoardWeight +
+	                      (Eval.ResourceAdvantage - 50.0f) * Weights.AdvantageResourceWeight +
+	                      (Eval.CardAdvantage - 50.0f) * Weights.AdvantageCardWeight +
+	                      (Eval.TempoAdvantage - 50.0f) * Weights.AdvantageTempoWeight;
 
 	return Eval;
 }
 
 float AGCGAIController::EvaluateCardPlay(const FGCGCardInstance& CardInstance)
 {
-	if (!CardDatabase)
-	{
-		return 0.0f;
-	}
-
-	const FGCGCardData* CardData = CardDatabase->GetCardData(CardInstance.CardNumber);
+	const FGCGCardData* CardData = GetCardData(CardInstance);
 	if (!CardData)
 	{
 		return 0.0f;
 	}
 
+	const FGCGAIWeights& Weights = GetWeights();
 	float Score = 0.0f;
 
 	// Base value: card stats
-	Score += CardInstance.AP * 5.0f;
-	Score += CardInstance.HP * 3.0f;
+	Score += CardInstance.GetTotalAP(CardData) * Weights.PlayAPWeight;
+	Score += CardInstance.GetTotalHP(CardData) * Weights.PlayHPWeight;
 
 	// Card type bonuses
 	switch (CardData->CardType)
 	{
 		case EGCGCardType::Unit:
-			Score += 20.0f; // Units are valuable
+			Score += Weights.PlayUnitBonus; // Units are valuable
 			break;
 		case EGCGCardType::Command:
-			Score += 15.0f; // Commands have immediate effect
+			Score += Weights.PlayCommandBonus; // Commands have immediate effect
 			break;
 		case EGCGCardType::Pilot:
-			Score += 10.0f; // Pilots enable Link Units
+			Score += Weights.PlayPilotBonus; // Pilots enable Link Units
 			break;
 		default:
 			break;
@@ -610,36 +750,36 @@ float AGCGAIController::EvaluateCardPlay(const FGCGCardInstance& CardInstance)
 	// Keyword bonuses
 	if (CardData->HasKeyword(EGCGKeyword::Repair))
 	{
-		Score += 15.0f; // Healing is valuable
+		Score += Weights.PlayRepairBonus; // Healing is valuable
 	}
 	if (CardData->HasKeyword(EGCGKeyword::Breach))
 	{
-		Score += 20.0f; // Direct damage is strong
+		Score += Weights.PlayBreachBonus; // Direct damage is strong
 	}
 	if (CardData->HasKeyword(EGCGKeyword::FirstStrike))
 	{
-		Score += 10.0f;
+		Score += Weights.PlayFirstStrikeBonus;
 	}
 	if (CardData->HasKeyword(EGCGKeyword::HighManeuver))
 	{
-		Score += 12.0f;
+		Score += Weights.PlayHighManeuverBonus;
 	}
 
 	// Evaluate based on game state
 	FGCGAIGameEvaluation GameEval = EvaluateGameState();
 
 	// If we're behind on board, prioritize Units
-	if (GameEval.BoardControl < 40.0f && CardData->CardType == EGCGCardType::Unit)
+	if (GameEval.BoardControl < Weights.BehindOnBoardControl && CardData->CardType == EGCGCardType::Unit)
 	{
-		Score += 15.0f;
+		Score += Weights.PlayBehindOnBoardUnitBonus;
 	}
 
 	// If opponent has strong board, prioritize removal/combat
-	if (GameEval.ThreatLevel > 60.0f)
+	if (GameEval.ThreatLevel > Weights.UnderThreatLevel)
 	{
 		if (CardData->HasKeyword(EGCGKeyword::Breach))
 		{
-			Score += 10.0f;
+			Score += Weights.PlayUnderThreatBreachBonus;
 		}
 	}
 
@@ -648,25 +788,27 @@ float AGCGAIController::EvaluateCardPlay(const FGCGCardInstance& CardInstance)
 
 float AGCGAIController::EvaluateAttack(const FGCGCardInstance& AttackerInstance, int32 TargetPlayerID)
 {
-	if (!AIPlayerState || !GameState)
+	const FGCGCardCatalog* Catalog = GetCatalog();
+	if (!AIPlayerState || !GameState || !Catalog)
 	{
 		return 0.0f;
 	}
 
+	const FGCGAIWeights& Weights = GetWeights();
 	float Score = 0.0f;
 
-	// Base score: attacker's AP
-	Score += AttackerInstance.AP * 10.0f;
+	// Base score: attacker's combat AP (Support included)
+	Score += FGCGRules::GetCombatAP(*Catalog, *AIPlayerState, AttackerInstance) * Weights.AttackAPWeight;
 
 	// Check keywords
-	if (AttackerInstance.ActiveKeywords.Contains(EGCGKeyword::FirstStrike))
+	if (FGCGRules::HasKeyword(*Catalog, AttackerInstance, EGCGKeyword::FirstStrike))
 	{
-		Score += 15.0f; // FirstStrike is valuable in combat
+		Score += Weights.AttackFirstStrikeBonus; // FirstStrike is valuable in combat
 	}
 
-	if (AttackerInstance.ActiveKeywords.Contains(EGCGKeyword::HighManeuver))
+	if (FGCGRules::HasKeyword(*Catalog, AttackerInstance, EGCGKeyword::HighManeuver))
 	{
-		Score += 10.0f; // Can't be blocked
+		Score += Weights.AttackHighManeuverBonus; // Can't be blocked
 	}
 
 	// Get opponent state
@@ -687,7 +829,7 @@ float AGCGAIController::EvaluateAttack(const FGCGCardInstance& AttackerInstance,
 		int32 PotentialBlockers = 0;
 		for (const FGCGCardInstance& OpponentUnit : OpponentState->BattleArea)
 		{
-			if (OpponentUnit.bIsActive && OpponentUnit.ActiveKeywords.Contains(EGCGKeyword::Blocker))
+			if (OpponentUnit.bIsActive && FGCGRules::HasKeyword(*Catalog, OpponentUnit, EGCGKeyword::Blocker))
 			{
 				PotentialBlockers++;
 			}
@@ -695,17 +837,17 @@ float AGCGAIController::EvaluateAttack(const FGCGCardInstance& AttackerInstance,
 
 		if (PotentialBlockers == 0)
 		{
-			Score += 20.0f; // Safe attack
+			Score += Weights.AttackUnblockedBonus; // Safe attack
 		}
 		else
 		{
-			Score -= PotentialBlockers * 5.0f; // Risky attack
+			Score -= PotentialBlockers * Weights.AttackPerBlockerPenalty; // Risky attack
 		}
 
 		// If opponent is low on shields, attacking is more valuable
 		if (OpponentState->ShieldStack.Num() <= 2)
 		{
-			Score += 25.0f; // Potential game-winning attack
+			Score += Weights.AttackLowShieldsBonus; // Potential game-winning attack
 		}
 	}
 
@@ -714,23 +856,42 @@ float AGCGAIController::EvaluateAttack(const FGCGCardInstance& AttackerInstance,
 
 float AGCGAIController::EvaluateBlock(const FGCGCardInstance& BlockerInstance, const FGCGCardInstance& AttackerInstance)
 {
+	const FGCGCardCatalog* Catalog = GetCatalog();
+	if (!AIPlayerState || !GameState || !Catalog)
+	{
+		return 0.0f;
+	}
+
+	// The attacker's Support comes from its own board
+	const AGCGPlayerState* AttackerState = AIPlayerState;
+	for (APlayerState* PS : GameState->PlayerArray)
+	{
+		const AGCGPlayerState* GCGPS = Cast<AGCGPlayerState>(PS);
+		if (GCGPS && GCGPS->FindCardInZone(AttackerInstance.InstanceID, EGCGCardZone::BattleArea))
+		{
+			AttackerState = GCGPS;
+			break;
+		}
+	}
+
+	const FGCGAIWeights& Weights = GetWeights();
 	float Score = 0.0f;
 
-	// Check if blocker can survive
-	int32 BlockerHP = BlockerInstance.HP - BlockerInstance.DamageTaken;
-	int32 AttackerAP = AttackerInstance.AP;
-	int32 BlockerAP = BlockerInstance.AP;
-	int32 AttackerHP = AttackerInstance.HP - AttackerInstance.DamageTaken;
+	// Resolve the fight the way combat will (combat AP, remaining HP, First Strike)
+	const FGCGUnitCombatOutcome Outcome = FGCGRules::ResolveUnitCombat(
+		FGCGRules::GetCombatAP(*Catalog, *AttackerState, AttackerInstance), FGCGRules::GetRemainingHP(*Catalog, AttackerInstance),
+		FGCGRules::GetCombatAP(*Catalog, *AIPlayerState, BlockerInstance), FGCGRules::GetRemainingHP(*Catalog, BlockerInstance),
+		FGCGRules::HasFirstStrikeAdvantage(*Catalog, AttackerInstance, BlockerInstance));
 
 	// Can we kill attacker?
-	bool bKillsAttacker = (BlockerAP >= AttackerHP);
-	bool bDiesBlocking = (AttackerAP >= BlockerHP);
+	const bool bKillsAttacker = Outcome.bAttackerDestroyed;
+	const bool bDiesBlocking = Outcome.bDefenderDestroyed;
 
 	if (bKillsAttacker && !bDiesBlocking)
 	{
 		// Favorable trade: we survive and kill attacker
-		Score += 50.0f;
-		Score += AttackerInstance.AP * 5.0f; // Bonus for killing strong attacker
+		Score += Weights.BlockWinningTradeBonus;
+		Score += AttackerInstance.GetTotalAP(GetCardData(AttackerInstance)) * Weights.BlockAttackerAPWeight; // Bonus for killing strong attacker
 	}
 	else if (bKillsAttacker && bDiesBlocking)
 	{
@@ -741,34 +902,34 @@ float AGCGAIController::EvaluateBlock(const FGCGCardInstance& BlockerInstance, c
 
 		if (AttackerValue > BlockerValue)
 		{
-			Score += 30.0f; // Good trade
+			Score += Weights.BlockGoodTradeBonus; // Good trade
 		}
 		else
 		{
-			Score += 10.0f; // Even trade
+			Score += Weights.BlockEvenTradeBonus; // Even trade
 		}
 	}
 	else if (!bKillsAttacker && !bDiesBlocking)
 	{
 		// Both survive: chump block to prevent damage
-		Score += 15.0f;
+		Score += Weights.BlockChumpBonus;
 	}
 	else
 	{
 		// We die, attacker survives: bad trade
-		Score -= 20.0f;
+		Score -= Weights.BlockLosingTradePenalty;
 	}
 
 	// If attacker has Breach, blocking is more important
-	if (AttackerInstance.ActiveKeywords.Contains(EGCGKeyword::Breach))
+	if (FGCGRules::HasKeyword(*Catalog, AttackerInstance, EGCGKeyword::Breach))
 	{
-		Score += 25.0f; // Prevent direct Base damage
+		Score += Weights.BlockBreachBonus; // Prevent direct Base damage
 	}
 
 	// If we're low on shields, blocking is critical
-	if (AIPlayerState && AIPlayerState->ShieldStack.Num() <= 2)
+	if (AIPlayerState->ShieldStack.Num() <= 2)
 	{
-		Score += 20.0f;
+		Score += Weights.BlockLowShieldsBonus;
 	}
 
 	return Score;
@@ -792,7 +953,7 @@ TArray<FGCGCardInstance> AGCGAIController::GetPlayableCards()
 {
 	TArray<FGCGCardInstance> PlayableCards;
 
-	if (!AIPlayerState || !CardDatabase)
+	if (!AIPlayerState)
 	{
 		return PlayableCards;
 	}
@@ -801,15 +962,16 @@ TArray<FGCGCardInstance> AGCGAIController::GetPlayableCards()
 
 	for (const FGCGCardInstance& Card : AIPlayerState->Hand)
 	{
+		const FGCGCardData* CardData = GetCardData(Card);
+		if (!CardData)
+		{
+			continue;
+		}
+
 		// Check if we have enough resources
-		if (Card.Cost <= AvailableResources)
+		if (Card.GetTotalCost(CardData) <= AvailableResources)
 		{
 			// Additional checks based on card type
-			const FGCGCardData* CardData = CardDatabase->GetCardData(Card.CardNumber);
-			if (!CardData)
-			{
-				continue;
-			}
 
 			// Check Battle Area limit for Units
 			if (CardData->CardType == EGCGCardType::Unit && AIPlayerState->BattleArea.Num() >= 6)
@@ -878,44 +1040,40 @@ TArray<FGCGCardInstance> AGCGAIController::GetBlockerUnits()
 
 float AGCGAIController::GetCardValue(const FGCGCardInstance& CardInstance)
 {
-	if (!CardDatabase)
-	{
-		return 0.0f;
-	}
-
-	const FGCGCardData* CardData = CardDatabase->GetCardData(CardInstance.CardNumber);
+	const FGCGCardData* CardData = GetCardData(CardInstance);
 	if (!CardData)
 	{
 		return 0.0f;
 	}
 
+	const FGCGAIWeights& Weights = GetWeights();
 	float Value = 0.0f;
 
 	// Base value: stats
-	Value += CardInstance.AP * 3.0f;
-	Value += CardInstance.HP * 2.0f;
+	Value += CardInstance.GetTotalAP(CardData) * Weights.ValueAPWeight;
+	Value += CardInstance.GetTotalHP(CardData) * Weights.ValueHPWeight;
 
 	// Card type
 	switch (CardData->CardType)
 	{
 		case EGCGCardType::Unit:
-			Value += 15.0f;
+			Value += Weights.ValueUnitBonus;
 			break;
 		case EGCGCardType::Command:
-			Value += 10.0f;
+			Value += Weights.ValueCommandBonus;
 			break;
 		case EGCGCardType::Pilot:
-			Value += 8.0f;
+			Value += Weights.ValuePilotBonus;
 			break;
 		default:
 			break;
 	}
 
 	// Keywords
-	Value += CardData->Keywords.Num() * 5.0f;
+	Value += CardData->Keywords.Num() * Weights.ValuePerKeyword;
 
 	// Effects
-	Value += CardData->Effects.Num() * 8.0f;
+	Value += CardData->Effects.Num() * Weights.ValuePerEffect;
 
 	// Cost efficiency
 	if (CardData->Cost > 0)
@@ -945,11 +1103,11 @@ bool AGCGAIController::ShouldPassPriority()
 	// Random chance to pass (makes AI less predictable)
 	if (Difficulty == EGCGAIDifficulty::Easy)
 	{
-		return FMath::RandRange(0.0f, 1.0f) > 0.7f;
+		return GetRandomStream().FRand() > 0.7f;
 	}
 	else if (Difficulty == EGCGAIDifficulty::Medium)
 	{
-		return FMath::RandRange(0.0f, 1.0f) > 0.5f;
+		return GetRandomStream().FRand() > 0.5f;
 	}
 
 	return false;
@@ -976,12 +1134,12 @@ FGCGAIAction AGCGAIController::MakeRandomAction()
 			if (!AIPlayerState->bPlacedResourceThisTurn && AIPlayerState->Hand.Num() > 0)
 			{
 				// Random card from hand
-				int32 RandomIndex = FMath::RandRange(0, AIPlayerState->Hand.Num() - 1);
+				int32 RandomIndex = GetRandomStream().RandRange(0, AIPlayerState->Hand.Num() - 1);
 				PossibleActions.Add(FGCGAIAction(
 					EGCGAIActionType::PlaceResource,
 					AIPlayerState->Hand[RandomIndex].InstanceID,
 					1.0f,
-					TEXT("Random resource placement")
+					GCG_AI_REASON(TEXT("Random resource placement"))
 				));
 			}
 			break;
@@ -996,7 +1154,7 @@ FGCGAIAction AGCGAIController::MakeRandomAction()
 					EGCGAIActionType::PlayCard,
 					Card.InstanceID,
 					1.0f,
-					FString::Printf(TEXT("Random play: %s"), *Card.CardName.ToString())
+					GCG_AI_REASON(TEXT("Random play: %s"), *Card.CardNumber.ToString())
 				));
 			}
 			break;
@@ -1013,7 +1171,7 @@ FGCGAIAction AGCGAIController::MakeRandomAction()
 					EGCGAIActionType::Attack,
 					Unit.InstanceID,
 					1.0f,
-					FString::Printf(TEXT("Random attack: %s"), *Unit.CardName.ToString())
+					GCG_AI_REASON(TEXT("Random attack: %s"), *Unit.CardNumber.ToString())
 				);
 				AttackAction.TargetPlayerID = OpponentID;
 				PossibleActions.Add(AttackAction);
@@ -1026,18 +1184,189 @@ FGCGAIAction AGCGAIController::MakeRandomAction()
 	}
 
 	// Always add pass option
-	PossibleActions.Add(FGCGAIAction(EGCGAIActionType::PassPriority, -1, 1.0f, TEXT("Random pass")));
+	PossibleActions.Add(FGCGAIAction(EGCGAIActionType::PassPriority, -1, 1.0f, GCG_AI_REASON(TEXT("Random pass"))));
 
 	// Pick random action
 	if (PossibleActions.Num() > 0)
 	{
-		int32 RandomIndex = FMath::RandRange(0, PossibleActions.Num() - 1);
+		int32 RandomIndex = GetRandomStream().RandRange(0, PossibleActions.Num() - 1);
 		return PossibleActions[RandomIndex];
 	}
 
 	return FGCGAIAction(EGCGAIActionType::PassPriority);
 }
 
+// ===========================================================================================
+// SEARCH (Expert)
+// ===========================================================================================
+
+FGCGAIAction AGCGAIController::DecideSearchAction()
+{
+	AGCGGameModeBase* GameMode = Cast<AGCGGameModeBase>(UGameplayStatics::GetGameMode(this));
+	if (!GameMode || !GameMode->GetMatchCatalog().IsValid() || !GameState || !AIPlayerState)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AGCGAIController::DecideSearchAction - No match to search (server only)"));
+		return FGCGAIAction(EGCGAIActionType::PassPriority);
+	}
+
+	const FGCGAIAction Action = DecideOnSnapshot(GameMode->GetMatchCatalog(), FGCGMatchSnapshot::CaptureLive(GameState, nullptr),
+		AIPlayerState->GetPlayerID(), EGCGAIDifficulty::Expert, GetSearchSettings(), GetWeights(), GetRandomStream().Next(), nullptr, bDebugLogging);
+
+	LogAIThinking(Action.Reason);
+
+	return Action;
+}
+
+FGCGSearchSettings AGCGAIController::GetSearchSettings() const
+{
+	FGCGSearchSettings Settings;
+	Settings.TimeBudgetSeconds = ExpertSearchTimeBudget;
+	Settings.MaxIterations = ExpertMaxIterations;
+	Settings.NumThreads = ExpertSearchThreads;
+	Settings.Parallelism = EGCGSearchParallelism::Tree;
+	return Settings;
+}
+
+const FGCGAIWeights& AGCGAIController::GetWeights() const
+{
+	return WeightsAsset ? WeightsAsset->Weights : FGCGAIWeights::GetDefault();
+}
+
+// ===========================================================================================
+// BACKGROUND DECISIONS
+// ===========================================================================================
+
+bool AGCGAIController::RequestDecision()
+{
+	CancelDecision();
+
+	AGCGGameModeBase* GameMode = Cast<AGCGGameModeBase>(UGameplayStatics::GetGameMode(this));
+	if (!GameMode || !GameMode->GetMatchCatalog().IsValid() || !GameState || !AIPlayerState)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AGCGAIController::RequestDecision - No match to decide on (server only)"));
+		return false;
+	}
+
+	// Everything the task reads is captured here; it never touches the world
+	FGCGCardCatalogPtr Catalog = GameMode->GetMatchCatalog();
+	FGCGMatchSnapshot Snapshot = FGCGMatchSnapshot::CaptureLive(GameState, nullptr);
+	const int32 PlayerID = AIPlayerState->GetPlayerID();
+	const EGCGAIDifficulty TaskDifficulty = Difficulty;
+	const FGCGSearchSettings Settings = GetSearchSettings();
+	const FGCGAIWeights Weights = GetWeights();
+	const uint64 Seed = GetRandomStream().Next();
+	const bool bExplain = bDebugLogging;
+
+	DecisionCancelFlag = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+	DecisionStateHash = GetDecisionStateHash();
+
+	DecisionTask = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[Catalog = MoveTemp(Catalog), Snapshot = MoveTemp(Snapshot), PlayerID, TaskDifficulty, Settings, Weights, Seed, CancelFlag = DecisionCancelFlag, bExplain]()
+		{
+			return DecideOnSnapshot(Catalog, Snapshot, PlayerID, TaskDifficulty, Settings, Weights, Seed, CancelFlag.Get(), bExplain);
+		});
+
+	// The thinking delay runs alongside the decision instead of after it
+	ThinkingTimer = bUseThinkingDelay ? GetRandomStream().FRandRange(MinThinkingDelay, MaxThinkingDelay) : 0.0f;
+
+	LogAIThinking(TEXT("AI deciding action in the background..."));
+
+	return true;
+}
+
+void AGCGAIController::CancelDecision()
+{
+	if (DecisionCancelFlag)
+	{
+		DecisionCancelFlag->store(true, std::memory_order_relaxed);
+		DecisionCancelFlag.Reset();
+	}
+
+	// The task owns everything it uses, so it can finish on its own
+	DecisionTask = UE::Tasks::TTask<FGCGAIAction>();
+}
+
+const FGCGCardData* AGCGAIController::GetCardData(const FGCGCardInstance& CardInstance) const
+{
+	AGCGGameModeBase* GameMode = Cast<AGCGGameModeBase>(UGameplayStatics::GetGameMode(this));
+	return GameMode ? GameMode->GetCardDataForInstance(CardInstance) : nullptr;
+}
+
+const FGCGCardCatalog* AGCGAIController::GetCatalog() const
+{
+	AGCGGameModeBase* GameMode = Cast<AGCGGameModeBase>(UGameplayStatics::GetGameMode(this));
+	return GameMode ? GameMode->GetMatchCatalog().Get() : nullptr;
+}
+
+uint64 AGCGAIController::GetDecisionStateHash() const
+{
+	// Recomputed from every card: an in-place edit that skipped RefreshCardHash must still count as a change
+	return GameState ? FGCGZobrist::HashLive(GameState, nullptr, true) : 0;
+}
+
+bool AGCGAIController::IsActionLegalLive(const FGCGAIAction& Action) const
+{
+	AGCGGameModeBase* GameMode = Cast<AGCGGameModeBase>(UGameplayStatics::GetGameMode(this));
+	UGameInstance* GameInstance = GetGameInstance();
+	if (!GameMode || !GameInstance || !AIPlayerState || !GameState)
+	{
+		return false;
+	}
+
+	switch (Action.ActionType)
+	{
+		case EGCGAIActionType::PlayCard:
+		{
+			// Shared play checks, including a Pilot's Unit still being ours and unpaired
+			const FGCGCardInstance* Card = AIPlayerState->FindCardInZone(Action.CardInstanceID, EGCGCardZone::Hand);
+			const UGCGPlayerActionSubsystem* ActionSubsystem = GameInstance->GetSubsystem<UGCGPlayerActionSubsystem>();
+			return Card && ActionSubsystem && ActionSubsystem->CanPlayCard(*Card, AIPlayerState, GameState, Action.TargetInstanceID).bSuccess;
+		}
+
+		case EGCGAIActionType::PlaceResource:
+			return AIPlayerState->FindCardInZone(Action.CardInstanceID, EGCGCardZone::Hand) != nullptr;
+
+		case EGCGAIActionType::Attack:
+		{
+			const FGCGCardInstance* Attacker = AIPlayerState->FindCardInZone(Action.CardInstanceID, EGCGCardZone::BattleArea);
+			const UGCGCombatSubsystem* CombatSubsystem = GameInstance->GetSubsystem<UGCGCombatSubsystem>();
+			if (!Attacker || !CombatSubsystem || !CombatSubsystem->CanAttack(*Attacker, AIPlayerState, GameState).bSuccess)
+			{
+				return false;
+			}
+
+			if (Action.TargetInstanceID <= 0)
+			{
+				return true;
+			}
+
+			// The attacked Unit must still be an enemy's and rested
+			for (APlayerState* PS : GameState->PlayerArray)
+			{
+				AGCGPlayerState* GCGPS = Cast<AGCGPlayerState>(PS);
+				if (GCGPS && GCGPS != AIPlayerState)
+				{
+					if (const FGCGCardInstance* Target = GCGPS->FindCardInZone(Action.TargetInstanceID, EGCGCardZone::BattleArea))
+					{
+						return !Target->bIsActive;
+					}
+				}
+			}
+			return false;
+		}
+
+		case EGCGAIActionType::Block:
+		{
+			const FGCGCardInstance* Blocker = AIPlayerState->FindCardInZone(Action.CardInstanceID, EGCGCardZone::BattleArea);
+			return GameState->bAttackInProgress && Blocker && Blocker->bIsActive;
+		}
+
+		default:
+			// Ending the turn and passing are always allowed
+			return true;
+	}
+}
+
 // ===========================================================================================
 // DEBUG
 // ===========================================================================================
@@ -1054,3 +1383,15 @@ void AGCGAIController::SetDebugLogging(bool bEnabled)
 {
 	bDebugLogging = bEnabled;
 }
+
+FGCGRandomStream& AGCGAIController::GetRandomStream()
+{
+	if (GameState && AIPlayerState)
+	{
+		return GameState->GetRandomStream(EGCGRandomStream::AI, AIPlayerState->GetPlayerID());
+	}
+
+	return FallbackRandom;
+}
+
+#undef GCG_AI_REASON
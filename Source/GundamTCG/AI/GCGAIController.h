@@ -7,12 +7,18 @@
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerController.h"
 #include "GundamTCG/GCGTypes.h"
+#include "GundamTCG/GameState/GCGMatchRandom.h"
+#include "Tasks/Task.h"
+#include <atomic>
 #include "GCGAIController.generated.h"
 
 // Forward declarations
 class AGCGPlayerState;
 class AGCGGameState;
-class UGCGCardDatabase;
+class UGCGAIWeightsAsset;
+class FGCGCardCatalog;
+struct FGCGAIWeights;
+struct FGCGSearchSettings;
 
 /**
  * AI Difficulty Level
@@ -23,7 +29,8 @@ enum class EGCGAIDifficulty : uint8
 	Random          UMETA(DisplayName = "Random (Testing)"),
 	Easy            UMETA(DisplayName = "Easy"),
 	Medium          UMETA(DisplayName = "Medium"),
-	Hard            UMETA(DisplayName = "Hard")
+	Hard            UMETA(DisplayName = "Hard"),
+	Expert          UMETA(DisplayName = "Expert (Search)")
 };
 
 /**
@@ -118,6 +125,16 @@ struct FGCGAIGameEvaluation
  * - Easy: Basic heuristics, makes obvious mistakes
  * - Medium: Decent heuristics, avoids major mistakes
  * - Hard: Advanced heuristics, near-optimal play
+ * - Expert: Monte Carlo Tree Search over the headless rules engine
+ *   (FGCGMonteCarloSearch), with Hard heuristics as the rollout policy
+ *
+ * Decisions run either synchronously (DecideAction and the Decide* functions,
+ * reading the live player states) or in the background (RequestDecision):
+ * the match is captured as an immutable FGCGMatchSnapshot, a task decides on
+ * a headless copy of it with FGCGHeuristicPolicy or the search, and Tick
+ * executes the result once the thinking delay - which runs meanwhile - is
+ * over too. A match that changes before then cancels the decision and a new
+ * one is started from the new state.
  */
 UCLASS()
 class GUNDAMTCG_API AGCGAIController : public APlayerController
@@ -132,6 +149,7 @@ public:
 	// ===========================================================================================
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 
 	/**
@@ -162,6 +180,26 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AI")
 	FGCGAIAction DecideAction();
 
+	/**
+	 * Start deciding the next action on a background task (server only)
+	 * Tick executes the action once it is ready and the thinking delay is over
+	 * @return False if there is no match to decide on
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AI")
+	bool RequestDecision();
+
+	/**
+	 * Drop the background decision, if any (a running search is stopped)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AI")
+	void CancelDecision();
+
+	/**
+	 * Is a background decision waiting to be executed?
+	 */
+	UFUNCTION(BlueprintPure, Category = "AI")
+	bool IsDecisionPending() const { return DecisionTask.IsValid(); }
+
 	/**
 	 * Execute an AI action
 	 * @param Action The action to execute
@@ -344,6 +382,22 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
 	float MaxThinkingDelay = 3.0f;
 
+	// Scoring weights (the hand-picked defaults if unset)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+	TObjectPtr<UGCGAIWeightsAsset> WeightsAsset = nullptr;
+
+	// Expert difficulty: search time per decision (seconds)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Search", meta = (ClampMin = "0.0"))
+	float ExpertSearchTimeBudget = 1.0f;
+
+	// Expert difficulty: search iterations per decision (0 = time budget only)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Search", meta = (ClampMin = "0"))
+	int32 ExpertMaxIterations = 0;
+
+	// Expert difficulty: search workers sharing one tree (0 = one per logical core)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Search", meta = (ClampMin = "0"))
+	int32 ExpertSearchThreads = 0;
+
 	// Enable debug logging
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
 	bool bDebugLogging = false;
@@ -357,10 +411,6 @@ protected:
 	UPROPERTY()
 	AGCGGameState* GameState = nullptr;
 
-	// Cached card database
-	UPROPERTY()
-	UGCGCardDatabase* CardDatabase = nullptr;
-
 	// Current thinking timer
 	UPROPERTY()
 	float ThinkingTimer = 0.0f;
@@ -372,4 +422,50 @@ protected:
 	// Pending action to execute
 	UPROPERTY()
 	FGCGAIAction PendingAction;
+
+	/**
+	 * This AI's random stream (score noise, random choices)
+	 * Comes from the match seed so AI games replay exactly
+	 */
+	FGCGRandomStream& GetRandomStream();
+
+	/**
+	 * Expert difficulty: search the current decision on a headless copy of the match
+	 * (server only - the copy needs every player's hidden zones)
+	 * @return Main Phase action, Block (TargetInstanceID = attack index) or PassPriority
+	 */
+	FGCGAIAction DecideSearchAction();
+
+	/** Search settings for the Expert difficulty */
+	FGCGSearchSettings GetSearchSettings() const;
+
+	/** Scoring weights: WeightsAsset's, or FGCGAIWeights::GetDefault() */
+	const FGCGAIWeights& GetWeights() const;
+
+	/** Static data behind a card, from the catalog generation this match pinned (server only) */
+	const FGCGCardData* GetCardData(const FGCGCardInstance& CardInstance) const;
+
+	/** The catalog generation this match pinned, for FGCGRules stat helpers (server only) */
+	const FGCGCardCatalog* GetCatalog() const;
+
+	/** Hash of the match as a decision sees it (see FGCGZobrist::HashLive) */
+	uint64 GetDecisionStateHash() const;
+
+	/** Can a decided action still be applied to the live match? (a matching hash alone doesn't prove it) */
+	bool IsActionLegalLive(const FGCGAIAction& Action) const;
+
+	// Background decision (see RequestDecision)
+	UE::Tasks::TTask<FGCGAIAction> DecisionTask;
+
+	// Set to stop the task's search early
+	TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> DecisionCancelFlag;
+
+	// Match hash when the decision was requested
+	uint64 DecisionStateHash = 0;
+
+	// Background re-decisions made because the last result was illegal on the live match
+	int32 IllegalDecisionRetries = 0;
+
+	// Used only when there is no game state to take a stream from
+	FGCGRandomStream FallbackRandom{FGCGMatchRandom::MakeSeed()};
 };
@@ -0,0 +1,22 @@
+// GCGAIWeights.cpp - AI Heuristic Weights Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGAIWeights.h"
+#include "GCGAIController.h"
+
+const FGCGAIWeights& FGCGAIWeights::GetDefault()
+{
+	static const FGCGAIWeights Default;
+	return Default;
+}
+
+float FGCGAIWeights::GetBlockThreshold(EGCGAIDifficulty Difficulty) const
+{
+	switch (Difficulty)
+	{
+	case EGCGAIDifficulty::Random:	return BlockThresholdRandom;
+	case EGCGAIDifficulty::Easy:	return BlockThresholdEasy;
+	case EGCGAIDifficulty::Medium:	return BlockThresholdMedium;
+	default:						return BlockThreshold;
+	}
+}
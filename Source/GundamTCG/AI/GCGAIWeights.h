@@ -0,0 +1,245 @@
+// GCGAIWeights.h - AI Heuristic Weights
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Scoring constants of the heuristic AI, editable as a data asset and tunable by self-play
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GCGAIWeights.generated.h"
+
+enum class EGCGAIDifficulty : uint8;
+
+/**
+ * AI Heuristic Weights
+ *
+ * Every number the heuristic AI scores with. Used by both AGCGAIController
+ * and FGCGHeuristicPolicy, so the live and headless AIs stay in step. The
+ * defaults are the original hand-picked values.
+ *
+ * UGCGTuneAIWeightsCommandlet tunes every float here except the ones marked
+ * NoTuning (Game Evaluation feeds only the live controller, which self-play
+ * doesn't run). Floats marked TuneFor are tuned only when tuning that difficulty.
+ */
+USTRUCT(BlueprintType)
+struct GUNDAMTCG_API FGCGAIWeights
+{
+	GENERATED_BODY()
+
+	// ===== CARD PLAY =====
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Play")
+	float PlayAPWeight = 5.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Play")
+	float PlayHPWeight = 3.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Play")
+	float PlayUnitBonus = 20.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Play")
+	float PlayCommandBonus = 15.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Play")
+	float PlayPilotBonus = 10.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Play")
+	float PlayBaseBonus = 10.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Play")
+	float PlayRepairBonus = 15.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Play")
+	float PlayBreachBonus = 20.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Play")
+	float PlayFirstStrikeBonus = 10.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Play")
+	float PlayHighManeuverBonus = 12.0f;
+
+	// Unit bonus while the opponent has more units
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Play")
+	float PlayBehindOnBoardUnitBonus = 15.0f;
+
+	// Breach bonus while the opponent's board is threatening (live controller)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Play", meta = (NoTuning))
+	float PlayUnderThreatBreachBonus = 10.0f;
+
+	// Minimum score to play a card rather than pass
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Play")
+	float PlayThreshold = 10.0f;
+
+	// ===== ATTACK =====
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
+	float AttackAPWeight = 10.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
+	float AttackFirstStrikeBonus = 15.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
+	float AttackHighManeuverBonus = 10.0f;
+
+	// No active enemy Blocker
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
+	float AttackUnblockedBonus = 20.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
+	float AttackPerBlockerPenalty = 5.0f;
+
+	// Opponent on 2 shields or fewer
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
+	float AttackLowShieldsBonus = 25.0f;
+
+	// Attacking a rested Unit: we destroy it and survive
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
+	float AttackWinningTradeBonus = 40.0f;
+
+	// Attacking a rested Unit: both destroyed, theirs worth more / not
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
+	float AttackGoodTradeBonus = 25.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
+	float AttackEvenTradeBonus = 5.0f;
+
+	// Attacking a rested Unit that survives
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
+	float AttackFailedTradePenalty = 20.0f;
+
+	// Per point of Breach when the attacked Unit is destroyed
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
+	float AttackBreachPerPoint = 10.0f;
+
+	// Minimum score to attack rather than end the turn
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
+	float AttackThreshold = 20.0f;
+
+	// ===== BLOCK =====
+
+	// Blocker survives and destroys the attacker
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Block")
+	float BlockWinningTradeBonus = 50.0f;
+
+	// Per point of the destroyed attacker's AP
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Block")
+	float BlockAttackerAPWeight = 5.0f;
+
+	// Both destroyed, the attacker worth more / not
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Block")
+	float BlockGoodTradeBonus = 30.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Block")
+	float BlockEvenTradeBonus = 10.0f;
+
+	// Both survive
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Block")
+	float BlockChumpBonus = 15.0f;
+
+	// Blocker destroyed, attacker survives
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Block")
+	float BlockLosingTradePenalty = 20.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Block")
+	float BlockBreachBonus = 25.0f;
+
+	// We are on 2 shields or fewer
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Block")
+	float BlockLowShieldsBonus = 20.0f;
+
+	// Minimum score to block, per difficulty (see GetBlockThreshold): lower difficulties block less readily
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Block", meta = (TuneFor = "Hard"))
+	float BlockThreshold = 20.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Block", meta = (TuneFor = "Medium"))
+	float BlockThresholdMedium = 30.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Block", meta = (TuneFor = "Easy"))
+	float BlockThresholdEasy = 40.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Block", meta = (NoTuning))
+	float BlockThresholdRandom = 50.0f;
+
+	// ===== CARD VALUE =====
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Value")
+	float ValueAPWeight = 3.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Value")
+	float ValueHPWeight = 2.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Value")
+	float ValueUnitBonus = 15.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Value")
+	float ValueCommandBonus = 10.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Value")
+	float ValuePilotBonus = 8.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Value")
+	float ValuePerKeyword = 5.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Value")
+	float ValuePerEffect = 8.0f;
+
+	// ===== GAME EVALUATION (live controller) =====
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Game Evaluation", meta = (NoTuning))
+	float BoardControlPerUnit = 10.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Game Evaluation", meta = (NoTuning))
+	float ResourceAdvantagePerResource = 5.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Game Evaluation", meta = (NoTuning))
+	float CardAdvantagePerCard = 2.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Game Evaluation", meta = (NoTuning))
+	float TempoAdvantagePerAP = 3.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Game Evaluation", meta = (NoTuning))
+	float ThreatPerAP = 2.0f;
+
+	// Weights of the four advantages in AdvantageScore
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Game Evaluation", meta = (NoTuning))
+	float AdvantageBoardWeight = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Game Evaluation", meta = (NoTuning))
+	float AdvantageResourceWeight = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Game Evaluation", meta = (NoTuning))
+	float AdvantageCardWeight = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Game Evaluation", meta = (NoTuning))
+	float AdvantageTempoWeight = 1.5f;
+
+	// Board control below this counts as behind on board (PlayBehindOnBoardUnitBonus)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Game Evaluation", meta = (NoTuning))
+	float BehindOnBoardControl = 40.0f;
+
+	// Threat level above this counts as under threat (PlayUnderThreatBreachBonus)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Game Evaluation", meta = (NoTuning))
+	float UnderThreatLevel = 60.0f;
+
+	/** Minimum block score for a difficulty (Hard and Expert use BlockThreshold) */
+	float GetBlockThreshold(EGCGAIDifficulty Difficulty) const;
+
+	/** The original hand-picked weights */
+	static const FGCGAIWeights& GetDefault();
+};
+
+/**
+ * AI Weights Asset
+ *
+ * A named set of FGCGAIWeights to assign to AGCGAIController::WeightsAsset
+ * (e.g. one per personality, or the output of a tuning run).
+ */
+UCLASS(BlueprintType)
+class GUNDAMTCG_API UGCGAIWeightsAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI", meta = (ShowOnlyInnerProperties))
+	FGCGAIWeights Weights;
+};
@@ -0,0 +1,533 @@
+// GCGHeuristicPolicy.cpp - Headless AI Policy Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGHeuristicPolicy.h"
+#include "GundamTCG/AI/GCGMonteCarloSearch.h"
+
+namespace
+{
+	/** A winning move outranks any heuristic */
+	constexpr float LethalBonus = 1000.0f;
+}
+
+FGCGHeuristicPolicy::FGCGHeuristicPolicy(const FGCGRulesEngine& InEngine, EGCGAIDifficulty InDifficulty, const FGCGSearchSettings* InSearchSettings,
+	const FGCGAIWeights* InWeights)
+	: Engine(InEngine)
+	, Difficulty(InDifficulty)
+	, Weights(InWeights ? *InWeights : FGCGAIWeights::GetDefault())
+	, MoveGenerator(InEngine)
+{
+	if (Difficulty == EGCGAIDifficulty::Expert)
+	{
+		Search = MakeUnique<FGCGMonteCarloSearch>(Engine, InSearchSettings ? *InSearchSettings : FGCGSearchSettings());
+	}
+}
+
+FGCGHeuristicPolicy::~FGCGHeuristicPolicy() = default;
+
+// ===========================================================================================
+// DECISIONS
+// ===========================================================================================
+
+FGCGAIAction FGCGHeuristicPolicy::DecideMainPhaseAction(FGCGMatchState& State) const
+{
+	const int32 PlayerID = State.ActivePlayerID;
+	const FGCGPlayerBoard& Board = State.GetPlayer(PlayerID);
+	const FGCGPlayerBoard& Opponent = State.GetOpponent(PlayerID);
+
+	if (Search)
+	{
+		const uint64 Seed = State.Random.GetStream(EGCGRandomStream::AI, PlayerID).Next();
+		return Search->Search(State, Seed).Move.ToAIAction();
+	}
+
+	// Random difficulty: any legal move (ending the turn included) with equal weight
+	if (Difficulty == EGCGAIDifficulty::Random)
+	{
+		FGCGMoveBuffer Moves;
+		MoveGenerator.GenerateMoves(State, Moves);
+		if (Moves.Num() == 0)
+		{
+			return FGCGAIAction(EGCGAIActionType::EndTurn);
+		}
+
+		FGCGRandomStream& Random = State.Random.GetStream(EGCGRandomStream::AI, PlayerID);
+		return Moves[Random.RandRange(0, Moves.Num() - 1)].ToAIAction();
+	}
+
+	// Main Phase first: deploy the best card worth playing
+	FGCGAIAction BestPlay(EGCGAIActionType::EndTurn);
+	float BestPlayScore = -1000.0f;
+
+	for (const FGCGCardInstance& Card : Board.Hand)
+	{
+		const FGCGCardView CardView = Engine.GetCardView(Card);
+		if (!CardView)
+		{
+			continue;
+		}
+
+		const int32 TargetID = CardView.GetCardType() == EGCGCardType::Pilot ? ChoosePilotTarget(State, PlayerID) : 0;
+		if (Engine.CanPlayCard(State, PlayerID, Card.InstanceID, TargetID) != EGCGRulesResult::Success)
+		{
+			continue;
+		}
+
+		const float Score = AddNoise(State, PlayerID, EvaluateCardPlay(State, PlayerID, CardView), -20.0f, 10.0f, 5.0f);
+		if (Score > BestPlayScore)
+		{
+			BestPlayScore = Score;
+			BestPlay = FGCGAIAction(EGCGAIActionType::PlayCard, Card.InstanceID, Score);
+			BestPlay.TargetInstanceID = TargetID;
+		}
+	}
+
+	if (BestPlay.ActionType == EGCGAIActionType::PlayCard && BestPlayScore >= Weights.PlayThreshold)
+	{
+		return BestPlay;
+	}
+
+	// Then attacks: the player or any rested enemy Unit
+	FGCGAIAction BestAttack(EGCGAIActionType::EndTurn);
+	float BestAttackScore = -1000.0f;
+
+	for (const FGCGCardInstance& Attacker : Board.BattleArea)
+	{
+		if (Engine.CanAttack(State, PlayerID, Attacker.InstanceID) != EGCGRulesResult::Success)
+		{
+			continue;
+		}
+
+		auto ConsiderTarget = [&](int32 TargetID)
+		{
+			float Score = EvaluateAttack(State, PlayerID, Attacker, TargetID);
+			if (Difficulty == EGCGAIDifficulty::Easy)
+			{
+				// Easy AI: Random attacks, doesn't evaluate well
+				Score = State.Random.GetStream(EGCGRandomStream::AI, PlayerID).FRandRange(0.0f, 50.0f);
+			}
+			else
+			{
+				Score = AddNoise(State, PlayerID, Score, 0.0f, 0.0f, 10.0f);
+			}
+
+			if (Score > BestAttackScore)
+			{
+				BestAttackScore = Score;
+				BestAttack = FGCGAIAction(EGCGAIActionType::Attack, Attacker.InstanceID, Score);
+				BestAttack.TargetInstanceID = TargetID;
+			}
+		};
+
+		ConsiderTarget(0);
+		for (const FGCGCardInstance& Target : Opponent.BattleArea)
+		{
+			if (!Target.bIsActive && Engine.CanAttack(State, PlayerID, Attacker.InstanceID, Target.InstanceID) == EGCGRulesResult::Success)
+			{
+				ConsiderTarget(Target.InstanceID);
+			}
+		}
+	}
+
+	if (BestAttack.ActionType == EGCGAIActionType::Attack && BestAttackScore > Weights.AttackThreshold)
+	{
+		return BestAttack;
+	}
+
+	return FGCGAIAction(EGCGAIActionType::EndTurn);
+}
+
+int32 FGCGHeuristicPolicy::DecideBlocker(FGCGMatchState& State) const
+{
+	if (!State.IsAttackInProgress())
+	{
+		return 0;
+	}
+
+	const FGCGAttackData& Attack = State.CurrentAttack;
+	const int32 PlayerID = Attack.TargetPlayerID;
+
+	if (Search)
+	{
+		const uint64 Seed = State.Random.GetStream(EGCGRandomStream::AI, PlayerID).Next();
+		const FGCGMove Move = Search->Search(State, Seed).Move;
+		return Move.Type == EGCGMoveType::Block ? Move.CardInstanceID : 0;
+	}
+	const FGCGCardInstance* Attacker = State.GetActivePlayer().FindCardInZone(Attack.AttackerInstanceID, EGCGCardZone::BattleArea);
+	if (!Attacker)
+	{
+		return 0;
+	}
+
+	int32 BestBlockerID = 0;
+	float BestScore = -1000.0f;
+	int32 NumBlockers = 0;
+
+	for (const FGCGCardInstance& Blocker : State.GetPlayer(PlayerID).BattleArea)
+	{
+		if (Engine.CanBlock(State, Blocker.InstanceID) != EGCGRulesResult::Success)
+		{
+			continue;
+		}
+
+		++NumBlockers;
+
+		float Score = 0.0f;
+		if (Difficulty == EGCGAIDifficulty::Random)
+		{
+			Score = State.Random.GetStream(EGCGRandomStream::AI, PlayerID).FRandRange(0.0f, 100.0f);
+		}
+		else if (Difficulty == EGCGAIDifficulty::Easy)
+		{
+			// Easy AI: Random blocking decisions
+			Score = State.Random.GetStream(EGCGRandomStream::AI, PlayerID).FRandRange(-20.0f, 40.0f);
+		}
+		else
+		{
+			Score = AddNoise(State, PlayerID, EvaluateBlock(State, PlayerID, Blocker, *Attacker), 0.0f, 0.0f, 5.0f);
+		}
+
+		if (Score > BestScore)
+		{
+			BestScore = Score;
+			BestBlockerID = Blocker.InstanceID;
+		}
+	}
+
+	if (NumBlockers == 0)
+	{
+		return 0;
+	}
+
+	// Hard AI: Always blocks if favorable; Medium/Easy: Sometimes doesn't block even when favorable
+	return BestScore > Weights.GetBlockThreshold(Difficulty) ? BestBlockerID : 0;
+}
+
+void FGCGHeuristicPolicy::DecideDiscards(const FGCGMatchState& State, int32 PlayerID, int32 DiscardCount, TArray<int32>& OutCardIDs) const
+{
+	OutCardIDs.Reset();
+
+	const TArray<FGCGCardInstance>& Hand = State.GetPlayer(PlayerID).Hand;
+	if (DiscardCount <= 0 || Hand.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<TPair<float, int32>, TInlineAllocator<16>> ByValue;
+	for (const FGCGCardInstance& Card : Hand)
+	{
+		ByValue.Emplace(GetCardValue(Card), Card.InstanceID);
+	}
+	ByValue.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+
+	for (int32 i = 0; i < DiscardCount && i < ByValue.Num(); ++i)
+	{
+		OutCardIDs.Add(ByValue[i].Value);
+	}
+}
+
+// ===========================================================================================
+// EVALUATION
+// ===========================================================================================
+
+float FGCGHeuristicPolicy::EvaluateCardPlay(const FGCGMatchState& State, int32 PlayerID, const FGCGCardView& CardView) const
+{
+	float Score = 0.0f;
+
+	// Base value: card stats
+	Score += CardView.GetAP() * Weights.PlayAPWeight;
+	Score += CardView.GetHP() * Weights.PlayHPWeight;
+
+	// Card type bonuses
+	switch (CardView.GetCardType())
+	{
+	case EGCGCardType::Unit:
+		Score += Weights.PlayUnitBonus; // Units are valuable
+		break;
+	case EGCGCardType::Command:
+		Score += Weights.PlayCommandBonus; // Commands have immediate effect
+		break;
+	case EGCGCardType::Pilot:
+		Score += Weights.PlayPilotBonus; // Pilots enable Link Units
+		break;
+	case EGCGCardType::Base:
+		Score += Weights.PlayBaseBonus; // Replaces the EX Base
+		break;
+	default:
+		break;
+	}
+
+	// Keyword bonuses
+	if (CardView.HasKeyword(EGCGKeyword::Repair))
+	{
+		Score += Weights.PlayRepairBonus; // Healing is valuable
+	}
+	if (CardView.HasKeyword(EGCGKeyword::Breach))
+	{
+		Score += Weights.PlayBreachBonus; // Direct damage is strong
+	}
+	if (CardView.HasKeyword(EGCGKeyword::FirstStrike))
+	{
+		Score += Weights.PlayFirstStrikeBonus;
+	}
+	if (CardView.HasKeyword(EGCGKeyword::HighManeuver))
+	{
+		Score += Weights.PlayHighManeuverBonus;
+	}
+
+	// If we're behind on board, prioritize Units
+	const FGCGCardCatalog& Catalog = Engine.GetCatalog();
+	const int32 OurUnits = FGCGRules::CountUnits(Catalog, State.GetPlayer(PlayerID));
+	const int32 TheirUnits = FGCGRules::CountUnits(Catalog, State.GetOpponent(PlayerID));
+	if (OurUnits < TheirUnits && CardView.GetCardType() == EGCGCardType::Unit)
+	{
+		Score += Weights.PlayBehindOnBoardUnitBonus;
+	}
+
+	return Score;
+}
+
+float FGCGHeuristicPolicy::EvaluateAttack(const FGCGMatchState& State, int32 PlayerID, const FGCGCardInstance& Attacker, int32 TargetInstanceID) const
+{
+	const FGCGCardCatalog& Catalog = Engine.GetCatalog();
+	const FGCGPlayerBoard& Board = State.GetPlayer(PlayerID);
+	const FGCGPlayerBoard& Opponent = State.GetOpponent(PlayerID);
+
+	const int32 AttackerAP = FGCGRules::GetCombatAP(Catalog, Board, Attacker);
+	const bool bHighManeuver = FGCGRules::HasKeyword(Catalog, Attacker, EGCGKeyword::HighManeuver);
+
+	float Score = 0.0f;
+
+	// Attacking a rested Unit: worth it when the trade is
+	if (TargetInstanceID != 0)
+	{
+		const FGCGCardInstance* Target = Opponent.FindCardInZone(TargetInstanceID, EGCGCardZone::BattleArea);
+		if (!Target)
+		{
+			return -1000.0f;
+		}
+
+		const FGCGUnitCombatOutcome Outcome = FGCGRules::ResolveUnitCombat(
+			AttackerAP, FGCGRules::GetRemainingHP(Catalog, Attacker),
+			FGCGRules::GetCombatAP(Catalog, Opponent, *Target), FGCGRules::GetRemainingHP(Catalog, *Target),
+			FGCGRules::HasFirstStrikeAdvantage(Catalog, Attacker, *Target));
+
+		if (Outcome.bDefenderDestroyed && !Outcome.bAttackerDestroyed)
+		{
+			Score += Weights.AttackWinningTradeBonus + GetCardValue(*Target);
+		}
+		else if (Outcome.bDefenderDestroyed)
+		{
+			Score += GetCardValue(*Target) > GetCardValue(Attacker) ? Weights.AttackGoodTradeBonus : Weights.AttackEvenTradeBonus;
+		}
+		else
+		{
+			Score -= Weights.AttackFailedTradePenalty;
+		}
+
+		// Breach turns a kill into shield damage as well
+		if (Outcome.bDefenderDestroyed)
+		{
+			Score += FGCGRules::GetKeywordValue(Catalog, Attacker, EGCGKeyword::Breach) * Weights.AttackBreachPerPoint;
+		}
+
+		return Score;
+	}
+
+	// Base score: attacker's AP
+	Score += AttackerAP * Weights.AttackAPWeight;
+
+	if (FGCGRules::HasKeyword(Catalog, Attacker, EGCGKeyword::FirstStrike))
+	{
+		Score += Weights.AttackFirstStrikeBonus; // FirstStrike is valuable in combat
+	}
+	if (bHighManeuver)
+	{
+		Score += Weights.AttackHighManeuverBonus; // Can't be blocked
+	}
+
+	// If opponent has no blockers, attack is safer
+	int32 PotentialBlockers = 0;
+	if (!bHighManeuver)
+	{
+		for (const FGCGCardInstance& OpponentUnit : Opponent.BattleArea)
+		{
+			if (OpponentUnit.bIsActive && FGCGRules::HasKeyword(Catalog, OpponentUnit, EGCGKeyword::Blocker))
+			{
+				PotentialBlockers++;
+			}
+		}
+	}
+
+	if (PotentialBlockers == 0)
+	{
+		Score += Weights.AttackUnblockedBonus; // Safe attack
+
+		// No Base and no shields left: this attack wins
+		if (FGCGRules::GetPlayerDamageTarget(Opponent) == EGCGPlayerDamageTarget::Player)
+		{
+			Score += LethalBonus;
+		}
+	}
+	else
+	{
+		Score -= PotentialBlockers * Weights.AttackPerBlockerPenalty; // Risky attack
+	}
+
+	// If opponent is low on shields, attacking is more valuable
+	if (Opponent.ShieldStack.Num() <= 2)
+	{
+		Score += Weights.AttackLowShieldsBonus; // Potential game-winning attack
+	}
+
+	return Score;
+}
+
+float FGCGHeuristicPolicy::EvaluateBlock(const FGCGMatchState& State, int32 PlayerID, const FGCGCardInstance& Blocker, const FGCGCardInstance& Attacker) const
+{
+	const FGCGCardCatalog& Catalog = Engine.GetCatalog();
+	const FGCGPlayerBoard& Board = State.GetPlayer(PlayerID);
+
+	const FGCGUnitCombatOutcome Outcome = FGCGRules::ResolveUnitCombat(
+		FGCGRules::GetCombatAP(Catalog, State.GetOpponent(PlayerID), Attacker), FGCGRules::GetRemainingHP(Catalog, Attacker),
+		FGCGRules::GetCombatAP(Catalog, Board, Blocker), FGCGRules::GetRemainingHP(Catalog, Blocker),
+		FGCGRules::HasFirstStrikeAdvantage(Catalog, Attacker, Blocker));
+
+	const bool bKillsAttacker = Outcome.bAttackerDestroyed;
+	const bool bDiesBlocking = Outcome.bDefenderDestroyed;
+
+	float Score = 0.0f;
+
+	if (bKillsAttacker && !bDiesBlocking)
+	{
+		// Favorable trade: we survive and kill attacker
+		Score += Weights.BlockWinningTradeBonus;
+		Score += FGCGRules::GetTotalAP(Catalog, Attacker) * Weights.BlockAttackerAPWeight; // Bonus for killing strong attacker
+	}
+	else if (bKillsAttacker && bDiesBlocking)
+	{
+		// Even trade: both die
+		Score += GetCardValue(Attacker) > GetCardValue(Blocker) ? Weights.BlockGoodTradeBonus : Weights.BlockEvenTradeBonus;
+	}
+	else if (!bKillsAttacker && !bDiesBlocking)
+	{
+		// Both survive: chump block to prevent damage
+		Score += Weights.BlockChumpBonus;
+	}
+	else
+	{
+		// We die, attacker survives: bad trade
+		Score -= Weights.BlockLosingTradePenalty;
+	}
+
+	// If attacker has Breach, blocking is more important
+	if (FGCGRules::HasKeyword(Catalog, Attacker, EGCGKeyword::Breach))
+	{
+		Score += Weights.BlockBreachBonus; // Prevent direct Base damage
+	}
+
+	// If we're low on shields, blocking is critical
+	if (Board.ShieldStack.Num() <= 2)
+	{
+		Score += Weights.BlockLowShieldsBonus;
+	}
+
+	// Nothing left to absorb the hit: block or lose
+	if (State.CurrentAttack.bTargetingPlayer && FGCGRules::GetPlayerDamageTarget(Board) == EGCGPlayerDamageTarget::Player)
+	{
+		Score += LethalBonus;
+	}
+
+	return Score;
+}
+
+float FGCGHeuristicPolicy::GetCardValue(const FGCGCardInstance& Card) const
+{
+	const FGCGCardView CardView = Engine.GetCardView(Card);
+	if (!CardView)
+	{
+		return 0.0f;
+	}
+
+	const FGCGCardCatalog& Catalog = Engine.GetCatalog();
+	float Value = 0.0f;
+
+	// Base value: stats
+	Value += FGCGRules::GetTotalAP(Catalog, Card) * Weights.ValueAPWeight;
+	Value += FGCGRules::GetTotalHP(Catalog, Card) * Weights.ValueHPWeight;
+
+	// Card type
+	switch (CardView.GetCardType())
+	{
+	case EGCGCardType::Unit:
+		Value += Weights.ValueUnitBonus;
+		break;
+	case EGCGCardType::Command:
+		Value += Weights.ValueCommandBonus;
+		break;
+	case EGCGCardType::Pilot:
+		Value += Weights.ValuePilotBonus;
+		break;
+	default:
+		break;
+	}
+
+	// Keywords
+	Value += CardView.NumKeywords() * Weights.ValuePerKeyword;
+
+	// Effects
+	Value += CardView.NumEffects() * Weights.ValuePerEffect;
+
+	// Cost efficiency
+	if (CardView.GetCost() > 0)
+	{
+		Value = Value / FMath::Sqrt(static_cast<float>(CardView.GetCost()));
+	}
+
+	return Value;
+}
+
+// ===========================================================================================
+// INTERNAL
+// ===========================================================================================
+
+int32 FGCGHeuristicPolicy::ChoosePilotTarget(const FGCGMatchState& State, int32 PlayerID) const
+{
+	int32 BestUnitID = 0;
+	int32 BestAP = MIN_int32;
+
+	for (const FGCGCardInstance& Card : State.GetPlayer(PlayerID).BattleArea)
+	{
+		const FGCGCardView CardView = Engine.GetCardView(Card);
+		if (!CardView || CardView.GetCardType() != EGCGCardType::Unit || Card.PairedCardInstanceID != 0)
+		{
+			continue;
+		}
+
+		const int32 AP = FGCGRules::GetTotalAP(Engine.GetCatalog(), Card);
+		if (AP > BestAP)
+		{
+			BestAP = AP;
+			BestUnitID = Card.InstanceID;
+		}
+	}
+
+	return BestUnitID;
+}
+
+float FGCGHeuristicPolicy::AddNoise(FGCGMatchState& State, int32 PlayerID, float Score, float EasyMin, float EasyMax, float MediumRange) const
+{
+	switch (Difficulty)
+	{
+	case EGCGAIDifficulty::Easy:
+		// Easy AI: Add random noise, sometimes makes mistakes
+		return EasyMin < EasyMax ? Score + State.Random.GetStream(EGCGRandomStream::AI, PlayerID).FRandRange(EasyMin, EasyMax) : Score;
+
+	case EGCGAIDifficulty::Medium:
+		// Medium AI: Small random noise
+		return Score + State.Random.GetStream(EGCGRandomStream::AI, PlayerID).FRandRange(-MediumRange, MediumRange);
+
+	default:
+		return Score;
+	}
+}
@@ -0,0 +1,100 @@
+// GCGHeuristicPolicy.h - Headless AI Policy
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// AGCGAIController's heuristics on an FGCGMatchState, for simulation without a world
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GundamTCG/AI/GCGAIController.h"
+#include "GundamTCG/AI/GCGAIWeights.h"
+#include "GundamTCG/AI/GCGMoveGenerator.h"
+#include "GundamTCG/Core/GCGRulesEngine.h"
+
+class FGCGMonteCarloSearch;
+struct FGCGSearchSettings;
+
+/**
+ * Heuristic Policy
+ *
+ * Decides actions for one player of a headless match. Scoring follows
+ * AGCGAIController (card play, attack and block evaluation, difficulty noise
+ * and thresholds, all weighted by FGCGAIWeights) but reads card data through
+ * the rules engine's catalog and legality through the engine itself, so every
+ * decision it returns is legal.
+ *
+ * The policy only decides; the caller applies the decision with FGCGRulesEngine.
+ * Noise is drawn from the match's AI stream for the deciding player, so a match
+ * replays identically from its seed.
+ *
+ * Expert difficulty hands Main Phase and block decisions to FGCGMonteCarloSearch
+ * (which rolls out with a Hard policy of its own); discards stay heuristic.
+ *
+ * Stateless apart from its settings: one instance can serve any number of
+ * matches on any number of threads.
+ */
+class GUNDAMTCG_API FGCGHeuristicPolicy
+{
+public:
+	/**
+	 * @param InSearchSettings Expert difficulty only: search settings (defaults if null)
+	 * @param InWeights Scoring weights (FGCGAIWeights::GetDefault() if null)
+	 */
+	FGCGHeuristicPolicy(const FGCGRulesEngine& InEngine, EGCGAIDifficulty InDifficulty, const FGCGSearchSettings* InSearchSettings = nullptr,
+		const FGCGAIWeights* InWeights = nullptr);
+	~FGCGHeuristicPolicy();
+
+	EGCGAIDifficulty GetDifficulty() const { return Difficulty; }
+	const FGCGAIWeights& GetWeights() const { return Weights; }
+
+	// ===== DECISIONS =====
+
+	/**
+	 * Next Main Phase action for the active player
+	 * @return PlayCard (CardInstanceID, TargetInstanceID = Pilot's Unit),
+	 *         Attack (CardInstanceID, TargetInstanceID = unit or 0 for the player)
+	 *         or EndTurn
+	 */
+	FGCGAIAction DecideMainPhaseAction(FGCGMatchState& State) const;
+
+	/**
+	 * Blocker for the current attack, as the defending player
+	 * @return Blocker instance ID, or 0 to let the attack through
+	 */
+	int32 DecideBlocker(FGCGMatchState& State) const;
+
+	/**
+	 * Cards to discard at the hand limit (lowest value first)
+	 */
+	void DecideDiscards(const FGCGMatchState& State, int32 PlayerID, int32 DiscardCount, TArray<int32>& OutCardIDs) const;
+
+	// ===== EVALUATION =====
+
+	/** Value of playing a card now */
+	float EvaluateCardPlay(const FGCGMatchState& State, int32 PlayerID, const FGCGCardView& CardView) const;
+
+	/** Value of an attack (TargetInstanceID 0 = the player) */
+	float EvaluateAttack(const FGCGMatchState& State, int32 PlayerID, const FGCGCardInstance& Attacker, int32 TargetInstanceID) const;
+
+	/** Value of blocking an attacker with a blocker */
+	float EvaluateBlock(const FGCGMatchState& State, int32 PlayerID, const FGCGCardInstance& Blocker, const FGCGCardInstance& Attacker) const;
+
+	/** Value of a card in general (discard order, trades) */
+	float GetCardValue(const FGCGCardInstance& Card) const;
+
+private:
+	/** Best unpaired Unit to receive a Pilot (0 if none) */
+	int32 ChoosePilotTarget(const FGCGMatchState& State, int32 PlayerID) const;
+
+	/** Score noise for this difficulty */
+	float AddNoise(FGCGMatchState& State, int32 PlayerID, float Score, float EasyMin, float EasyMax, float MediumRange) const;
+
+	const FGCGRulesEngine& Engine;
+	EGCGAIDifficulty Difficulty;
+	FGCGAIWeights Weights;
+
+	/** Random difficulty's legal moves */
+	FGCGMoveGenerator MoveGenerator;
+
+	/** Expert difficulty's search (null otherwise) */
+	TUniquePtr<FGCGMonteCarloSearch> Search;
+};
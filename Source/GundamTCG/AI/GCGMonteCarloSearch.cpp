@@ -0,0 +1,547 @@
+// GCGMonteCarloSearch.cpp - Information Set Monte Carlo Tree Search Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGMonteCarloSearch.h"
+#include "Tasks/Task.h"
+#include <atomic>
+
+namespace
+{
+	/** Iterations between clock reads when searching on a time budget */
+	constexpr int32 TimeCheckInterval = 16;
+
+	/** Iterations when neither a time budget nor an iteration cap is set */
+	constexpr int32 DefaultIterations = 1000;
+
+	/** Score difference that makes Evaluate return ~0.73 / ~0.27 */
+	constexpr float EvaluationScale = 8.0f;
+
+	/** Rewards are summed in fixed point so they can be added atomically */
+	constexpr double RewardScale = 65536.0;
+
+	/** One node of a search tree; nodes refer to each other by index into the tree's pool */
+	struct FGCGSearchNode
+	{
+		// Written once before the node is published, read-only after
+
+		/** Move that leads here from the parent */
+		FGCGMove Move;
+
+		int32 Parent = INDEX_NONE;
+		int32 NextSibling = INDEX_NONE;
+
+		/** Player who made Move (rewards are backed up from their point of view) */
+		int32 Mover = INDEX_NONE;
+
+		// Shared between workers
+
+		std::atomic<int32> FirstChild{INDEX_NONE};
+
+		/** Completed visits plus virtual losses in flight */
+		std::atomic<int32> Visits{0};
+
+		/** Iterations in which this move was legal when its parent was selected from */
+		std::atomic<int32> Availability{0};
+
+		/** Sum of rewards, times RewardScale */
+		std::atomic<int64> Reward{0};
+
+		double GetMeanReward() const
+		{
+			const int32 NumVisits = Visits.load(std::memory_order_relaxed);
+			return NumVisits > 0 ? Reward.load(std::memory_order_relaxed) / (RewardScale * NumVisits) : 0.5;
+		}
+	};
+}
+
+/** Fixed pool of nodes; node 0 is the root */
+struct FGCGMonteCarloSearch::FTree
+{
+	explicit FTree(int32 InCapacity)
+		: Nodes(MakeUnique<FGCGSearchNode[]>(InCapacity))
+		, Capacity(InCapacity)
+	{
+	}
+
+	FGCGSearchNode& operator[](int32 Index) { return Nodes[Index]; }
+	const FGCGSearchNode& operator[](int32 Index) const { return Nodes[Index]; }
+
+	int32 Num() const { return FMath::Min(NumAllocated.load(std::memory_order_relaxed), Capacity); }
+
+	int32 FindChild(int32 NodeIndex, const FGCGMove& Move) const
+	{
+		return FindChildFrom(Nodes[NodeIndex].FirstChild.load(std::memory_order_acquire), Move);
+	}
+
+	int32 FindChildFrom(int32 Child, const FGCGMove& Move) const
+	{
+		for (; Child != INDEX_NONE; Child = Nodes[Child].NextSibling)
+		{
+			if (Nodes[Child].Move.IsSameChoice(Move))
+			{
+				return Child;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	/**
+	 * Add a child for Move, already holding InitialVisits (virtual loss)
+	 * @return The child - another worker's if it added the same move first - or INDEX_NONE if the pool is full
+	 */
+	int32 AddChild(int32 NodeIndex, const FGCGMove& Move, int32 Mover, int32 InitialVisits)
+	{
+		const int32 NewIndex = NumAllocated.fetch_add(1, std::memory_order_relaxed);
+		if (NewIndex >= Capacity)
+		{
+			return INDEX_NONE;
+		}
+
+		FGCGSearchNode& NewNode = Nodes[NewIndex];
+		NewNode.Move = Move;
+		NewNode.Parent = NodeIndex;
+		NewNode.Mover = Mover;
+		NewNode.Visits.store(InitialVisits, std::memory_order_relaxed);
+
+		std::atomic<int32>& Head = Nodes[NodeIndex].FirstChild;
+		int32 FirstChild = Head.load(std::memory_order_acquire);
+		do
+		{
+			const int32 Existing = FindChildFrom(FirstChild, Move);
+			if (Existing != INDEX_NONE)
+			{
+				// Lost the race; our slot stays unused
+				Nodes[Existing].Visits.fetch_add(InitialVisits, std::memory_order_relaxed);
+				return Existing;
+			}
+			NewNode.NextSibling = FirstChild;
+		}
+		while (!Head.compare_exchange_weak(FirstChild, NewIndex, std::memory_order_release, std::memory_order_acquire));
+
+		return NewIndex;
+	}
+
+private:
+	TUniquePtr<FGCGSearchNode[]> Nodes;
+	int32 Capacity = 0;
+	std::atomic<int32> NumAllocated{1};
+};
+
+/** A worker's own random stream and scratch state, reused every iteration */
+struct FGCGMonteCarloSearch::FWorker
+{
+	FGCGRandomStream Random;
+	FGCGMatchState Sim;
+	FGCGMoveBuffer Moves;
+	TArray<int32, TFixedAllocator<FGCGMoveBuffer::Capacity>> MoveChildren;
+	TArray<int32, TFixedAllocator<FGCGMoveBuffer::Capacity>> Untried;
+	TArray<int32> Discards;
+	int32 Iterations = 0;
+};
+
+/** When the workers stop, shared by all of them */
+struct FGCGMonteCarloSearch::FControl
+{
+	double Deadline = 0.0;
+	bool bTimed = false;
+
+	/** 0 = no cap */
+	int32 MaxIterations = 0;
+
+	std::atomic<int32> IterationsStarted{0};
+
+	int32 VirtualLoss = 1;
+
+	/** Set by another thread to stop early (may be null) */
+	const std::atomic<bool>* bCancel = nullptr;
+};
+
+FGCGMonteCarloSearch::FGCGMonteCarloSearch(const FGCGRulesEngine& InEngine, const FGCGSearchSettings& InSettings)
+	: Engine(InEngine)
+	, Settings(InSettings)
+	, MoveGenerator(InEngine)
+	, RolloutPolicy(InEngine, InSettings.RolloutDifficulty)
+{
+}
+
+// ===========================================================================================
+// SEARCH
+// ===========================================================================================
+
+FGCGSearchResult FGCGMonteCarloSearch::Search(const FGCGMatchState& RootState, uint64 Seed, const std::atomic<bool>* bCancel) const
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FGCGSearchResult Result;
+
+	const int32 PlayerID = FGCGMoveGenerator::GetDecidingPlayer(RootState);
+	FGCGMoveBuffer RootMoves;
+	MoveGenerator.GenerateMoves(RootState, RootMoves);
+
+	if (PlayerID == INDEX_NONE || RootMoves.Num() <= 1)
+	{
+		// Nothing to choose
+		if (RootMoves.Num() == 1)
+		{
+			Result.Move = RootMoves[0];
+		}
+		Result.Seconds = FPlatformTime::Seconds() - StartTime;
+		return Result;
+	}
+
+	FControl Control;
+	Control.bTimed = Settings.TimeBudgetSeconds > 0.0f;
+	Control.Deadline = StartTime + Settings.TimeBudgetSeconds;
+	Control.MaxIterations = (Settings.MaxIterations > 0 || Control.bTimed) ? Settings.MaxIterations : DefaultIterations;
+	Control.VirtualLoss = FMath::Max(1, Settings.VirtualLoss);
+	Control.bCancel = bCancel;
+
+	const int32 NumWorkers = FMath::Max(1, Settings.NumThreads > 0 ? Settings.NumThreads : FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	const bool bSharedTree = NumWorkers == 1 || Settings.Parallelism == EGCGSearchParallelism::Tree;
+
+	// A tree never grows past one node per iteration
+	int32 TreeCapacity = FMath::Max(2, Settings.MaxNodes);
+	if (Control.MaxIterations > 0)
+	{
+		TreeCapacity = FMath::Min(TreeCapacity, Control.MaxIterations + 1);
+	}
+
+	TArray<TUniquePtr<FTree>, TInlineAllocator<1>> Trees;
+	for (int32 TreeIndex = 0; TreeIndex < (bSharedTree ? 1 : NumWorkers); ++TreeIndex)
+	{
+		Trees.Add(MakeUnique<FTree>(TreeCapacity));
+	}
+
+	// Each worker's stream is split off the search seed
+	FGCGRandomStream SeedStream(Seed);
+	TArray<FWorker> Workers;
+	Workers.SetNum(NumWorkers);
+	for (FWorker& Worker : Workers)
+	{
+		Worker.Random.Initialize(SeedStream.Next());
+	}
+
+	auto Run = [this, &RootState, PlayerID, &Trees, &Workers, &Control, bSharedTree](int32 WorkerIndex)
+	{
+		RunWorker(RootState, PlayerID, *Trees[bSharedTree ? 0 : WorkerIndex], Workers[WorkerIndex], Control);
+	};
+
+	// The calling thread is worker 0
+	TArray<UE::Tasks::FTask> Tasks;
+	Tasks.Reserve(NumWorkers - 1);
+	for (int32 WorkerIndex = 1; WorkerIndex < NumWorkers; ++WorkerIndex)
+	{
+		Tasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [&Run, WorkerIndex]() { Run(WorkerIndex); }));
+	}
+	Run(0);
+	UE::Tasks::Wait(Tasks);
+
+	// Most visited root move over all trees, as the real state's move
+	int32 BestVisits = -1;
+	for (const FGCGMove& Move : RootMoves)
+	{
+		int32 Visits = 0;
+		int64 Reward = 0;
+		for (const TUniquePtr<FTree>& Tree : Trees)
+		{
+			const int32 Child = Tree->FindChild(0, Move);
+			if (Child != INDEX_NONE)
+			{
+				Visits += (*Tree)[Child].Visits.load(std::memory_order_relaxed);
+				Reward += (*Tree)[Child].Reward.load(std::memory_order_relaxed);
+			}
+		}
+
+		if (Visits > BestVisits)
+		{
+			BestVisits = Visits;
+			Result.Move = Move;
+			Result.MoveVisits = Visits;
+			Result.MoveValue = Visits > 0 ? float(Reward / (RewardScale * Visits)) : 0.5f;
+		}
+	}
+
+	for (const FWorker& Worker : Workers)
+	{
+		Result.Iterations += Worker.Iterations;
+	}
+	for (const TUniquePtr<FTree>& Tree : Trees)
+	{
+		Result.Nodes += Tree->Num();
+	}
+	Result.Threads = NumWorkers;
+	Result.Seconds = FPlatformTime::Seconds() - StartTime;
+	return Result;
+}
+
+void FGCGMonteCarloSearch::RunWorker(const FGCGMatchState& RootState, int32 PlayerID, FTree& Tree, FWorker& Worker, FControl& Control) const
+{
+	const double Exploration = Settings.ExplorationConstant;
+	const int32 VirtualLoss = Control.VirtualLoss;
+
+	for (int32 LocalIteration = 0; ; ++LocalIteration)
+	{
+		if (Control.bTimed && LocalIteration > 0 && LocalIteration % TimeCheckInterval == 0 && FPlatformTime::Seconds() >= Control.Deadline)
+		{
+			break;
+		}
+		if (Control.MaxIterations > 0 && Control.IterationsStarted.fetch_add(1, std::memory_order_relaxed) >= Control.MaxIterations)
+		{
+			break;
+		}
+		if (Control.bCancel && Control.bCancel->load(std::memory_order_relaxed))
+		{
+			break;
+		}
+
+		// 1. Determinize
+		FGCGMatchState& Sim = Worker.Sim;
+		Sim = RootState;
+		Determinize(Sim, PlayerID, Worker.Random);
+
+		// 2-3. Select through fully expanded nodes, expand the first node with an untried move
+		int32 NodeIndex = 0;
+		while (!Sim.bGameOver)
+		{
+			MoveGenerator.GenerateMoves(Sim, Worker.Moves);
+			if (Worker.Moves.Num() == 0)
+			{
+				break;
+			}
+
+			const int32 Mover = FGCGMoveGenerator::GetDecidingPlayer(Sim);
+
+			Worker.MoveChildren.Reset();
+			Worker.Untried.Reset();
+			for (int32 MoveIndex = 0; MoveIndex < Worker.Moves.Num(); ++MoveIndex)
+			{
+				const int32 Child = Tree.FindChild(NodeIndex, Worker.Moves[MoveIndex]);
+				Worker.MoveChildren.Add(Child);
+				if (Child == INDEX_NONE)
+				{
+					Worker.Untried.Add(MoveIndex);
+				}
+			}
+
+			if (Worker.Untried.Num() > 0)
+			{
+				const int32 MoveIndex = Worker.Untried[Worker.Random.RandRange(0, Worker.Untried.Num() - 1)];
+				const int32 Child = Tree.AddChild(NodeIndex, Worker.Moves[MoveIndex], Mover, VirtualLoss);
+
+				ApplyMove(Sim, Worker.Moves[MoveIndex], Worker.Discards);
+				if (Child != INDEX_NONE)
+				{
+					NodeIndex = Child;
+				}
+				break;
+			}
+
+			// UCB over the children legal in this determinization
+			int32 BestMove = 0;
+			double BestScore = -1.0;
+			for (int32 MoveIndex = 0; MoveIndex < Worker.Moves.Num(); ++MoveIndex)
+			{
+				FGCGSearchNode& Node = Tree[Worker.MoveChildren[MoveIndex]];
+				const int32 Availability = Node.Availability.fetch_add(1, std::memory_order_relaxed) + 1;
+				const int32 Visits = FMath::Max(1, Node.Visits.load(std::memory_order_relaxed));
+
+				const double Score = Node.GetMeanReward()
+					+ Exploration * FMath::Sqrt(FMath::Loge(double(Availability)) / Visits);
+				if (Score > BestScore)
+				{
+					BestScore = Score;
+					BestMove = MoveIndex;
+				}
+			}
+
+			NodeIndex = Worker.MoveChildren[BestMove];
+			Tree[NodeIndex].Visits.fetch_add(VirtualLoss, std::memory_order_relaxed);
+
+			// Apply this determinization's move: the tree's may name another copy of the card
+			ApplyMove(Sim, Worker.Moves[BestMove], Worker.Discards);
+		}
+
+		// 4. Rollout
+		const float Reward = Sim.bGameOver ? GetTerminalReward(Sim, PlayerID) : Rollout(Sim, PlayerID, Worker.Discards);
+
+		// 5. Backpropagate, turning the virtual losses back into one real visit
+		for (int32 Index = NodeIndex; Index != 0; Index = Tree[Index].Parent)
+		{
+			FGCGSearchNode& Node = Tree[Index];
+			const double NodeReward = Node.Mover == PlayerID ? Reward : 1.0f - Reward;
+			Node.Reward.fetch_add(int64(NodeReward * RewardScale), std::memory_order_relaxed);
+			Node.Visits.fetch_add(1 - VirtualLoss, std::memory_order_relaxed);
+		}
+
+		++Worker.Iterations;
+	}
+}
+
+// ===========================================================================================
+// DETERMINIZATION
+// ===========================================================================================
+
+void FGCGMonteCarloSearch::Determinize(FGCGMatchState& State, int32 ObserverID, FGCGRandomStream& Random) const
+{
+	// Pool the zones' cards, shuffle and deal them back in the same counts
+	auto Redeal = [&Random](FGCGPlayerBoard& Board, std::initializer_list<EGCGCardZone> Zones)
+	{
+		TArray<FGCGCardInstance, TInlineAllocator<64>> Pool;
+		for (EGCGCardZone Zone : Zones)
+		{
+			Pool.Append(*Board.GetZoneArray(Zone));
+		}
+
+		Random.Shuffle(Pool);
+
+		int32 Next = 0;
+		for (EGCGCardZone Zone : Zones)
+		{
+			TArray<FGCGCardInstance>& ZoneArray = *Board.GetZoneArray(Zone);
+			for (FGCGCardInstance& Card : ZoneArray)
+			{
+				Card = MoveTemp(Pool[Next++]);
+				Card.CurrentZone = Zone;
+			}
+		}
+	};
+
+	FGCGPlayerBoard& Observer = State.GetPlayer(ObserverID);
+	FGCGPlayerBoard& Opponent = State.GetOpponent(ObserverID);
+
+	// The opponent's hand, deck and shields are one unknown pool; ours is everything but the hand
+	Redeal(Opponent, { EGCGCardZone::Hand, EGCGCardZone::Deck, EGCGCardZone::ShieldStack });
+	Redeal(Observer, { EGCGCardZone::Deck, EGCGCardZone::ShieldStack });
+	Redeal(Opponent, { EGCGCardZone::ResourceDeck });
+	Redeal(Observer, { EGCGCardZone::ResourceDeck });
+
+	Observer.RebuildCardLocationIndex();
+	Opponent.RebuildCardLocationIndex();
+
+	// The real streams would replay the real match's future shuffles and AI noise
+	State.Random.Initialize(Random.Next());
+}
+
+// ===========================================================================================
+// EVALUATION
+// ===========================================================================================
+
+float FGCGMonteCarloSearch::Evaluate(const FGCGMatchState& State, int32 PlayerID) const
+{
+	const FGCGCardCatalog& Catalog = Engine.GetCatalog();
+
+	auto ScoreBoard = [&](const FGCGPlayerBoard& Board)
+	{
+		// Life: shields, then what is left of the Base
+		float Score = Board.ShieldStack.Num() * 4.0f;
+		for (const FGCGCardInstance& Base : Board.BaseSection)
+		{
+			Score += FGCGRules::GetRemainingHP(Catalog, Base);
+		}
+
+		// Board: each Unit by its combat AP and remaining HP
+		for (const FGCGCardInstance& Card : Board.BattleArea)
+		{
+			if (FGCGRules::GetCardType(Catalog, Card) == EGCGCardType::Unit)
+			{
+				Score += 1.5f + FGCGRules::GetCombatAP(Catalog, Board, Card) * 0.6f + FGCGRules::GetRemainingHP(Catalog, Card) * 0.4f;
+			}
+		}
+
+		// Options and mana
+		Score += Board.Hand.Num() * 0.8f;
+		Score += Board.ResourceArea.Num() * 0.5f;
+
+		return Score;
+	};
+
+	const float Difference = ScoreBoard(State.GetPlayer(PlayerID)) - ScoreBoard(State.GetOpponent(PlayerID));
+	return 1.0f / (1.0f + FMath::Exp(-Difference / EvaluationScale));
+}
+
+float FGCGMonteCarloSearch::GetTerminalReward(const FGCGMatchState& State, int32 PlayerID)
+{
+	if (State.WinnerPlayerID == PlayerID)
+	{
+		return 1.0f;
+	}
+	return FGCGMatchState::IsValidPlayerID(State.WinnerPlayerID) ? 0.0f : 0.5f;
+}
+
+// ===========================================================================================
+// ROLLOUT
+// ===========================================================================================
+
+float FGCGMonteCarloSearch::Rollout(FGCGMatchState& State, int32 PlayerID, TArray<int32>& Discards) const
+{
+	const int32 LastTurn = State.TurnNumber + Settings.RolloutTurns;
+
+	// An attack may still be waiting for its block
+	if (State.IsAttackInProgress())
+	{
+		if (const int32 BlockerID = RolloutPolicy.DecideBlocker(State))
+		{
+			Engine.DeclareBlocker(State, BlockerID);
+		}
+		Engine.ResolveAttack(State);
+	}
+
+	// Same turn loop as FGCGMatchSimulator::PlayMatch
+	while (!State.bGameOver && State.TurnNumber < LastTurn)
+	{
+		const int32 ActiveID = State.ActivePlayerID;
+
+		for (int32 NumActions = 0; NumActions < Settings.MaxActionsPerTurn && !State.bGameOver; ++NumActions)
+		{
+			const FGCGAIAction Action = RolloutPolicy.DecideMainPhaseAction(State);
+			const int32 TargetID = FMath::Max(0, Action.TargetInstanceID);
+
+			if (Action.ActionType == EGCGAIActionType::PlayCard)
+			{
+				if (Engine.PlayCard(State, ActiveID, Action.CardInstanceID, TargetID) != EGCGRulesResult::Success)
+				{
+					break;
+				}
+			}
+			else if (Action.ActionType == EGCGAIActionType::Attack)
+			{
+				if (Engine.DeclareAttack(State, ActiveID, Action.CardInstanceID, TargetID) != EGCGRulesResult::Success)
+				{
+					break;
+				}
+
+				if (const int32 BlockerID = RolloutPolicy.DecideBlocker(State))
+				{
+					Engine.DeclareBlocker(State, BlockerID);
+				}
+				Engine.ResolveAttack(State);
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		if (State.bGameOver)
+		{
+			break;
+		}
+
+		RolloutPolicy.DecideDiscards(State, ActiveID, FGCGRules::GetHandExcess(State.GetPlayer(ActiveID)), Discards);
+		Engine.EndTurn(State, Discards);
+	}
+
+	return State.bGameOver ? GetTerminalReward(State, PlayerID) : Evaluate(State, PlayerID);
+}
+
+void FGCGMonteCarloSearch::ApplyMove(FGCGMatchState& State, const FGCGMove& Move, TArray<int32>& Discards) const
+{
+	Discards.Reset();
+	if (Move.Type == EGCGMoveType::EndTurn)
+	{
+		const int32 ActiveID = State.ActivePlayerID;
+		RolloutPolicy.DecideDiscards(State, ActiveID, FGCGRules::GetHandExcess(State.GetPlayer(ActiveID)), Discards);
+	}
+
+	MoveGenerator.ApplyMove(State, Move, Discards);
+}
@@ -0,0 +1,165 @@
+// GCGMonteCarloSearch.h - Information Set Monte Carlo Tree Search
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Search-based decisions for the Expert AI difficulty
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GundamTCG/AI/GCGHeuristicPolicy.h"
+#include "GundamTCG/AI/GCGMoveGenerator.h"
+#include <atomic>
+
+/**
+ * How a search spreads over several workers
+ */
+enum class EGCGSearchParallelism : uint8
+{
+	/** Each worker grows its own tree; root visits are summed at the end */
+	Root,
+
+	/** Workers share one tree, kept apart by virtual loss */
+	Tree
+};
+
+/**
+ * Search settings
+ */
+struct FGCGSearchSettings
+{
+	/** Wall-clock budget per decision in seconds (0 = no limit) */
+	float TimeBudgetSeconds = 1.0f;
+
+	/** Iteration cap per decision (0 = no limit); use instead of the time budget for reproducible play */
+	int32 MaxIterations = 0;
+
+	/** UCB exploration constant (rewards are in [0, 1]) */
+	float ExplorationConstant = 0.7f;
+
+	/** Whole turns a rollout plays before the position is scored by Evaluate */
+	int32 RolloutTurns = 6;
+
+	/** Actions one player may take in a rollout turn before it is ended for them */
+	int32 MaxActionsPerTurn = 32;
+
+	/** Heuristic used as the rollout (default) policy */
+	EGCGAIDifficulty RolloutDifficulty = EGCGAIDifficulty::Hard;
+
+	/** Workers per search (0 = one per logical core); only 1 replays exactly from the seed */
+	int32 NumThreads = 1;
+
+	EGCGSearchParallelism Parallelism = EGCGSearchParallelism::Tree;
+
+	/** Tree parallelism: lost visits a worker puts on each node of its path until it backs up */
+	int32 VirtualLoss = 1;
+
+	/** Node capacity of one tree; a full tree stops expanding but keeps searching */
+	int32 MaxNodes = 1 << 16;
+};
+
+/**
+ * What a search did
+ */
+struct FGCGSearchResult
+{
+	/** Move to play (valid in the searched state) */
+	FGCGMove Move;
+
+	/** Over all workers */
+	int32 Iterations = 0;
+	int32 Nodes = 0;
+	int32 Threads = 1;
+
+	/** Visits and mean reward (0 = loss, 1 = win) of the chosen move */
+	int32 MoveVisits = 0;
+	float MoveValue = 0.5f;
+
+	double Seconds = 0.0;
+};
+
+/**
+ * Monte Carlo Tree Search (single-observer ISMCTS)
+ *
+ * Chooses the deciding player's move at the current decision point of a
+ * headless match. Each iteration:
+ *
+ * 1. Determinize: copy the match and re-deal what the deciding player can't
+ *    see - the opponent's hand, deck and shields are re-dealt from their pooled
+ *    cards (the known card pool), and our own deck and shields are reshuffled
+ *    together. Random streams are reseeded so rollouts don't follow the real
+ *    match's future.
+ * 2. Select down one shared tree with UCB, considering only the children that
+ *    are legal in this determinization (each counts its availability); moves
+ *    match across determinizations by FGCGMove::IsSameChoice.
+ * 3. Expand one untried legal move.
+ * 4. Roll out with FGCGHeuristicPolicy for RolloutTurns turns, then score the
+ *    result (win / loss, or Evaluate for unfinished games).
+ * 5. Back up the reward from each node's mover's point of view.
+ *
+ * The most visited root move is returned. Stops at the time budget or the
+ * iteration cap, whichever comes first.
+ *
+ * Parallel search runs NumThreads workers as tasks (the caller's thread is
+ * one of them). Each worker owns its random stream (split from the seed) and
+ * its scratch state - the determinized match, move lists, discards - reused
+ * from iteration to iteration. With Root parallelism every worker grows a
+ * private tree; with Tree parallelism they share one, lock-free: nodes come
+ * from a preallocated pool through an atomic counter, children are pushed
+ * onto their parent's list with compare-and-swap, and statistics are atomic.
+ * A worker adds VirtualLoss lost visits to each node it descends through and
+ * takes them back when it backs up, steering the others to other lines.
+ *
+ * Stateless apart from its settings: one instance can run any number of
+ * searches on any number of threads.
+ */
+class GUNDAMTCG_API FGCGMonteCarloSearch
+{
+public:
+	FGCGMonteCarloSearch(const FGCGRulesEngine& InEngine, const FGCGSearchSettings& InSettings);
+
+	const FGCGSearchSettings& GetSettings() const { return Settings; }
+
+	/**
+	 * Search for the deciding player's move (see FGCGMoveGenerator::GetDecidingPlayer)
+	 * @param State The match (not modified)
+	 * @param Seed Seed for determinizations and rollouts
+	 * @param bCancel Optional flag another thread sets to stop the search early
+	 * @return The chosen move (EndTurn if the game is over)
+	 */
+	FGCGSearchResult Search(const FGCGMatchState& State, uint64 Seed, const std::atomic<bool>* bCancel = nullptr) const;
+
+	/**
+	 * Re-deal the cards an observer can't see (see class comment)
+	 * @param State Match to determinize in place
+	 * @param ObserverID Player whose knowledge is kept
+	 * @param Random Source of the deal
+	 */
+	void Determinize(FGCGMatchState& State, int32 ObserverID, FGCGRandomStream& Random) const;
+
+	/**
+	 * Score an unfinished match for a player
+	 * @return 0 (lost) .. 1 (won) - shields, Base, units, hand and resources against the opponent's
+	 */
+	float Evaluate(const FGCGMatchState& State, int32 PlayerID) const;
+
+private:
+	struct FTree;
+	struct FWorker;
+	struct FControl;
+
+	/** One worker's share of a search: iterate on Tree until Control runs out */
+	void RunWorker(const FGCGMatchState& RootState, int32 PlayerID, FTree& Tree, FWorker& Worker, FControl& Control) const;
+
+	/** Play on with the rollout policy, then score for PlayerID */
+	float Rollout(FGCGMatchState& State, int32 PlayerID, TArray<int32>& Discards) const;
+
+	/** Apply a move, choosing discards with the rollout policy when it ends the turn */
+	void ApplyMove(FGCGMatchState& State, const FGCGMove& Move, TArray<int32>& Discards) const;
+
+	/** Win / loss / draw reward of a finished match for PlayerID */
+	static float GetTerminalReward(const FGCGMatchState& State, int32 PlayerID);
+
+	const FGCGRulesEngine& Engine;
+	FGCGSearchSettings Settings;
+	FGCGMoveGenerator MoveGenerator;
+	FGCGHeuristicPolicy RolloutPolicy;
+};
@@ -0,0 +1,226 @@
+// GCGMoveGenerator.cpp - Headless Move Generator Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGMoveGenerator.h"
+
+// ===== MOVE =====
+
+FGCGAIAction FGCGMove::ToAIAction() const
+{
+	switch (Type)
+	{
+	case EGCGMoveType::PlayCard:
+	case EGCGMoveType::PairPilot:
+	{
+		FGCGAIAction Action(EGCGAIActionType::PlayCard, CardInstanceID);
+		Action.TargetInstanceID = TargetInstanceID;
+		return Action;
+	}
+
+	case EGCGMoveType::Attack:
+	{
+		FGCGAIAction Action(EGCGAIActionType::Attack, CardInstanceID);
+		Action.TargetInstanceID = TargetInstanceID;
+		return Action;
+	}
+
+	case EGCGMoveType::Block:
+		return FGCGAIAction(EGCGAIActionType::Block, CardInstanceID);
+
+	case EGCGMoveType::Pass:
+		return FGCGAIAction(EGCGAIActionType::PassPriority);
+
+	case EGCGMoveType::EndTurn:
+	default:
+		return FGCGAIAction(EGCGAIActionType::EndTurn);
+	}
+}
+
+FString FGCGMove::ToString() const
+{
+	switch (Type)
+	{
+	case EGCGMoveType::PlayCard:	return FString::Printf(TEXT("PlayCard %d (card %d)"), CardInstanceID, CardId);
+	case EGCGMoveType::PairPilot:	return FString::Printf(TEXT("PairPilot %d (card %d) -> %d"), CardInstanceID, CardId, TargetInstanceID);
+	case EGCGMoveType::Attack:		return FString::Printf(TEXT("Attack %d -> %d"), CardInstanceID, TargetInstanceID);
+	case EGCGMoveType::Block:		return FString::Printf(TEXT("Block %d"), CardInstanceID);
+	case EGCGMoveType::Pass:		return TEXT("Pass");
+	case EGCGMoveType::EndTurn:
+	default:						return TEXT("EndTurn");
+	}
+}
+
+// ===== GENERATOR =====
+
+FGCGMoveGenerator::FGCGMoveGenerator(const FGCGRulesEngine& InEngine)
+	: Engine(InEngine)
+{
+}
+
+int32 FGCGMoveGenerator::GetDecidingPlayer(const FGCGMatchState& State)
+{
+	if (State.bGameOver)
+	{
+		return INDEX_NONE;
+	}
+
+	return State.IsAttackInProgress() ? State.CurrentAttack.TargetPlayerID : State.ActivePlayerID;
+}
+
+void FGCGMoveGenerator::GenerateMoves(const FGCGMatchState& State, FGCGMoveBuffer& OutMoves) const
+{
+	OutMoves.Reset();
+
+	if (State.bGameOver)
+	{
+		return;
+	}
+
+	// Block Step: each legal Blocker, or let the attack through
+	if (State.IsAttackInProgress())
+	{
+		OutMoves.Add(FGCGMove(EGCGMoveType::Pass));
+
+		for (const FGCGCardInstance& Blocker : State.GetPlayer(State.CurrentAttack.TargetPlayerID).BattleArea)
+		{
+			if (Engine.CanBlock(State, Blocker.InstanceID) == EGCGRulesResult::Success)
+			{
+				OutMoves.Add(FGCGMove(EGCGMoveType::Block, Blocker.InstanceID));
+			}
+		}
+		return;
+	}
+
+	if (State.CurrentPhase != EGCGTurnPhase::MainPhase)
+	{
+		return;
+	}
+
+	const int32 PlayerID = State.ActivePlayerID;
+	const FGCGPlayerBoard& Board = State.GetPlayer(PlayerID);
+	const FGCGPlayerBoard& Opponent = State.GetOpponent(PlayerID);
+
+	OutMoves.Add(FGCGMove(EGCGMoveType::EndTurn));
+
+	// Cards from hand (one move per distinct card and target)
+	const int32 FirstPlayMove = OutMoves.Num();
+	auto AddPlay = [&](EGCGMoveType Type, const FGCGCardInstance& Card, int32 TargetID)
+	{
+		for (int32 i = FirstPlayMove; i < OutMoves.Num(); ++i)
+		{
+			if (OutMoves[i].CardId == Card.CardId && OutMoves[i].TargetInstanceID == TargetID)
+			{
+				return;
+			}
+		}
+
+		if (Engine.CanPlayCard(State, PlayerID, Card.InstanceID, TargetID) == EGCGRulesResult::Success)
+		{
+			OutMoves.Add(FGCGMove(Type, Card.InstanceID, TargetID, Card.CardId));
+		}
+	};
+
+	for (const FGCGCardInstance& Card : Board.Hand)
+	{
+		const FGCGCardView CardView = Engine.GetCardView(Card);
+		if (!CardView)
+		{
+			continue;
+		}
+
+		if (CardView.GetCardType() == EGCGCardType::Pilot)
+		{
+			for (const FGCGCardInstance& Unit : Board.BattleArea)
+			{
+				if (Unit.PairedCardInstanceID == 0)
+				{
+					AddPlay(EGCGMoveType::PairPilot, Card, Unit.InstanceID);
+				}
+			}
+		}
+		else
+		{
+			AddPlay(EGCGMoveType::PlayCard, Card, 0);
+		}
+	}
+
+	// Attacks: the player, or any rested enemy Unit
+	for (const FGCGCardInstance& Attacker : Board.BattleArea)
+	{
+		if (Engine.CanAttack(State, PlayerID, Attacker.InstanceID) != EGCGRulesResult::Success)
+		{
+			continue;
+		}
+
+		OutMoves.Add(FGCGMove(EGCGMoveType::Attack, Attacker.InstanceID, 0));
+
+		for (const FGCGCardInstance& Target : Opponent.BattleArea)
+		{
+			if (!Target.bIsActive && Engine.CanAttack(State, PlayerID, Attacker.InstanceID, Target.InstanceID) == EGCGRulesResult::Success)
+			{
+				OutMoves.Add(FGCGMove(EGCGMoveType::Attack, Attacker.InstanceID, Target.InstanceID));
+			}
+		}
+	}
+}
+
+EGCGRulesResult FGCGMoveGenerator::ApplyMove(FGCGMatchState& State, const FGCGMove& Move, TConstArrayView<int32> Discards) const
+{
+	switch (Move.Type)
+	{
+	case EGCGMoveType::PlayCard:
+	case EGCGMoveType::PairPilot:
+		return Engine.PlayCard(State, State.ActivePlayerID, Move.CardInstanceID, Move.TargetInstanceID);
+
+	case EGCGMoveType::Attack:
+	{
+		const EGCGRulesResult Result = Engine.DeclareAttack(State, State.ActivePlayerID, Move.CardInstanceID, Move.TargetInstanceID);
+		if (Result == EGCGRulesResult::Success && State.IsAttackInProgress() && !HasLegalBlocker(State))
+		{
+			// Nothing to decide in the Block Step
+			return Engine.ResolveAttack(State);
+		}
+		return Result;
+	}
+
+	case EGCGMoveType::Block:
+	{
+		const EGCGRulesResult Result = Engine.DeclareBlocker(State, Move.CardInstanceID);
+		if (Result != EGCGRulesResult::Success)
+		{
+			return Result;
+		}
+		return Engine.ResolveAttack(State);
+	}
+
+	case EGCGMoveType::Pass:
+		return Engine.ResolveAttack(State);
+
+	case EGCGMoveType::EndTurn:
+	default:
+		if (State.bGameOver)
+		{
+			return EGCGRulesResult::GameOver;
+		}
+		Engine.EndTurn(State, Discards);
+		return EGCGRulesResult::Success;
+	}
+}
+
+bool FGCGMoveGenerator::HasLegalBlocker(const FGCGMatchState& State) const
+{
+	if (!State.IsAttackInProgress())
+	{
+		return false;
+	}
+
+	for (const FGCGCardInstance& Blocker : State.GetPlayer(State.CurrentAttack.TargetPlayerID).BattleArea)
+	{
+		if (Engine.CanBlock(State, Blocker.InstanceID) == EGCGRulesResult::Success)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
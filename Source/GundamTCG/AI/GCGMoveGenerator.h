@@ -0,0 +1,168 @@
+// GCGMoveGenerator.h - Headless Move Generator
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Enumerates and applies the legal choices of a headless match for search
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GundamTCG/AI/GCGAIController.h"
+#include "GundamTCG/Core/GCGRulesEngine.h"
+
+/**
+ * Move Type
+ */
+enum class EGCGMoveType : uint8
+{
+	EndTurn,
+
+	/** Play a Unit, Base or Command from hand */
+	PlayCard,
+
+	/** Play a Pilot from hand onto an unpaired Unit */
+	PairPilot,
+
+	Attack,
+	Block,
+
+	/** Block Step: let the attack through */
+	Pass
+};
+
+/**
+ * One choice at a decision point (plain data - 12 bytes, no strings)
+ */
+struct GUNDAMTCG_API FGCGMove
+{
+	EGCGMoveType Type = EGCGMoveType::EndTurn;
+
+	/** Card played (PlayCard, PairPilot) - identifies the choice when the instance is hidden */
+	uint16 CardId = 0;
+
+	/** Card played, attacker or blocker */
+	int32 CardInstanceID = 0;
+
+	/** Unit a Pilot pairs with, or the attack target (0 = the player) */
+	int32 TargetInstanceID = 0;
+
+	FGCGMove() = default;
+
+	FGCGMove(EGCGMoveType InType, int32 InCardInstanceID = 0, int32 InTargetInstanceID = 0, uint16 InCardId = 0)
+		: Type(InType), CardId(InCardId), CardInstanceID(InCardInstanceID), TargetInstanceID(InTargetInstanceID)
+	{
+	}
+
+	/**
+	 * Is this the same decision as another move, from the deciding player's view?
+	 * Cards from hand compare by card, not instance: the opponent's hand is
+	 * sampled differently on every determinization, so "play GD01-001" has to
+	 * mean the same move whichever copy happens to be in the sampled hand.
+	 */
+	bool IsSameChoice(const FGCGMove& Other) const
+	{
+		if (Type != Other.Type || TargetInstanceID != Other.TargetInstanceID)
+		{
+			return false;
+		}
+		return IsFromHand() ? CardId == Other.CardId : CardInstanceID == Other.CardInstanceID;
+	}
+
+	bool IsFromHand() const { return Type == EGCGMoveType::PlayCard || Type == EGCGMoveType::PairPilot; }
+
+	/** The same move as an AGCGAIController action */
+	FGCGAIAction ToAIAction() const;
+
+	/** Short description for logs */
+	FString ToString() const;
+};
+
+static_assert(sizeof(FGCGMove) == 12, "FGCGMove should stay compact");
+
+/**
+ * Fixed-capacity move list for FGCGMoveGenerator (never allocates)
+ *
+ * Capacity covers a full hand of distinct Pilots against a full Battle Area
+ * of unpaired Units, plus every attacker against every target; a move that
+ * doesn't fit is dropped with an ensure.
+ */
+struct FGCGMoveBuffer
+{
+	static constexpr int32 Capacity = 256;
+
+	int32 Num() const { return NumMoves; }
+
+	void Reset() { NumMoves = 0; }
+
+	/** @return False if the buffer is full (the move is dropped) */
+	bool Add(const FGCGMove& Move)
+	{
+		if (!ensureMsgf(NumMoves < Capacity, TEXT("FGCGMoveBuffer - More than %d moves"), Capacity))
+		{
+			return false;
+		}
+		Moves[NumMoves++] = Move;
+		return true;
+	}
+
+	const FGCGMove& operator[](int32 Index) const
+	{
+		checkSlow(Index >= 0 && Index < NumMoves);
+		return Moves[Index];
+	}
+
+	const FGCGMove* begin() const { return Moves; }
+	const FGCGMove* end() const { return Moves + NumMoves; }
+
+private:
+	FGCGMove Moves[Capacity];
+	int32 NumMoves = 0;
+};
+
+/**
+ * Move Generator
+ *
+ * Lists every legal choice at the current decision point of a headless match
+ * and applies a chosen one through FGCGRulesEngine. The decision points are:
+ * - Main Phase (active player): play a card, pair a Pilot (each unpaired Unit
+ *   separately), attack with a unit (the player or each rested enemy Unit),
+ *   or end the turn
+ * - Block Step (defending player): block with a legal Blocker, or pass
+ *
+ * Resources are placed by the Resource Phase itself and the headless rules
+ * have no activated abilities, so neither is a choice here.
+ *
+ * Legality comes from the engine's Can* checks, so a generated move never
+ * fails when applied. Several copies of a card in hand produce one move.
+ * Moves go into a caller-owned FGCGMoveBuffer: generating never allocates.
+ *
+ * Shared by the search, the Random policy and anything else that needs the
+ * legal choices. Stateless; safe to share across threads.
+ */
+class GUNDAMTCG_API FGCGMoveGenerator
+{
+public:
+	explicit FGCGMoveGenerator(const FGCGRulesEngine& InEngine);
+
+	/**
+	 * Player who makes the next choice: the defender while an attack waits for
+	 * a block, otherwise the active player (INDEX_NONE once the game is over)
+	 */
+	static int32 GetDecidingPlayer(const FGCGMatchState& State);
+
+	/**
+	 * Every legal move at the current decision point (empty once the game is over)
+	 */
+	void GenerateMoves(const FGCGMatchState& State, FGCGMoveBuffer& OutMoves) const;
+
+	/**
+	 * Apply a move. Attacks nobody can block resolve at once; blocks and
+	 * passes resolve the attack.
+	 * @param Discards EndTurn only: cards to discard at the hand limit
+	 */
+	EGCGRulesResult ApplyMove(FGCGMatchState& State, const FGCGMove& Move, TConstArrayView<int32> Discards = TConstArrayView<int32>()) const;
+
+	/** Can the defending player block the current attack at all? */
+	bool HasLegalBlocker(const FGCGMatchState& State) const;
+
+private:
+	const FGCGRulesEngine& Engine;
+};
@@ -0,0 +1,448 @@
+// GCGCardCatalog.cpp - Immutable Flat Card Catalog Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGCardCatalog.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace
+{
+	/** Append CardId to a posting list, ignoring repeats from the same card */
+	void AddPosting(TArray<FGCGCardId>& List, FGCGCardId CardId)
+	{
+		if (List.Num() == 0 || List.Last() != CardId)
+		{
+			List.Add(CardId);
+		}
+	}
+
+	/** Keep only the entries of InOut that also appear in Other (both sorted ascending) */
+	void IntersectInPlace(TArray<FGCGCardId>& InOut, TConstArrayView<FGCGCardId> Other)
+	{
+		int32 Write = 0;
+		int32 OtherIndex = 0;
+
+		for (int32 Read = 0; Read < InOut.Num() && OtherIndex < Other.Num(); ++Read)
+		{
+			const FGCGCardId Candidate = InOut[Read];
+
+			while (OtherIndex < Other.Num() && Other[OtherIndex] < Candidate)
+			{
+				++OtherIndex;
+			}
+
+			if (OtherIndex < Other.Num() && Other[OtherIndex] == Candidate)
+			{
+				InOut[Write++] = Candidate;
+				++OtherIndex;
+			}
+		}
+
+		InOut.SetNum(Write, EAllowShrinking::No);
+	}
+}
+
+// ===== BUILD =====
+
+bool FGCGCardCatalog::Build(TArray<FGCGCardData>&& Rows, int32 NumTokenRows, TArray<FString>& OutErrors)
+{
+	Reset();
+
+	// Ids are uint16 and GCG_INVALID_CARD_ID is reserved
+	const int32 MaxCards = GCG_INVALID_CARD_ID;
+	if (Rows.Num() > MaxCards)
+	{
+		OutErrors.Add(FString::Printf(TEXT("Catalog holds at most %d cards (got %d), extra rows dropped"),
+			MaxCards, Rows.Num()));
+		Rows.SetNum(MaxCards);
+	}
+
+	Cards.Reserve(Rows.Num());
+	CardIdIndex.Reserve(Rows.Num());
+
+	bool bAllAccepted = OutErrors.Num() == 0;
+
+	for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+	{
+		FGCGCardData& Row = Rows[RowIndex];
+
+		if (Row.CardNumber.IsNone())
+		{
+			OutErrors.Add(TEXT("Card row with empty CardNumber skipped"));
+			bAllAccepted = false;
+			continue;
+		}
+
+		if (CardIdIndex.Contains(Row.CardNumber))
+		{
+			OutErrors.Add(FString::Printf(TEXT("Duplicate card number skipped: %s"), *Row.CardNumber.ToString()));
+			bAllAccepted = false;
+			continue;
+		}
+
+		const FGCGCardId CardId = static_cast<FGCGCardId>(Cards.Num());
+		CardIdIndex.Add(Row.CardNumber, CardId);
+		Cards.Add(MoveTemp(Row));
+
+		if (RowIndex < NumTokenRows)
+		{
+			NumTokens = Cards.Num();
+		}
+	}
+
+	Cards.Shrink();
+	Rows.Empty();
+
+	BuildIndices();
+
+	if (!CompileEffects(OutErrors))
+	{
+		bAllAccepted = false;
+	}
+
+	return bAllAccepted;
+}
+
+bool FGCGCardCatalog::BuildFromCooked(TArray<FGCGCardData>&& TokenRows, TSharedRef<const FGCGCookedCardCatalog, ESPMode::ThreadSafe> InCooked,
+	TArray<FString>& OutErrors)
+{
+	// Tokens go through the row path; the pool stays in the blob
+	const int32 NumTokenRows = TokenRows.Num();
+	bool bAllAccepted = Build(MoveTemp(TokenRows), NumTokenRows, OutErrors);
+
+	if (!InCooked->IsOpen())
+	{
+		OutErrors.Add(TEXT("Cooked catalog is not open, only tokens were loaded"));
+		return false;
+	}
+
+	// Mapped cards can't be dropped one by one like rows
+	const int32 MaxCookedCards = GCG_INVALID_CARD_ID - Cards.Num();
+	if (InCooked->Num() > MaxCookedCards)
+	{
+		OutErrors.Add(FString::Printf(TEXT("Catalog holds at most %d cards besides tokens (cooked blob has %d), only tokens were loaded"),
+			MaxCookedCards, InCooked->Num()));
+		return false;
+	}
+
+	Cooked = InCooked;
+	NumCookedCards = InCooked->Num();
+	MaterializedCards.SetNum(NumCookedCards);
+
+	for (const FGCGCardData& Token : Cards)
+	{
+		if (Cooked->FindCardId(Token.CardNumber) != GCG_INVALID_CARD_ID)
+		{
+			OutErrors.Add(FString::Printf(TEXT("Cooked card shadowed by a token with the same number: %s"), *Token.CardNumber.ToString()));
+			bAllAccepted = false;
+		}
+	}
+
+	BuildIndices();
+
+	return bAllAccepted;
+}
+
+void FGCGCardCatalog::Reset()
+{
+	Cards.Empty();
+	CardIdIndex.Empty();
+	NumTokens = 0;
+
+	Cooked.Reset();
+	NumCookedCards = 0;
+	MaterializedCards.Empty();
+
+	TypeIndex.Empty();
+	ColorIndex.Empty();
+	TraitIndex.Empty();
+	KeywordIndex.Empty();
+	LevelIndex.Empty();
+	CostIndex.Empty();
+
+	FirstEffect.Empty();
+	CompiledEffects.Empty();
+	EffectCode.Empty();
+	EffectTimings.Empty();
+
+	Generation = 0;
+}
+
+void FGCGCardCatalog::Diff(const FGCGCardCatalog& OldCatalog, const FGCGCardCatalog& NewCatalog, FGCGCardCatalogDiff& OutDiff)
+{
+	OutDiff = FGCGCardCatalogDiff();
+
+	UScriptStruct* CardStruct = FGCGCardData::StaticStruct();
+
+	// Rows are compared in place; cooked cards are expanded into scratch copies, not kept
+	auto ResolveCard = [](const FGCGCardCatalog& Catalog, FGCGCardId CardId, FGCGCardData& Scratch) -> const FGCGCardData*
+	{
+		if (Catalog.Cards.IsValidIndex(CardId))
+		{
+			return &Catalog.Cards[CardId];
+		}
+		return Catalog.CopyCard(CardId, Scratch) ? &Scratch : nullptr;
+	};
+
+	// Same blob on both sides: its cards are identical by construction, only the rows can differ
+	const bool bSameBlob = NewCatalog.Cooked.IsValid() && NewCatalog.Cooked == OldCatalog.Cooked;
+	if (bSameBlob)
+	{
+		OutDiff.NumUnchanged += NewCatalog.NumCookedCards;
+	}
+
+	FGCGCardData OldScratch;
+	FGCGCardData NewScratch;
+
+	const int32 NumNewToCompare = bSameBlob ? NewCatalog.Cards.Num() : NewCatalog.Num();
+	for (int32 Index = 0; Index < NumNewToCompare; ++Index)
+	{
+		const FGCGCardData* NewCard = ResolveCard(NewCatalog, static_cast<FGCGCardId>(Index), NewScratch);
+		const FGCGCardData* OldCard = ResolveCard(OldCatalog, OldCatalog.FindCardId(NewCard->CardNumber), OldScratch);
+		if (!OldCard)
+		{
+			OutDiff.Added.Add(NewCard->CardNumber);
+		}
+		else if (!CardStruct->CompareScriptStruct(OldCard, NewCard, PPF_None))
+		{
+			OutDiff.Changed.Add(NewCard->CardNumber);
+		}
+		else
+		{
+			++OutDiff.NumUnchanged;
+		}
+	}
+
+	const int32 NumOldToCompare = bSameBlob ? OldCatalog.Cards.Num() : OldCatalog.Num();
+	for (int32 Index = 0; Index < NumOldToCompare; ++Index)
+	{
+		const FName CardNumber = OldCatalog.GetCardView(static_cast<FGCGCardId>(Index)).GetCardNumber();
+		if (NewCatalog.FindCardId(CardNumber) == GCG_INVALID_CARD_ID)
+		{
+			OutDiff.Removed.Add(CardNumber);
+		}
+	}
+}
+
+void FGCGCardCatalog::BuildIndices()
+{
+	// Walk the pool in CardId order so every posting list comes out sorted
+	for (int32 Index = NumTokens; Index < Num(); ++Index)
+	{
+		const FGCGCardId CardId = static_cast<FGCGCardId>(Index);
+		const FGCGCardView Card = GetCardView(CardId);
+
+		AddPosting(TypeIndex.FindOrAdd(Card.GetCardType()), CardId);
+		AddPosting(LevelIndex.FindOrAdd(Card.GetLevel()), CardId);
+		AddPosting(CostIndex.FindOrAdd(Card.GetCost()), CardId);
+
+		if (const FGCGCookedCardRecord* Record = GetCookedRecord(CardId))
+		{
+			for (uint32 Color : Cooked->GetWords(Record->Colors))
+			{
+				AddPosting(ColorIndex.FindOrAdd(static_cast<EGCGCardColor>(Color)), CardId);
+			}
+
+			for (uint32 Trait : Cooked->GetWords(Record->Traits))
+			{
+				AddPosting(TraitIndex.FindOrAdd(Cooked->GetName(Trait)), CardId);
+			}
+
+			for (const FGCGCookedKeyword& Keyword : Cooked->GetKeywords(Record->Keywords))
+			{
+				AddPosting(KeywordIndex.FindOrAdd(static_cast<EGCGKeyword>(Keyword.Keyword)), CardId);
+			}
+			continue;
+		}
+
+		const FGCGCardData& Row = Cards[Index];
+
+		for (EGCGCardColor Color : Row.Colors)
+		{
+			AddPosting(ColorIndex.FindOrAdd(Color), CardId);
+		}
+
+		for (const FName& Trait : Row.Traits)
+		{
+			AddPosting(TraitIndex.FindOrAdd(Trait), CardId);
+		}
+
+		for (const FGCGKeywordInstance& Keyword : Row.Keywords)
+		{
+			AddPosting(KeywordIndex.FindOrAdd(Keyword.Keyword), CardId);
+		}
+	}
+
+	for (TPair<EGCGCardType, TArray<FGCGCardId>>& Pair : TypeIndex) { Pair.Value.Shrink(); }
+	for (TPair<EGCGCardColor, TArray<FGCGCardId>>& Pair : ColorIndex) { Pair.Value.Shrink(); }
+	for (TPair<FName, TArray<FGCGCardId>>& Pair : TraitIndex) { Pair.Value.Shrink(); }
+	for (TPair<EGCGKeyword, TArray<FGCGCardId>>& Pair : KeywordIndex) { Pair.Value.Shrink(); }
+	for (TPair<int32, TArray<FGCGCardId>>& Pair : LevelIndex) { Pair.Value.Shrink(); }
+	for (TPair<int32, TArray<FGCGCardId>>& Pair : CostIndex) { Pair.Value.Shrink(); }
+}
+
+bool FGCGCardCatalog::CompileEffects(TArray<FString>& OutErrors)
+{
+	bool bAllCompiled = true;
+
+	FirstEffect.SetNumUninitialized(Cards.Num() + 1);
+	EffectTimings.SetNumZeroed(Cards.Num());
+
+	for (int32 CardId = 0; CardId < Cards.Num(); ++CardId)
+	{
+		FirstEffect[CardId] = CompiledEffects.Num();
+
+		const FGCGCardData& Card = Cards[CardId];
+		for (int32 EffectIndex = 0; EffectIndex < Card.Effects.Num(); ++EffectIndex)
+		{
+			const FGCGEffectData& Effect = Card.Effects[EffectIndex];
+
+			FGCGCompiledEffect Compiled;
+			Compiled.Timing = Effect.Timing;
+			Compiled.EffectIndex = static_cast<uint16>(EffectIndex);
+			Compiled.FirstInstruction = EffectCode.Num();
+
+			FString Error;
+			if (!FGCGEffectCompiler::Compile(Effect, EffectCode, Error))
+			{
+				OutErrors.Add(FString::Printf(TEXT("%s effect %d rejected: %s"), *Card.CardNumber.ToString(), EffectIndex, *Error));
+				bAllCompiled = false;
+				continue;
+			}
+
+			Compiled.NumInstructions = EffectCode.Num() - Compiled.FirstInstruction;
+			CompiledEffects.Add(Compiled);
+			EffectTimings[CardId] |= GetEffectTimingBit(Effect.Timing);
+		}
+	}
+
+	FirstEffect[Cards.Num()] = CompiledEffects.Num();
+
+	CompiledEffects.Shrink();
+	EffectCode.Shrink();
+
+	return bAllCompiled;
+}
+
+// ===== LOOKUP =====
+
+bool FGCGCardCatalog::CopyCard(FGCGCardId CardId, FGCGCardData& OutCard) const
+{
+	if (Cards.IsValidIndex(CardId))
+	{
+		OutCard = Cards[CardId];
+		return true;
+	}
+
+	return GetCookedRecord(CardId) && Cooked->MaterializeCard(static_cast<FGCGCardId>(CardId - Cards.Num()), OutCard);
+}
+
+const FGCGCardData* FGCGCardCatalog::GetMaterializedCard(FGCGCardId CardId) const
+{
+	if (!GetCookedRecord(CardId))
+	{
+		return nullptr;
+	}
+
+	const int32 CookedIndex = CardId - Cards.Num();
+	{
+		FReadScopeLock ReadLock(MaterializeLock);
+		if (const FGCGCardData* Existing = MaterializedCards[CookedIndex].Get())
+		{
+			return Existing;
+		}
+	}
+
+	TUniquePtr<FGCGCardData> Expanded = MakeUnique<FGCGCardData>();
+	Cooked->MaterializeCard(static_cast<FGCGCardId>(CookedIndex), *Expanded);
+
+	// Another thread may have expanded it meanwhile; the first copy stays so its pointers stay valid
+	FWriteScopeLock WriteLock(MaterializeLock);
+	TUniquePtr<FGCGCardData>& Slot = MaterializedCards[CookedIndex];
+	if (!Slot.IsValid())
+	{
+		Slot = MoveTemp(Expanded);
+	}
+	return Slot.Get();
+}
+
+// ===== QUERY =====
+
+int32 FGCGCardCatalog::Query(const FGCGCardQuery& InQuery, TArray<FGCGCardId>& OutCardIds) const
+{
+	OutCardIds.Reset();
+
+	// Gather every indexed term as a posting list
+	TArray<TConstArrayView<FGCGCardId>, TInlineAllocator<16>> Lists;
+
+	if (InQuery.CardType.IsSet())
+	{
+		Lists.Add(GetCardIdsByType(InQuery.CardType.GetValue()));
+	}
+	for (EGCGCardColor Color : InQuery.Colors)
+	{
+		Lists.Add(GetCardIdsByColor(Color));
+	}
+	for (const FName& Trait : InQuery.Traits)
+	{
+		Lists.Add(GetCardIdsByTrait(Trait));
+	}
+	for (EGCGKeyword Keyword : InQuery.Keywords)
+	{
+		Lists.Add(GetCardIdsByKeyword(Keyword));
+	}
+
+	// Exact level/cost can use the index directly, ranges are filtered below
+	const bool bExactLevel = InQuery.MinLevel.IsSet() && InQuery.MaxLevel.IsSet() && InQuery.MinLevel.GetValue() == InQuery.MaxLevel.GetValue();
+	const bool bExactCost = InQuery.MinCost.IsSet() && InQuery.MaxCost.IsSet() && InQuery.MinCost.GetValue() == InQuery.MaxCost.GetValue();
+	if (bExactLevel)
+	{
+		Lists.Add(GetCardIdsByLevel(InQuery.MinLevel.GetValue()));
+	}
+	if (bExactCost)
+	{
+		Lists.Add(GetCardIdsByCost(InQuery.MinCost.GetValue()));
+	}
+
+	if (Lists.Num() > 0)
+	{
+		// Smallest list first keeps every intersection pass as short as possible
+		Lists.Sort([](const TConstArrayView<FGCGCardId>& A, const TConstArrayView<FGCGCardId>& B)
+		{
+			return A.Num() < B.Num();
+		});
+
+		OutCardIds.Append(Lists[0].GetData(), Lists[0].Num());
+		for (int32 ListIndex = 1; ListIndex < Lists.Num() && OutCardIds.Num() > 0; ++ListIndex)
+		{
+			IntersectInPlace(OutCardIds, Lists[ListIndex]);
+		}
+	}
+	else
+	{
+		// No indexed terms - start from the whole pool
+		OutCardIds.Reserve(Num() - NumTokens);
+		for (int32 Index = NumTokens; Index < Num(); ++Index)
+		{
+			OutCardIds.Add(static_cast<FGCGCardId>(Index));
+		}
+	}
+
+	// Range filters on the surviving candidates
+	const bool bFilterLevel = !bExactLevel && (InQuery.MinLevel.IsSet() || InQuery.MaxLevel.IsSet());
+	const bool bFilterCost = !bExactCost && (InQuery.MinCost.IsSet() || InQuery.MaxCost.IsSet());
+	if (bFilterLevel || bFilterCost)
+	{
+		const int32 MinLevel = InQuery.MinLevel.Get(MIN_int32);
+		const int32 MaxLevel = InQuery.MaxLevel.Get(MAX_int32);
+		const int32 MinCost = InQuery.MinCost.Get(MIN_int32);
+		const int32 MaxCost = InQuery.MaxCost.Get(MAX_int32);
+
+		OutCardIds.RemoveAll([this, MinLevel, MaxLevel, MinCost, MaxCost](FGCGCardId CardId)
+		{
+			const FGCGCardView Card = GetCardView(CardId);
+			return Card.GetLevel() < MinLevel || Card.GetLevel() > MaxLevel || Card.GetCost() < MinCost || Card.GetCost() > MaxCost;
+		});
+	}
+
+	return OutCardIds.Num();
+}
@@ -0,0 +1,391 @@
+// GCGCardCatalog.h - Immutable Flat Card Catalog
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Contiguous, read-only card definition storage addressed by dense CardIds
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GundamTCG/GCGTypes.h"
+#include "GundamTCG/Cards/GCGEffectProgram.h"
+#include "GundamTCG/Cards/GCGCardView.h"
+
+/**
+ * Card Query
+ * Conjunctive filter over the catalog's secondary indices.
+ * Every set field must match; unset fields are ignored.
+ */
+struct FGCGCardQuery
+{
+	/** Card type to match */
+	TOptional<EGCGCardType> CardType;
+
+	/** Colors the card must have (all of them) */
+	TArray<EGCGCardColor> Colors;
+
+	/** Traits the card must have (all of them) */
+	TArray<FName> Traits;
+
+	/** Keywords the card must have (all of them) */
+	TArray<EGCGKeyword> Keywords;
+
+	/** Inclusive level range */
+	TOptional<int32> MinLevel;
+	TOptional<int32> MaxLevel;
+
+	/** Inclusive cost range */
+	TOptional<int32> MinCost;
+	TOptional<int32> MaxCost;
+};
+
+/**
+ * Card Catalog Diff
+ * Row-level differences between two catalog generations, keyed by card number.
+ */
+struct FGCGCardCatalogDiff
+{
+	/** Card numbers only present in the new catalog */
+	TArray<FName> Added;
+
+	/** Card numbers only present in the old catalog */
+	TArray<FName> Removed;
+
+	/** Card numbers present in both whose row data differs */
+	TArray<FName> Changed;
+
+	/** Number of rows present and identical in both */
+	int32 NumUnchanged = 0;
+
+	bool HasChanges() const { return Added.Num() > 0 || Removed.Num() > 0 || Changed.Num() > 0; }
+
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("%d added, %d removed, %d changed, %d unchanged"),
+			Added.Num(), Removed.Num(), Changed.Num(), NumUnchanged);
+	}
+};
+
+/**
+ * Card Catalog
+ *
+ * Flat, immutable store for every card definition known to the game:
+ * - Each card is addressed by a dense FGCGCardId
+ * - CardNumber → CardId resolution goes through a single hash index
+ * - Tokens occupy the front of the id range and are excluded from the card pool
+ *
+ * The card pool is backed one of two ways:
+ * - Build(): FGCGCardData rows (DataTable, CSV) in one contiguous array
+ * - BuildFromCooked(): a memory-mapped FGCGCookedCardCatalog, shared rather than copied.
+ *   Card views, CardNumber lookups and the compiled effect programs are served from the
+ *   mapped records; only the tokens are owned rows.
+ *
+ * The rules read cards through GetCardView(), which never copies. GetCard() hands out
+ * FGCGCardData for presentation code: a cooked card is expanded on its first GetCard()
+ * and kept for the life of the catalog, so only the cards a UI or Blueprint asks for
+ * ever reach the heap.
+ *
+ * Secondary indices (posting lists of CardIds, sorted ascending) are built
+ * alongside the array for CardType, Colors, Traits, Keywords, Level and Cost.
+ *
+ * Every card's Effects are compiled once - at build for rows, at cook time
+ * for blobs - into flat instruction streams (see FGCGEffectCompiler); the
+ * rules interpret those programs rather than the effect rows.
+ * Single-attribute lookups return views into those lists; multi-attribute
+ * queries intersect them into a caller-owned buffer, so filtering the pool
+ * never copies FGCGCardData.
+ *
+ * The catalog is built once by UGCGCardDatabase::ReloadCardData() and is not
+ * mutated afterwards, so lookups never touch the DataTable and pointers into
+ * the catalog stay valid for as long as the catalog itself is alive.
+ *
+ * Each reload that changes card data publishes a new catalog with the next
+ * generation number (see FGCGCardCatalogPtr). CardIds are only meaningful
+ * within the generation that assigned them.
+ */
+class GUNDAMTCG_API FGCGCardCatalog
+{
+public:
+	// ===== BUILD =====
+
+	/**
+	 * Build the catalog from a set of card rows (replaces any previous contents)
+	 * CardIds are assigned in row order. Duplicate card numbers keep the first row.
+	 * @param Rows Card rows to take ownership of (tokens first)
+	 * @param NumTokenRows How many leading rows are tokens (not indexed, not part of the pool)
+	 * @param OutErrors Build problems (duplicates, empty card numbers, overflow)
+	 * @return True if every row was accepted
+	 */
+	bool Build(TArray<FGCGCardData>&& Rows, int32 NumTokenRows, TArray<FString>& OutErrors);
+
+	/**
+	 * Build the catalog over a cooked blob (replaces any previous contents)
+	 * Tokens get the first CardIds, the blob's cards follow in blob order. The blob is
+	 * shared, not copied: the catalog keeps it mapped for as long as the catalog lives.
+	 * @param TokenRows Token rows to take ownership of
+	 * @param InCooked An open cooked catalog
+	 * @param OutErrors Build problems (duplicates, empty card numbers, overflow)
+	 * @return True if every token and cooked card was accepted
+	 */
+	bool BuildFromCooked(TArray<FGCGCardData>&& TokenRows, TSharedRef<const FGCGCookedCardCatalog, ESPMode::ThreadSafe> InCooked,
+		TArray<FString>& OutErrors);
+
+	/**
+	 * Remove all cards and indices from the catalog
+	 */
+	void Reset();
+
+	/**
+	 * Compare the rows of two catalogs by card number
+	 * Catalogs over the same cooked blob compare only their tokens.
+	 * @param OldCatalog The previous generation
+	 * @param NewCatalog The candidate generation
+	 * @param OutDiff Added / removed / changed card numbers
+	 */
+	static void Diff(const FGCGCardCatalog& OldCatalog, const FGCGCardCatalog& NewCatalog, FGCGCardCatalogDiff& OutDiff);
+
+	// ===== GENERATION =====
+
+	/**
+	 * Generation number assigned when the catalog was published (0 = never published)
+	 */
+	uint32 GetGeneration() const { return Generation; }
+
+	/**
+	 * Tag the catalog with its generation (done once, before publishing)
+	 */
+	void SetGeneration(uint32 InGeneration) { Generation = InGeneration; }
+
+	// ===== LOOKUP =====
+
+	/**
+	 * Resolve a card number to its CardId
+	 * @param CardNumber The card number (e.g., "GU-001")
+	 * @return CardId, or GCG_INVALID_CARD_ID if not in the catalog
+	 */
+	FGCGCardId FindCardId(FName CardNumber) const
+	{
+		if (const FGCGCardId* Found = CardIdIndex.Find(CardNumber))
+		{
+			return *Found;
+		}
+
+		const FGCGCardId CookedId = Cooked.IsValid() ? Cooked->FindCardId(CardNumber) : GCG_INVALID_CARD_ID;
+		return CookedId != GCG_INVALID_CARD_ID ? static_cast<FGCGCardId>(CookedId + Cards.Num()) : GCG_INVALID_CARD_ID;
+	}
+
+	/**
+	 * View a card's definition by CardId, without copying it (what the rules read)
+	 * @param CardId The CardId to look up
+	 * @return View of the row or mapped record; invalid if the id is not valid for this catalog
+	 */
+	FGCGCardView GetCardView(FGCGCardId CardId) const
+	{
+		return Cards.IsValidIndex(CardId) ? FGCGCardView(&Cards[CardId]) : FGCGCardView(Cooked.Get(), GetCookedRecord(CardId));
+	}
+
+	/**
+	 * View a card's definition by card number
+	 * @param CardNumber The card number to look up
+	 * @return View of the card, or an invalid view if not found
+	 */
+	FGCGCardView FindCardView(FName CardNumber) const
+	{
+		return GetCardView(FindCardId(CardNumber));
+	}
+
+	/**
+	 * Get card data by CardId
+	 * O(1) for rows; a cooked card is expanded on first request (see class comment).
+	 * @param CardId The CardId to look up
+	 * @return Pointer to card data, or nullptr if the id is not valid for this catalog
+	 */
+	const FGCGCardData* GetCard(FGCGCardId CardId) const
+	{
+		return Cards.IsValidIndex(CardId) ? &Cards[CardId] : GetMaterializedCard(CardId);
+	}
+
+	/**
+	 * Get card data by card number
+	 * @param CardNumber The card number to look up
+	 * @return Pointer to card data, or nullptr if not found
+	 */
+	const FGCGCardData* FindCard(FName CardNumber) const
+	{
+		return GetCard(FindCardId(CardNumber));
+	}
+
+	/**
+	 * Copy a card's data out without keeping a cooked card expanded in the catalog
+	 * @param CardId The CardId to copy
+	 * @param OutCard The card data
+	 * @return True if the id is valid for this catalog
+	 */
+	bool CopyCard(FGCGCardId CardId, FGCGCardData& OutCard) const;
+
+	/**
+	 * Is this CardId valid for this catalog?
+	 */
+	bool IsValidCardId(FGCGCardId CardId) const { return CardId < Num(); }
+
+	/**
+	 * Is this CardId a token entry?
+	 */
+	bool IsTokenId(FGCGCardId CardId) const { return CardId < NumTokens; }
+
+	/**
+	 * Number of entries in the catalog (tokens included)
+	 */
+	int32 Num() const { return Cards.Num() + NumCookedCards; }
+
+	/**
+	 * Number of token entries at the front of the catalog
+	 */
+	int32 GetNumTokens() const { return NumTokens; }
+
+	/**
+	 * Is the card pool served from a cooked blob?
+	 */
+	bool IsCooked() const { return Cooked.IsValid(); }
+
+	// ===== SECONDARY INDICES =====
+
+	/** CardIds of the given type (sorted, pool only) */
+	TConstArrayView<FGCGCardId> GetCardIdsByType(EGCGCardType CardType) const { return FindPostingList(TypeIndex, CardType); }
+
+	/** CardIds containing the given color (sorted, pool only) */
+	TConstArrayView<FGCGCardId> GetCardIdsByColor(EGCGCardColor Color) const { return FindPostingList(ColorIndex, Color); }
+
+	/** CardIds with the given trait (sorted, pool only) */
+	TConstArrayView<FGCGCardId> GetCardIdsByTrait(FName Trait) const { return FindPostingList(TraitIndex, Trait); }
+
+	/** CardIds with the given printed keyword (sorted, pool only) */
+	TConstArrayView<FGCGCardId> GetCardIdsByKeyword(EGCGKeyword Keyword) const { return FindPostingList(KeywordIndex, Keyword); }
+
+	/** CardIds with the given level (sorted, pool only) */
+	TConstArrayView<FGCGCardId> GetCardIdsByLevel(int32 Level) const { return FindPostingList(LevelIndex, Level); }
+
+	/** CardIds with the given printed cost (sorted, pool only) */
+	TConstArrayView<FGCGCardId> GetCardIdsByCost(int32 Cost) const { return FindPostingList(CostIndex, Cost); }
+
+	/**
+	 * Run a conjunctive query against the indices
+	 * Posting lists are intersected smallest-first; level/cost ranges are checked
+	 * against the surviving candidates. OutCardIds is reset but keeps its allocation,
+	 * so a reused buffer makes repeated queries allocation-free.
+	 * @param Query The filter to apply
+	 * @param OutCardIds Matching CardIds, sorted ascending
+	 * @return Number of matches
+	 */
+	int32 Query(const FGCGCardQuery& Query, TArray<FGCGCardId>& OutCardIds) const;
+
+	// ===== EFFECTS =====
+
+	/**
+	 * Compiled effects of a card, in FGCGCardData::Effects order
+	 * Effects that failed to compile were reported by Build() and are left out.
+	 */
+	TConstArrayView<FGCGCompiledEffect> GetEffects(FGCGCardId CardId) const
+	{
+		if (Cards.IsValidIndex(CardId))
+		{
+			return MakeArrayView(CompiledEffects).Slice(FirstEffect[CardId], FirstEffect[CardId + 1] - FirstEffect[CardId]);
+		}
+
+		const FGCGCookedCardRecord* Record = GetCookedRecord(CardId);
+		return Record ? Cooked->GetCompiledEffects(Record->CompiledEffects) : TConstArrayView<FGCGCompiledEffect>();
+	}
+
+	/** Timings the card has compiled effects for (GetEffectTimingBit), 0 if none */
+	uint32 GetEffectTimings(FGCGCardId CardId) const
+	{
+		if (Cards.IsValidIndex(CardId))
+		{
+			return EffectTimings[CardId];
+		}
+
+		const FGCGCookedCardRecord* Record = GetCookedRecord(CardId);
+		return Record ? Record->EffectTimings : 0;
+	}
+
+	/**
+	 * Instructions of one compiled effect
+	 * @param CardId The card Effect came from (GetEffects)
+	 * @param Effect One of that card's compiled effects
+	 */
+	TConstArrayView<FGCGEffectInstruction> GetEffectCode(FGCGCardId CardId, const FGCGCompiledEffect& Effect) const
+	{
+		if (Cards.IsValidIndex(CardId))
+		{
+			return MakeArrayView(EffectCode).Slice(Effect.FirstInstruction, Effect.NumInstructions);
+		}
+		return Cooked.IsValid() ? Cooked->GetCode(Effect) : TConstArrayView<FGCGEffectInstruction>();
+	}
+
+private:
+	template <typename KeyType>
+	static TConstArrayView<FGCGCardId> FindPostingList(const TMap<KeyType, TArray<FGCGCardId>>& Index, const KeyType& Key)
+	{
+		const TArray<FGCGCardId>* List = Index.Find(Key);
+		return List ? TConstArrayView<FGCGCardId>(*List) : TConstArrayView<FGCGCardId>();
+	}
+
+	/** Record of a cooked card, or nullptr for rows and invalid ids */
+	const FGCGCookedCardRecord* GetCookedRecord(FGCGCardId CardId) const
+	{
+		return Cooked.IsValid() && CardId >= Cards.Num() ? Cooked->GetRecord(static_cast<FGCGCardId>(CardId - Cards.Num())) : nullptr;
+	}
+
+	/** Expanded copy of a cooked card, made on first request */
+	const FGCGCardData* GetMaterializedCard(FGCGCardId CardId) const;
+
+	/** Build all secondary indices from the card pool */
+	void BuildIndices();
+
+	/** Compile every card's effects; rejected effects are reported and skipped */
+	bool CompileEffects(TArray<FString>& OutErrors);
+
+	/** Card rows, indexed by CardId (tokens only when the pool is cooked) */
+	TArray<FGCGCardData> Cards;
+
+	/** Mapped blob serving CardIds [Cards.Num(), Num()) (null for row catalogs) */
+	TSharedPtr<const FGCGCookedCardCatalog, ESPMode::ThreadSafe> Cooked;
+
+	/** Number of cards served from Cooked */
+	int32 NumCookedCards = 0;
+
+	/** Cooked cards expanded by GetCard(), by blob index (slots are filled once, never replaced) */
+	mutable TArray<TUniquePtr<FGCGCardData>> MaterializedCards;
+
+	/** Guards MaterializedCards (catalogs are read from AI worker threads too) */
+	mutable FRWLock MaterializeLock;
+
+	/** CardNumber → CardId (rows only; cooked cards resolve through the blob's hash table) */
+	TMap<FName, FGCGCardId> CardIdIndex;
+
+	/** Number of token entries at the front of Cards */
+	int32 NumTokens = 0;
+
+	/** Publish generation (see UGCGCardDatabase::AcquireCatalog) */
+	uint32 Generation = 0;
+
+	// Posting lists (CardIds ascending)
+	TMap<EGCGCardType, TArray<FGCGCardId>> TypeIndex;
+	TMap<EGCGCardColor, TArray<FGCGCardId>> ColorIndex;
+	TMap<FName, TArray<FGCGCardId>> TraitIndex;
+	TMap<EGCGKeyword, TArray<FGCGCardId>> KeywordIndex;
+	TMap<int32, TArray<FGCGCardId>> LevelIndex;
+	TMap<int32, TArray<FGCGCardId>> CostIndex;
+
+	// Compiled effects of the rows: card CardId owns CompiledEffects[FirstEffect[CardId], FirstEffect[CardId + 1])
+	TArray<int32> FirstEffect;
+	TArray<FGCGCompiledEffect> CompiledEffects;
+	TArray<FGCGEffectInstruction> EffectCode;
+
+	/** Per card: mask of the timings in its compiled effects */
+	TArray<uint32> EffectTimings;
+};
+
+/**
+ * Shared handle to a published, immutable catalog generation
+ * Holding one keeps that generation (its FGCGCardData pointers, card views and cooked mapping) alive.
+ */
+using FGCGCardCatalogPtr = TSharedPtr<const FGCGCardCatalog, ESPMode::ThreadSafe>;
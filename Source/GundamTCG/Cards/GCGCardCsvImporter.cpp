@@ -0,0 +1,633 @@
+// GCGCardCsvImporter.cpp - Streaming CSV Card Importer Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGCardCsvImporter.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Misc/ScopeExit.h"
+
+namespace
+{
+	// ===== SCHEMA =====
+
+	enum class ECsvColumn : int32
+	{
+		CardNumber,
+		CardName,
+		CardText,
+		CardType,
+		Colors,
+		Traits,
+		Level,
+		Cost,
+		AP,
+		HP,
+		Keywords,
+		Rarity,
+		SetNumber,
+		CollectorNumber,
+		LinkRequirements,
+		Count
+	};
+
+	const TCHAR* const ColumnNames[] =
+	{
+		TEXT("CardNumber"), TEXT("CardName"), TEXT("CardText"), TEXT("CardType"), TEXT("Colors"),
+		TEXT("Traits"), TEXT("Level"), TEXT("Cost"), TEXT("AP"), TEXT("HP"), TEXT("Keywords"),
+		TEXT("Rarity"), TEXT("SetNumber"), TEXT("CollectorNumber"), TEXT("LinkRequirements")
+	};
+	static_assert(UE_ARRAY_COUNT(ColumnNames) == static_cast<int32>(ECsvColumn::Count), "Column names out of sync");
+
+	/** Header column → field index */
+	struct FColumnMap
+	{
+		int32 FieldIndex[static_cast<int32>(ECsvColumn::Count)];
+		int32 NumFields = 0;
+
+		FColumnMap()
+		{
+			for (int32& Index : FieldIndex)
+			{
+				Index = INDEX_NONE;
+			}
+		}
+
+		int32 Get(ECsvColumn Column) const { return FieldIndex[static_cast<int32>(Column)]; }
+	};
+
+	/**
+	 * Case-insensitive enum name lookups
+	 * Built once on the calling thread so workers never touch UEnum reflection.
+	 */
+	struct FEnumLookups
+	{
+		TMap<FString, EGCGCardType> CardTypes;
+		TMap<FString, EGCGCardColor> Colors;
+		TMap<FString, EGCGKeyword> Keywords;
+
+		FEnumLookups()
+		{
+			Fill(StaticEnum<EGCGCardType>(), CardTypes);
+			Fill(StaticEnum<EGCGCardColor>(), Colors);
+			Fill(StaticEnum<EGCGKeyword>(), Keywords);
+			Keywords.Remove(TEXT("None"));
+		}
+
+		template <typename EnumType>
+		static void Fill(const UEnum* Enum, TMap<FString, EnumType>& Out)
+		{
+			// Last entry is the generated _MAX
+			for (int32 Index = 0; Index < Enum->NumEnums() - 1; ++Index)
+			{
+				const EnumType Value = static_cast<EnumType>(Enum->GetValueByIndex(Index));
+				Out.Add(Enum->GetNameStringByIndex(Index), Value);
+				Out.Add(Enum->GetDisplayNameTextByIndex(Index).ToString(), Value);
+			}
+		}
+	};
+
+	const FEnumLookups& GetEnumLookups()
+	{
+		static const FEnumLookups Lookups;
+		return Lookups;
+	}
+
+	// ===== ROW SCANNER =====
+
+	/** A complete row inside the scanner buffer */
+	struct FRowSpan
+	{
+		int32 Offset;
+		int32 Length;
+		int32 LineNumber;
+	};
+
+	/**
+	 * Quote-aware row splitter over a growing byte buffer
+	 * Rows may span chunk boundaries and contain newlines inside quoted fields.
+	 */
+	class FCsvRowScanner
+	{
+	public:
+		TArray<uint8> Buffer;
+
+		void Append(const uint8* Bytes, int32 NumBytes)
+		{
+			Buffer.Append(Bytes, NumBytes);
+		}
+
+		/** Emit every complete row; on the final call, also the unterminated last row */
+		void Scan(TArray<FRowSpan>& OutRows, bool bFinal)
+		{
+			// Skip UTF-8 BOM
+			if (!bStarted && Buffer.Num() >= 3 && Buffer[0] == 0xEF && Buffer[1] == 0xBB && Buffer[2] == 0xBF)
+			{
+				RowStart = ScanPos = 3;
+			}
+			bStarted = true;
+
+			for (; ScanPos < Buffer.Num(); ++ScanPos)
+			{
+				const uint8 Char = Buffer[ScanPos];
+				if (Char == '"')
+				{
+					// Doubled quotes toggle twice, so escapes need no special case
+					bInQuotes = !bInQuotes;
+				}
+				else if (Char == '\n')
+				{
+					++CurrentLine;
+					if (!bInQuotes)
+					{
+						EmitRow(ScanPos, OutRows);
+						RowStart = ScanPos + 1;
+						RowLine = CurrentLine;
+					}
+				}
+			}
+
+			if (bFinal && RowStart < Buffer.Num())
+			{
+				EmitRow(Buffer.Num(), OutRows);
+				RowStart = Buffer.Num();
+			}
+		}
+
+		/** Drop bytes of rows already handed out */
+		void Compact()
+		{
+			if (RowStart > 0)
+			{
+				Buffer.RemoveAt(0, RowStart, EAllowShrinking::No);
+				ScanPos -= RowStart;
+				RowStart = 0;
+			}
+		}
+
+		bool IsInQuotes() const { return bInQuotes; }
+		int32 GetRowLine() const { return RowLine; }
+
+	private:
+		void EmitRow(int32 End, TArray<FRowSpan>& OutRows)
+		{
+			int32 Length = End - RowStart;
+			if (Length > 0 && Buffer[RowStart + Length - 1] == '\r')
+			{
+				--Length;
+			}
+
+			// Blank lines are skipped
+			if (Length > 0)
+			{
+				OutRows.Add({ RowStart, Length, RowLine });
+			}
+		}
+
+		int32 ScanPos = 0;
+		int32 RowStart = 0;
+		int32 CurrentLine = 1;
+		int32 RowLine = 1;
+		bool bInQuotes = false;
+		bool bStarted = false;
+	};
+
+	// ===== FIELD PARSING =====
+
+	using FFieldArray = TArray<FString, TInlineAllocator<16>>;
+
+	/** Split one row into unquoted, unescaped fields */
+	void SplitFields(const ANSICHAR* Row, int32 Length, FFieldArray& OutFields)
+	{
+		TArray<ANSICHAR, TInlineAllocator<256>> FieldBytes;
+
+		auto FlushField = [&FieldBytes, &OutFields]()
+		{
+			const FUTF8ToTCHAR Converted(FieldBytes.GetData(), FieldBytes.Num());
+			OutFields.Emplace(Converted.Length(), Converted.Get());
+			FieldBytes.Reset();
+		};
+
+		bool bQuoted = false;
+		for (int32 Index = 0; Index < Length; ++Index)
+		{
+			const ANSICHAR Char = Row[Index];
+			if (bQuoted)
+			{
+				if (Char == '"')
+				{
+					if (Index + 1 < Length && Row[Index + 1] == '"')
+					{
+						FieldBytes.Add('"');
+						++Index;
+					}
+					else
+					{
+						bQuoted = false;
+					}
+				}
+				else
+				{
+					FieldBytes.Add(Char);
+				}
+			}
+			else if (Char == '"')
+			{
+				bQuoted = true;
+			}
+			else if (Char == ',')
+			{
+				FlushField();
+			}
+			else
+			{
+				FieldBytes.Add(Char);
+			}
+		}
+
+		FlushField();
+	}
+
+	bool ParseInt(const FString& Text, int32& OutValue)
+	{
+		const FString Trimmed = Text.TrimStartAndEnd();
+		if (Trimmed.IsEmpty())
+		{
+			OutValue = 0;
+			return true;
+		}
+		return LexTryParseString(OutValue, *Trimmed);
+	}
+
+	void SplitList(const FString& Text, const TCHAR* Delimiter, TArray<FString>& OutItems)
+	{
+		Text.ParseIntoArray(OutItems, Delimiter, true);
+		for (FString& Item : OutItems)
+		{
+			Item.TrimStartAndEndInline();
+		}
+		OutItems.RemoveAll([](const FString& Item) { return Item.IsEmpty(); });
+	}
+
+	/** Parsed output for one data row */
+	struct FParsedRow
+	{
+		FGCGCardData Card;
+		TArray<FString> Errors;
+	};
+
+	void ParseColors(const FString& Text, const FEnumLookups& Lookups, TArray<EGCGCardColor>& OutColors, TArray<FString>& OutErrors)
+	{
+		TArray<FString> Items;
+		SplitList(Text, TEXT("|"), Items);
+		for (const FString& Item : Items)
+		{
+			if (const EGCGCardColor* Color = Lookups.Colors.Find(Item))
+			{
+				OutColors.Add(*Color);
+			}
+			else
+			{
+				OutErrors.Add(FString::Printf(TEXT("Unknown color '%s'"), *Item));
+			}
+		}
+	}
+
+	void ParseNames(const FString& Text, TArray<FName>& OutNames)
+	{
+		TArray<FString> Items;
+		SplitList(Text, TEXT("|"), Items);
+		for (const FString& Item : Items)
+		{
+			OutNames.Add(FName(*Item));
+		}
+	}
+
+	void ParseLinkRequirement(const FString& Text, const FEnumLookups& Lookups, FGCGLinkRequirement& OutRequirement, TArray<FString>& OutErrors)
+	{
+		TArray<FString> Clauses;
+		SplitList(Text, TEXT(";"), Clauses);
+		for (const FString& Clause : Clauses)
+		{
+			FString Key;
+			FString Value;
+			if (!Clause.Split(TEXT(":"), &Key, &Value))
+			{
+				OutErrors.Add(FString::Printf(TEXT("Link requirement '%s' is not Key:Value"), *Clause));
+				continue;
+			}
+
+			Key.TrimStartAndEndInline();
+			if (Key.Equals(TEXT("Colors"), ESearchCase::IgnoreCase))
+			{
+				ParseColors(Value, Lookups, OutRequirement.RequiredColors, OutErrors);
+			}
+			else if (Key.Equals(TEXT("Traits"), ESearchCase::IgnoreCase))
+			{
+				ParseNames(Value, OutRequirement.RequiredTraits);
+			}
+			else if (Key.Equals(TEXT("Card"), ESearchCase::IgnoreCase))
+			{
+				OutRequirement.SpecificCardNumber = FName(*Value.TrimStartAndEnd());
+			}
+			else
+			{
+				OutErrors.Add(FString::Printf(TEXT("Unknown link requirement '%s'"), *Key));
+			}
+		}
+	}
+
+	void ParseRow(const ANSICHAR* Row, int32 Length, const FColumnMap& Columns, const FEnumLookups& Lookups, FParsedRow& Out)
+	{
+		FFieldArray Fields;
+		SplitFields(Row, Length, Fields);
+
+		if (Fields.Num() != Columns.NumFields)
+		{
+			Out.Errors.Add(FString::Printf(TEXT("Expected %d fields, found %d"), Columns.NumFields, Fields.Num()));
+			return;
+		}
+
+		static const FString EmptyField;
+		auto Field = [&Fields, &Columns](ECsvColumn Column) -> const FString&
+		{
+			const int32 Index = Columns.Get(Column);
+			return Index != INDEX_NONE ? Fields[Index] : EmptyField;
+		};
+
+		FGCGCardData& Card = Out.Card;
+
+		// Identity
+		const FString CardNumber = Field(ECsvColumn::CardNumber).TrimStartAndEnd();
+		if (CardNumber.IsEmpty())
+		{
+			Out.Errors.Add(TEXT("CardNumber is empty"));
+		}
+		Card.CardNumber = FName(*CardNumber);
+		Card.CardName = FText::FromString(Field(ECsvColumn::CardName));
+		Card.CardText = FText::FromString(Field(ECsvColumn::CardText));
+
+		const FString CardType = Field(ECsvColumn::CardType).TrimStartAndEnd();
+		if (const EGCGCardType* Type = Lookups.CardTypes.Find(CardType))
+		{
+			Card.CardType = *Type;
+		}
+		else
+		{
+			Out.Errors.Add(FString::Printf(TEXT("Unknown card type '%s'"), *CardType));
+		}
+
+		ParseColors(Field(ECsvColumn::Colors), Lookups, Card.Colors, Out.Errors);
+		ParseNames(Field(ECsvColumn::Traits), Card.Traits);
+
+		// Stats
+		struct FIntField { ECsvColumn Column; int32* Target; };
+		const FIntField IntFields[] =
+		{
+			{ ECsvColumn::Level, &Card.Level },
+			{ ECsvColumn::Cost, &Card.Cost },
+			{ ECsvColumn::AP, &Card.AP },
+			{ ECsvColumn::HP, &Card.HP },
+			{ ECsvColumn::CollectorNumber, &Card.CollectorNumber }
+		};
+		for (const FIntField& IntField : IntFields)
+		{
+			if (!ParseInt(Field(IntField.Column), *IntField.Target))
+			{
+				Out.Errors.Add(FString::Printf(TEXT("%s '%s' is not an integer"),
+					ColumnNames[static_cast<int32>(IntField.Column)], *Field(IntField.Column)));
+			}
+		}
+
+		// Keywords
+		TArray<FString> KeywordTokens;
+		SplitList(Field(ECsvColumn::Keywords), TEXT("|"), KeywordTokens);
+		for (const FString& Token : KeywordTokens)
+		{
+			FGCGKeywordInstance Keyword;
+			FString KeywordError;
+			if (FGCGCardCsvImporter::ParseKeyword(Token, Keyword, KeywordError))
+			{
+				Card.Keywords.Add(Keyword);
+			}
+			else
+			{
+				Out.Errors.Add(KeywordError);
+			}
+		}
+
+		// Metadata
+		const FString Rarity = Field(ECsvColumn::Rarity).TrimStartAndEnd();
+		Card.Rarity = Rarity.IsEmpty() ? NAME_None : FName(*Rarity);
+		const FString Set = Field(ECsvColumn::SetNumber).TrimStartAndEnd();
+		Card.Set = Set.IsEmpty() ? NAME_None : FName(*Set);
+
+		ParseLinkRequirement(Field(ECsvColumn::LinkRequirements), Lookups, Card.LinkRequirement, Out.Errors);
+		Card.bCanBePilot = Card.CardType == EGCGCardType::Pilot;
+	}
+
+	/** Streaming import state shared by ImportFile and ImportText */
+	class FCsvImportSession
+	{
+	public:
+		explicit FCsvImportSession(FGCGCsvImportResult& InResult)
+			: Result(InResult)
+			, Lookups(GetEnumLookups())
+		{
+		}
+
+		void Feed(const uint8* Bytes, int32 NumBytes, bool bFinal)
+		{
+			Scanner.Append(Bytes, NumBytes);
+
+			Rows.Reset();
+			Scanner.Scan(Rows, bFinal);
+
+			int32 FirstDataRow = 0;
+			if (!bHaveHeader && Rows.Num() > 0)
+			{
+				ParseHeader(Rows[0]);
+				FirstDataRow = 1;
+			}
+
+			if (bHeaderValid)
+			{
+				ParseBatch(MakeArrayView(Rows).RightChop(FirstDataRow));
+			}
+
+			Scanner.Compact();
+
+			if (bFinal && Scanner.IsInQuotes())
+			{
+				Result.Errors.Add({ Scanner.GetRowLine(), TEXT("Unterminated quoted field") });
+			}
+		}
+
+	private:
+		void ParseHeader(const FRowSpan& HeaderRow)
+		{
+			bHaveHeader = true;
+
+			FFieldArray HeaderFields;
+			SplitFields(reinterpret_cast<const ANSICHAR*>(Scanner.Buffer.GetData() + HeaderRow.Offset), HeaderRow.Length, HeaderFields);
+			Columns.NumFields = HeaderFields.Num();
+
+			for (int32 FieldIndex = 0; FieldIndex < HeaderFields.Num(); ++FieldIndex)
+			{
+				const FString Name = HeaderFields[FieldIndex].TrimStartAndEnd();
+				bool bKnown = false;
+				for (int32 Column = 0; Column < static_cast<int32>(ECsvColumn::Count); ++Column)
+				{
+					if (Name.Equals(ColumnNames[Column], ESearchCase::IgnoreCase))
+					{
+						Columns.FieldIndex[Column] = FieldIndex;
+						bKnown = true;
+						break;
+					}
+				}
+
+				if (!bKnown)
+				{
+					Result.Warnings.Add({ HeaderRow.LineNumber, FString::Printf(TEXT("Unknown column '%s' ignored"), *Name) });
+				}
+			}
+
+			bHeaderValid = Columns.Get(ECsvColumn::CardNumber) != INDEX_NONE && Columns.Get(ECsvColumn::CardType) != INDEX_NONE;
+			if (!bHeaderValid)
+			{
+				Result.Errors.Add({ HeaderRow.LineNumber, TEXT("Header must contain CardNumber and CardType columns") });
+			}
+		}
+
+		void ParseBatch(TConstArrayView<FRowSpan> Batch)
+		{
+			if (Batch.Num() == 0)
+			{
+				return;
+			}
+
+			Parsed.Reset();
+			Parsed.SetNum(Batch.Num());
+
+			const uint8* BufferData = Scanner.Buffer.GetData();
+			ParallelFor(Batch.Num(), [this, Batch, BufferData](int32 Index)
+			{
+				const FRowSpan& Row = Batch[Index];
+				ParseRow(reinterpret_cast<const ANSICHAR*>(BufferData + Row.Offset), Row.Length, Columns, Lookups, Parsed[Index]);
+			});
+
+			// Merge in file order
+			Result.RowsRead += Batch.Num();
+			Result.Cards.Reserve(Result.Cards.Num() + Batch.Num());
+			for (int32 Index = 0; Index < Batch.Num(); ++Index)
+			{
+				FParsedRow& Row = Parsed[Index];
+				if (Row.Errors.Num() == 0)
+				{
+					Result.Cards.Add(MoveTemp(Row.Card));
+					continue;
+				}
+
+				for (FString& Error : Row.Errors)
+				{
+					Result.Errors.Add({ Batch[Index].LineNumber, MoveTemp(Error) });
+				}
+			}
+		}
+
+		FGCGCsvImportResult& Result;
+		const FEnumLookups& Lookups;
+		FCsvRowScanner Scanner;
+		FColumnMap Columns;
+		TArray<FRowSpan> Rows;
+		TArray<FParsedRow> Parsed;
+		bool bHaveHeader = false;
+		bool bHeaderValid = false;
+	};
+}
+
+// ===== IMPORT =====
+
+bool FGCGCardCsvImporter::ImportFile(const FString& FilePath, FGCGCsvImportResult& OutResult, int32 ChunkBytes)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	ON_SCOPE_EXIT { OutResult.Seconds = FPlatformTime::Seconds() - StartTime; };
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!Reader)
+	{
+		OutResult.Errors.Add({ 0, FString::Printf(TEXT("Failed to open %s"), *FilePath) });
+		return false;
+	}
+
+	FCsvImportSession Session(OutResult);
+
+	TArray<uint8> Chunk;
+	Chunk.SetNumUninitialized(FMath::Max(ChunkBytes, 4096));
+
+	int64 Remaining = Reader->TotalSize();
+	do
+	{
+		const int32 BytesToRead = static_cast<int32>(FMath::Min<int64>(Remaining, Chunk.Num()));
+		Reader->Serialize(Chunk.GetData(), BytesToRead);
+		Remaining -= BytesToRead;
+
+		Session.Feed(Chunk.GetData(), BytesToRead, Remaining <= 0);
+	}
+	while (Remaining > 0 && !Reader->IsError());
+
+	if (Reader->IsError())
+	{
+		OutResult.Errors.Add({ 0, FString::Printf(TEXT("Read error in %s"), *FilePath) });
+	}
+
+	return OutResult.Errors.Num() == 0;
+}
+
+bool FGCGCardCsvImporter::ImportText(TConstArrayView<uint8> Utf8Text, FGCGCsvImportResult& OutResult)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FCsvImportSession Session(OutResult);
+	Session.Feed(Utf8Text.GetData(), Utf8Text.Num(), true);
+
+	OutResult.Seconds = FPlatformTime::Seconds() - StartTime;
+	return OutResult.Errors.Num() == 0;
+}
+
+bool FGCGCardCsvImporter::ParseKeyword(FStringView Token, FGCGKeywordInstance& OutKeyword, FString& OutError)
+{
+	Token = Token.TrimStartAndEnd();
+
+	// "Name" or "Name(Value)"
+	FStringView NamePart = Token;
+	int32 Value = 0;
+
+	int32 OpenParen = INDEX_NONE;
+	if (Token.FindChar(TEXT('('), OpenParen))
+	{
+		if (!Token.EndsWith(TEXT(')')))
+		{
+			OutError = FString::Printf(TEXT("Keyword '%.*s' is missing ')'"), Token.Len(), Token.GetData());
+			return false;
+		}
+
+		const FString ValueText(Token.Mid(OpenParen + 1, Token.Len() - OpenParen - 2));
+		if (!ParseInt(ValueText, Value))
+		{
+			OutError = FString::Printf(TEXT("Keyword '%.*s' has a non-integer value"), Token.Len(), Token.GetData());
+			return false;
+		}
+
+		NamePart = Token.Left(OpenParen).TrimEnd();
+	}
+
+	const EGCGKeyword* Keyword = GetEnumLookups().Keywords.Find(FString(NamePart));
+	if (!Keyword)
+	{
+		OutError = FString::Printf(TEXT("Unknown keyword '%.*s'"), NamePart.Len(), NamePart.GetData());
+		return false;
+	}
+
+	OutKeyword = FGCGKeywordInstance(*Keyword, Value);
+	return true;
+}
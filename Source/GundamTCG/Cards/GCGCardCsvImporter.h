@@ -0,0 +1,92 @@
+// GCGCardCsvImporter.h - Streaming CSV Card Importer
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Native card CSV import (no UDataTable) with chunked reads and parallel row parsing
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GundamTCG/GCGTypes.h"
+
+/**
+ * Import error with its source line
+ */
+struct FGCGCsvImportError
+{
+	/** 1-based line number in the source file (0 = file-level error) */
+	int32 LineNumber = 0;
+
+	FString Message;
+
+	FString ToString() const
+	{
+		return LineNumber > 0 ? FString::Printf(TEXT("Line %d: %s"), LineNumber, *Message) : Message;
+	}
+};
+
+/**
+ * Import result
+ */
+struct FGCGCsvImportResult
+{
+	/** Successfully parsed cards, in file order */
+	TArray<FGCGCardData> Cards;
+
+	/** Every problem found (rows with errors are not added to Cards) */
+	TArray<FGCGCsvImportError> Errors;
+
+	/** Problems that lose no card data (e.g. unknown columns, which are ignored) */
+	TArray<FGCGCsvImportError> Warnings;
+
+	/** Data rows read (header excluded) */
+	int32 RowsRead = 0;
+
+	/** Wall time spent importing */
+	double Seconds = 0.0;
+};
+
+/**
+ * Card CSV Importer
+ *
+ * Reads card CSVs with the TestCards.csv schema:
+ *   CardNumber, CardName, CardText, CardType, Colors, Traits, Level, Cost, AP, HP,
+ *   Keywords, Rarity, SetNumber, CollectorNumber, LinkRequirements
+ *
+ * Column order comes from the header row. Field syntax:
+ * - Colors, Traits, Keywords: pipe-separated ("Mobile Suit|Zeon")
+ * - Keywords: "Name" or "Name(Value)" ("Repair(2)|Blocker")
+ * - LinkRequirements: ';'-separated clauses "Colors:Red|Blue", "Traits:Pilot|Newtype", "Card:GU-011"
+ * - Fields may be quoted ("...") to contain commas, newlines or doubled quotes
+ *
+ * The file is read in fixed-size chunks; a quote-aware scanner cuts complete rows out of
+ * each chunk, and batches of rows are parsed on ParallelFor. Memory stays bounded by the
+ * chunk and batch sizes plus the parsed output.
+ */
+class GUNDAMTCG_API FGCGCardCsvImporter
+{
+public:
+	/**
+	 * Import a card CSV file
+	 * @param FilePath The CSV file to read
+	 * @param OutResult Parsed cards, errors and warnings
+	 * @param ChunkBytes Read buffer size
+	 * @return True if the file was read and every row parsed without errors (warnings don't count)
+	 */
+	static bool ImportFile(const FString& FilePath, FGCGCsvImportResult& OutResult, int32 ChunkBytes = 256 * 1024);
+
+	/**
+	 * Import card CSV text already in memory (UTF-8)
+	 * @param Utf8Text The CSV contents
+	 * @param OutResult Parsed cards, errors and warnings
+	 * @return True if every row parsed without errors (warnings don't count)
+	 */
+	static bool ImportText(TConstArrayView<uint8> Utf8Text, FGCGCsvImportResult& OutResult);
+
+	/**
+	 * Parse one keyword token ("Blocker", "Repair(2)")
+	 * @param Token The keyword token
+	 * @param OutKeyword The parsed keyword
+	 * @param OutError Error message on failure
+	 * @return True if the token is a valid keyword
+	 */
+	static bool ParseKeyword(FStringView Token, FGCGKeywordInstance& OutKeyword, FString& OutError);
+};
@@ -0,0 +1,80 @@
+// GCGCardView.cpp - Non-Owning Card Definition View Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGCardView.h"
+
+// ===== IDENTITY =====
+
+FName FGCGCardView::GetCardNumber() const
+{
+	if (Record)
+	{
+		return Cooked->GetName(Record->CardNumber);
+	}
+	return Data ? Data->CardNumber : FName(NAME_None);
+}
+
+// ===== KEYWORDS, COLORS, TRAITS =====
+
+bool FGCGCardView::HasKeyword(EGCGKeyword Keyword) const
+{
+	if (Record)
+	{
+		for (const FGCGCookedKeyword& CookedKeyword : Cooked->GetKeywords(Record->Keywords))
+		{
+			if (CookedKeyword.Keyword == static_cast<uint8>(Keyword))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+	return Data && Data->HasKeyword(Keyword);
+}
+
+int32 FGCGCardView::GetTotalKeywordValue(EGCGKeyword Keyword) const
+{
+	if (Record)
+	{
+		int32 Total = 0;
+		for (const FGCGCookedKeyword& CookedKeyword : Cooked->GetKeywords(Record->Keywords))
+		{
+			if (CookedKeyword.Keyword == static_cast<uint8>(Keyword))
+			{
+				Total += CookedKeyword.Value;
+			}
+		}
+		return Total;
+	}
+	return Data ? Data->GetTotalKeywordValue(Keyword) : 0;
+}
+
+bool FGCGCardView::HasColor(EGCGCardColor Color) const
+{
+	if (Record)
+	{
+		return Cooked->GetWords(Record->Colors).Contains(static_cast<uint32>(Color));
+	}
+	return Data && Data->Colors.Contains(Color);
+}
+
+bool FGCGCardView::HasTrait(FName Trait) const
+{
+	if (Record)
+	{
+		return Cooked->ContainsString(Cooked->GetWords(Record->Traits), Trait);
+	}
+	return Data && Data->HasTrait(Trait);
+}
+
+// ===== EFFECTS =====
+
+FString FGCGCardView::GetEffectDescription(int32 EffectIndex) const
+{
+	if (Record)
+	{
+		const TConstArrayView<FGCGCookedEffect> Effects = Cooked->GetEffects(Record->Effects);
+		return Effects.IsValidIndex(EffectIndex) ? Cooked->GetFString(Effects[EffectIndex].Description) : FString();
+	}
+	return Data && Data->Effects.IsValidIndex(EffectIndex) ? Data->Effects[EffectIndex].Description.ToString() : FString();
+}
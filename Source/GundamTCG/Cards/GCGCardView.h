@@ -0,0 +1,91 @@
+// GCGCardView.h - Non-Owning Card Definition View
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Read-only view of one card definition, over an FGCGCardData row or a mapped cooked record
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GundamTCG/GCGTypes.h"
+#include "GundamTCG/Cards/GCGCookedCardCatalog.h"
+
+/**
+ * Card View
+ *
+ * What the rules read from a card definition, without owning or copying it.
+ * A view points either at an FGCGCardData row (DataTable / CSV catalogs) or at
+ * a record inside a memory-mapped cooked catalog, so a catalog served from a
+ * cooked blob answers rules lookups straight from the shared mapped pages.
+ *
+ * Views are as long-lived as the catalog generation that handed them out.
+ * Numbers and enums are read in place; names and text are converted on request,
+ * so keep GetCardNumber / GetEffectDescription out of hot loops.
+ */
+class GUNDAMTCG_API FGCGCardView
+{
+public:
+	/** Invalid view (unknown card) */
+	FGCGCardView() = default;
+
+	/** View of a card row */
+	explicit FGCGCardView(const FGCGCardData* InData)
+		: Data(InData)
+	{
+	}
+
+	/** View of a cooked record */
+	FGCGCardView(const FGCGCookedCardCatalog* InCooked, const FGCGCookedCardRecord* InRecord)
+		: Cooked(InRecord ? InCooked : nullptr)
+		, Record(InRecord)
+	{
+	}
+
+	bool IsValid() const { return Data != nullptr || Record != nullptr; }
+	explicit operator bool() const { return IsValid(); }
+
+	// ===== IDENTITY =====
+
+	FName GetCardNumber() const;
+
+	EGCGCardType GetCardType() const
+	{
+		return Record ? static_cast<EGCGCardType>(Record->CardType) : Data ? Data->CardType : EGCGCardType::Unit;
+	}
+
+	// ===== STATS =====
+
+	int32 GetLevel() const { return Record ? Record->Level : Data ? Data->Level : 0; }
+	int32 GetCost() const { return Record ? Record->Cost : Data ? Data->Cost : 0; }
+	int32 GetAP() const { return Record ? Record->AP : Data ? Data->AP : 0; }
+	int32 GetHP() const { return Record ? Record->HP : Data ? Data->HP : 0; }
+	bool CanBePilot() const { return Record ? Record->bCanBePilot != 0 : Data && Data->bCanBePilot; }
+
+	// ===== KEYWORDS, COLORS, TRAITS =====
+
+	/** Does the card print this keyword? */
+	bool HasKeyword(EGCGKeyword Keyword) const;
+
+	/** Total printed X of a keyword (stacking) */
+	int32 GetTotalKeywordValue(EGCGKeyword Keyword) const;
+
+	bool HasColor(EGCGCardColor Color) const;
+	bool HasTrait(FName Trait) const;
+
+	/** Number of printed keywords */
+	int32 NumKeywords() const { return Record ? static_cast<int32>(Record->Keywords.Num) : Data ? Data->Keywords.Num() : 0; }
+
+	// ===== EFFECTS =====
+
+	/** Number of effect rows (compiled or not) */
+	int32 NumEffects() const { return Record ? static_cast<int32>(Record->Effects.Num) : Data ? Data->Effects.Num() : 0; }
+
+	/** Description of the effect at EffectIndex (FGCGCompiledEffect::EffectIndex), for logs */
+	FString GetEffectDescription(int32 EffectIndex) const;
+
+private:
+	/** Card row (null for cooked views) */
+	const FGCGCardData* Data = nullptr;
+
+	/** Cooked blob and record (null for row views) */
+	const FGCGCookedCardCatalog* Cooked = nullptr;
+	const FGCGCookedCardRecord* Record = nullptr;
+};
@@ -0,0 +1,665 @@
+// GCGCookedCardCatalog.cpp - Cooked Binary Card Catalog Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGCookedCardCatalog.h"
+#include "GCGCardCatalog.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Engine/Texture2D.h"
+
+namespace
+{
+	/** FNV-1a over ASCII-uppercased UTF-8 bytes (card numbers compare case-insensitively, like FName) */
+	uint32 HashCardNumber(const ANSICHAR* Bytes, int32 Length)
+	{
+		uint32 Hash = 2166136261u;
+		for (int32 Index = 0; Index < Length; ++Index)
+		{
+			Hash ^= static_cast<uint8>(FCharAnsi::ToUpper(Bytes[Index]));
+			Hash *= 16777619u;
+		}
+		return Hash;
+	}
+
+	bool CardNumbersMatch(const ANSICHAR* A, const ANSICHAR* B, int32 LengthB)
+	{
+		for (int32 Index = 0; Index < LengthB; ++Index)
+		{
+			if (A[Index] == '\0' || FCharAnsi::ToUpper(A[Index]) != FCharAnsi::ToUpper(B[Index]))
+			{
+				return false;
+			}
+		}
+		return A[LengthB] == '\0';
+	}
+
+	uint32 AlignSection(uint32 Offset)
+	{
+		return Align(Offset, 4u);
+	}
+
+	/** Case-sensitive string dedup for the string pool */
+	struct FCaseSensitiveStringKeyFuncs : BaseKeyFuncs<TPair<FString, uint32>, FString, false>
+	{
+		static const FString& GetSetKey(const TPair<FString, uint32>& Element) { return Element.Key; }
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	/** Collects the variable-size sections while records are written */
+	struct FCookedBlobBuilder
+	{
+		TArray<FGCGCookedCardRecord> Records;
+		TArray<FGCGCookedKeyword> Keywords;
+		TArray<FGCGCookedEffect> Effects;
+		TArray<FGCGCookedClause> Clauses;
+		TArray<FGCGCompiledEffect> CompiledEffects;
+		TArray<FGCGEffectInstruction> Code;
+		TArray<uint32> Words;
+		TArray<uint8> Strings;
+		TMap<FString, uint32, FDefaultSetAllocator, FCaseSensitiveStringKeyFuncs> StringOffsets;
+
+		FCookedBlobBuilder()
+		{
+			// Offset 0 is the empty string
+			Strings.Add(0);
+		}
+
+		uint32 AddString(const FString& Value)
+		{
+			if (Value.IsEmpty())
+			{
+				return 0;
+			}
+
+			if (const uint32* Existing = StringOffsets.Find(Value))
+			{
+				return *Existing;
+			}
+
+			const FTCHARToUTF8 Utf8(*Value);
+			const uint32 Offset = Strings.Num();
+			Strings.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+			Strings.Add(0);
+
+			StringOffsets.Add(Value, Offset);
+			return Offset;
+		}
+
+		uint32 AddName(FName Value)
+		{
+			return Value.IsNone() ? 0 : AddString(Value.ToString());
+		}
+
+		FGCGCookedRange AddNames(const TArray<FName>& Values)
+		{
+			FGCGCookedRange Range{ static_cast<uint32>(Words.Num()), static_cast<uint32>(Values.Num()) };
+			for (const FName& Value : Values)
+			{
+				Words.Add(AddName(Value));
+			}
+			return Range;
+		}
+
+		FGCGCookedRange AddStrings(const TArray<FString>& Values)
+		{
+			FGCGCookedRange Range{ static_cast<uint32>(Words.Num()), static_cast<uint32>(Values.Num()) };
+			for (const FString& Value : Values)
+			{
+				Words.Add(AddString(Value));
+			}
+			return Range;
+		}
+
+		FGCGCookedRange AddColors(const TArray<EGCGCardColor>& Values)
+		{
+			FGCGCookedRange Range{ static_cast<uint32>(Words.Num()), static_cast<uint32>(Values.Num()) };
+			for (EGCGCardColor Value : Values)
+			{
+				Words.Add(static_cast<uint32>(Value));
+			}
+			return Range;
+		}
+
+		FGCGCookedClause& AddClause(FName Type, const TArray<FString>& Params)
+		{
+			FGCGCookedClause& Clause = Clauses.AddZeroed_GetRef();
+			Clause.Type = AddName(Type);
+			Clause.Params = AddStrings(Params);
+			return Clause;
+		}
+
+		void AddEffect(const FGCGEffectData& Effect)
+		{
+			FGCGCookedEffect Cooked;
+			FMemory::Memzero(Cooked);
+			Cooked.Timing = static_cast<uint8>(Effect.Timing);
+			Cooked.bOncePerTurn = Effect.bOncePerTurn ? 1 : 0;
+			Cooked.Description = AddString(Effect.Description.ToString());
+
+			Cooked.Conditions.First = Clauses.Num();
+			for (const FGCGEffectCondition& Condition : Effect.Conditions)
+			{
+				AddClause(Condition.ConditionType, Condition.Parameters);
+			}
+			Cooked.Conditions.Num = Clauses.Num() - Cooked.Conditions.First;
+
+			Cooked.Costs.First = Clauses.Num();
+			for (const FGCGEffectCost& Cost : Effect.Costs)
+			{
+				FGCGCookedClause& Clause = AddClause(Cost.CostType, Cost.Parameters);
+				Clause.Amount = Cost.Amount;
+				Clause.ActivationCost = Cost.ActivationCost;
+			}
+			Cooked.Costs.Num = Clauses.Num() - Cooked.Costs.First;
+
+			Cooked.Operations.First = Clauses.Num();
+			for (const FGCGEffectOperation& Operation : Effect.Operations)
+			{
+				FGCGCookedClause& Clause = AddClause(Operation.OperationType, Operation.Parameters);
+				Clause.Target = AddName(Operation.Target);
+				Clause.Amount = Operation.Amount;
+				Clause.TargetScope = static_cast<uint8>(Operation.TargetScope);
+				Clause.bRequiresTarget = Operation.bRequiresTarget ? 1 : 0;
+				Clause.Duration = static_cast<uint8>(Operation.Duration);
+			}
+			Cooked.Operations.Num = Clauses.Num() - Cooked.Operations.First;
+
+			Effects.Add(Cooked);
+		}
+
+		/** Copy a card's compiled programs field by field (padding stays zero, so cooks are reproducible) */
+		void AddCompiledEffects(const FGCGCardCatalog& Catalog, FGCGCardId CardId, FGCGCookedCardRecord& Record)
+		{
+			Record.CompiledEffects.First = CompiledEffects.Num();
+			for (const FGCGCompiledEffect& Effect : Catalog.GetEffects(CardId))
+			{
+				FGCGCompiledEffect& Cooked = CompiledEffects.AddZeroed_GetRef();
+				Cooked.Timing = Effect.Timing;
+				Cooked.EffectIndex = Effect.EffectIndex;
+				Cooked.FirstInstruction = Code.Num();
+
+				for (const FGCGEffectInstruction& Instruction : Catalog.GetEffectCode(CardId, Effect))
+				{
+					FGCGEffectInstruction& CookedInstruction = Code.AddZeroed_GetRef();
+					CookedInstruction.Op = Instruction.Op;
+					CookedInstruction.Target = Instruction.Target;
+					CookedInstruction.Arg = Instruction.Arg;
+					CookedInstruction.Operand = Instruction.Operand;
+				}
+
+				Cooked.NumInstructions = Code.Num() - Cooked.FirstInstruction;
+			}
+			Record.CompiledEffects.Num = CompiledEffects.Num() - Record.CompiledEffects.First;
+			Record.EffectTimings = Catalog.GetEffectTimings(CardId);
+		}
+
+		void AddCard(const FGCGCardData& Card, const FGCGCardCatalog& Catalog, FGCGCardId CardId)
+		{
+			FGCGCookedCardRecord& Record = Records.AddZeroed_GetRef();
+
+			Record.CardNumber = AddName(Card.CardNumber);
+			Record.CardName = AddString(Card.CardName.ToString());
+			Record.CardText = AddString(Card.CardText.ToString());
+			Record.FlavorText = AddString(Card.FlavorText.ToString());
+			Record.CardArt = AddString(Card.CardArt.ToString());
+			Record.Set = AddName(Card.Set);
+			Record.Rarity = AddName(Card.Rarity);
+			Record.LinkSpecificCard = AddName(Card.LinkRequirement.SpecificCardNumber);
+
+			Record.Level = Card.Level;
+			Record.Cost = Card.Cost;
+			Record.AP = Card.AP;
+			Record.HP = Card.HP;
+			Record.CollectorNumber = Card.CollectorNumber;
+
+			Record.Colors = AddColors(Card.Colors);
+			Record.Traits = AddNames(Card.Traits);
+			Record.LinkColors = AddColors(Card.LinkRequirement.RequiredColors);
+			Record.LinkTraits = AddNames(Card.LinkRequirement.RequiredTraits);
+
+			Record.Keywords.First = Keywords.Num();
+			for (const FGCGKeywordInstance& Keyword : Card.Keywords)
+			{
+				FGCGCookedKeyword& Cooked = Keywords.AddZeroed_GetRef();
+				Cooked.Keyword = static_cast<uint8>(Keyword.Keyword);
+				Cooked.Value = Keyword.Value;
+			}
+			Record.Keywords.Num = Card.Keywords.Num();
+
+			Record.Effects.First = Effects.Num();
+			for (const FGCGEffectData& Effect : Card.Effects)
+			{
+				AddEffect(Effect);
+			}
+			Record.Effects.Num = Card.Effects.Num();
+
+			AddCompiledEffects(Catalog, CardId, Record);
+
+			Record.CardType = static_cast<uint8>(Card.CardType);
+			Record.bCanBePilot = Card.bCanBePilot ? 1 : 0;
+		}
+	};
+
+	template <typename RecordType>
+	FGCGCookedRange PlaceSection(uint32& Cursor, const TArray<RecordType>& Section)
+	{
+		Cursor = AlignSection(Cursor);
+		FGCGCookedRange Range{ Cursor, static_cast<uint32>(Section.Num()) };
+		Cursor += static_cast<uint32>(Section.Num() * sizeof(RecordType));
+		return Range;
+	}
+
+	template <typename RecordType>
+	void CopySection(TArray<uint8>& Blob, const FGCGCookedRange& Range, const TArray<RecordType>& Section)
+	{
+		if (Section.Num() > 0)
+		{
+			FMemory::Memcpy(Blob.GetData() + Range.First, Section.GetData(), Section.Num() * sizeof(RecordType));
+		}
+	}
+}
+
+FGCGCookedCardCatalog::FGCGCookedCardCatalog() = default;
+
+FGCGCookedCardCatalog::~FGCGCookedCardCatalog()
+{
+	Close();
+}
+
+// ===== COOKING =====
+
+void FGCGCookedCardCatalog::Serialize(const FGCGCardCatalog& Catalog, TArray<uint8>& OutBlob)
+{
+	const int32 NumCards = Catalog.Num() - Catalog.GetNumTokens();
+
+	FCookedBlobBuilder Builder;
+	Builder.Records.Reserve(NumCards);
+	for (int32 CardId = Catalog.GetNumTokens(); CardId < Catalog.Num(); ++CardId)
+	{
+		FGCGCardData Card;
+		Catalog.CopyCard(static_cast<FGCGCardId>(CardId), Card);
+		Builder.AddCard(Card, Catalog, static_cast<FGCGCardId>(CardId));
+	}
+
+	// Hash table: power of two, at most half full
+	const int32 TableSize = FMath::RoundUpToPowerOfTwo(FMath::Max(8, NumCards * 2));
+	TArray<uint16> HashTable;
+	HashTable.Init(GCGCookedCatalog::EmptySlot, TableSize);
+
+	for (int32 CardIndex = 0; CardIndex < Builder.Records.Num(); ++CardIndex)
+	{
+		const ANSICHAR* CardNumber = reinterpret_cast<const ANSICHAR*>(Builder.Strings.GetData() + Builder.Records[CardIndex].CardNumber);
+		uint32 Slot = HashCardNumber(CardNumber, FCStringAnsi::Strlen(CardNumber)) & (TableSize - 1);
+		while (HashTable[Slot] != GCGCookedCatalog::EmptySlot)
+		{
+			Slot = (Slot + 1) & (TableSize - 1);
+		}
+		HashTable[Slot] = static_cast<uint16>(CardIndex);
+	}
+
+	// Lay out sections
+	FGCGCookedCatalogHeader Header;
+	FMemory::Memzero(Header);
+	Header.Magic = GCGCookedCatalog::Magic;
+	Header.Version = GCGCookedCatalog::Version;
+	Header.NumCards = Builder.Records.Num();
+
+	uint32 Cursor = sizeof(FGCGCookedCatalogHeader);
+	Header.Cards = PlaceSection(Cursor, Builder.Records);
+	Header.Keywords = PlaceSection(Cursor, Builder.Keywords);
+	Header.Effects = PlaceSection(Cursor, Builder.Effects);
+	Header.Clauses = PlaceSection(Cursor, Builder.Clauses);
+	Header.CompiledEffects = PlaceSection(Cursor, Builder.CompiledEffects);
+	Header.Code = PlaceSection(Cursor, Builder.Code);
+	Header.Words = PlaceSection(Cursor, Builder.Words);
+	Header.HashTable = PlaceSection(Cursor, HashTable);
+	Header.Strings = PlaceSection(Cursor, Builder.Strings);
+	Header.TotalSize = AlignSection(Cursor);
+
+	OutBlob.Reset();
+	OutBlob.SetNumZeroed(Header.TotalSize);
+	FMemory::Memcpy(OutBlob.GetData(), &Header, sizeof(Header));
+	CopySection(OutBlob, Header.Cards, Builder.Records);
+	CopySection(OutBlob, Header.Keywords, Builder.Keywords);
+	CopySection(OutBlob, Header.Effects, Builder.Effects);
+	CopySection(OutBlob, Header.Clauses, Builder.Clauses);
+	CopySection(OutBlob, Header.CompiledEffects, Builder.CompiledEffects);
+	CopySection(OutBlob, Header.Code, Builder.Code);
+	CopySection(OutBlob, Header.Words, Builder.Words);
+	CopySection(OutBlob, Header.HashTable, HashTable);
+	CopySection(OutBlob, Header.Strings, Builder.Strings);
+}
+
+bool FGCGCookedCardCatalog::WriteToFile(const FGCGCardCatalog& Catalog, const FString& FilePath, FString& OutError)
+{
+	TArray<uint8> Blob;
+	Serialize(Catalog, Blob);
+
+	if (!FFileHelper::SaveArrayToFile(Blob, *FilePath))
+	{
+		OutError = FString::Printf(TEXT("Failed to write cooked catalog: %s"), *FilePath);
+		return false;
+	}
+
+	return true;
+}
+
+// ===== LOADING =====
+
+bool FGCGCookedCardCatalog::Open(const FString& FilePath, FString& OutError)
+{
+	Close();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*FilePath);
+	if (MappedResult.HasValue())
+	{
+		MappedHandle = MappedResult.StealValue();
+		MappedRegion.Reset(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
+	}
+
+	if (MappedRegion.IsValid())
+	{
+		Data = MappedRegion->GetMappedPtr();
+		DataSize = MappedRegion->GetMappedSize();
+	}
+	else
+	{
+		// Platform can't map this file - read it instead
+		MappedHandle.Reset();
+		if (!FFileHelper::LoadFileToArray(FallbackBuffer, *FilePath))
+		{
+			OutError = FString::Printf(TEXT("Failed to open cooked catalog: %s"), *FilePath);
+			return false;
+		}
+		Data = FallbackBuffer.GetData();
+		DataSize = FallbackBuffer.Num();
+	}
+
+	Header = DataSize >= static_cast<int64>(sizeof(FGCGCookedCatalogHeader))
+		? reinterpret_cast<const FGCGCookedCatalogHeader*>(Data)
+		: nullptr;
+
+	if (!Validate(OutError))
+	{
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+void FGCGCookedCardCatalog::Close()
+{
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+	FallbackBuffer.Empty();
+
+	Data = nullptr;
+	DataSize = 0;
+	Header = nullptr;
+}
+
+bool FGCGCookedCardCatalog::Validate(FString& OutError) const
+{
+	if (!Header)
+	{
+		OutError = TEXT("Cooked catalog is smaller than its header");
+		return false;
+	}
+
+	if (Header->Magic != GCGCookedCatalog::Magic)
+	{
+		OutError = TEXT("Not a cooked card catalog (bad magic)");
+		return false;
+	}
+
+	if (Header->Version != GCGCookedCatalog::Version)
+	{
+		OutError = FString::Printf(TEXT("Cooked catalog version %u, expected %u - re-run the cook"),
+			Header->Version, GCGCookedCatalog::Version);
+		return false;
+	}
+
+	if (Header->TotalSize != DataSize)
+	{
+		OutError = FString::Printf(TEXT("Cooked catalog size mismatch (header %u, file %lld)"), Header->TotalSize, DataSize);
+		return false;
+	}
+
+	auto SectionFits = [this](const FGCGCookedRange& Section, uint64 ElementSize)
+	{
+		return Section.First % 4 == 0 && static_cast<uint64>(Section.First) + Section.Num * ElementSize <= static_cast<uint64>(DataSize);
+	};
+
+	if (!SectionFits(Header->Cards, sizeof(FGCGCookedCardRecord))
+		|| !SectionFits(Header->Keywords, sizeof(FGCGCookedKeyword))
+		|| !SectionFits(Header->Effects, sizeof(FGCGCookedEffect))
+		|| !SectionFits(Header->Clauses, sizeof(FGCGCookedClause))
+		|| !SectionFits(Header->CompiledEffects, sizeof(FGCGCompiledEffect))
+		|| !SectionFits(Header->Code, sizeof(FGCGEffectInstruction))
+		|| !SectionFits(Header->Words, sizeof(uint32))
+		|| !SectionFits(Header->HashTable, sizeof(uint16))
+		|| !SectionFits(Header->Strings, sizeof(uint8)))
+	{
+		OutError = TEXT("Cooked catalog section out of bounds");
+		return false;
+	}
+
+	if (Header->Cards.Num != Header->NumCards || Header->NumCards >= GCG_INVALID_CARD_ID)
+	{
+		OutError = TEXT("Cooked catalog card count is invalid");
+		return false;
+	}
+
+	if (!FMath::IsPowerOfTwo(Header->HashTable.Num) || Header->HashTable.Num <= Header->NumCards)
+	{
+		OutError = TEXT("Cooked catalog hash table is invalid");
+		return false;
+	}
+
+	if (Header->Strings.Num == 0 || Data[Header->Strings.First] != 0 || Data[Header->Strings.First + Header->Strings.Num - 1] != 0)
+	{
+		OutError = TEXT("Cooked catalog string pool is not terminated");
+		return false;
+	}
+
+	return true;
+}
+
+// ===== DIRECT ACCESS =====
+
+const FGCGCookedCardRecord* FGCGCookedCardCatalog::GetRecord(FGCGCardId CardId) const
+{
+	if (!Header || CardId >= Header->NumCards)
+	{
+		return nullptr;
+	}
+
+	return reinterpret_cast<const FGCGCookedCardRecord*>(Data + Header->Cards.First) + CardId;
+}
+
+FGCGCardId FGCGCookedCardCatalog::FindCardId(FName CardNumber) const
+{
+	if (!Header || CardNumber.IsNone())
+	{
+		return GCG_INVALID_CARD_ID;
+	}
+
+	const FTCHARToUTF8 Utf8(*CardNumber.ToString());
+	const ANSICHAR* Key = reinterpret_cast<const ANSICHAR*>(Utf8.Get());
+	const int32 KeyLength = Utf8.Length();
+
+	const uint16* Table = reinterpret_cast<const uint16*>(Data + Header->HashTable.First);
+	const uint32 Mask = Header->HashTable.Num - 1;
+
+	for (uint32 Slot = HashCardNumber(Key, KeyLength) & Mask, Probes = 0; Probes <= Mask; Slot = (Slot + 1) & Mask, ++Probes)
+	{
+		const uint16 CardId = Table[Slot];
+		if (CardId == GCGCookedCatalog::EmptySlot)
+		{
+			break;
+		}
+
+		const FGCGCookedCardRecord* Record = GetRecord(CardId);
+		if (Record && CardNumbersMatch(reinterpret_cast<const ANSICHAR*>(GetString(Record->CardNumber)), Key, KeyLength))
+		{
+			return CardId;
+		}
+	}
+
+	return GCG_INVALID_CARD_ID;
+}
+
+const UTF8CHAR* FGCGCookedCardCatalog::GetString(uint32 Offset) const
+{
+	if (!Header || Offset >= Header->Strings.Num)
+	{
+		// Offset 0 is always the empty string
+		Offset = 0;
+	}
+
+	return reinterpret_cast<const UTF8CHAR*>(Data + Header->Strings.First + Offset);
+}
+
+FString FGCGCookedCardCatalog::GetFString(uint32 Offset) const
+{
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(GetString(Offset)));
+	return FString(Converted.Length(), Converted.Get());
+}
+
+FName FGCGCookedCardCatalog::GetName(uint32 Offset) const
+{
+	return Offset == 0 ? FName(NAME_None) : FName(*GetFString(Offset));
+}
+
+bool FGCGCookedCardCatalog::ContainsString(TConstArrayView<uint32> Offsets, FName Name) const
+{
+	if (Name.IsNone())
+	{
+		return Offsets.Contains(0u);
+	}
+
+	const FTCHARToUTF8 Utf8(*Name.ToString());
+	const ANSICHAR* Key = reinterpret_cast<const ANSICHAR*>(Utf8.Get());
+
+	for (uint32 Offset : Offsets)
+	{
+		if (CardNumbersMatch(reinterpret_cast<const ANSICHAR*>(GetString(Offset)), Key, Utf8.Length()))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// ===== MATERIALIZATION =====
+
+bool FGCGCookedCardCatalog::MaterializeCard(FGCGCardId CardId, FGCGCardData& OutCard) const
+{
+	const FGCGCookedCardRecord* Record = GetRecord(CardId);
+	if (!Record)
+	{
+		return false;
+	}
+
+	auto ToName = [this](uint32 Offset)
+	{
+		return GetName(Offset);
+	};
+
+	OutCard = FGCGCardData();
+
+	OutCard.CardNumber = ToName(Record->CardNumber);
+	OutCard.CardName = FText::FromString(GetFString(Record->CardName));
+	OutCard.CardType = static_cast<EGCGCardType>(Record->CardType);
+	OutCard.Level = Record->Level;
+	OutCard.Cost = Record->Cost;
+	OutCard.AP = Record->AP;
+	OutCard.HP = Record->HP;
+	OutCard.bCanBePilot = Record->bCanBePilot != 0;
+	OutCard.CardText = FText::FromString(GetFString(Record->CardText));
+	OutCard.FlavorText = FText::FromString(GetFString(Record->FlavorText));
+	OutCard.Set = ToName(Record->Set);
+	OutCard.Rarity = ToName(Record->Rarity);
+	OutCard.CollectorNumber = Record->CollectorNumber;
+
+	if (Record->CardArt != 0)
+	{
+		OutCard.CardArt = TSoftObjectPtr<UTexture2D>(FSoftObjectPath(GetFString(Record->CardArt)));
+	}
+
+	for (uint32 Color : GetWords(Record->Colors))
+	{
+		OutCard.Colors.Add(static_cast<EGCGCardColor>(Color));
+	}
+	for (uint32 Trait : GetWords(Record->Traits))
+	{
+		OutCard.Traits.Add(ToName(Trait));
+	}
+
+	OutCard.LinkRequirement.SpecificCardNumber = ToName(Record->LinkSpecificCard);
+	for (uint32 Color : GetWords(Record->LinkColors))
+	{
+		OutCard.LinkRequirement.RequiredColors.Add(static_cast<EGCGCardColor>(Color));
+	}
+	for (uint32 Trait : GetWords(Record->LinkTraits))
+	{
+		OutCard.LinkRequirement.RequiredTraits.Add(ToName(Trait));
+	}
+
+	for (const FGCGCookedKeyword& Keyword : GetKeywords(Record->Keywords))
+	{
+		OutCard.Keywords.Add(FGCGKeywordInstance(static_cast<EGCGKeyword>(Keyword.Keyword), Keyword.Value));
+	}
+
+	auto ToParams = [this](const FGCGCookedRange& Range)
+	{
+		TArray<FString> Params;
+		for (uint32 Param : GetWords(Range))
+		{
+			Params.Add(GetFString(Param));
+		}
+		return Params;
+	};
+
+	for (const FGCGCookedEffect& CookedEffect : GetEffects(Record->Effects))
+	{
+		FGCGEffectData& Effect = OutCard.Effects.AddDefaulted_GetRef();
+		Effect.Timing = static_cast<EGCGEffectTiming>(CookedEffect.Timing);
+		Effect.bOncePerTurn = CookedEffect.bOncePerTurn != 0;
+		Effect.Description = FText::FromString(GetFString(CookedEffect.Description));
+
+		for (const FGCGCookedClause& Clause : GetClauses(CookedEffect.Conditions))
+		{
+			FGCGEffectCondition& Condition = Effect.Conditions.AddDefaulted_GetRef();
+			Condition.ConditionType = ToName(Clause.Type);
+			Condition.Parameters = ToParams(Clause.Params);
+		}
+
+		for (const FGCGCookedClause& Clause : GetClauses(CookedEffect.Costs))
+		{
+			FGCGEffectCost& Cost = Effect.Costs.AddDefaulted_GetRef();
+			Cost.CostType = ToName(Clause.Type);
+			Cost.Amount = Clause.Amount;
+			Cost.ActivationCost = Clause.ActivationCost;
+			Cost.Parameters = ToParams(Clause.Params);
+		}
+
+		for (const FGCGCookedClause& Clause : GetClauses(CookedEffect.Operations))
+		{
+			FGCGEffectOperation& Operation = Effect.Operations.AddDefaulted_GetRef();
+			Operation.OperationType = ToName(Clause.Type);
+			Operation.Target = ToName(Clause.Target);
+			Operation.TargetScope = static_cast<EGCGTargetScope>(Clause.TargetScope);
+			Operation.bRequiresTarget = Clause.bRequiresTarget != 0;
+			Operation.Amount = Clause.Amount;
+			Operation.Duration = static_cast<EGCGModifierDuration>(Clause.Duration);
+			Operation.Parameters = ToParams(Clause.Params);
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,288 @@
+// GCGCookedCardCatalog.h - Cooked Binary Card Catalog
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Versioned, position-independent card catalog blob that is memory-mapped at load
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GundamTCG/GCGTypes.h"
+#include "GundamTCG/Cards/GCGEffectProgram.h"
+
+class FGCGCardCatalog;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+// ===========================================================================================
+// ON-DISK LAYOUT
+// ===========================================================================================
+//
+// [Header][Card records][Keywords][Effects][Clauses][Compiled effects][Code][Words][Hash table][String pool]
+//
+// - Every section starts on a 4-byte boundary; all offsets are bytes from the blob start
+// - Strings are UTF-8, NUL-terminated, referenced by pool offset (offset 0 = empty string)
+// - Variable-length lists (colors, traits, parameters) are ranges into the Words section
+// - Effects are stored pre-parsed: conditions, costs and operations are flat clause records
+// - Each card's effects are also stored compiled (FGCGCompiledEffect + FGCGEffectInstruction,
+//   exactly as FGCGCardCatalog holds them), with instruction ranges into the Code section
+// - The hash table maps a case-insensitive hash of CardNumber to a CardId (open addressing)
+//
+// Bump GCGCookedCatalog::Version whenever any record layout changes.
+
+namespace GCGCookedCatalog
+{
+	/** 'GCAT' */
+	inline constexpr uint32 Magic = 0x54414347;
+
+	/** Current blob format version */
+	inline constexpr uint32 Version = 2;
+
+	/** Empty slot marker in the hash table */
+	inline constexpr uint16 EmptySlot = GCG_INVALID_CARD_ID;
+}
+
+/** First element + element count (or byte offset + count for header sections) */
+struct FGCGCookedRange
+{
+	uint32 First = 0;
+	uint32 Num = 0;
+};
+
+struct FGCGCookedCatalogHeader
+{
+	uint32 Magic;
+	uint32 Version;
+	uint32 TotalSize;
+	uint32 NumCards;
+
+	// Section byte offsets and element counts
+	FGCGCookedRange Cards;
+	FGCGCookedRange Keywords;
+	FGCGCookedRange Effects;
+	FGCGCookedRange Clauses;
+	FGCGCookedRange CompiledEffects;
+	FGCGCookedRange Code;
+	FGCGCookedRange Words;
+	FGCGCookedRange HashTable;
+	FGCGCookedRange Strings;
+};
+
+/** Fixed-size card record (one per card, indexed by CardId) */
+struct FGCGCookedCardRecord
+{
+	// String pool offsets
+	uint32 CardNumber;
+	uint32 CardName;
+	uint32 CardText;
+	uint32 FlavorText;
+	uint32 CardArt;
+	uint32 Set;
+	uint32 Rarity;
+	uint32 LinkSpecificCard;
+
+	// Stats
+	int32 Level;
+	int32 Cost;
+	int32 AP;
+	int32 HP;
+	int32 CollectorNumber;
+
+	// Ranges into Words (enum values or string offsets)
+	FGCGCookedRange Colors;
+	FGCGCookedRange Traits;
+	FGCGCookedRange LinkColors;
+	FGCGCookedRange LinkTraits;
+
+	// Ranges into the Keywords / Effects / Compiled effects sections
+	FGCGCookedRange Keywords;
+	FGCGCookedRange Effects;
+	FGCGCookedRange CompiledEffects;
+
+	/** Timings the card has compiled effects for (GetEffectTimingBit) */
+	uint32 EffectTimings;
+
+	uint8 CardType;
+	uint8 bCanBePilot;
+	uint8 Padding[2];
+};
+
+struct FGCGCookedKeyword
+{
+	uint8 Keyword;
+	uint8 Padding[3];
+	int32 Value;
+};
+
+/** Pre-parsed effect: ranges into the Clauses section */
+struct FGCGCookedEffect
+{
+	uint8 Timing;
+	uint8 bOncePerTurn;
+	uint8 Padding[2];
+	uint32 Description;
+	FGCGCookedRange Conditions;
+	FGCGCookedRange Costs;
+	FGCGCookedRange Operations;
+};
+
+/** Condition, cost or operation (unused fields are zero) */
+struct FGCGCookedClause
+{
+	uint32 Type;
+	uint32 Target;
+	int32 Amount;
+	int32 ActivationCost;
+	FGCGCookedRange Params;
+	uint8 TargetScope;
+	uint8 bRequiresTarget;
+	uint8 Duration;
+	uint8 Padding;
+};
+
+static_assert(sizeof(FGCGCookedCardRecord) % 4 == 0, "Cooked records must keep 4-byte alignment");
+static_assert(sizeof(FGCGCookedEffect) % 4 == 0, "Cooked records must keep 4-byte alignment");
+static_assert(sizeof(FGCGCookedClause) % 4 == 0, "Cooked records must keep 4-byte alignment");
+static_assert(sizeof(FGCGCompiledEffect) == 12 && std::is_trivially_copyable_v<FGCGCompiledEffect>,
+	"FGCGCompiledEffect is stored in the blob as-is - bump GCGCookedCatalog::Version if it changes");
+static_assert(std::is_trivially_copyable_v<FGCGEffectInstruction>,
+	"FGCGEffectInstruction is stored in the blob as-is - bump GCGCookedCatalog::Version if it changes");
+
+/**
+ * Cooked Card Catalog
+ *
+ * Reader/writer for the binary catalog blob produced by the GCGCookCardCatalog commandlet.
+ *
+ * Open() memory-maps the file read-only, so every process serving the same blob shares
+ * one physical copy through the OS page cache. Records, strings, effect clauses and the
+ * compiled effect programs are read in place - nothing is parsed or compiled at load.
+ * FGCGCardCatalog::BuildFromCooked serves its lookups (FGCGCardView, GetEffects,
+ * GetEffectCode) straight from this mapping; MaterializeCard() only expands a record
+ * for callers that need a full FGCGCardData row.
+ *
+ * CardIds here are blob indices (card pool only, no tokens).
+ */
+class GUNDAMTCG_API FGCGCookedCardCatalog
+{
+public:
+	FGCGCookedCardCatalog();
+	~FGCGCookedCardCatalog();
+
+	FGCGCookedCardCatalog(const FGCGCookedCardCatalog&) = delete;
+	FGCGCookedCardCatalog& operator=(const FGCGCookedCardCatalog&) = delete;
+
+	// ===== COOKING =====
+
+	/**
+	 * Serialize a built catalog's card pool (tokens are left out) with its compiled effects
+	 * @param Catalog The catalog to cook (pool cards in CardId order)
+	 * @param OutBlob The serialized blob
+	 */
+	static void Serialize(const FGCGCardCatalog& Catalog, TArray<uint8>& OutBlob);
+
+	/**
+	 * Serialize a built catalog's card pool and write the blob to disk
+	 * @param Catalog The catalog to cook
+	 * @param FilePath Destination file
+	 * @param OutError Error message on failure
+	 * @return True if the file was written
+	 */
+	static bool WriteToFile(const FGCGCardCatalog& Catalog, const FString& FilePath, FString& OutError);
+
+	// ===== LOADING =====
+
+	/**
+	 * Memory-map a cooked blob and validate its header
+	 * Falls back to reading the file into memory if the platform cannot map it.
+	 * @param FilePath The .gcgcat file to open
+	 * @param OutError Error message on failure
+	 * @return True if the blob is open and valid
+	 */
+	bool Open(const FString& FilePath, FString& OutError);
+
+	/**
+	 * Unmap the blob
+	 */
+	void Close();
+
+	bool IsOpen() const { return Data != nullptr; }
+
+	/** Was the blob memory-mapped (false = read into memory)? */
+	bool IsMapped() const { return MappedRegion.IsValid(); }
+
+	// ===== DIRECT ACCESS =====
+
+	/** Number of cards in the blob */
+	int32 Num() const { return Header ? static_cast<int32>(Header->NumCards) : 0; }
+
+	/**
+	 * Get a card record in place
+	 * @param CardId Blob index
+	 * @return Record, or nullptr if out of range
+	 */
+	const FGCGCookedCardRecord* GetRecord(FGCGCardId CardId) const;
+
+	/**
+	 * Find a card by number (case-insensitive, through the blob's hash table)
+	 * @param CardNumber The card number to find
+	 * @return Blob index, or GCG_INVALID_CARD_ID if not found
+	 */
+	FGCGCardId FindCardId(FName CardNumber) const;
+
+	/** Get a pooled UTF-8 string in place */
+	const UTF8CHAR* GetString(uint32 Offset) const;
+
+	/** Pooled string as an FString / FName (converted, so keep out of hot loops) */
+	FString GetFString(uint32 Offset) const;
+	FName GetName(uint32 Offset) const;
+
+	/** Is a name among these pooled strings (e.g. a record's Traits words)? Case-insensitive, like FName */
+	bool ContainsString(TConstArrayView<uint32> Offsets, FName Name) const;
+
+	TConstArrayView<uint32> GetWords(const FGCGCookedRange& Range) const { return GetSection<uint32>(Header->Words, Range); }
+	TConstArrayView<FGCGCookedKeyword> GetKeywords(const FGCGCookedRange& Range) const { return GetSection<FGCGCookedKeyword>(Header->Keywords, Range); }
+	TConstArrayView<FGCGCookedEffect> GetEffects(const FGCGCookedRange& Range) const { return GetSection<FGCGCookedEffect>(Header->Effects, Range); }
+	TConstArrayView<FGCGCookedClause> GetClauses(const FGCGCookedRange& Range) const { return GetSection<FGCGCookedClause>(Header->Clauses, Range); }
+	TConstArrayView<FGCGCompiledEffect> GetCompiledEffects(const FGCGCookedRange& Range) const { return GetSection<FGCGCompiledEffect>(Header->CompiledEffects, Range); }
+
+	/** Instructions of one compiled effect from GetCompiledEffects */
+	TConstArrayView<FGCGEffectInstruction> GetCode(const FGCGCompiledEffect& Effect) const
+	{
+		return GetSection<FGCGEffectInstruction>(Header->Code,
+			FGCGCookedRange{ static_cast<uint32>(Effect.FirstInstruction), static_cast<uint32>(Effect.NumInstructions) });
+	}
+
+	// ===== MATERIALIZATION =====
+
+	/**
+	 * Expand one record into FGCGCardData (a heap copy - the rules read FGCGCardView instead)
+	 * @param CardId Blob index
+	 * @param OutCard The expanded card
+	 * @return True if the CardId was valid
+	 */
+	bool MaterializeCard(FGCGCardId CardId, FGCGCardData& OutCard) const;
+
+private:
+	template <typename RecordType>
+	TConstArrayView<RecordType> GetSection(const FGCGCookedRange& Section, const FGCGCookedRange& Range) const
+	{
+		if (!Data || static_cast<uint64>(Range.First) + Range.Num > Section.Num)
+		{
+			return TConstArrayView<RecordType>();
+		}
+		const RecordType* Base = reinterpret_cast<const RecordType*>(Data + Section.First);
+		return TConstArrayView<RecordType>(Base + Range.First, Range.Num);
+	}
+
+	/** Check header, section bounds and string pool termination */
+	bool Validate(FString& OutError) const;
+
+	/** Mapping (kept alive while the blob is open; region is released before the handle) */
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	/** Used only when the platform cannot map the file */
+	TArray64<uint8> FallbackBuffer;
+
+	const uint8* Data = nullptr;
+	int64 DataSize = 0;
+	const FGCGCookedCatalogHeader* Header = nullptr;
+};
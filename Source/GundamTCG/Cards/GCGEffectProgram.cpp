@@ -0,0 +1,311 @@
+// GCGEffectProgram.cpp - Compiled Card Effects Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGEffectProgram.h"
+#include "GCGCardCsvImporter.h"
+
+namespace
+{
+	/** Every name the compiler understands, built once */
+	struct FEffectNames
+	{
+		// Conditions
+		const FName YourTurn{TEXT("YourTurn")};
+		const FName OpponentTurn{TEXT("OpponentTurn")};
+		const FName HasActiveResources{TEXT("HasActiveResources")};
+
+		// Costs
+		const FName RestResources{TEXT("RestResources")};
+		const FName RestThisUnit{TEXT("RestThisUnit")};
+		const FName TrashSelf{TEXT("TrashSelf")};
+
+		// Operations
+		const FName Draw{TEXT("Draw")};
+		const FName DealDamageToPlayer{TEXT("DealDamageToPlayer")};
+		const FName DealDamageToUnit{TEXT("DealDamageToUnit")};
+		const FName DestroyUnit{TEXT("DestroyUnit")};
+		const FName GiveAP{TEXT("GiveAP")};
+		const FName GiveHP{TEXT("GiveHP")};
+		const FName GrantKeyword{TEXT("GrantKeyword")};
+
+		// Targets
+		const FName Self{TEXT("Self")};
+		const FName SourcePlayer{TEXT("SourcePlayer")};
+		const FName OpponentPlayer{TEXT("OpponentPlayer")};
+		const FName TargetUnit{TEXT("TargetUnit")};
+		const FName FriendlyUnit{TEXT("FriendlyUnit")};
+	};
+
+	const FEffectNames& GetEffectNames()
+	{
+		static const FEffectNames Names;
+		return Names;
+	}
+
+	bool ParseCount(const FString& Text, int32& OutValue)
+	{
+		const FString Trimmed = Text.TrimStartAndEnd();
+		if (Trimmed.IsEmpty() || !Trimmed.IsNumeric() || Trimmed.Contains(TEXT(".")))
+		{
+			return false;
+		}
+
+		OutValue = FCString::Atoi(*Trimmed);
+		return OutValue >= 0;
+	}
+
+	bool CompileCondition(const FGCGEffectCondition& Condition, TArray<FGCGEffectInstruction>& Code, FString& OutError)
+	{
+		const FEffectNames& Names = GetEffectNames();
+
+		if (Condition.ConditionType == Names.YourTurn)
+		{
+			Code.Emplace(EGCGEffectOp::IfYourTurn);
+		}
+		else if (Condition.ConditionType == Names.OpponentTurn)
+		{
+			Code.Emplace(EGCGEffectOp::IfOpponentTurn);
+		}
+		else if (Condition.ConditionType == Names.HasActiveResources)
+		{
+			int32 Required = 1;
+			if (Condition.Parameters.Num() > 0 && !ParseCount(Condition.Parameters[0], Required))
+			{
+				OutError = FString::Printf(TEXT("HasActiveResources needs a resource count, got '%s'"), *Condition.Parameters[0]);
+				return false;
+			}
+			Code.Emplace(EGCGEffectOp::IfActiveResources, Required);
+		}
+		else
+		{
+			OutError = FString::Printf(TEXT("Unknown condition type '%s'"), *Condition.ConditionType.ToString());
+			return false;
+		}
+
+		return true;
+	}
+
+	bool CompileOperation(const FGCGEffectOperation& Operation, TArray<FGCGEffectInstruction>& Code, FString& OutError)
+	{
+		const FEffectNames& Names = GetEffectNames();
+		const FName Type = Operation.OperationType;
+		const FName TargetName = Operation.Target;
+
+		// ----- Player operations -----
+		if (Type == Names.Draw || Type == Names.DealDamageToPlayer)
+		{
+			EGCGEffectTarget Target = EGCGEffectTarget::SourcePlayer;
+			if (TargetName == Names.OpponentPlayer || (TargetName.IsNone() && Type == Names.DealDamageToPlayer))
+			{
+				Target = EGCGEffectTarget::OpponentPlayer;
+			}
+			else if (!TargetName.IsNone() && TargetName != Names.Self && TargetName != Names.SourcePlayer)
+			{
+				OutError = FString::Printf(TEXT("%s needs a player target, got '%s'"), *Type.ToString(), *TargetName.ToString());
+				return false;
+			}
+
+			if (Operation.Amount < 0)
+			{
+				OutError = FString::Printf(TEXT("%s has a negative amount (%d)"), *Type.ToString(), Operation.Amount);
+				return false;
+			}
+
+			Code.Emplace(Type == Names.Draw ? EGCGEffectOp::Draw : EGCGEffectOp::DealDamageToPlayer, Operation.Amount, Target);
+			return true;
+		}
+
+		// ----- Unit operations -----
+		EGCGEffectOp Op;
+		uint8 Arg = 0;
+		int32 Operand = Operation.Amount;
+		bool bBuff = false;
+
+		if (Type == Names.DealDamageToUnit)
+		{
+			Op = EGCGEffectOp::DealDamageToUnit;
+		}
+		else if (Type == Names.DestroyUnit)
+		{
+			Op = EGCGEffectOp::DestroyUnit;
+		}
+		else if (Type == Names.GiveAP || Type == Names.GiveHP)
+		{
+			Op = Type == Names.GiveAP ? EGCGEffectOp::GiveAP : EGCGEffectOp::GiveHP;
+			Arg = static_cast<uint8>(Operation.Duration);
+			bBuff = true;
+		}
+		else if (Type == Names.GrantKeyword)
+		{
+			FGCGKeywordInstance Keyword;
+			FString KeywordError;
+			if (Operation.Parameters.Num() == 0)
+			{
+				OutError = TEXT("GrantKeyword needs a keyword parameter");
+				return false;
+			}
+			if (!FGCGCardCsvImporter::ParseKeyword(Operation.Parameters[0], Keyword, KeywordError))
+			{
+				OutError = FString::Printf(TEXT("GrantKeyword: %s"), *KeywordError);
+				return false;
+			}
+
+			Op = EGCGEffectOp::GrantKeyword;
+			Arg = static_cast<uint8>(Keyword.Keyword);
+			Operand = FMath::Max(Keyword.Value, Operation.Amount);
+			bBuff = true;
+		}
+		else
+		{
+			OutError = FString::Printf(TEXT("Unknown operation type '%s'"), *Type.ToString());
+			return false;
+		}
+
+		if (Type == Names.DealDamageToUnit && Operation.Amount < 0)
+		{
+			OutError = FString::Printf(TEXT("DealDamageToUnit has a negative amount (%d)"), Operation.Amount);
+			return false;
+		}
+
+		// Untargeted: debuffs and removal go to the enemy, buffs to our own side
+		EGCGEffectTarget Target;
+		if (TargetName == Names.Self)
+		{
+			Target = EGCGEffectTarget::Self;
+		}
+		else if (TargetName == Names.FriendlyUnit)
+		{
+			Target = EGCGEffectTarget::FriendlyUnit;
+		}
+		else if (TargetName.IsNone() || TargetName == Names.TargetUnit)
+		{
+			Target = (bBuff && Operation.Amount >= 0) ? EGCGEffectTarget::FriendlyUnit : EGCGEffectTarget::EnemyUnit;
+		}
+		else
+		{
+			OutError = FString::Printf(TEXT("%s needs a unit target, got '%s'"), *Type.ToString(), *TargetName.ToString());
+			return false;
+		}
+
+		Code.Emplace(Op, Operand, Target, Arg);
+		return true;
+	}
+}
+
+bool FGCGEffectCompiler::Compile(const FGCGEffectData& Effect, TArray<FGCGEffectInstruction>& OutCode, FString& OutError)
+{
+	const FEffectNames& Names = GetEffectNames();
+
+	TArray<FGCGEffectInstruction, TInlineAllocator<16>> Code;
+
+	// ----- Checks -----
+	for (const FGCGEffectCondition& Condition : Effect.Conditions)
+	{
+		if (!CompileCondition(Condition, Code, OutError))
+		{
+			return false;
+		}
+	}
+
+	if (Effect.bOncePerTurn)
+	{
+		Code.Emplace(EGCGEffectOp::IfNotActivatedThisTurn);
+	}
+
+	int32 ResourceCost = 0;
+	bool bRestSource = false;
+	bool bTrashSource = false;
+	for (const FGCGEffectCost& Cost : Effect.Costs)
+	{
+		if (Cost.ActivationCost < 0 || Cost.Amount < 0)
+		{
+			OutError = FString::Printf(TEXT("Cost '%s' has a negative amount"), *Cost.CostType.ToString());
+			return false;
+		}
+
+		ResourceCost += Cost.ActivationCost;
+		if (Cost.CostType == Names.RestResources)
+		{
+			ResourceCost += Cost.Amount;
+		}
+		else if (Cost.CostType == Names.RestThisUnit)
+		{
+			bRestSource = true;
+		}
+		else if (Cost.CostType == Names.TrashSelf)
+		{
+			bTrashSource = true;
+		}
+		else if (!Cost.CostType.IsNone())
+		{
+			OutError = FString::Printf(TEXT("Unknown cost type '%s'"), *Cost.CostType.ToString());
+			return false;
+		}
+	}
+
+	if (ResourceCost > 0)
+	{
+		Code.Emplace(EGCGEffectOp::CanPayResources, ResourceCost);
+	}
+	if (bRestSource)
+	{
+		Code.Emplace(EGCGEffectOp::CanRestSource);
+	}
+	if (bTrashSource)
+	{
+		Code.Emplace(EGCGEffectOp::CanTrashSource);
+	}
+
+	// ----- Payments -----
+	if (ResourceCost > 0)
+	{
+		Code.Emplace(EGCGEffectOp::PayResources, ResourceCost);
+	}
+	Code.Emplace(EGCGEffectOp::CountActivation);
+	if (bRestSource)
+	{
+		Code.Emplace(EGCGEffectOp::RestSource);
+	}
+	if (bTrashSource)
+	{
+		Code.Emplace(EGCGEffectOp::TrashSource);
+	}
+
+	// ----- Operations -----
+	for (const FGCGEffectOperation& Operation : Effect.Operations)
+	{
+		if (!CompileOperation(Operation, Code, OutError))
+		{
+			return false;
+		}
+	}
+
+	OutCode.Append(Code);
+	return true;
+}
+
+const TCHAR* FGCGEffectCompiler::GetOpName(EGCGEffectOp Op)
+{
+	switch (Op)
+	{
+	case EGCGEffectOp::IfYourTurn:				return TEXT("IfYourTurn");
+	case EGCGEffectOp::IfOpponentTurn:			return TEXT("IfOpponentTurn");
+	case EGCGEffectOp::IfActiveResources:		return TEXT("IfActiveResources");
+	case EGCGEffectOp::IfNotActivatedThisTurn:	return TEXT("IfNotActivatedThisTurn");
+	case EGCGEffectOp::CanPayResources:			return TEXT("CanPayResources");
+	case EGCGEffectOp::CanRestSource:			return TEXT("CanRestSource");
+	case EGCGEffectOp::CanTrashSource:			return TEXT("CanTrashSource");
+	case EGCGEffectOp::PayResources:			return TEXT("PayResources");
+	case EGCGEffectOp::CountActivation:			return TEXT("CountActivation");
+	case EGCGEffectOp::RestSource:				return TEXT("RestSource");
+	case EGCGEffectOp::TrashSource:				return TEXT("TrashSource");
+	case EGCGEffectOp::Draw:					return TEXT("Draw");
+	case EGCGEffectOp::DealDamageToPlayer:		return TEXT("DealDamageToPlayer");
+	case EGCGEffectOp::DealDamageToUnit:		return TEXT("DealDamageToUnit");
+	case EGCGEffectOp::DestroyUnit:				return TEXT("DestroyUnit");
+	case EGCGEffectOp::GiveAP:					return TEXT("GiveAP");
+	case EGCGEffectOp::GiveHP:					return TEXT("GiveHP");
+	case EGCGEffectOp::GrantKeyword:			return TEXT("GrantKeyword");
+	default:									return TEXT("Unknown");
+	}
+}
@@ -0,0 +1,184 @@
+// GCGEffectProgram.h - Compiled Card Effects
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// FGCGEffectData rows compiled to flat, validated instruction streams at catalog build time
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GundamTCG/GCGTypes.h"
+
+/**
+ * Effect opcode
+ *
+ * A program runs top to bottom in three blocks: checks (conditions and cost
+ * checks - the first that fails stops the effect, nothing has changed yet),
+ * payments, then operations.
+ */
+enum class EGCGEffectOp : uint8
+{
+	// ===== Checks =====
+
+	/** Source player is the active player */
+	IfYourTurn,
+
+	/** Source player is not the active player */
+	IfOpponentTurn,
+
+	/** Source player has at least Operand active resources */
+	IfActiveResources,
+
+	/** Source card hasn't resolved an effect this turn */
+	IfNotActivatedThisTurn,
+
+	/** Source player can rest Operand resources */
+	CanPayResources,
+
+	/** Source card is an active card in the Battle Area */
+	CanRestSource,
+
+	/** Source card is still somewhere on its owner's board */
+	CanTrashSource,
+
+	// ===== Payments =====
+
+	/** Rest Operand active resources */
+	PayResources,
+
+	/** Count the activation on the source card (for IfNotActivatedThisTurn) */
+	CountActivation,
+
+	/** Rest the source card */
+	RestSource,
+
+	/** Move the source card to its owner's Trash */
+	TrashSource,
+
+	// ===== Operations =====
+
+	/** Target player draws Operand cards */
+	Draw,
+
+	/** Operand damage to the target player */
+	DealDamageToPlayer,
+
+	/** Operand effect damage to the target unit */
+	DealDamageToUnit,
+
+	/** Destroy the target unit */
+	DestroyUnit,
+
+	/** Operand AP for Arg (EGCGModifierDuration) to the target unit */
+	GiveAP,
+
+	/** Operand HP for Arg (EGCGModifierDuration) to the target unit */
+	GiveHP,
+
+	/** Temporary keyword Arg (EGCGKeyword) with value Operand to the target unit */
+	GrantKeyword
+};
+
+/**
+ * Who an operation acts on, resolved at compile time from the row's Target name
+ */
+enum class EGCGEffectTarget : uint8
+{
+	/** No target (checks and payments) */
+	None,
+
+	/** The source card */
+	Self,
+
+	/** The source card's controller */
+	SourcePlayer,
+
+	/** The source card's opponent */
+	OpponentPlayer,
+
+	/** The triggering target, else the strongest enemy unit */
+	EnemyUnit,
+
+	/** The triggering target, else the strongest friendly unit */
+	FriendlyUnit
+};
+
+/**
+ * One instruction (8 bytes)
+ */
+struct FGCGEffectInstruction
+{
+	EGCGEffectOp Op = EGCGEffectOp::IfYourTurn;
+	EGCGEffectTarget Target = EGCGEffectTarget::None;
+
+	/** Op-specific enum operand (modifier duration, keyword) */
+	uint8 Arg = 0;
+
+	/** Integer operand (amount, count) */
+	int32 Operand = 0;
+
+	FGCGEffectInstruction() = default;
+
+	FGCGEffectInstruction(EGCGEffectOp InOp, int32 InOperand = 0, EGCGEffectTarget InTarget = EGCGEffectTarget::None, uint8 InArg = 0)
+		: Op(InOp), Target(InTarget), Arg(InArg), Operand(InOperand)
+	{
+	}
+};
+
+static_assert(sizeof(FGCGEffectInstruction) == 8, "FGCGEffectInstruction should stay 8 bytes");
+
+/** Number of EGCGEffectTiming values (timing masks and per-timing tables) */
+inline constexpr int32 GCGNumEffectTimings = static_cast<int32>(EGCGEffectTiming::Continuous) + 1;
+
+static_assert(GCGNumEffectTimings <= 32, "Effect timing masks are uint32");
+
+/** Bit of a timing in a timing mask */
+inline constexpr uint32 GetEffectTimingBit(EGCGEffectTiming Timing)
+{
+	return 1u << static_cast<uint32>(Timing);
+}
+
+/**
+ * One compiled effect: its timing and a range of instructions
+ */
+struct FGCGCompiledEffect
+{
+	EGCGEffectTiming Timing = EGCGEffectTiming::None;
+
+	/** Index of the source row in FGCGCardData::Effects (for its Description) */
+	uint16 EffectIndex = 0;
+
+	/** Range in the owner's instruction array */
+	int32 FirstInstruction = 0;
+	int32 NumInstructions = 0;
+};
+
+/**
+ * Effect Compiler
+ *
+ * Turns one FGCGEffectData into instructions. Names are matched once here:
+ *
+ *   Conditions: YourTurn, OpponentTurn, HasActiveResources[:N = 1]
+ *   Costs:      RestResources (Amount), RestThisUnit, TrashSelf, plus any ActivationCost
+ *   Operations: Draw, DealDamageToPlayer, DealDamageToUnit, DestroyUnit, GiveAP, GiveHP,
+ *               GrantKeyword (Parameters[0] = "Name" or "Name(Value)")
+ *   Targets:    None, Self, SourcePlayer, OpponentPlayer, TargetUnit, FriendlyUnit
+ *
+ * Resource costs are summed into one check and one payment. Anything else -
+ * an unknown name, a non-numeric parameter, a negative amount, a keyword that
+ * doesn't parse, a unit operation aimed at a player - is a compile error, so a
+ * malformed effect is rejected when the catalog is built instead of quietly
+ * failing mid-game.
+ */
+struct GUNDAMTCG_API FGCGEffectCompiler
+{
+	/**
+	 * Compile an effect
+	 * @param Effect The effect row
+	 * @param OutCode Instructions are appended here (left untouched on error)
+	 * @param OutError Why the effect was rejected
+	 * @return True if the effect compiled
+	 */
+	static bool Compile(const FGCGEffectData& Effect, TArray<FGCGEffectInstruction>& OutCode, FString& OutError);
+
+	/** Opcode name, for logs */
+	static const TCHAR* GetOpName(EGCGEffectOp Op);
+};
@@ -0,0 +1,102 @@
+// GCGCookCardCatalogCommandlet.cpp - Card Catalog Cook Step Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGCookCardCatalogCommandlet.h"
+#include "Engine/DataTable.h"
+#include "GundamTCG/Cards/GCGCardCatalog.h"
+#include "GundamTCG/Cards/GCGCardCsvImporter.h"
+#include "GundamTCG/Cards/GCGCookedCardCatalog.h"
+#include "GundamTCG/Subsystems/GCGCardDatabase.h"
+
+UGCGCookCardCatalogCommandlet::UGCGCookCardCatalogCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UGCGCookCardCatalogCommandlet::Main(const FString& Params)
+{
+	FString DataTablePath = TEXT("/Game/Cards/Data/DT_Cards.DT_Cards");
+	FString OutputPath = UGCGCardDatabase::GetDefaultCookedCatalogPath();
+
+	FString CsvPath;
+	FParse::Value(*Params, TEXT("DataTable="), DataTablePath);
+	FParse::Value(*Params, TEXT("Csv="), CsvPath);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	TArray<FGCGCardData> Rows;
+
+	if (!CsvPath.IsEmpty())
+	{
+		FGCGCsvImportResult ImportResult;
+		if (!FGCGCardCsvImporter::ImportFile(CsvPath, ImportResult))
+		{
+			for (const FGCGCsvImportError& Error : ImportResult.Errors)
+			{
+				UE_LOG(LogTemp, Error, TEXT("UGCGCookCardCatalogCommandlet::Main - %s: %s"), *CsvPath, *Error.ToString());
+			}
+			return 1;
+		}
+
+		for (const FGCGCsvImportError& Warning : ImportResult.Warnings)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UGCGCookCardCatalogCommandlet::Main - %s: %s"), *CsvPath, *Warning.ToString());
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("UGCGCookCardCatalogCommandlet::Main - Imported %d rows from %s in %.1f ms"),
+			ImportResult.RowsRead, *CsvPath, ImportResult.Seconds * 1000.0);
+
+		Rows = MoveTemp(ImportResult.Cards);
+	}
+	else
+	{
+		UDataTable* CardTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
+		if (!CardTable)
+		{
+			UE_LOG(LogTemp, Error, TEXT("UGCGCookCardCatalogCommandlet::Main - Failed to load DataTable: %s"), *DataTablePath);
+			return 1;
+		}
+
+		if (CardTable->GetRowStruct() != FGCGCardData::StaticStruct())
+		{
+			UE_LOG(LogTemp, Error, TEXT("UGCGCookCardCatalogCommandlet::Main - %s does not use FGCGCardData rows"), *DataTablePath);
+			return 1;
+		}
+
+		TArray<FGCGCardData*> AllRows;
+		CardTable->GetAllRows<FGCGCardData>(TEXT("CookCardCatalog"), AllRows);
+
+		Rows.Reserve(AllRows.Num());
+		for (const FGCGCardData* Row : AllRows)
+		{
+			if (Row)
+			{
+				Rows.Add(*Row);
+			}
+		}
+	}
+
+	// Build first so the blob gets the same duplicate handling as a runtime load
+	FGCGCardCatalog Catalog;
+	TArray<FString> BuildErrors;
+	Catalog.Build(MoveTemp(Rows), 0, BuildErrors);
+
+	for (const FString& Error : BuildErrors)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UGCGCookCardCatalogCommandlet::Main - %s"), *Error);
+	}
+
+	FString WriteError;
+	if (!FGCGCookedCardCatalog::WriteToFile(Catalog, OutputPath, WriteError))
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGCGCookCardCatalogCommandlet::Main - %s"), *WriteError);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("UGCGCookCardCatalogCommandlet::Main - Cooked %d cards to %s"),
+		Catalog.Num(), *OutputPath);
+
+	return 0;
+}
@@ -0,0 +1,34 @@
+// GCGCookCardCatalogCommandlet.h - Card Catalog Cook Step
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Offline step that writes the card DataTable to a cooked, memory-mappable catalog blob
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GCGCookCardCatalogCommandlet.generated.h"
+
+/**
+ * Cook Card Catalog Commandlet
+ *
+ * Usage:
+ *   UnrealEditor-Cmd GundamTCG.uproject -run=GCGCookCardCatalog
+ *     [-DataTable=/Game/Cards/Data/DT_Cards.DT_Cards | -Csv=<path to card CSV>]
+ *     [-Output=<ProjectContent>/Cards/Data/CardCatalog.gcgcat]
+ *
+ * Loads every FGCGCardData row (from the DataTable, or straight from a CSV via
+ * FGCGCardCsvImporter - any import error fails the cook), builds the catalog
+ * (duplicate/empty card numbers are reported and dropped) and serializes it with
+ * FGCGCookedCardCatalog.
+ * Tokens are not cooked - UGCGCardDatabase adds them at load.
+ */
+UCLASS()
+class UGCGCookCardCatalogCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGCGCookCardCatalogCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,355 @@
+// GCGSimulateMatchesCommandlet.cpp - Batch Match Simulation Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGSimulateMatchesCommandlet.h"
+#include "Dom/JsonObject.h"
+#include "Engine/DataTable.h"
+#include "GundamTCG/Cards/GCGCardCatalog.h"
+#include "GundamTCG/Cards/GCGCardCsvImporter.h"
+#include "GundamTCG/Cards/GCGCookedCardCatalog.h"
+#include "GundamTCG/Core/GCGMatchSimulator.h"
+#include "GundamTCG/Subsystems/GCGCardDatabase.h"
+#include "HAL/FileManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+UGCGSimulateMatchesCommandlet::UGCGSimulateMatchesCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UGCGSimulateMatchesCommandlet::Main(const FString& Params)
+{
+	FString DeckAPath;
+	FString DeckBPath;
+	FString DifficultyAName = TEXT("Medium");
+	FString DifficultyBName = TEXT("Medium");
+	FString SeedRange;
+	FString SearchParallelism = TEXT("Tree");
+	FString DataTablePath;
+	FString CsvPath;
+	FString OutputDir = FPaths::ProjectSavedDir() / TEXT("Simulations") / FDateTime::Now().ToString();
+
+	FGCGSimulationConfig Config;
+
+	// Expert AI searches a fixed number of iterations so batches replay from their seeds
+	Config.Search.TimeBudgetSeconds = 0.0f;
+	Config.Search.MaxIterations = 200;
+
+	FParse::Value(*Params, TEXT("DeckA="), DeckAPath);
+	FParse::Value(*Params, TEXT("DeckB="), DeckBPath);
+	FParse::Value(*Params, TEXT("AIA="), DifficultyAName);
+	FParse::Value(*Params, TEXT("AIB="), DifficultyBName);
+	FParse::Value(*Params, TEXT("Seeds="), SeedRange);
+	FParse::Value(*Params, TEXT("FirstSeed="), Config.FirstSeed);
+	FParse::Value(*Params, TEXT("Matches="), Config.NumMatches);
+	FParse::Value(*Params, TEXT("Threads="), Config.NumThreads);
+	FParse::Value(*Params, TEXT("MaxTurns="), Config.MaxTurns);
+	FParse::Value(*Params, TEXT("SearchIterations="), Config.Search.MaxIterations);
+	FParse::Value(*Params, TEXT("SearchTime="), Config.Search.TimeBudgetSeconds);
+	FParse::Value(*Params, TEXT("SearchThreads="), Config.Search.NumThreads);
+	FParse::Value(*Params, TEXT("SearchParallel="), SearchParallelism);
+	FParse::Value(*Params, TEXT("DataTable="), DataTablePath);
+	FParse::Value(*Params, TEXT("Csv="), CsvPath);
+	FParse::Value(*Params, TEXT("Output="), OutputDir);
+
+	if (DeckAPath.IsEmpty() || DeckBPath.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGCGSimulateMatchesCommandlet::Main - Both -DeckA= and -DeckB= are required"));
+		return 1;
+	}
+
+	if (!ParseDifficulty(DifficultyAName, Config.DifficultyA) || !ParseDifficulty(DifficultyBName, Config.DifficultyB))
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGCGSimulateMatchesCommandlet::Main - Unknown difficulty (AIA=%s, AIB=%s)"),
+			*DifficultyAName, *DifficultyBName);
+		return 1;
+	}
+
+	if (SearchParallelism.Equals(TEXT("Root"), ESearchCase::IgnoreCase))
+	{
+		Config.Search.Parallelism = EGCGSearchParallelism::Root;
+	}
+	else if (SearchParallelism.Equals(TEXT("Tree"), ESearchCase::IgnoreCase))
+	{
+		Config.Search.Parallelism = EGCGSearchParallelism::Tree;
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGCGSimulateMatchesCommandlet::Main - Unknown -SearchParallel=%s (expected Root or Tree)"), *SearchParallelism);
+		return 1;
+	}
+
+	// -Seeds=First-Last overrides -FirstSeed/-Matches
+	if (!SeedRange.IsEmpty())
+	{
+		FString FirstText;
+		FString LastText;
+		if (!SeedRange.Split(TEXT("-"), &FirstText, &LastText) || !FirstText.IsNumeric() || !LastText.IsNumeric())
+		{
+			UE_LOG(LogTemp, Error, TEXT("UGCGSimulateMatchesCommandlet::Main - Invalid -Seeds=%s (expected First-Last)"), *SeedRange);
+			return 1;
+		}
+
+		const uint64 FirstSeed = FCString::Strtoui64(*FirstText, nullptr, 10);
+		const uint64 LastSeed = FCString::Strtoui64(*LastText, nullptr, 10);
+		if (LastSeed < FirstSeed || LastSeed - FirstSeed >= uint64(MAX_int32))
+		{
+			UE_LOG(LogTemp, Error, TEXT("UGCGSimulateMatchesCommandlet::Main - Invalid -Seeds=%s"), *SeedRange);
+			return 1;
+		}
+
+		Config.FirstSeed = FirstSeed;
+		Config.NumMatches = int32(LastSeed - FirstSeed + 1);
+	}
+
+	if (Config.NumMatches <= 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGCGSimulateMatchesCommandlet::Main - Nothing to simulate (Matches=%d)"), Config.NumMatches);
+		return 1;
+	}
+
+	FString DeckError;
+	if (!LoadDeckList(DeckAPath, Config.DeckA, DeckError) || !LoadDeckList(DeckBPath, Config.DeckB, DeckError))
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGCGSimulateMatchesCommandlet::Main - %s"), *DeckError);
+		return 1;
+	}
+
+	const FGCGCardCatalogPtr Catalog = LoadCatalog(CsvPath, DataTablePath, { &Config.DeckA, &Config.DeckB });
+	if (!Catalog.IsValid())
+	{
+		return 1;
+	}
+
+	// ===== Simulate =====
+
+	UE_LOG(LogTemp, Display, TEXT("UGCGSimulateMatchesCommandlet::Main - %s (%s) vs %s (%s), seeds %llu-%llu"),
+		*Config.DeckA.DeckName.ToString(), *DifficultyAName, *Config.DeckB.DeckName.ToString(), *DifficultyBName,
+		Config.FirstSeed, Config.FirstSeed + Config.NumMatches - 1);
+
+	const FGCGMatchSimulator Simulator(Catalog);
+	const FGCGSimulationStats Stats = Simulator.Run(Config);
+
+	UE_LOG(LogTemp, Display, TEXT("UGCGSimulateMatchesCommandlet::Main - %d matches in %.2f s (%.0f matches/s)"),
+		Stats.NumMatches, Stats.Seconds, Stats.GetMatchesPerSecond());
+	UE_LOG(LogTemp, Display, TEXT("UGCGSimulateMatchesCommandlet::Main - %s: %.1f%%, %s: %.1f%%, draws: %d"),
+		*Config.DeckA.DeckName.ToString(), Stats.GetWinRate(0) * 100.0,
+		*Config.DeckB.DeckName.ToString(), Stats.GetWinRate(1) * 100.0, Stats.Draws);
+	UE_LOG(LogTemp, Display, TEXT("UGCGSimulateMatchesCommandlet::Main - First player wins %.1f%%, average %.1f turns (min %d, max %d)"),
+		Stats.GetFirstPlayerWinRate() * 100.0, Stats.GetAverageTurns(), Stats.MinTurns, Stats.MaxTurns);
+
+	// ===== Output =====
+
+	IFileManager::Get().MakeDirectory(*OutputDir, true);
+
+	const FString SummaryPath = OutputDir / TEXT("Summary.json");
+	const FString MatchesPath = OutputDir / TEXT("Matches.csv");
+	const FString CardsPath = OutputDir / TEXT("Cards.csv");
+
+	if (!FFileHelper::SaveStringToFile(Stats.ToJson(), *SummaryPath)
+		|| !FFileHelper::SaveStringToFile(Stats.ToMatchesCsv(), *MatchesPath)
+		|| !FFileHelper::SaveStringToFile(Stats.ToCardsCsv(), *CardsPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGCGSimulateMatchesCommandlet::Main - Failed to write results to %s"), *OutputDir);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("UGCGSimulateMatchesCommandlet::Main - Results written to %s"), *OutputDir);
+
+	return 0;
+}
+
+bool UGCGSimulateMatchesCommandlet::LoadDeckList(const FString& FilePath, FGCGDeckList& OutDeck, FString& OutError)
+{
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *FilePath))
+	{
+		OutError = FString::Printf(TEXT("Failed to read deck file %s"), *FilePath);
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+	{
+		OutError = FString::Printf(TEXT("%s is not valid JSON"), *FilePath);
+		return false;
+	}
+
+	FString DeckName = FPaths::GetBaseFilename(FilePath);
+	Root->TryGetStringField(TEXT("Name"), DeckName);
+	OutDeck.DeckName = FText::FromString(DeckName);
+
+	// "GD01-001" adds one copy, "4x GD01-001" adds four
+	auto ReadCards = [&Root](const TCHAR* Field, TArray<FName>& OutCards)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+		if (!Root->TryGetArrayField(Field, Entries))
+		{
+			return;
+		}
+
+		for (const TSharedPtr<FJsonValue>& Entry : *Entries)
+		{
+			FString Text = Entry->AsString().TrimStartAndEnd();
+
+			int32 Copies = 1;
+			FString CountText;
+			FString CardText;
+			if (Text.Split(TEXT("x "), &CountText, &CardText) && CountText.IsNumeric())
+			{
+				Copies = FCString::Atoi(*CountText);
+				Text = CardText.TrimStart();
+			}
+
+			for (int32 i = 0; i < Copies; ++i)
+			{
+				OutCards.Add(FName(*Text));
+			}
+		}
+	};
+
+	ReadCards(TEXT("MainDeck"), OutDeck.MainDeck);
+	ReadCards(TEXT("ResourceDeck"), OutDeck.ResourceDeck);
+
+	if (OutDeck.MainDeck.Num() == 0)
+	{
+		OutError = FString::Printf(TEXT("%s has no MainDeck cards"), *FilePath);
+		return false;
+	}
+
+	return true;
+}
+
+FGCGCardCatalogPtr UGCGSimulateMatchesCommandlet::LoadCatalog(const FString& CsvPath, const FString& DataTablePath, TConstArrayView<const FGCGDeckList*> Decks)
+{
+	// Tokens first, as UGCGCardDatabase does, so their CardIds match a live session
+	TArray<FGCGCardData> Rows;
+	Rows.Add(UGCGCardDatabase::CreateEXBaseTokenData());
+	Rows.Add(UGCGCardDatabase::CreateEXResourceTokenData());
+	const int32 TokenRowCount = Rows.Num();
+
+	TSharedRef<FGCGCardCatalog, ESPMode::ThreadSafe> Catalog = MakeShared<FGCGCardCatalog, ESPMode::ThreadSafe>();
+	TArray<FString> BuildErrors;
+	bool bFromCooked = false;
+
+	if (!CsvPath.IsEmpty())
+	{
+		FGCGCsvImportResult ImportResult;
+		if (!FGCGCardCsvImporter::ImportFile(CsvPath, ImportResult))
+		{
+			for (const FGCGCsvImportError& Error : ImportResult.Errors)
+			{
+				UE_LOG(LogTemp, Error, TEXT("UGCGSimulateMatchesCommandlet::LoadCatalog - %s: %s"), *CsvPath, *Error.ToString());
+			}
+			return nullptr;
+		}
+
+		for (const FGCGCsvImportError& Warning : ImportResult.Warnings)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UGCGSimulateMatchesCommandlet::LoadCatalog - %s: %s"), *CsvPath, *Warning.ToString());
+		}
+
+		Rows.Append(MoveTemp(ImportResult.Cards));
+	}
+	else if (!DataTablePath.IsEmpty())
+	{
+		UDataTable* CardTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
+		if (!CardTable || CardTable->GetRowStruct() != FGCGCardData::StaticStruct())
+		{
+			UE_LOG(LogTemp, Error, TEXT("UGCGSimulateMatchesCommandlet::LoadCatalog - Failed to load FGCGCardData DataTable: %s"), *DataTablePath);
+			return nullptr;
+		}
+
+		TArray<FGCGCardData*> AllRows;
+		CardTable->GetAllRows<FGCGCardData>(TEXT("SimulateMatches"), AllRows);
+
+		for (const FGCGCardData* Row : AllRows)
+		{
+			if (Row)
+			{
+				Rows.Add(*Row);
+			}
+		}
+	}
+	else
+	{
+		const FString CookedPath = UGCGCardDatabase::GetDefaultCookedCatalogPath();
+
+		TSharedRef<FGCGCookedCardCatalog, ESPMode::ThreadSafe> Cooked = MakeShared<FGCGCookedCardCatalog, ESPMode::ThreadSafe>();
+		FString OpenError;
+		if (!Cooked->Open(CookedPath, OpenError))
+		{
+			UE_LOG(LogTemp, Error, TEXT("UGCGSimulateMatchesCommandlet::LoadCatalog - %s (pass -Csv= or -DataTable=, or run -run=GCGCookCardCatalog)"), *OpenError);
+			return nullptr;
+		}
+
+		// Serve the pool from the mapped blob; only the token rows are owned
+		Catalog->BuildFromCooked(MoveTemp(Rows), Cooked, BuildErrors);
+		bFromCooked = true;
+	}
+
+	if (!bFromCooked)
+	{
+		Catalog->Build(MoveTemp(Rows), TokenRowCount, BuildErrors);
+	}
+
+	for (const FString& Error : BuildErrors)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UGCGSimulateMatchesCommandlet::LoadCatalog - %s"), *Error);
+	}
+
+	// Every card in every deck must resolve, or the engine would silently skip it
+	bool bDecksValid = true;
+	for (const FGCGDeckList* Deck : Decks)
+	{
+		for (const TArray<FName>* Cards : { &Deck->MainDeck, &Deck->ResourceDeck })
+		{
+			for (const FName& CardNumber : *Cards)
+			{
+				if (Catalog->FindCardId(CardNumber) == GCG_INVALID_CARD_ID)
+				{
+					UE_LOG(LogTemp, Error, TEXT("UGCGSimulateMatchesCommandlet::LoadCatalog - %s: unknown card %s"),
+						*Deck->DeckName.ToString(), *CardNumber.ToString());
+					bDecksValid = false;
+				}
+			}
+		}
+	}
+
+	if (!bDecksValid)
+	{
+		return nullptr;
+	}
+
+	return Catalog;
+}
+
+bool UGCGSimulateMatchesCommandlet::ParseDifficulty(const FString& Name, EGCGAIDifficulty& OutDifficulty)
+{
+	static const TPair<const TCHAR*, EGCGAIDifficulty> Names[] =
+	{
+		{ TEXT("Random"), EGCGAIDifficulty::Random },
+		{ TEXT("Easy"), EGCGAIDifficulty::Easy },
+		{ TEXT("Medium"), EGCGAIDifficulty::Medium },
+		{ TEXT("Hard"), EGCGAIDifficulty::Hard },
+		{ TEXT("Expert"), EGCGAIDifficulty::Expert },
+	};
+
+	for (const TPair<const TCHAR*, EGCGAIDifficulty>& Entry : Names)
+	{
+		if (Name.Equals(Entry.Key, ESearchCase::IgnoreCase))
+		{
+			OutDifficulty = Entry.Value;
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,63 @@
+// GCGSimulateMatchesCommandlet.h - Batch Match Simulation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Offline tool that plays thousands of AI-vs-AI matches to tune decks and the AI
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GundamTCG/AI/GCGAIController.h"
+#include "GundamTCG/Cards/GCGCardCatalog.h"
+#include "GCGSimulateMatchesCommandlet.generated.h"
+
+/**
+ * Simulate Matches Commandlet
+ *
+ * Usage:
+ *   UnrealEditor-Cmd GundamTCG.uproject -run=GCGSimulateMatches
+ *     -DeckA=<deck.json> -DeckB=<deck.json>
+ *     [-AIA=Random|Easy|Medium|Hard|Expert] [-AIB=Random|Easy|Medium|Hard|Expert]
+ *     [-Seeds=<First>-<Last> | -FirstSeed=<N> -Matches=<N>]
+ *     [-Threads=<N>] [-MaxTurns=<N>]
+ *     [-SearchIterations=<N, default 200>] [-SearchTime=<seconds, default 0 = none>]
+ *     [-SearchThreads=<N, default 1>] [-SearchParallel=Root|Tree]
+ *     [-Output=<ProjectSaved>/Simulations/<timestamp>]
+ *     [-DataTable=/Game/Cards/Data/DT_Cards.DT_Cards | -Csv=<path to card CSV>]
+ *
+ * Deck files are JSON: { "Name": "...", "MainDeck": ["GD01-001", ...], "ResourceDeck": [...] }
+ * (a card appears once per copy; "4x GD01-001" is also accepted).
+ *
+ * Cards come from the CSV or DataTable if given, else the cooked catalog
+ * (see UGCGCookCardCatalogCommandlet). Matches run on FGCGMatchSimulator and
+ * write Summary.json, Matches.csv and Cards.csv to the output directory.
+ *
+ * Expert AI searches -SearchIterations per decision; a -SearchTime budget
+ * also stops it early but makes results depend on machine load. Matches
+ * already run one per core, so -SearchThreads above 1 only pays off with
+ * fewer -Threads (and gives up exact replays).
+ */
+UCLASS()
+class UGCGSimulateMatchesCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGCGSimulateMatchesCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+	// ===== Shared with the other offline AI tools =====
+
+	/** Load a deck list from a JSON file */
+	static bool LoadDeckList(const FString& FilePath, FGCGDeckList& OutDeck, FString& OutError);
+
+	/** Parse a difficulty name (case-insensitive) */
+	static bool ParseDifficulty(const FString& Name, EGCGAIDifficulty& OutDifficulty);
+
+	/**
+	 * Build the card catalog from a CSV, a DataTable or the cooked catalog (see class comment)
+	 * @param Decks Every card of these must resolve
+	 * @return The catalog, or null (errors are logged)
+	 */
+	static FGCGCardCatalogPtr LoadCatalog(const FString& CsvPath, const FString& DataTablePath, TConstArrayView<const FGCGDeckList*> Decks);
+};
@@ -0,0 +1,412 @@
+// GCGTuneAIWeightsCommandlet.cpp - AI Weight Tuning Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGTuneAIWeightsCommandlet.h"
+#include "GCGSimulateMatchesCommandlet.h"
+#include "Dom/JsonObject.h"
+#include "GundamTCG/Core/GCGMatchSimulator.h"
+#include "HAL/FileManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+	/**
+	 * Elo difference implied by a match score, with a 95% confidence interval
+	 */
+	struct FGCGEloEstimate
+	{
+		int32 Matches = 0;
+		double Score = 0.5;
+		double Elo = 0.0;
+		double EloLow = 0.0;
+		double EloHigh = 0.0;
+	};
+
+	double ScoreToElo(double Score)
+	{
+		// Keep a clean sweep finite
+		Score = FMath::Clamp(Score, 0.001, 0.999);
+		return -400.0 * FMath::LogX(10.0, 1.0 / Score - 1.0);
+	}
+
+	FGCGEloEstimate EstimateElo(int32 Wins, int32 Draws, int32 Matches)
+	{
+		FGCGEloEstimate Estimate;
+		Estimate.Matches = Matches;
+		if (Matches <= 0)
+		{
+			return Estimate;
+		}
+
+		const int32 Losses = Matches - Wins - Draws;
+		const double Score = (Wins + 0.5 * Draws) / Matches;
+
+		// Standard error of the mean per-match score (1, 0.5 or 0)
+		const double Variance = (Wins * FMath::Square(1.0 - Score) + Draws * FMath::Square(0.5 - Score) + Losses * FMath::Square(Score)) / Matches;
+		const double StdError = FMath::Sqrt(Variance / Matches);
+
+		Estimate.Score = Score;
+		Estimate.Elo = ScoreToElo(Score);
+		Estimate.EloLow = ScoreToElo(Score - 1.96 * StdError);
+		Estimate.EloHigh = ScoreToElo(Score + 1.96 * StdError);
+		return Estimate;
+	}
+}
+
+UGCGTuneAIWeightsCommandlet::UGCGTuneAIWeightsCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UGCGTuneAIWeightsCommandlet::Main(const FString& Params)
+{
+	FString DeckAPath;
+	FString DeckBPath;
+	FString DifficultyName = TEXT("Hard");
+	FString BaselinePath;
+	FString DataTablePath;
+	FString CsvPath;
+	FString OutputDir = FPaths::ProjectSavedDir() / TEXT("AITuning") / FDateTime::Now().ToString();
+	int32 Iterations = 100;
+	int32 MatchesPerStep = 200;
+	int32 FinalMatches = 2000;
+	float StepSize = 0.05f;
+	float Perturbation = 0.1f;
+	uint64 Seed = 1;
+
+	FGCGSimulationConfig Config;
+
+	FParse::Value(*Params, TEXT("DeckA="), DeckAPath);
+	FParse::Value(*Params, TEXT("DeckB="), DeckBPath);
+	FParse::Value(*Params, TEXT("AI="), DifficultyName);
+	FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	FParse::Value(*Params, TEXT("MatchesPerStep="), MatchesPerStep);
+	FParse::Value(*Params, TEXT("FinalMatches="), FinalMatches);
+	FParse::Value(*Params, TEXT("StepSize="), StepSize);
+	FParse::Value(*Params, TEXT("Perturbation="), Perturbation);
+	FParse::Value(*Params, TEXT("Threads="), Config.NumThreads);
+	FParse::Value(*Params, TEXT("MaxTurns="), Config.MaxTurns);
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	FParse::Value(*Params, TEXT("DataTable="), DataTablePath);
+	FParse::Value(*Params, TEXT("Csv="), CsvPath);
+	FParse::Value(*Params, TEXT("Output="), OutputDir);
+
+	if (DeckAPath.IsEmpty() || DeckBPath.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGCGTuneAIWeightsCommandlet::Main - Both -DeckA= and -DeckB= are required"));
+		return 1;
+	}
+
+	// Weights only steer the heuristic difficulties; Random ignores them and Expert is too slow to tune with
+	EGCGAIDifficulty Difficulty = EGCGAIDifficulty::Hard;
+	if (!UGCGSimulateMatchesCommandlet::ParseDifficulty(DifficultyName, Difficulty)
+		|| Difficulty == EGCGAIDifficulty::Random || Difficulty == EGCGAIDifficulty::Expert)
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGCGTuneAIWeightsCommandlet::Main - Invalid -AI=%s (expected Easy, Medium or Hard)"), *DifficultyName);
+		return 1;
+	}
+	Config.DifficultyA = Difficulty;
+	Config.DifficultyB = Difficulty;
+
+	if (Iterations < 0 || MatchesPerStep <= 0 || FinalMatches <= 0 || StepSize <= 0.0f || Perturbation <= 0.0f)
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGCGTuneAIWeightsCommandlet::Main - Invalid settings (Iterations=%d, MatchesPerStep=%d, FinalMatches=%d, StepSize=%.3f, Perturbation=%.3f)"),
+			Iterations, MatchesPerStep, FinalMatches, StepSize, Perturbation);
+		return 1;
+	}
+
+	FString Error;
+	if (!UGCGSimulateMatchesCommandlet::LoadDeckList(DeckAPath, Config.DeckA, Error)
+		|| !UGCGSimulateMatchesCommandlet::LoadDeckList(DeckBPath, Config.DeckB, Error))
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGCGTuneAIWeightsCommandlet::Main - %s"), *Error);
+		return 1;
+	}
+
+	FGCGAIWeights Baseline;
+	if (!BaselinePath.IsEmpty() && !LoadWeights(BaselinePath, Baseline, Error))
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGCGTuneAIWeightsCommandlet::Main - %s"), *Error);
+		return 1;
+	}
+
+	const FGCGCardCatalogPtr Catalog = UGCGSimulateMatchesCommandlet::LoadCatalog(CsvPath, DataTablePath, { &Config.DeckA, &Config.DeckB });
+	if (!Catalog.IsValid())
+	{
+		return 1;
+	}
+
+	const FGCGMatchSimulator Simulator(Catalog);
+	const double StartTime = FPlatformTime::Seconds();
+
+	// ===== SPSA =====
+
+	const TArray<const FFloatProperty*> Tunable = GetTunableWeights(DifficultyName);
+	const int32 NumWeights = Tunable.Num();
+
+	// Search in normalized coordinates: weight = baseline + scale * x
+	TArray<double> Origin;
+	TArray<double> Scale;
+	TArray<double> X;
+	TArray<double> Delta;
+	Origin.SetNumUninitialized(NumWeights);
+	Scale.SetNumUninitialized(NumWeights);
+	X.SetNumZeroed(NumWeights);
+	Delta.SetNumZeroed(NumWeights);
+
+	for (int32 i = 0; i < NumWeights; ++i)
+	{
+		Origin[i] = Tunable[i]->GetPropertyValue_InContainer(&Baseline);
+		Scale[i] = FMath::Max(FMath::Abs(Origin[i]), 1.0);
+	}
+
+	auto MakeWeights = [&](double Sign, double Step)
+	{
+		FGCGAIWeights Weights = Baseline;
+		for (int32 i = 0; i < NumWeights; ++i)
+		{
+			const double Value = Origin[i] + Scale[i] * (X[i] + Sign * Step * Delta[i]);
+			Tunable[i]->SetPropertyValue_InContainer(&Weights, float(FMath::Max(Value, 0.0)));
+		}
+		return Weights;
+	};
+
+	TStringBuilder<4096> Trace;
+	Trace << TEXT("Iteration,StepSize,Perturbation,ScorePlus");
+	for (const FFloatProperty* Property : Tunable)
+	{
+		Trace << TEXT(",") << Property->GetName();
+	}
+	Trace << TEXT("\n");
+
+	UE_LOG(LogTemp, Display, TEXT("UGCGTuneAIWeightsCommandlet::Main - Tuning %d weights: %d iterations of %d matches (%s vs %s, %s)"),
+		NumWeights, Iterations, 2 * MatchesPerStep, *Config.DeckA.DeckName.ToString(), *Config.DeckB.DeckName.ToString(), *DifficultyName);
+
+	FGCGRandomStream Random(Seed);
+	const double Stability = Iterations / 10.0;
+	Config.NumMatches = MatchesPerStep;
+
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		const double Ak = StepSize / FMath::Pow(Iteration + 1 + Stability, 0.602);
+		const double Ck = Perturbation / FMath::Pow(Iteration + 1.0, 0.101);
+
+		for (double& D : Delta)
+		{
+			D = Random.RandRange(0, 1) ? 1.0 : -1.0;
+		}
+
+		const FGCGAIWeights Plus = MakeWeights(1.0, Ck);
+		const FGCGAIWeights Minus = MakeWeights(-1.0, Ck);
+
+		// Fresh seeds every iteration, shared by both assignments
+		Config.FirstSeed = Seed + uint64(Iteration) * uint64(MatchesPerStep);
+
+		int32 Wins = 0;
+		int32 Draws = 0;
+		PlayBothSides(Simulator, Config, Plus, Minus, Wins, Draws);
+
+		const int32 Matches = 2 * MatchesPerStep;
+		const double ScorePlus = (Wins + 0.5 * Draws) / Matches;
+
+		// Score(+) - Score(-), in [-1, 1]
+		const double Difference = 2.0 * ScorePlus - 1.0;
+		for (int32 i = 0; i < NumWeights; ++i)
+		{
+			X[i] += Ak * Difference / (2.0 * Ck * Delta[i]);
+		}
+
+		Trace.Appendf(TEXT("%d,%.5f,%.5f,%.4f"), Iteration, Ak, Ck, ScorePlus);
+		const FGCGAIWeights Current = MakeWeights(0.0, 0.0);
+		for (const FFloatProperty* Property : Tunable)
+		{
+			Trace.Appendf(TEXT(",%.4f"), Property->GetPropertyValue_InContainer(&Current));
+		}
+		Trace << TEXT("\n");
+
+		UE_LOG(LogTemp, Display, TEXT("UGCGTuneAIWeightsCommandlet::Main - Iteration %d/%d: perturbed + scored %.3f against -"),
+			Iteration + 1, Iterations, ScorePlus);
+	}
+
+	const FGCGAIWeights Tuned = MakeWeights(0.0, 0.0);
+
+	// ===== Evaluate against the baseline =====
+
+	// Seeds the tuning never saw
+	Config.FirstSeed = Seed + uint64(Iterations) * uint64(MatchesPerStep);
+	Config.NumMatches = FinalMatches;
+
+	int32 FinalWins = 0;
+	int32 FinalDraws = 0;
+	PlayBothSides(Simulator, Config, Tuned, Baseline, FinalWins, FinalDraws);
+
+	const FGCGEloEstimate Elo = EstimateElo(FinalWins, FinalDraws, 2 * FinalMatches);
+	const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogTemp, Display, TEXT("UGCGTuneAIWeightsCommandlet::Main - Tuned vs baseline: %d wins, %d draws, %d losses (score %.3f)"),
+		FinalWins, FinalDraws, Elo.Matches - FinalWins - FinalDraws, Elo.Score);
+	UE_LOG(LogTemp, Display, TEXT("UGCGTuneAIWeightsCommandlet::Main - Elo %+.1f (95%% CI %+.1f to %+.1f), %.1f s"),
+		Elo.Elo, Elo.EloLow, Elo.EloHigh, Seconds);
+
+	for (int32 i = 0; i < NumWeights; ++i)
+	{
+		const float Value = Tunable[i]->GetPropertyValue_InContainer(&Tuned);
+		if (!FMath::IsNearlyEqual(Value, float(Origin[i])))
+		{
+			UE_LOG(LogTemp, Display, TEXT("UGCGTuneAIWeightsCommandlet::Main -   %s: %.2f -> %.2f"),
+				*Tunable[i]->GetName(), Origin[i], Value);
+		}
+	}
+
+	// ===== Output =====
+
+	FString Report;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Report);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("DeckA"), Config.DeckA.DeckName.ToString());
+	Writer->WriteValue(TEXT("DeckB"), Config.DeckB.DeckName.ToString());
+	Writer->WriteValue(TEXT("AI"), DifficultyName);
+	Writer->WriteValue(TEXT("Baseline"), BaselinePath.IsEmpty() ? FString(TEXT("Default")) : BaselinePath);
+	Writer->WriteValue(TEXT("Seed"), FString::Printf(TEXT("%llu"), Seed));
+	Writer->WriteValue(TEXT("Iterations"), Iterations);
+	Writer->WriteValue(TEXT("MatchesPerStep"), 2 * MatchesPerStep);
+	Writer->WriteValue(TEXT("StepSize"), StepSize);
+	Writer->WriteValue(TEXT("Perturbation"), Perturbation);
+	Writer->WriteValue(TEXT("Seconds"), Seconds);
+	Writer->WriteObjectStart(TEXT("Evaluation"));
+	Writer->WriteValue(TEXT("Matches"), Elo.Matches);
+	Writer->WriteValue(TEXT("Wins"), FinalWins);
+	Writer->WriteValue(TEXT("Draws"), FinalDraws);
+	Writer->WriteValue(TEXT("Score"), Elo.Score);
+	Writer->WriteValue(TEXT("Elo"), Elo.Elo);
+	Writer->WriteValue(TEXT("EloLow95"), Elo.EloLow);
+	Writer->WriteValue(TEXT("EloHigh95"), Elo.EloHigh);
+	Writer->WriteObjectEnd();
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	IFileManager::Get().MakeDirectory(*OutputDir, true);
+
+	const FString WeightsPath = OutputDir / TEXT("Weights.json");
+	const FString TracePath = OutputDir / TEXT("Trace.csv");
+	const FString ReportPath = OutputDir / TEXT("Report.json");
+
+	if (!FFileHelper::SaveStringToFile(WeightsToJson(Tuned), *WeightsPath)
+		|| !FFileHelper::SaveStringToFile(Trace.ToString(), *TracePath)
+		|| !FFileHelper::SaveStringToFile(Report, *ReportPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGCGTuneAIWeightsCommandlet::Main - Failed to write results to %s"), *OutputDir);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("UGCGTuneAIWeightsCommandlet::Main - Results written to %s"), *OutputDir);
+
+	return 0;
+}
+
+bool UGCGTuneAIWeightsCommandlet::LoadWeights(const FString& Path, FGCGAIWeights& OutWeights, FString& OutError)
+{
+	// Asset path
+	if (!FPaths::GetExtension(Path).Equals(TEXT("json"), ESearchCase::IgnoreCase))
+	{
+		const UGCGAIWeightsAsset* Asset = LoadObject<UGCGAIWeightsAsset>(nullptr, *Path);
+		if (!Asset)
+		{
+			OutError = FString::Printf(TEXT("Failed to load UGCGAIWeightsAsset %s"), *Path);
+			return false;
+		}
+
+		OutWeights = Asset->Weights;
+		return true;
+	}
+
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *Path))
+	{
+		OutError = FString::Printf(TEXT("Failed to read weights file %s"), *Path);
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+	{
+		OutError = FString::Printf(TEXT("%s is not valid JSON"), *Path);
+		return false;
+	}
+
+	// Missing weights keep their defaults
+	OutWeights = FGCGAIWeights();
+	for (TFieldIterator<FFloatProperty> It(FGCGAIWeights::StaticStruct()); It; ++It)
+	{
+		double Value = 0.0;
+		if (Root->TryGetNumberField(It->GetName(), Value))
+		{
+			It->SetPropertyValue_InContainer(&OutWeights, float(Value));
+		}
+	}
+
+	return true;
+}
+
+FString UGCGTuneAIWeightsCommandlet::WeightsToJson(const FGCGAIWeights& Weights)
+{
+	FString Output;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+
+	Writer->WriteObjectStart();
+	for (TFieldIterator<FFloatProperty> It(FGCGAIWeights::StaticStruct()); It; ++It)
+	{
+		Writer->WriteValue(It->GetName(), It->GetPropertyValue_InContainer(&Weights));
+	}
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	return Output;
+}
+
+TArray<const FFloatProperty*> UGCGTuneAIWeightsCommandlet::GetTunableWeights(const FString& DifficultyName)
+{
+	TArray<const FFloatProperty*> Tunable;
+	for (TFieldIterator<FFloatProperty> It(FGCGAIWeights::StaticStruct()); It; ++It)
+	{
+#if WITH_METADATA
+		if (It->HasMetaData(TEXT("NoTuning")))
+		{
+			continue;
+		}
+
+		// Another difficulty's weight never affects these matches; tuning it would only add noise
+		if (It->HasMetaData(TEXT("TuneFor")) && !It->GetMetaData(TEXT("TuneFor")).Equals(DifficultyName, ESearchCase::IgnoreCase))
+		{
+			continue;
+		}
+#endif
+		Tunable.Add(*It);
+	}
+	return Tunable;
+}
+
+void UGCGTuneAIWeightsCommandlet::PlayBothSides(const FGCGMatchSimulator& Simulator, FGCGSimulationConfig& Config,
+	const FGCGAIWeights& Weights, const FGCGAIWeights& Opponent, int32& OutWins, int32& OutDraws)
+{
+	// Weights on Deck A, then on Deck B, so neither deck's edge leaks into the score
+	Config.WeightsA = Weights;
+	Config.WeightsB = Opponent;
+	const FGCGSimulationStats OnDeckA = Simulator.Run(Config);
+
+	Config.WeightsA = Opponent;
+	Config.WeightsB = Weights;
+	const FGCGSimulationStats OnDeckB = Simulator.Run(Config);
+
+	OutWins = OnDeckA.Wins[0] + OnDeckB.Wins[1];
+	OutDraws = OnDeckA.Draws + OnDeckB.Draws;
+}
@@ -0,0 +1,76 @@
+// GCGTuneAIWeightsCommandlet.h - AI Weight Tuning
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Offline tool that tunes FGCGAIWeights by parallel self-play
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GundamTCG/AI/GCGAIWeights.h"
+#include "GCGTuneAIWeightsCommandlet.generated.h"
+
+class FGCGMatchSimulator;
+struct FGCGSimulationConfig;
+
+/**
+ * Tune AI Weights Commandlet
+ *
+ * Usage:
+ *   UnrealEditor-Cmd GundamTCG.uproject -run=GCGTuneAIWeights
+ *     -DeckA=<deck.json> -DeckB=<deck.json>
+ *     [-AI=Easy|Medium|Hard] [-Baseline=<weights.json | /Game/AI/DA_Weights.DA_Weights>]
+ *     [-Iterations=<N, default 100>] [-MatchesPerStep=<N, default 200>] [-FinalMatches=<N, default 2000>]
+ *     [-StepSize=<a, default 0.05>] [-Perturbation=<c, default 0.1>]
+ *     [-Threads=<N>] [-MaxTurns=<N>] [-Seed=<N>]
+ *     [-Output=<ProjectSaved>/AITuning/<timestamp>]
+ *     [-DataTable=/Game/Cards/Data/DT_Cards.DT_Cards | -Csv=<path to card CSV>]
+ *
+ * Decks, cards and matches work as in UGCGSimulateMatchesCommandlet.
+ *
+ * Runs SPSA (simultaneous perturbation stochastic approximation) on every
+ * float of FGCGAIWeights not marked NoTuning (nor TuneFor another
+ * difficulty, e.g. the other difficulties' block thresholds), starting from the baseline
+ * (the defaults unless -Baseline is given). Each weight moves on its own
+ * scale, max(|baseline|, 1), and stays non-negative. Every iteration
+ * perturbs all weights at once by +/-c_k, plays the two perturbed AIs against
+ * each other on both deck assignments and the same seeds, and steps along
+ * the win-rate difference:
+ *
+ *   x += a_k * (Score(+) - Score(-)) / (2 c_k Delta)
+ *   a_k = a / (k + 1 + Iterations / 10)^0.602, c_k = c / (k + 1)^0.101
+ *
+ * The tuned weights then play FinalMatches against the baseline (again on
+ * both assignments), and the result is reported as an Elo difference with a
+ * 95% confidence interval.
+ *
+ * Writes Weights.json (load with -Baseline=, or copy into a UGCGAIWeightsAsset),
+ * Trace.csv (score and weights per iteration) and Report.json to the output
+ * directory. Matches run one per core; a fixed -Seed replays the whole run.
+ */
+UCLASS()
+class UGCGTuneAIWeightsCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGCGTuneAIWeightsCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+	/** Load weights from a JSON file written by this commandlet, or a UGCGAIWeightsAsset path */
+	static bool LoadWeights(const FString& Path, FGCGAIWeights& OutWeights, FString& OutError);
+
+	/** Weights as a JSON object (one number per float) */
+	static FString WeightsToJson(const FGCGAIWeights& Weights);
+
+private:
+	/** Floats of FGCGAIWeights tuned for a difficulty (not marked NoTuning, TuneFor absent or matching) */
+	static TArray<const FFloatProperty*> GetTunableWeights(const FString& DifficultyName);
+
+	/**
+	 * Play Weights against Opponent on both deck assignments with the same seeds
+	 * @param OutWins, OutDraws Results of Weights over all 2 * Config.NumMatches matches
+	 */
+	static void PlayBothSides(const FGCGMatchSimulator& Simulator, FGCGSimulationConfig& Config,
+		const FGCGAIWeights& Weights, const FGCGAIWeights& Opponent, int32& OutWins, int32& OutDraws);
+};
@@ -0,0 +1,46 @@
+// GCGExpiryQueue.cpp - Modifier Expiry Queue Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGExpiryQueue.h"
+
+void FGCGExpiryQueue::Add(int32 InstanceID, int32 Turn, EGCGExpiryPoint Point)
+{
+	FEntry& Entry = Buckets[GetBucketIndex(Turn, Point)].AddDefaulted_GetRef();
+	Entry.InstanceID = InstanceID;
+	Entry.Turn = Turn;
+}
+
+int32 FGCGExpiryQueue::PopDue(int32 Turn, EGCGExpiryPoint Point, TArray<int32>& OutInstanceIDs)
+{
+	TArray<FEntry>& Bucket = Buckets[GetBucketIndex(Turn, Point)];
+	const int32 FirstOut = OutInstanceIDs.Num();
+
+	for (int32 i = Bucket.Num() - 1; i >= 0; --i)
+	{
+		if (Bucket[i].Turn <= Turn)
+		{
+			OutInstanceIDs.AddUnique(Bucket[i].InstanceID);
+			Bucket.RemoveAtSwap(i, EAllowShrinking::No);
+		}
+	}
+
+	return OutInstanceIDs.Num() - FirstOut;
+}
+
+void FGCGExpiryQueue::Reset()
+{
+	for (TArray<FEntry>& Bucket : Buckets)
+	{
+		Bucket.Reset();
+	}
+}
+
+int32 FGCGExpiryQueue::Num() const
+{
+	int32 Count = 0;
+	for (const TArray<FEntry>& Bucket : Buckets)
+	{
+		Count += Bucket.Num();
+	}
+	return Count;
+}
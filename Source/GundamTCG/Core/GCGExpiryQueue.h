@@ -0,0 +1,76 @@
+// GCGExpiryQueue.h - Modifier Expiry Queue
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Turn-bucketed queue of cards holding "until end of battle / turn" modifiers and keywords
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Point at which a queued modifier expires
+ */
+enum class EGCGExpiryPoint : uint8
+{
+	EndOfBattle,
+	EndOfTurn,
+
+	Count
+};
+
+/**
+ * Expiry Queue
+ *
+ * A timer wheel of card instance IDs with one bucket per (turn slot, expiry
+ * point). Whoever gives a card a temporary modifier or keyword files the card
+ * under the turn and point it expires at; cleanup then drains that single
+ * bucket instead of sweeping every card in play.
+ *
+ * Turns wrap around NumTurnSlots buckets. Entries remember their turn, so a
+ * bucket only releases what is due and keeps later turns' entries queued.
+ * The queue only says which cards to look at: the caller still drops the
+ * expired modifiers (FGCGRules::CleanupExpiredModifiers), so a card queued
+ * twice, or one whose modifiers were already removed, costs a lookup and
+ * nothing else.
+ */
+struct GUNDAMTCG_API FGCGExpiryQueue
+{
+	/** Turns the wheel spans before slots are reused */
+	static constexpr int32 NumTurnSlots = 4;
+
+	/**
+	 * Queue a card
+	 * @param InstanceID Card holding the temporary modifier / keyword
+	 * @param Turn Turn it expires in
+	 * @param Point End of that turn's battle, or end of the turn
+	 */
+	void Add(int32 InstanceID, int32 Turn, EGCGExpiryPoint Point);
+
+	/**
+	 * Remove the cards due at Point of Turn (or of an earlier turn in the same slot)
+	 * @param OutInstanceIDs Receives each due card once
+	 * @return Number of cards appended
+	 */
+	int32 PopDue(int32 Turn, EGCGExpiryPoint Point, TArray<int32>& OutInstanceIDs);
+
+	/** Drop every entry (new match) */
+	void Reset();
+
+	/** Number of queued entries */
+	int32 Num() const;
+
+private:
+	struct FEntry
+	{
+		int32 InstanceID = 0;
+		int32 Turn = 0;
+	};
+
+	static int32 GetBucketIndex(int32 Turn, EGCGExpiryPoint Point)
+	{
+		return static_cast<int32>(static_cast<uint32>(Turn) % NumTurnSlots) * static_cast<int32>(EGCGExpiryPoint::Count)
+			+ static_cast<int32>(Point);
+	}
+
+	/** NumTurnSlots * Count buckets, see GetBucketIndex */
+	TArray<FEntry> Buckets[NumTurnSlots * static_cast<int32>(EGCGExpiryPoint::Count)];
+};
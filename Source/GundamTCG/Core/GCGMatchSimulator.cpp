@@ -0,0 +1,313 @@
+// GCGMatchSimulator.cpp - Batch Match Simulator Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGMatchSimulator.h"
+#include "Serialization/JsonWriter.h"
+#include "Tasks/Task.h"
+#include <atomic>
+
+namespace
+{
+	const TCHAR* GetSideName(int32 Side)
+	{
+		return Side == 0 ? TEXT("A") : Side == 1 ? TEXT("B") : TEXT("Draw");
+	}
+
+	/** Card numbers sorted for stable report output */
+	TArray<FName> GetSortedCardNumbers(const TMap<FName, FGCGSimCardStats>& CardStats)
+	{
+		TArray<FName> CardNumbers;
+		CardStats.GetKeys(CardNumbers);
+		CardNumbers.Sort(FNameLexicalLess());
+		return CardNumbers;
+	}
+}
+
+// ===== STATS =====
+
+void FGCGSimulationStats::Merge(const FGCGSimulationStats& Other)
+{
+	NumMatches += Other.NumMatches;
+	Draws += Other.Draws;
+	TotalTurns += Other.TotalTurns;
+	MinTurns = FMath::Min(MinTurns, Other.MinTurns);
+	MaxTurns = FMath::Max(MaxTurns, Other.MaxTurns);
+
+	for (int32 Side = 0; Side < 2; ++Side)
+	{
+		Wins[Side] += Other.Wins[Side];
+		MatchesFirst[Side] += Other.MatchesFirst[Side];
+		WinsFirst[Side] += Other.WinsFirst[Side];
+
+		for (const TPair<FName, FGCGSimCardStats>& Entry : Other.CardStats[Side])
+		{
+			FGCGSimCardStats& Stats = CardStats[Side].FindOrAdd(Entry.Key);
+			Stats.TimesPlayed += Entry.Value.TimesPlayed;
+			Stats.MatchesPlayed += Entry.Value.MatchesPlayed;
+			Stats.WinsWhenPlayed += Entry.Value.WinsWhenPlayed;
+		}
+	}
+}
+
+double FGCGSimulationStats::GetFirstPlayerWinRate() const
+{
+	const int32 DecidedFirst = NumMatches - Draws;
+	return DecidedFirst > 0 ? double(WinsFirst[0] + WinsFirst[1]) / DecidedFirst : 0.0;
+}
+
+FString FGCGSimulationStats::ToMatchesCsv() const
+{
+	TStringBuilder<4096> Csv;
+	Csv << TEXT("Seed,First,Winner,Turns\n");
+
+	for (const FGCGSimMatchResult& Match : Matches)
+	{
+		Csv.Appendf(TEXT("%llu,%s,%s,%d\n"), Match.Seed, GetSideName(Match.FirstSide), GetSideName(Match.WinnerSide), Match.Turns);
+	}
+
+	return Csv.ToString();
+}
+
+FString FGCGSimulationStats::ToCardsCsv() const
+{
+	TStringBuilder<4096> Csv;
+	Csv << TEXT("Side,CardNumber,TimesPlayed,MatchesPlayed,WinsWhenPlayed,WinRateWhenPlayed\n");
+
+	for (int32 Side = 0; Side < 2; ++Side)
+	{
+		for (const FName& CardNumber : GetSortedCardNumbers(CardStats[Side]))
+		{
+			const FGCGSimCardStats& Stats = CardStats[Side].FindChecked(CardNumber);
+			const double WinRate = Stats.MatchesPlayed > 0 ? double(Stats.WinsWhenPlayed) / Stats.MatchesPlayed : 0.0;
+			Csv.Appendf(TEXT("%s,%s,%d,%d,%d,%.4f\n"), GetSideName(Side), *CardNumber.ToString(),
+				Stats.TimesPlayed, Stats.MatchesPlayed, Stats.WinsWhenPlayed, WinRate);
+		}
+	}
+
+	return Csv.ToString();
+}
+
+FString FGCGSimulationStats::ToJson() const
+{
+	FString Output;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("Matches"), NumMatches);
+	Writer->WriteValue(TEXT("Draws"), Draws);
+	Writer->WriteValue(TEXT("Seconds"), Seconds);
+	Writer->WriteValue(TEXT("MatchesPerSecond"), GetMatchesPerSecond());
+	Writer->WriteValue(TEXT("AverageTurns"), GetAverageTurns());
+	Writer->WriteValue(TEXT("MinTurns"), NumMatches > 0 ? MinTurns : 0);
+	Writer->WriteValue(TEXT("MaxTurns"), MaxTurns);
+	Writer->WriteValue(TEXT("FirstPlayerWinRate"), GetFirstPlayerWinRate());
+
+	Writer->WriteObjectStart(TEXT("Sides"));
+	for (int32 Side = 0; Side < 2; ++Side)
+	{
+		Writer->WriteObjectStart(GetSideName(Side));
+		Writer->WriteValue(TEXT("Wins"), Wins[Side]);
+		Writer->WriteValue(TEXT("WinRate"), GetWinRate(Side));
+		Writer->WriteValue(TEXT("MatchesFirst"), MatchesFirst[Side]);
+		Writer->WriteValue(TEXT("WinsFirst"), WinsFirst[Side]);
+
+		Writer->WriteArrayStart(TEXT("Cards"));
+		for (const FName& CardNumber : GetSortedCardNumbers(CardStats[Side]))
+		{
+			const FGCGSimCardStats& Stats = CardStats[Side].FindChecked(CardNumber);
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("CardNumber"), CardNumber.ToString());
+			Writer->WriteValue(TEXT("TimesPlayed"), Stats.TimesPlayed);
+			Writer->WriteValue(TEXT("MatchesPlayed"), Stats.MatchesPlayed);
+			Writer->WriteValue(TEXT("WinsWhenPlayed"), Stats.WinsWhenPlayed);
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteObjectEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	return Output;
+}
+
+// ===== SIMULATOR =====
+
+FGCGMatchSimulator::FGCGMatchSimulator(FGCGCardCatalogPtr InCatalog)
+	: Engine(MoveTemp(InCatalog))
+{
+}
+
+FGCGSimulationStats FGCGMatchSimulator::Run(const FGCGSimulationConfig& Config) const
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	const int32 NumMatches = FMath::Max(0, Config.NumMatches);
+	const int32 RequestedWorkers = Config.NumThreads > 0 ? Config.NumThreads : FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+	const int32 NumWorkers = FMath::Clamp(RequestedWorkers, 1, FMath::Max(1, NumMatches));
+
+	TArray<FGCGSimulationStats> WorkerStats;
+	WorkerStats.SetNum(NumWorkers);
+
+	TArray<FGCGSimMatchResult> Results;
+	Results.SetNum(NumMatches);
+
+	// Workers pull match indices until the batch is exhausted
+	std::atomic<int32> NextMatch{0};
+
+	TArray<UE::Tasks::FTask> Workers;
+	Workers.Reserve(NumWorkers);
+	for (int32 WorkerIndex = 0; WorkerIndex < NumWorkers; ++WorkerIndex)
+	{
+		Workers.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, &Config, &WorkerStats, &Results, &NextMatch, NumMatches, WorkerIndex]()
+		{
+			FGCGSimulationStats& Stats = WorkerStats[WorkerIndex];
+			for (int32 MatchIndex = NextMatch.fetch_add(1, std::memory_order_relaxed); MatchIndex < NumMatches;
+				MatchIndex = NextMatch.fetch_add(1, std::memory_order_relaxed))
+			{
+				Results[MatchIndex] = PlayMatch(Config, Config.FirstSeed + MatchIndex, &Stats);
+			}
+		}));
+	}
+	UE::Tasks::Wait(Workers);
+
+	FGCGSimulationStats Total;
+	for (const FGCGSimulationStats& Stats : WorkerStats)
+	{
+		Total.Merge(Stats);
+	}
+	Total.Matches = MoveTemp(Results);
+	Total.Seconds = FPlatformTime::Seconds() - StartTime;
+
+	return Total;
+}
+
+FGCGSimMatchResult FGCGMatchSimulator::PlayMatch(const FGCGSimulationConfig& Config, uint64 Seed, FGCGSimulationStats* OutStats) const
+{
+	FGCGSimMatchResult Result;
+	Result.Seed = Seed;
+	Result.FirstSide = (Seed & 1) ? 1 : 0;
+
+	// Player 0 goes first; map players to deck sides
+	const int32 PlayerSide[GCGRules::NumPlayers] = { Result.FirstSide, 1 - Result.FirstSide };
+	const FGCGDeckList* Decks[2] = { &Config.DeckA, &Config.DeckB };
+	const EGCGAIDifficulty Difficulties[2] = { Config.DifficultyA, Config.DifficultyB };
+	const FGCGAIWeights* Weights[2] = { &Config.WeightsA, &Config.WeightsB };
+
+	const FGCGHeuristicPolicy Policies[GCGRules::NumPlayers] = {
+		FGCGHeuristicPolicy(Engine, Difficulties[PlayerSide[0]], &Config.Search, Weights[PlayerSide[0]]),
+		FGCGHeuristicPolicy(Engine, Difficulties[PlayerSide[1]], &Config.Search, Weights[PlayerSide[1]])
+	};
+
+	FGCGMatchState State;
+	Engine.SetupMatch(State, *Decks[PlayerSide[0]], *Decks[PlayerSide[1]], Seed);
+	Engine.StartTurn(State);
+
+	TArray<FName, TInlineAllocator<32>> CardsPlayed[GCGRules::NumPlayers];
+	TArray<int32> Discards;
+
+	while (!State.bGameOver && State.TurnNumber <= Config.MaxTurns)
+	{
+		const int32 PlayerID = State.ActivePlayerID;
+		const FGCGHeuristicPolicy& Policy = Policies[PlayerID];
+
+		for (int32 NumActions = 0; NumActions < Config.MaxActionsPerTurn && !State.bGameOver; ++NumActions)
+		{
+			const FGCGAIAction Action = Policy.DecideMainPhaseAction(State);
+			const int32 TargetID = FMath::Max(0, Action.TargetInstanceID);
+
+			if (Action.ActionType == EGCGAIActionType::PlayCard)
+			{
+				const FGCGCardInstance* Card = State.GetPlayer(PlayerID).FindCard(Action.CardInstanceID);
+				const FName CardNumber = Card ? Card->CardNumber : NAME_None;
+
+				const EGCGRulesResult PlayResult = Engine.PlayCard(State, PlayerID, Action.CardInstanceID, TargetID);
+				if (PlayResult != EGCGRulesResult::Success && PlayResult != EGCGRulesResult::GameOver)
+				{
+					break;
+				}
+				CardsPlayed[PlayerID].Add(CardNumber);
+			}
+			else if (Action.ActionType == EGCGAIActionType::Attack)
+			{
+				if (Engine.DeclareAttack(State, PlayerID, Action.CardInstanceID, TargetID) != EGCGRulesResult::Success)
+				{
+					break;
+				}
+
+				if (const int32 BlockerID = Policies[FGCGMatchState::GetOpponentID(PlayerID)].DecideBlocker(State))
+				{
+					Engine.DeclareBlocker(State, BlockerID);
+				}
+				Engine.ResolveAttack(State);
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		if (State.bGameOver)
+		{
+			break;
+		}
+
+		Policy.DecideDiscards(State, PlayerID, FGCGRules::GetHandExcess(State.GetPlayer(PlayerID)), Discards);
+		Engine.EndTurn(State, Discards);
+	}
+
+	Result.Turns = FMath::Min(State.TurnNumber, Config.MaxTurns);
+	Result.WinnerSide = State.bGameOver && FGCGMatchState::IsValidPlayerID(State.WinnerPlayerID) ? PlayerSide[State.WinnerPlayerID] : -1;
+
+	if (OutStats)
+	{
+		FGCGSimulationStats& Stats = *OutStats;
+		++Stats.NumMatches;
+		++Stats.MatchesFirst[Result.FirstSide];
+		Stats.TotalTurns += Result.Turns;
+		Stats.MinTurns = FMath::Min(Stats.MinTurns, Result.Turns);
+		Stats.MaxTurns = FMath::Max(Stats.MaxTurns, Result.Turns);
+
+		if (Result.WinnerSide < 0)
+		{
+			++Stats.Draws;
+		}
+		else
+		{
+			++Stats.Wins[Result.WinnerSide];
+			if (Result.WinnerSide == Result.FirstSide)
+			{
+				++Stats.WinsFirst[Result.FirstSide];
+			}
+		}
+
+		for (int32 PlayerID = 0; PlayerID < GCGRules::NumPlayers; ++PlayerID)
+		{
+			const int32 Side = PlayerSide[PlayerID];
+			TMap<FName, FGCGSimCardStats>& SideStats = Stats.CardStats[Side];
+
+			TArray<FName, TInlineAllocator<32>>& Played = CardsPlayed[PlayerID];
+			for (const FName& CardNumber : Played)
+			{
+				++SideStats.FindOrAdd(CardNumber).TimesPlayed;
+			}
+
+			// Once per match for the "played in" counts
+			Played.Sort(FNameFastLess());
+			for (int32 i = 0; i < Played.Num(); ++i)
+			{
+				if (i == 0 || Played[i] != Played[i - 1])
+				{
+					FGCGSimCardStats& CardStats = SideStats.FindChecked(Played[i]);
+					++CardStats.MatchesPlayed;
+					CardStats.WinsWhenPlayed += Result.WinnerSide == Side ? 1 : 0;
+				}
+			}
+		}
+	}
+
+	return Result;
+}
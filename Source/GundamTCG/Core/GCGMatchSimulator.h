@@ -0,0 +1,159 @@
+// GCGMatchSimulator.h - Batch Match Simulator
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Plays many headless AI-vs-AI matches in parallel and aggregates the results
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GundamTCG/AI/GCGHeuristicPolicy.h"
+#include "GundamTCG/AI/GCGMonteCarloSearch.h"
+#include "GundamTCG/Core/GCGRulesEngine.h"
+
+/**
+ * Batch settings
+ */
+struct FGCGSimulationConfig
+{
+	FGCGDeckList DeckA;
+	FGCGDeckList DeckB;
+
+	EGCGAIDifficulty DifficultyA = EGCGAIDifficulty::Medium;
+	EGCGAIDifficulty DifficultyB = EGCGAIDifficulty::Medium;
+
+	/** Scoring weights of each side's AI */
+	FGCGAIWeights WeightsA;
+	FGCGAIWeights WeightsB;
+
+	/** Match i uses seed FirstSeed + i; even seeds put Deck A first, odd seeds Deck B */
+	uint64 FirstSeed = 1;
+	int32 NumMatches = 1000;
+
+	/** Worker tasks (0 = one per logical core) */
+	int32 NumThreads = 0;
+
+	/** Matches still running after this many turns are counted as draws */
+	int32 MaxTurns = 100;
+
+	/** Actions one player may take in a turn before it is ended for them */
+	int32 MaxActionsPerTurn = 64;
+
+	/** Search settings for the Expert difficulty (an iteration cap keeps batches reproducible) */
+	FGCGSearchSettings Search;
+};
+
+/**
+ * Result of one match
+ */
+struct FGCGSimMatchResult
+{
+	uint64 Seed = 0;
+
+	/** 0 = Deck A, 1 = Deck B */
+	int32 FirstSide = 0;
+
+	/** 0 = Deck A, 1 = Deck B, -1 = draw (turn limit) */
+	int32 WinnerSide = -1;
+
+	int32 Turns = 0;
+};
+
+/**
+ * Per-card results for one side
+ */
+struct FGCGSimCardStats
+{
+	/** Copies played over all matches */
+	int32 TimesPlayed = 0;
+
+	/** Matches in which at least one copy was played */
+	int32 MatchesPlayed = 0;
+
+	/** Of those, matches the side won */
+	int32 WinsWhenPlayed = 0;
+};
+
+/**
+ * Aggregated batch results
+ */
+struct GUNDAMTCG_API FGCGSimulationStats
+{
+	int32 NumMatches = 0;
+	int32 Draws = 0;
+
+	/** Wins per side (0 = Deck A, 1 = Deck B) */
+	int32 Wins[2] = { 0, 0 };
+
+	/** Matches each side went first, and how many of those it won */
+	int32 MatchesFirst[2] = { 0, 0 };
+	int32 WinsFirst[2] = { 0, 0 };
+
+	int64 TotalTurns = 0;
+	int32 MinTurns = MAX_int32;
+	int32 MaxTurns = 0;
+
+	/** Per-card results per side */
+	TMap<FName, FGCGSimCardStats> CardStats[2];
+
+	/** Every match, in seed order */
+	TArray<FGCGSimMatchResult> Matches;
+
+	/** Wall-clock time of the batch */
+	double Seconds = 0.0;
+
+	/** Add another worker's totals (match list excluded) */
+	void Merge(const FGCGSimulationStats& Other);
+
+	double GetWinRate(int32 Side) const { return NumMatches > 0 ? double(Wins[Side]) / NumMatches : 0.0; }
+	double GetFirstPlayerWinRate() const;
+	double GetAverageTurns() const { return NumMatches > 0 ? double(TotalTurns) / NumMatches : 0.0; }
+	double GetMatchesPerSecond() const { return Seconds > 0.0 ? NumMatches / Seconds : 0.0; }
+
+	/** One row per match: Seed,First,Winner,Turns */
+	FString ToMatchesCsv() const;
+
+	/** One row per card and side: Side,CardNumber,TimesPlayed,MatchesPlayed,WinsWhenPlayed,WinRateWhenPlayed */
+	FString ToCardsCsv() const;
+
+	/** Summary and per-card results */
+	FString ToJson() const;
+};
+
+/**
+ * Match Simulator
+ *
+ * Plays complete matches with FGCGRulesEngine and one FGCGHeuristicPolicy per
+ * side. No world, actors, ticking or thinking delays - a match is a tight loop
+ * over a stack-local FGCGMatchState.
+ *
+ * Run() launches NumThreads worker tasks on the task scheduler (work-stealing
+ * across the worker threads). Each worker pulls the next match index from a
+ * shared counter until the batch is done, so long and short matches balance
+ * out, and accumulates into its own FGCGSimulationStats - nothing is shared
+ * between workers but the counter, the immutable catalog and the result slots.
+ *
+ * Every match is fully determined by its seed, independent of thread count.
+ */
+class GUNDAMTCG_API FGCGMatchSimulator
+{
+public:
+	explicit FGCGMatchSimulator(FGCGCardCatalogPtr InCatalog);
+
+	/**
+	 * Play a batch of matches
+	 * @param Config Decks, difficulties, seeds and threads
+	 * @return Aggregated results
+	 */
+	FGCGSimulationStats Run(const FGCGSimulationConfig& Config) const;
+
+	/**
+	 * Play one match to completion
+	 * @param Seed Match seed (also decides which deck goes first)
+	 * @param OutStats Optional: the match is added to these totals
+	 */
+	FGCGSimMatchResult PlayMatch(const FGCGSimulationConfig& Config, uint64 Seed, FGCGSimulationStats* OutStats = nullptr) const;
+
+	const FGCGRulesEngine& GetEngine() const { return Engine; }
+
+private:
+	FGCGRulesEngine Engine;
+};
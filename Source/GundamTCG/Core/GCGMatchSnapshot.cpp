@@ -0,0 +1,407 @@
+// GCGMatchSnapshot.cpp - Match State Snapshots Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGMatchSnapshot.h"
+#include "GundamTCG/GameModes/GCGGameModeBase.h"
+#include "GundamTCG/GameState/GCGGameState.h"
+#include "GundamTCG/PlayerState/GCGPlayerState.h"
+#include "GundamTCG/Subsystems/GCGEffectStackSubsystem.h"
+
+/**
+ * Captured effect stack (UGCGEffectStackSubsystem)
+ */
+struct FGCGEffectStackSnapshot
+{
+	TArray<FGCGEffectStackEntry> EffectStack;
+	TMap<int32, TArray<FGCGEffectStackEntry>> DuringThisTurnEffects;
+	TArray<FGCGUnitSnapshot> UnitSnapshots;
+};
+
+namespace
+{
+	EGCGCardZone ZoneFromIndex(int32 ZoneIndex)
+	{
+		return static_cast<EGCGCardZone>(ZoneIndex + 1);
+	}
+
+	/**
+	 * Capture every zone of a board or player state; a zone whose location index
+	 * version matches the base holds the same cards and is shared, not copied
+	 */
+	template <typename OwnerType>
+	void CaptureZones(FGCGPlayerSnapshot& Player, const OwnerType& Owner, const FGCGCardLocationIndex& Index, const FGCGPlayerSnapshot* BasePlayer)
+	{
+		for (int32 ZoneIndex = 0; ZoneIndex < GCGRules::NumZones; ++ZoneIndex)
+		{
+			const EGCGCardZone Zone = ZoneFromIndex(ZoneIndex);
+			const uint64 Version = Index.GetZoneVersion(Zone);
+
+			if (BasePlayer && BasePlayer->ZoneVersions[ZoneIndex] == Version)
+			{
+				Player.Zones.Add(BasePlayer->Zones[ZoneIndex]);
+			}
+			else
+			{
+				Player.Zones.Add(MakeShared<const TArray<FGCGCardInstance>, ESPMode::ThreadSafe>(*Owner.GetZoneArray(Zone)));
+			}
+
+			Player.ZoneVersions.Add(Version);
+		}
+	}
+
+	/**
+	 * Copy back every zone whose version differs from the captured one, rebuild the
+	 * location index if anything was copied, then adopt the captured versions so the
+	 * next capture against this snapshot shares every zone
+	 */
+	template <typename OwnerType>
+	void RestoreZones(const FGCGPlayerSnapshot& Player, OwnerType& Owner, FGCGCardLocationIndex& Index)
+	{
+		bool bZonesChanged = false;
+		for (int32 ZoneIndex = 0; ZoneIndex < GCGRules::NumZones; ++ZoneIndex)
+		{
+			const EGCGCardZone Zone = ZoneFromIndex(ZoneIndex);
+			if (Index.GetZoneVersion(Zone) != Player.ZoneVersions[ZoneIndex])
+			{
+				*Owner.GetZoneArray(Zone) = *Player.Zones[ZoneIndex];
+				bZonesChanged = true;
+			}
+		}
+
+		if (bZonesChanged)
+		{
+			Owner.RebuildCardLocationIndex();
+		}
+
+		for (int32 ZoneIndex = 0; ZoneIndex < GCGRules::NumZones; ++ZoneIndex)
+		{
+			Index.SetZoneVersion(ZoneFromIndex(ZoneIndex), Player.ZoneVersions[ZoneIndex]);
+		}
+	}
+
+	/** Same entries in the same order with the same state (every UPROPERTY compared) */
+	template <typename StructType>
+	bool AreEntriesIdentical(const TArray<StructType>& A, const TArray<StructType>& B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+
+		if (A.GetData() == B.GetData())
+		{
+			return true;
+		}
+
+		const UScriptStruct* Struct = StructType::StaticStruct();
+		for (int32 i = 0; i < A.Num(); ++i)
+		{
+			if (!Struct->CompareScriptStruct(&A[i], &B[i], PPF_None))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool AreTurnEffectsIdentical(const TMap<int32, TArray<FGCGEffectStackEntry>>& A, const TMap<int32, TArray<FGCGEffectStackEntry>>& B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+
+		for (const auto& Entry : A)
+		{
+			const TArray<FGCGEffectStackEntry>* Other = B.Find(Entry.Key);
+			if (!Other || !AreEntriesIdentical(Entry.Value, *Other))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+// ===== HEADLESS =====
+
+FGCGMatchSnapshot FGCGMatchSnapshot::Capture(const FGCGMatchState& State, const FGCGMatchSnapshot* Base)
+{
+	FGCGMatchSnapshot Snapshot;
+
+	for (const FGCGPlayerBoard& Board : State.Players)
+	{
+		const FGCGPlayerSnapshot* BasePlayer = Base ? Base->FindPlayer(Board.PlayerID) : nullptr;
+
+		FGCGPlayerSnapshot& Player = Snapshot.Players.AddDefaulted_GetRef();
+		Player.PlayerID = Board.PlayerID;
+		Player.bHasLost = Board.bHasLost;
+		Player.bHasPlacedResourceThisTurn = Board.bHasPlacedResourceThisTurn;
+		Player.bHasDrawnThisTurn = Board.bHasDrawnThisTurn;
+
+		CaptureZones(Player, Board, Board.CardLocations, BasePlayer);
+	}
+
+	Snapshot.TurnNumber = State.TurnNumber;
+	Snapshot.ActivePlayerID = State.ActivePlayerID;
+	Snapshot.CurrentPhase = State.CurrentPhase;
+	Snapshot.bAttackInProgress = State.IsAttackInProgress();
+	Snapshot.CurrentAttack = State.CurrentAttack;
+	Snapshot.bGameInProgress = State.CurrentPhase != EGCGTurnPhase::NotStarted && !State.bGameOver;
+	Snapshot.bGameOver = State.bGameOver;
+	Snapshot.WinnerPlayerID = State.WinnerPlayerID;
+	Snapshot.NextInstanceID = State.NextInstanceID;
+	Snapshot.Random = State.Random;
+
+	return Snapshot;
+}
+
+void FGCGMatchSnapshot::Restore(FGCGMatchState& State) const
+{
+	for (FGCGPlayerBoard& Board : State.Players)
+	{
+		const FGCGPlayerSnapshot* Player = FindPlayer(Board.PlayerID);
+		if (!ensureMsgf(Player, TEXT("FGCGMatchSnapshot::Restore - Snapshot has no player %d"), Board.PlayerID))
+		{
+			continue;
+		}
+
+		RestoreZones(*Player, Board, Board.CardLocations);
+
+		Board.bHasLost = Player->bHasLost;
+		Board.bHasPlacedResourceThisTurn = Player->bHasPlacedResourceThisTurn;
+		Board.bHasDrawnThisTurn = Player->bHasDrawnThisTurn;
+	}
+
+	State.TurnNumber = TurnNumber;
+	State.ActivePlayerID = ActivePlayerID;
+	State.CurrentPhase = CurrentPhase;
+	State.CurrentAttack = CurrentAttack;
+	State.bGameOver = bGameOver;
+	State.WinnerPlayerID = WinnerPlayerID;
+	State.NextInstanceID = NextInstanceID;
+	State.Random = Random;
+}
+
+// ===== LIVE =====
+
+FGCGMatchSnapshot FGCGMatchSnapshot::CaptureLive(const AGCGGameState* GameState, const UGCGEffectStackSubsystem* EffectStack, const FGCGMatchSnapshot* Base)
+{
+	FGCGMatchSnapshot Snapshot;
+
+	if (!GameState)
+	{
+		UE_LOG(LogTemp, Error, TEXT("FGCGMatchSnapshot::CaptureLive - GameState is null"));
+		return Snapshot;
+	}
+
+	for (const TObjectPtr<APlayerState>& PlayerState : GameState->PlayerArray)
+	{
+		const AGCGPlayerState* GCGPlayerState = Cast<AGCGPlayerState>(PlayerState);
+		if (!GCGPlayerState)
+		{
+			continue;
+		}
+
+		const FGCGPlayerSnapshot* BasePlayer = Base ? Base->FindPlayer(GCGPlayerState->GetPlayerID()) : nullptr;
+
+		FGCGPlayerSnapshot& Player = Snapshot.Players.AddDefaulted_GetRef();
+		Player.PlayerID = GCGPlayerState->GetPlayerID();
+		Player.bHasLost = GCGPlayerState->bHasLost;
+		Player.bHasPriority = GCGPlayerState->bHasPriority;
+		Player.bHasPlacedResourceThisTurn = GCGPlayerState->bHasPlacedResourceThisTurn;
+		Player.bHasDrawnThisTurn = GCGPlayerState->bHasDrawnThisTurn;
+
+		// Zones edited behind the index's back carry stale versions - re-index them first
+		if (GCGPlayerState->bCardLocationIndexDirty)
+		{
+			GCGPlayerState->RebuildCardLocationIndex();
+		}
+
+		CaptureZones(Player, *GCGPlayerState, GCGPlayerState->CardLocationIndex, BasePlayer);
+	}
+
+	Snapshot.TurnNumber = GameState->TurnNumber;
+	Snapshot.ActivePlayerID = GameState->ActivePlayerID;
+	Snapshot.CurrentPhase = GameState->CurrentPhase;
+	Snapshot.CurrentStartPhaseStep = GameState->CurrentStartPhaseStep;
+	Snapshot.CurrentEndPhaseStep = GameState->CurrentEndPhaseStep;
+	Snapshot.bAttackInProgress = GameState->bAttackInProgress;
+	Snapshot.CurrentAttack = GameState->CurrentAttack;
+	Snapshot.bGameInProgress = GameState->bGameInProgress;
+	Snapshot.bGameOver = GameState->bGameOver;
+	Snapshot.WinnerPlayerID = GameState->WinnerPlayerID;
+	Snapshot.Random = GameState->MatchRandom;
+	Snapshot.bIsTeamBattle = GameState->bIsTeamBattle;
+	Snapshot.TeamA = GameState->TeamA;
+	Snapshot.TeamB = GameState->TeamB;
+
+	if (const AGCGGameModeBase* GameMode = GameState->GetWorld() ? GameState->GetWorld()->GetAuthGameMode<AGCGGameModeBase>() : nullptr)
+	{
+		Snapshot.NextInstanceID = GameMode->NextInstanceID;
+	}
+
+	Snapshot.CaptureEffectStack(EffectStack, Base);
+
+	return Snapshot;
+}
+
+bool FGCGMatchSnapshot::RestoreLive(AGCGGameState* GameState, UGCGEffectStackSubsystem* EffectStack) const
+{
+	if (!GameState)
+	{
+		UE_LOG(LogTemp, Error, TEXT("FGCGMatchSnapshot::RestoreLive - GameState is null"));
+		return false;
+	}
+
+	// Resolve every player before touching anything so a failed restore changes nothing
+	TArray<AGCGPlayerState*, TInlineAllocator<4>> Targets;
+	for (const FGCGPlayerSnapshot& Player : Players)
+	{
+		AGCGPlayerState* Target = nullptr;
+		for (const TObjectPtr<APlayerState>& PlayerState : GameState->PlayerArray)
+		{
+			AGCGPlayerState* GCGPlayerState = Cast<AGCGPlayerState>(PlayerState);
+			if (GCGPlayerState && GCGPlayerState->GetPlayerID() == Player.PlayerID)
+			{
+				Target = GCGPlayerState;
+				break;
+			}
+		}
+
+		if (!Target)
+		{
+			UE_LOG(LogTemp, Error, TEXT("FGCGMatchSnapshot::RestoreLive - Player %d is no longer in the game"), Player.PlayerID);
+			return false;
+		}
+
+		Targets.Add(Target);
+	}
+
+	for (int32 i = 0; i < Players.Num(); ++i)
+	{
+		const FGCGPlayerSnapshot& Player = Players[i];
+		AGCGPlayerState* Target = Targets[i];
+
+		if (Target->bCardLocationIndexDirty)
+		{
+			Target->RebuildCardLocationIndex();
+		}
+
+		RestoreZones(Player, *Target, Target->CardLocationIndex);
+
+		Target->bHasLost = Player.bHasLost;
+		Target->bHasPriority = Player.bHasPriority;
+		Target->bHasPlacedResourceThisTurn = Player.bHasPlacedResourceThisTurn;
+		Target->bHasDrawnThisTurn = Player.bHasDrawnThisTurn;
+	}
+
+	GameState->TurnNumber = TurnNumber;
+	GameState->ActivePlayerID = ActivePlayerID;
+	GameState->CurrentPhase = CurrentPhase;
+	GameState->CurrentStartPhaseStep = CurrentStartPhaseStep;
+	GameState->CurrentEndPhaseStep = CurrentEndPhaseStep;
+	GameState->bAttackInProgress = bAttackInProgress;
+	GameState->CurrentAttack = CurrentAttack;
+	GameState->bGameInProgress = bGameInProgress;
+	GameState->bGameOver = bGameOver;
+	GameState->WinnerPlayerID = WinnerPlayerID;
+	GameState->MatchRandom = Random;
+	GameState->bIsTeamBattle = bIsTeamBattle;
+	GameState->TeamA = TeamA;
+	GameState->TeamB = TeamB;
+
+	if (AGCGGameModeBase* GameMode = GameState->GetWorld() ? GameState->GetWorld()->GetAuthGameMode<AGCGGameModeBase>() : nullptr)
+	{
+		GameMode->NextInstanceID = NextInstanceID;
+	}
+
+	RestoreEffectStack(EffectStack);
+
+	return true;
+}
+
+// ===== ACCESS =====
+
+const FGCGPlayerSnapshot* FGCGMatchSnapshot::FindPlayer(int32 PlayerID) const
+{
+	return Players.FindByPredicate([PlayerID](const FGCGPlayerSnapshot& Player) { return Player.PlayerID == PlayerID; });
+}
+
+int32 FGCGMatchSnapshot::CountSharedZones(const FGCGMatchSnapshot& Other) const
+{
+	int32 Shared = 0;
+
+	for (const FGCGPlayerSnapshot& Player : Players)
+	{
+		if (const FGCGPlayerSnapshot* OtherPlayer = Other.FindPlayer(Player.PlayerID))
+		{
+			for (int32 ZoneIndex = 0; ZoneIndex < GCGRules::NumZones; ++ZoneIndex)
+			{
+				Shared += &Player.Zones[ZoneIndex].Get() == &OtherPlayer->Zones[ZoneIndex].Get() ? 1 : 0;
+			}
+		}
+	}
+
+	return Shared;
+}
+
+// ===== INTERNAL =====
+
+void FGCGMatchSnapshot::CaptureEffectStack(const UGCGEffectStackSubsystem* Subsystem, const FGCGMatchSnapshot* Base)
+{
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	StackIndexCounter = Subsystem->StackIndexCounter;
+
+	if (Subsystem->EffectStack.Num() == 0 && Subsystem->DuringThisTurnEffects.Num() == 0 && Subsystem->UnitSnapshots.Num() == 0)
+	{
+		return;
+	}
+
+	if (Base && Base->EffectStack.IsValid()
+		&& AreEntriesIdentical(Subsystem->EffectStack, Base->EffectStack->EffectStack)
+		&& AreTurnEffectsIdentical(Subsystem->DuringThisTurnEffects, Base->EffectStack->DuringThisTurnEffects)
+		&& AreEntriesIdentical(Subsystem->UnitSnapshots, Base->EffectStack->UnitSnapshots))
+	{
+		EffectStack = Base->EffectStack;
+		return;
+	}
+
+	TSharedRef<FGCGEffectStackSnapshot, ESPMode::ThreadSafe> Captured = MakeShared<FGCGEffectStackSnapshot, ESPMode::ThreadSafe>();
+	Captured->EffectStack = Subsystem->EffectStack;
+	Captured->DuringThisTurnEffects = Subsystem->DuringThisTurnEffects;
+	Captured->UnitSnapshots = Subsystem->UnitSnapshots;
+	EffectStack = Captured;
+}
+
+void FGCGMatchSnapshot::RestoreEffectStack(UGCGEffectStackSubsystem* Subsystem) const
+{
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	Subsystem->StackIndexCounter = StackIndexCounter;
+
+	if (EffectStack.IsValid())
+	{
+		Subsystem->EffectStack = EffectStack->EffectStack;
+		Subsystem->DuringThisTurnEffects = EffectStack->DuringThisTurnEffects;
+		Subsystem->UnitSnapshots = EffectStack->UnitSnapshots;
+	}
+	else
+	{
+		Subsystem->EffectStack.Reset();
+		Subsystem->DuringThisTurnEffects.Reset();
+		Subsystem->UnitSnapshots.Reset();
+	}
+
+	Subsystem->RefreshOldestTrackedTurn();
+	Subsystem->RefreshFreeUnitSnapshots();
+}
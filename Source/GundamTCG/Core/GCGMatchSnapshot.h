@@ -0,0 +1,147 @@
+// GCGMatchSnapshot.h - Match State Snapshots
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Immutable, structurally shared captures of the full rules state for search, undo and rollback
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GundamTCG/Core/GCGMatchState.h"
+
+class AGCGGameState;
+class AGCGPlayerState;
+class UGCGEffectStackSubsystem;
+
+/** Captured effect stack (defined with the live capture code) */
+struct FGCGEffectStackSnapshot;
+
+/** One captured zone - immutable once published, shared by every snapshot it is unchanged in */
+using FGCGZoneSnapshotRef = TSharedRef<const TArray<FGCGCardInstance>, ESPMode::ThreadSafe>;
+
+/**
+ * Captured player: nine zones and the rules flags
+ */
+struct FGCGPlayerSnapshot
+{
+	int32 PlayerID = 0;
+
+	/** Indexed by zone (EGCGCardZone - 1) */
+	TArray<FGCGZoneSnapshotRef, TInlineAllocator<GCGRules::NumZones>> Zones;
+
+	/** Location index version of each zone when captured (FGCGCardLocationIndex::GetZoneVersion) */
+	TArray<uint64, TInlineAllocator<GCGRules::NumZones>> ZoneVersions;
+
+	bool bHasLost = false;
+	bool bHasPriority = false;
+	bool bHasPlacedResourceThisTurn = false;
+	bool bHasDrawnThisTurn = false;
+
+	const TArray<FGCGCardInstance>& GetZone(EGCGCardZone Zone) const { return *Zones[static_cast<int32>(Zone) - 1]; }
+};
+
+/**
+ * Match Snapshot
+ *
+ * Everything needed to put a match back exactly as it was: every zone of every
+ * player (card state, modifiers, order), turn / phase / step, the attack in
+ * progress, result, instance ID counter, random streams and the effect stack
+ * with its "during this turn" effects. Static data (catalog, deck lists) is not
+ * captured - it does not change during a match.
+ *
+ * Snapshots are immutable. Zones are held by shared reference, and Capture
+ * takes an optional base snapshot: every zone whose location index version
+ * (bumped by every move and RefreshCardHash) still matches the base, and an
+ * unchanged effect stack, is shared with it instead of copied. A search or undo
+ * history that captures after every action therefore only pays for the zones
+ * that action touched, without comparing the others card by card, and copying
+ * a snapshot is a handful of reference count bumps. Snapshots may be shared
+ * across threads.
+ *
+ * Works on both sides of the game:
+ * - Headless: Capture(FGCGMatchState) / Restore(FGCGMatchState) for AI search and tests
+ * - Live: CaptureLive / RestoreLive on the server's AGCGGameState, player states
+ *   and effect stack, for rolling back a rejected action
+ *
+ * Restoring assigns only the zones whose version differs, so unchanged zones keep
+ * their allocations and are not re-sent to clients.
+ */
+struct GUNDAMTCG_API FGCGMatchSnapshot
+{
+	// ===== PLAYERS =====
+
+	TArray<FGCGPlayerSnapshot, TInlineAllocator<4>> Players;
+
+	// ===== TURN =====
+
+	int32 TurnNumber = 0;
+	int32 ActivePlayerID = 0;
+	EGCGTurnPhase CurrentPhase = EGCGTurnPhase::NotStarted;
+	EGCGStartPhaseStep CurrentStartPhaseStep = EGCGStartPhaseStep::None;
+	EGCGEndPhaseStep CurrentEndPhaseStep = EGCGEndPhaseStep::None;
+
+	bool bAttackInProgress = false;
+	FGCGAttackData CurrentAttack;
+
+	// ===== RESULT =====
+
+	bool bGameInProgress = false;
+	bool bGameOver = false;
+	int32 WinnerPlayerID = -1;
+
+	// ===== MATCH DATA =====
+
+	int32 NextInstanceID = 1;
+	FGCGMatchRandom Random;
+
+	/** Team battle only */
+	bool bIsTeamBattle = false;
+	FGCGTeamInfo TeamA;
+	FGCGTeamInfo TeamB;
+
+	// ===== EFFECT STACK =====
+
+	/** Null when both the stack and the "during this turn" effects are empty */
+	TSharedPtr<const FGCGEffectStackSnapshot, ESPMode::ThreadSafe> EffectStack;
+	int32 StackIndexCounter = 0;
+
+	// ===== HEADLESS =====
+
+	/**
+	 * Capture a headless match
+	 * @param State The match
+	 * @param Base Optional earlier snapshot of the same match to share unchanged zones with
+	 */
+	static FGCGMatchSnapshot Capture(const FGCGMatchState& State, const FGCGMatchSnapshot* Base = nullptr);
+
+	/**
+	 * Put a headless match back to this snapshot (location indices are rebuilt)
+	 */
+	void Restore(FGCGMatchState& State) const;
+
+	// ===== LIVE =====
+
+	/**
+	 * Capture a live match (server only - reads the game mode's instance counter
+	 * and the match random streams)
+	 * @param GameState The match's game state (player states are taken from its PlayerArray)
+	 * @param EffectStack The effect stack subsystem (may be null)
+	 * @param Base Optional earlier snapshot of the same match to share unchanged zones with
+	 */
+	static FGCGMatchSnapshot CaptureLive(const AGCGGameState* GameState, const UGCGEffectStackSubsystem* EffectStack, const FGCGMatchSnapshot* Base = nullptr);
+
+	/**
+	 * Put a live match back to this snapshot
+	 * @return False if a captured player is no longer in the game state
+	 */
+	bool RestoreLive(AGCGGameState* GameState, UGCGEffectStackSubsystem* EffectStack) const;
+
+	// ===== ACCESS =====
+
+	const FGCGPlayerSnapshot* FindPlayer(int32 PlayerID) const;
+
+	/** Number of zones held by reference in both snapshots (structural sharing) */
+	int32 CountSharedZones(const FGCGMatchSnapshot& Other) const;
+
+private:
+	void CaptureEffectStack(const UGCGEffectStackSubsystem* Subsystem, const FGCGMatchSnapshot* Base);
+	void RestoreEffectStack(UGCGEffectStackSubsystem* Subsystem) const;
+};
@@ -0,0 +1,151 @@
+// GCGMatchState.cpp - Headless Match State Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGMatchState.h"
+
+// ===== PLAYER BOARD =====
+
+TArray<FGCGCardInstance>* FGCGPlayerBoard::GetZoneArray(EGCGCardZone Zone)
+{
+	return const_cast<TArray<FGCGCardInstance>*>(static_cast<const FGCGPlayerBoard*>(this)->GetZoneArray(Zone));
+}
+
+const TArray<FGCGCardInstance>* FGCGPlayerBoard::GetZoneArray(EGCGCardZone Zone) const
+{
+	switch (Zone)
+	{
+	case EGCGCardZone::Deck:
+		return &Deck;
+	case EGCGCardZone::ResourceDeck:
+		return &ResourceDeck;
+	case EGCGCardZone::Hand:
+		return &Hand;
+	case EGCGCardZone::ResourceArea:
+		return &ResourceArea;
+	case EGCGCardZone::BattleArea:
+		return &BattleArea;
+	case EGCGCardZone::ShieldStack:
+		return &ShieldStack;
+	case EGCGCardZone::BaseSection:
+		return &BaseSection;
+	case EGCGCardZone::Trash:
+		return &Trash;
+	case EGCGCardZone::Removal:
+		return &Removal;
+	default:
+		return nullptr;
+	}
+}
+
+FGCGCardInstance* FGCGPlayerBoard::FindCard(int32 InstanceID, EGCGCardZone* OutZone, int32* OutSlot)
+{
+	return const_cast<FGCGCardInstance*>(static_cast<const FGCGPlayerBoard*>(this)->FindCard(InstanceID, OutZone, OutSlot));
+}
+
+const FGCGCardInstance* FGCGPlayerBoard::FindCard(int32 InstanceID, EGCGCardZone* OutZone, int32* OutSlot) const
+{
+	// The engine keeps the index exact, so a miss is authoritative; hits are still checked against the slot
+	const FGCGCardLocation Location = CardLocations.Find(InstanceID);
+	if (!Location.IsValid())
+	{
+		return nullptr;
+	}
+
+	const TArray<FGCGCardInstance>* ZoneArray = GetZoneArray(Location.Zone);
+	if (!ZoneArray || !ZoneArray->IsValidIndex(Location.Slot) || (*ZoneArray)[Location.Slot].InstanceID != InstanceID)
+	{
+		ensureMsgf(false, TEXT("FGCGPlayerBoard::FindCard - Location index out of sync for instance %d"), InstanceID);
+		return nullptr;
+	}
+
+	if (OutZone) { *OutZone = Location.Zone; }
+	if (OutSlot) { *OutSlot = Location.Slot; }
+	return &(*ZoneArray)[Location.Slot];
+}
+
+FGCGCardInstance* FGCGPlayerBoard::FindCardInZone(int32 InstanceID, EGCGCardZone Zone)
+{
+	EGCGCardZone FoundZone = EGCGCardZone::None;
+	FGCGCardInstance* Found = FindCard(InstanceID, &FoundZone);
+	return (Found && FoundZone == Zone) ? Found : nullptr;
+}
+
+const FGCGCardInstance* FGCGPlayerBoard::FindCardInZone(int32 InstanceID, EGCGCardZone Zone) const
+{
+	EGCGCardZone FoundZone = EGCGCardZone::None;
+	const FGCGCardInstance* Found = FindCard(InstanceID, &FoundZone);
+	return (Found && FoundZone == Zone) ? Found : nullptr;
+}
+
+void FGCGPlayerBoard::IndexZone(EGCGCardZone Zone, int32 FirstSlot)
+{
+	if (const TArray<FGCGCardInstance>* ZoneArray = GetZoneArray(Zone))
+	{
+		CardLocations.IndexZone(Zone, *ZoneArray, FirstSlot);
+	}
+}
+
+void FGCGPlayerBoard::UnindexCard(int32 InstanceID)
+{
+	CardLocations.Remove(InstanceID);
+}
+
+void FGCGPlayerBoard::RebuildCardLocationIndex()
+{
+	CardLocations.Reset();
+
+	CardLocations.IndexZone(EGCGCardZone::Deck, Deck);
+	CardLocations.IndexZone(EGCGCardZone::ResourceDeck, ResourceDeck);
+	CardLocations.IndexZone(EGCGCardZone::Hand, Hand);
+	CardLocations.IndexZone(EGCGCardZone::ResourceArea, ResourceArea);
+	CardLocations.IndexZone(EGCGCardZone::BattleArea, BattleArea);
+	CardLocations.IndexZone(EGCGCardZone::ShieldStack, ShieldStack);
+	CardLocations.IndexZone(EGCGCardZone::BaseSection, BaseSection);
+	CardLocations.IndexZone(EGCGCardZone::Trash, Trash);
+	CardLocations.IndexZone(EGCGCardZone::Removal, Removal);
+}
+
+void FGCGPlayerBoard::ResetTurnFlags()
+{
+	bHasPlacedResourceThisTurn = false;
+	bHasDrawnThisTurn = false;
+}
+
+void FGCGPlayerBoard::Reset()
+{
+	Deck.Reset();
+	ResourceDeck.Reset();
+	Hand.Reset();
+	ResourceArea.Reset();
+	BattleArea.Reset();
+	ShieldStack.Reset();
+	BaseSection.Reset();
+	Trash.Reset();
+	Removal.Reset();
+
+	bHasLost = false;
+	ResetTurnFlags();
+
+	CardLocations.Reset();
+}
+
+// ===== MATCH STATE =====
+
+FGCGCardInstance* FGCGMatchState::FindCard(int32 InstanceID, int32* OutPlayerID, EGCGCardZone* OutZone)
+{
+	return const_cast<FGCGCardInstance*>(static_cast<const FGCGMatchState*>(this)->FindCard(InstanceID, OutPlayerID, OutZone));
+}
+
+const FGCGCardInstance* FGCGMatchState::FindCard(int32 InstanceID, int32* OutPlayerID, EGCGCardZone* OutZone) const
+{
+	for (const FGCGPlayerBoard& Board : Players)
+	{
+		if (const FGCGCardInstance* Found = Board.FindCard(InstanceID, OutZone))
+		{
+			if (OutPlayerID) { *OutPlayerID = Board.PlayerID; }
+			return Found;
+		}
+	}
+
+	return nullptr;
+}
@@ -0,0 +1,179 @@
+// GCGMatchState.h - Headless Match State
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Plain data for one 1v1 match - no actors, no world, cheap to copy
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GundamTCG/GCGTypes.h"
+#include "GundamTCG/Core/GCGRules.h"
+#include "GundamTCG/GameState/GCGMatchRandom.h"
+#include "GundamTCG/PlayerState/GCGCardLocationIndex.h"
+
+/**
+ * Player Board
+ *
+ * Headless counterpart of AGCGPlayerState: the same nine zone arrays under
+ * the same names and stacking order (stacked zones bottom → top, see
+ * FGCGOrderedZone), plus the per-turn flags. Because the member names match,
+ * every FGCGRules board helper works on both.
+ */
+struct GUNDAMTCG_API FGCGPlayerBoard
+{
+	/** Player ID (0-based) */
+	int32 PlayerID = 0;
+
+	// ===== ZONES =====
+
+	TArray<FGCGCardInstance> Deck;
+	TArray<FGCGCardInstance> ResourceDeck;
+	TArray<FGCGCardInstance> Hand;
+	TArray<FGCGCardInstance> ResourceArea;
+	TArray<FGCGCardInstance> BattleArea;
+	TArray<FGCGCardInstance> ShieldStack;
+	TArray<FGCGCardInstance> BaseSection;
+	TArray<FGCGCardInstance> Trash;
+	TArray<FGCGCardInstance> Removal;
+
+	// ===== FLAGS =====
+
+	bool bHasLost = false;
+	bool bHasPlacedResourceThisTurn = false;
+	bool bHasDrawnThisTurn = false;
+
+	// ===== ZONE ACCESS =====
+
+	/**
+	 * Get the array backing a zone
+	 * @return The zone array, or nullptr for EGCGCardZone::None
+	 */
+	TArray<FGCGCardInstance>* GetZoneArray(EGCGCardZone Zone);
+	const TArray<FGCGCardInstance>* GetZoneArray(EGCGCardZone Zone) const;
+
+	/**
+	 * Find a card in any zone via the location index
+	 * @param InstanceID The card instance ID
+	 * @param OutZone Optional: receives the zone
+	 * @param OutSlot Optional: receives the slot
+	 * @return The card, or nullptr if this player doesn't hold it
+	 */
+	FGCGCardInstance* FindCard(int32 InstanceID, EGCGCardZone* OutZone = nullptr, int32* OutSlot = nullptr);
+	const FGCGCardInstance* FindCard(int32 InstanceID, EGCGCardZone* OutZone = nullptr, int32* OutSlot = nullptr) const;
+
+	/**
+	 * Find a card only if it is in the given zone
+	 */
+	FGCGCardInstance* FindCardInZone(int32 InstanceID, EGCGCardZone Zone);
+	const FGCGCardInstance* FindCardInZone(int32 InstanceID, EGCGCardZone Zone) const;
+
+	/**
+	 * Re-index a zone from a slot onwards (after adds, removals or shuffles)
+	 */
+	void IndexZone(EGCGCardZone Zone, int32 FirstSlot = 0);
+
+	/**
+	 * Forget a card that left this player's zones
+	 */
+	void UnindexCard(int32 InstanceID);
+
+	/**
+	 * Rebuild the whole location index from the zone arrays
+	 */
+	void RebuildCardLocationIndex();
+
+	// ===== STATE HASH =====
+
+	/**
+	 * Re-key a card after changing it in place (see FGCGZobrist; also bumps its zone's version)
+	 */
+	void RefreshCardHash(const FGCGCardInstance& Card) { CardLocations.Refresh(Card); }
+
+	/**
+	 * XOR of the FGCGZobrist keys of every card on this board, kept current by the location index
+	 */
+	uint64 GetStateHash() const { return CardLocations.GetHash(); }
+
+	/**
+	 * Reset turn flags (start of turn)
+	 */
+	void ResetTurnFlags();
+
+	/**
+	 * Empty every zone and flag (keeps PlayerID)
+	 */
+	void Reset();
+
+private:
+	/** Snapshots share zones by the index's zone versions */
+	friend struct FGCGMatchSnapshot;
+
+	/** InstanceID → (zone, slot) and the board hash; the rules engine keeps it in sync */
+	FGCGCardLocationIndex CardLocations;
+};
+
+/**
+ * Match State
+ *
+ * Everything the rules need to continue a 1v1 match: both boards, turn and
+ * phase, the attack being resolved, the instance ID counter and the match's
+ * random streams. It holds no pointers into the engine, so copying it
+ * clones the match.
+ *
+ * Driven by FGCGRulesEngine. AGCGGameState / AGCGPlayerState hold the same
+ * information in replicated form for live matches.
+ */
+struct GUNDAMTCG_API FGCGMatchState
+{
+	// ===== PLAYERS =====
+
+	FGCGPlayerBoard Players[GCGRules::NumPlayers];
+
+	// ===== TURN =====
+
+	int32 TurnNumber = 0;
+	int32 ActivePlayerID = 0;
+	EGCGTurnPhase CurrentPhase = EGCGTurnPhase::NotStarted;
+
+	/** Attack being resolved (CurrentCombatStep == None when idle) */
+	FGCGAttackData CurrentAttack;
+
+	// ===== RESULT =====
+
+	bool bGameOver = false;
+	int32 WinnerPlayerID = -1;
+
+	// ===== MATCH DATA =====
+
+	/** Next card instance ID (IDs are dense, starting at 1) */
+	int32 NextInstanceID = 1;
+
+	/** Deck, AI and effect randomness */
+	FGCGMatchRandom Random;
+
+	// ===== ACCESS =====
+
+	FGCGPlayerBoard& GetPlayer(int32 PlayerID) { return Players[PlayerID]; }
+	const FGCGPlayerBoard& GetPlayer(int32 PlayerID) const { return Players[PlayerID]; }
+
+	FGCGPlayerBoard& GetOpponent(int32 PlayerID) { return Players[GetOpponentID(PlayerID)]; }
+	const FGCGPlayerBoard& GetOpponent(int32 PlayerID) const { return Players[GetOpponentID(PlayerID)]; }
+
+	FGCGPlayerBoard& GetActivePlayer() { return Players[ActivePlayerID]; }
+	const FGCGPlayerBoard& GetActivePlayer() const { return Players[ActivePlayerID]; }
+
+	static int32 GetOpponentID(int32 PlayerID) { return PlayerID == 0 ? 1 : 0; }
+
+	static bool IsValidPlayerID(int32 PlayerID) { return PlayerID >= 0 && PlayerID < GCGRules::NumPlayers; }
+
+	/** Is an attack waiting to be blocked / resolved? */
+	bool IsAttackInProgress() const { return CurrentAttack.CurrentCombatStep != EGCGCombatStep::None; }
+
+	/**
+	 * Find a card on either board
+	 * @param InstanceID The card instance ID
+	 * @param OutPlayerID Optional: receives the player holding the card
+	 * @param OutZone Optional: receives the zone
+	 */
+	FGCGCardInstance* FindCard(int32 InstanceID, int32* OutPlayerID = nullptr, EGCGCardZone* OutZone = nullptr);
+	const FGCGCardInstance* FindCard(int32 InstanceID, int32* OutPlayerID = nullptr, EGCGCardZone* OutZone = nullptr) const;
+};
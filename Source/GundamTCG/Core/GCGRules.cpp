@@ -0,0 +1,198 @@
+// GCGRules.cpp - Shared Rules Helpers Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGRules.h"
+
+const TCHAR* LexToString(EGCGRulesResult Result)
+{
+	switch (Result)
+	{
+	case EGCGRulesResult::Success:			return TEXT("Success");
+	case EGCGRulesResult::GameOver:			return TEXT("GameOver");
+	case EGCGRulesResult::WrongPhase:		return TEXT("WrongPhase");
+	case EGCGRulesResult::NotYourTurn:		return TEXT("NotYourTurn");
+	case EGCGRulesResult::CardNotFound:		return TEXT("CardNotFound");
+	case EGCGRulesResult::WrongZone:		return TEXT("WrongZone");
+	case EGCGRulesResult::UnknownCard:		return TEXT("UnknownCard");
+	case EGCGRulesResult::LevelTooHigh:		return TEXT("LevelTooHigh");
+	case EGCGRulesResult::CannotPayCost:	return TEXT("CannotPayCost");
+	case EGCGRulesResult::ZoneFull:			return TEXT("ZoneFull");
+	case EGCGRulesResult::InvalidTarget:	return TEXT("InvalidTarget");
+	case EGCGRulesResult::CannotAttack:		return TEXT("CannotAttack");
+	case EGCGRulesResult::CannotBlock:		return TEXT("CannotBlock");
+	case EGCGRulesResult::AttackInProgress:	return TEXT("AttackInProgress");
+	case EGCGRulesResult::NoAttack:			return TEXT("NoAttack");
+	default:								return TEXT("Unknown");
+	}
+}
+
+// ===== CARD DATA =====
+
+FName FGCGRules::GetEXBaseTokenName()
+{
+	static const FName EXBaseName(TEXT("EXBase"));
+	return EXBaseName;
+}
+
+FName FGCGRules::GetEXResourceTokenName()
+{
+	static const FName EXResourceName(TEXT("EXResource"));
+	return EXResourceName;
+}
+
+// ===== ZONES =====
+
+int32 FGCGRules::GetZoneMaxCapacity(EGCGCardZone Zone)
+{
+	switch (Zone)
+	{
+	case EGCGCardZone::BattleArea:
+		return GCGRules::MaxUnits;
+
+	case EGCGCardZone::ResourceArea:
+		return GCGRules::MaxResources;
+
+	case EGCGCardZone::BaseSection:
+		return GCGRules::MaxBases;
+
+	default:
+		// Hand, decks, shields, Trash and Removal are unlimited
+		return -1;
+	}
+}
+
+bool FGCGRules::IsCardTypeAllowedInZone(EGCGCardZone Zone, EGCGCardType CardType)
+{
+	switch (Zone)
+	{
+	case EGCGCardZone::BattleArea:
+		// Only Units can be in Battle Area
+		return CardType == EGCGCardType::Unit;
+
+	case EGCGCardZone::BaseSection:
+		// Only Base cards (or EX Base tokens)
+		return CardType == EGCGCardType::Base;
+
+	case EGCGCardZone::ResourceArea:
+	case EGCGCardZone::Hand:
+	case EGCGCardZone::Deck:
+	case EGCGCardZone::ResourceDeck:
+	case EGCGCardZone::ShieldStack:
+	case EGCGCardZone::Trash:
+	case EGCGCardZone::Removal:
+		// These zones accept any card type
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+bool FGCGRules::IsZoneOrdered(EGCGCardZone Zone)
+{
+	return Zone == EGCGCardZone::Deck || Zone == EGCGCardZone::ResourceDeck || Zone == EGCGCardZone::ShieldStack;
+}
+
+void FGCGRules::ApplyZoneEntryRules(FGCGCardInstance& Card, EGCGCardZone Zone)
+{
+	switch (Zone)
+	{
+	case EGCGCardZone::BattleArea:
+		// Units enter battle area rested (unless effect says otherwise)
+		Card.bIsActive = false;
+		break;
+
+	case EGCGCardZone::ResourceArea:
+	case EGCGCardZone::Hand:
+		// Resources enter active; cards in hand are always active (conceptually)
+		Card.bIsActive = true;
+		break;
+
+	case EGCGCardZone::Trash:
+	case EGCGCardZone::Removal:
+		// Clear all state when going to trash/removal
+		Card.bIsActive = false;
+		Card.DamageCounters = 0;
+		Card.ActiveModifiers.Empty();
+		Card.RefreshModifierTotals();
+		Card.ClearTemporaryKeywords();
+		break;
+
+	default:
+		break;
+	}
+}
+
+bool FGCGRules::ApplyZoneExitRules(FGCGCardInstance& Card, EGCGCardZone Zone)
+{
+	// Leaving play breaks a Link pairing
+	const bool bLeavingPlay = Zone == EGCGCardZone::BattleArea || Zone == EGCGCardZone::ResourceArea || Zone == EGCGCardZone::BaseSection;
+	if (bLeavingPlay && Card.PairedCardInstanceID != 0)
+	{
+		Card.PairedCardInstanceID = 0;
+		return true;
+	}
+
+	return false;
+}
+
+// ===== MODIFIERS =====
+
+void FGCGRules::AddModifier(FGCGCardInstance& Card, EGCGModifierType ModifierType, int32 Amount,
+	EGCGModifierDuration Duration, int32 SourceInstanceID, int32 TurnNumber)
+{
+	FGCGActiveModifier Modifier;
+	Modifier.ModifierType = ModifierType;
+	Modifier.Amount = Amount;
+	Modifier.Duration = Duration;
+	Modifier.SourceInstanceID = SourceInstanceID;
+	Modifier.CreatedOnTurn = TurnNumber;
+
+	Card.ActiveModifiers.Add(Modifier);
+	Card.RefreshModifierTotals();
+}
+
+int32 FGCGRules::CleanupExpiredModifiers(FGCGCardInstance& Card, bool bEndOfTurn, bool bEndOfBattle)
+{
+	if (Card.ActiveModifiers.Num() == 0)
+	{
+		return 0;
+	}
+
+	const int32 NumRemoved = Card.ActiveModifiers.RemoveAll([bEndOfTurn, bEndOfBattle](const FGCGActiveModifier& Modifier)
+	{
+		// Instant modifiers shouldn't be stored at all
+		return Modifier.Duration == EGCGModifierDuration::Instant
+			|| (bEndOfTurn && Modifier.Duration == EGCGModifierDuration::UntilEndOfTurn)
+			|| (bEndOfBattle && Modifier.Duration == EGCGModifierDuration::UntilEndOfBattle);
+	});
+
+	if (NumRemoved > 0)
+	{
+		Card.RefreshModifierTotals();
+	}
+
+	return NumRemoved;
+}
+
+// ===== COMBAT =====
+
+FGCGUnitCombatOutcome FGCGRules::ResolveUnitCombat(int32 AttackerAP, int32 AttackerHPLeft, int32 DefenderAP, int32 DefenderHPLeft, bool bFirstStrike)
+{
+	FGCGUnitCombatOutcome Outcome;
+	Outcome.bFirstStrike = bFirstStrike;
+
+	Outcome.DamageToDefender = FMath::Max(0, AttackerAP);
+	Outcome.bDefenderDestroyed = Outcome.DamageToDefender > 0 && Outcome.DamageToDefender >= DefenderHPLeft;
+
+	// First Strike: a destroyed defender never deals its damage
+	if (bFirstStrike && Outcome.bDefenderDestroyed)
+	{
+		return Outcome;
+	}
+
+	Outcome.DamageToAttacker = FMath::Max(0, DefenderAP);
+	Outcome.bAttackerDestroyed = Outcome.DamageToAttacker > 0 && Outcome.DamageToAttacker >= AttackerHPLeft;
+
+	return Outcome;
+}
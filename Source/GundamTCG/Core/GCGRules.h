@@ -0,0 +1,830 @@
+// GCGRules.h - Shared Rules Helpers
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Rule calculations shared by the headless rules engine and the actor-based subsystems
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "GundamTCG/GCGTypes.h"
+#include "GundamTCG/Cards/GCGCardCatalog.h"
+
+// Fixed numbers from the comprehensive rules (1v1)
+namespace GCGRules
+{
+	inline constexpr int32 NumPlayers = 2;
+	inline constexpr int32 NumZones = 9;
+	inline constexpr int32 MainDeckSize = 50;
+	inline constexpr int32 ResourceDeckSize = 10;
+	inline constexpr int32 StartingHandSize = 5;
+	inline constexpr int32 StartingShields = 6;
+	inline constexpr int32 MaxUnits = 6;
+	inline constexpr int32 MaxResources = 15;
+	inline constexpr int32 MaxBases = 1;
+	inline constexpr int32 HandLimit = 10;
+}
+
+/**
+ * Where damage dealt to a player lands
+ */
+enum class EGCGPlayerDamageTarget : uint8
+{
+	Base,		// Base (or EX Base) takes AP as damage
+	Shield,		// Top shield is destroyed (Burst)
+	Player		// No Base, no shields - the player is defeated
+};
+
+/**
+ * Why a rules action was accepted or rejected
+ * (an enum rather than a message, so rejected actions cost nothing to report)
+ */
+enum class EGCGRulesResult : uint8
+{
+	Success,
+	GameOver,
+	WrongPhase,
+	NotYourTurn,
+	CardNotFound,
+	WrongZone,
+	UnknownCard,
+	LevelTooHigh,
+	CannotPayCost,
+	ZoneFull,
+	InvalidTarget,
+	CannotAttack,
+	CannotBlock,
+	AttackInProgress,
+	NoAttack
+};
+
+/** Readable name for logs and simulator reports */
+GUNDAMTCG_API const TCHAR* LexToString(EGCGRulesResult Result);
+
+/**
+ * Outcome of one unit-vs-unit battle (nothing applied yet)
+ */
+struct FGCGUnitCombatOutcome
+{
+	int32 DamageToAttacker = 0;
+	int32 DamageToDefender = 0;
+	bool bAttackerDestroyed = false;
+	bool bDefenderDestroyed = false;
+
+	/** Attacker struck first (and the defender never hit back if destroyed) */
+	bool bFirstStrike = false;
+};
+
+/**
+ * Rules
+ *
+ * Pure rule calculations with no UObject or world dependency. Board helpers
+ * are templates over any type exposing the nine zone arrays by their usual
+ * names (Deck, Hand, ResourceArea, BattleArea, ShieldStack, BaseSection, ...),
+ * so FGCGPlayerBoard (headless simulation) and AGCGPlayerState (live match)
+ * run exactly the same code.
+ *
+ * The zone-move, play-card and combat flows live here too, so the rules
+ * engine and the live subsystems (UGCGZoneSubsystem, UGCGPlayerActionSubsystem,
+ * UGCGCombatSubsystem) are thin adapters over one implementation. Flows never
+ * trigger effects: each caller resolves timings with its own effect system.
+ */
+struct GUNDAMTCG_API FGCGRules
+{
+	// ===== CARD DATA =====
+
+	/**
+	 * View a card's definition (what every rule below reads; never copies the card)
+	 * @param Catalog The match catalog
+	 * @param Card The card instance
+	 * @return View of the card, invalid if the catalog doesn't know the card
+	 */
+	static FGCGCardView GetCardView(const FGCGCardCatalog& Catalog, const FGCGCardInstance& Card)
+	{
+		const FGCGCardView View = Catalog.GetCardView(Card.CardId);
+		return View ? View : Catalog.FindCardView(Card.CardNumber);
+	}
+
+	/**
+	 * Resolve a card's full definition (names, text, art - for presentation code)
+	 * @param Catalog The match catalog
+	 * @param Card The card instance
+	 * @return Card data, or nullptr if the catalog doesn't know the card
+	 */
+	static const FGCGCardData* GetCardData(const FGCGCardCatalog& Catalog, const FGCGCardInstance& Card)
+	{
+		if (const FGCGCardData* CardData = Catalog.GetCard(Card.CardId))
+		{
+			return CardData;
+		}
+		return Catalog.FindCard(Card.CardNumber);
+	}
+
+	/** Card type, treating unknown cards as Units */
+	static EGCGCardType GetCardType(const FGCGCardCatalog& Catalog, const FGCGCardInstance& Card)
+	{
+		return GetCardView(Catalog, Card).GetCardType();
+	}
+
+	/** Printed or temporary keyword */
+	static bool HasKeyword(const FGCGCardCatalog& Catalog, const FGCGCardInstance& Card, EGCGKeyword Keyword)
+	{
+		return Card.HasTemporaryKeyword(Keyword) || GetCardView(Catalog, Card).HasKeyword(Keyword);
+	}
+
+	/** Total X of a keyword (printed + temporary, stacking) */
+	static int32 GetKeywordValue(const FGCGCardCatalog& Catalog, const FGCGCardInstance& Card, EGCGKeyword Keyword)
+	{
+		return GetCardView(Catalog, Card).GetTotalKeywordValue(Keyword) + Card.GetTotalKeywordValue(Keyword, nullptr);
+	}
+
+	/** AP with modifiers (0 for unknown cards) */
+	static int32 GetTotalAP(const FGCGCardCatalog& Catalog, const FGCGCardInstance& Card)
+	{
+		const FGCGCardView View = GetCardView(Catalog, Card);
+		return View ? FMath::Max(0, View.GetAP() + Card.ModifierAP) : 0;
+	}
+
+	/** HP with modifiers (0 for unknown cards) */
+	static int32 GetTotalHP(const FGCGCardCatalog& Catalog, const FGCGCardInstance& Card)
+	{
+		const FGCGCardView View = GetCardView(Catalog, Card);
+		return View ? FMath::Max(0, View.GetHP() + Card.ModifierHP) : 0;
+	}
+
+	/** Cost with modifiers (0 for unknown cards) */
+	static int32 GetTotalCost(const FGCGCardCatalog& Catalog, const FGCGCardInstance& Card)
+	{
+		const FGCGCardView View = GetCardView(Catalog, Card);
+		return View ? FMath::Max(0, View.GetCost() + Card.ModifierCost) : 0;
+	}
+
+	/** Damage has reached HP (unknown cards are never destroyed) */
+	static bool IsDestroyed(const FGCGCardCatalog& Catalog, const FGCGCardInstance& Card)
+	{
+		return GetCardView(Catalog, Card) && Card.DamageCounters >= GetTotalHP(Catalog, Card);
+	}
+
+	/** Token type name of the EX Base */
+	static FName GetEXBaseTokenName();
+
+	/** Token type name of the EX Resource */
+	static FName GetEXResourceTokenName();
+
+	// ===== ZONES =====
+
+	/**
+	 * Maximum number of cards a zone can hold
+	 * @return Capacity, or -1 for unlimited
+	 */
+	static int32 GetZoneMaxCapacity(EGCGCardZone Zone);
+
+	/**
+	 * Can a card of this type sit in this zone?
+	 */
+	static bool IsCardTypeAllowedInZone(EGCGCardZone Zone, EGCGCardType CardType);
+
+	/**
+	 * Is this zone a stack (bottom → top order matters)?
+	 */
+	static bool IsZoneOrdered(EGCGCardZone Zone);
+
+	/**
+	 * State changes for a card entering a zone (rest/activate, clearing state on Trash/Removal)
+	 */
+	static void ApplyZoneEntryRules(FGCGCardInstance& Card, EGCGCardZone Zone);
+
+	/**
+	 * State changes for a card leaving a zone (leaving play breaks a pairing)
+	 * @return True if a pairing was broken
+	 */
+	static bool ApplyZoneExitRules(FGCGCardInstance& Card, EGCGCardZone Zone);
+
+	// ===== MODIFIERS =====
+
+	/**
+	 * Add a stat modifier and refresh the cached totals
+	 */
+	static void AddModifier(FGCGCardInstance& Card, EGCGModifierType ModifierType, int32 Amount,
+		EGCGModifierDuration Duration, int32 SourceInstanceID, int32 TurnNumber);
+
+	/**
+	 * Drop modifiers that expire now
+	 * @return Number of modifiers removed
+	 */
+	static int32 CleanupExpiredModifiers(FGCGCardInstance& Card, bool bEndOfTurn, bool bEndOfBattle);
+
+	// ===== COMBAT =====
+
+	/**
+	 * Does the attacker deal its damage first? (First Strike on the attacker only)
+	 */
+	static bool HasFirstStrikeAdvantage(const FGCGCardCatalog& Catalog, const FGCGCardInstance& Attacker, const FGCGCardInstance& Defender)
+	{
+		return HasKeyword(Catalog, Attacker, EGCGKeyword::FirstStrike) && !HasKeyword(Catalog, Defender, EGCGKeyword::FirstStrike);
+	}
+
+	/**
+	 * HP a card has left before it is destroyed
+	 */
+	static int32 GetRemainingHP(const FGCGCardCatalog& Catalog, const FGCGCardInstance& Card)
+	{
+		return GetTotalHP(Catalog, Card) - Card.DamageCounters;
+	}
+
+	/**
+	 * Simultaneous battle damage, or First Strike damage with no retaliation from a destroyed defender
+	 * @param AttackerAP Attacker's combat AP (Support included)
+	 * @param AttackerHPLeft Attacker's remaining HP
+	 * @param DefenderAP Defender's combat AP (Support included)
+	 * @param DefenderHPLeft Defender's remaining HP
+	 * @param bFirstStrike Attacker has First Strike advantage
+	 */
+	static FGCGUnitCombatOutcome ResolveUnitCombat(int32 AttackerAP, int32 AttackerHPLeft, int32 DefenderAP, int32 DefenderHPLeft, bool bFirstStrike);
+
+	/**
+	 * Shields destroyed by one instance of damage (Suppression: 1 per point of damage)
+	 */
+	static int32 GetShieldsToBreak(int32 Damage, bool bSuppression)
+	{
+		return bSuppression ? FMath::Max(1, Damage) : 1;
+	}
+
+	// ===== BOARD HELPERS =====
+	// Helpers that change cards in place re-key them on the board (RefreshCardHash)
+
+	/**
+	 * Number of active (unrested) resources
+	 */
+	template<typename BoardType>
+	static int32 CountActiveResources(const BoardType& Board)
+	{
+		int32 ActiveCount = 0;
+		for (const FGCGCardInstance& Resource : Board.ResourceArea)
+		{
+			ActiveCount += Resource.bIsActive ? 1 : 0;
+		}
+		return ActiveCount;
+	}
+
+	/**
+	 * Can the player rest enough resources for a cost?
+	 */
+	template<typename BoardType>
+	static bool CanPayCost(const BoardType& Board, int32 Cost)
+	{
+		return Cost <= 0 || CountActiveResources(Board) >= Cost;
+	}
+
+	/**
+	 * Rest resources to pay a cost (nothing is rested if the cost can't be paid in full)
+	 * @return True if paid
+	 */
+	template<typename BoardType>
+	static bool PayCost(BoardType& Board, int32 Cost)
+	{
+		if (!CanPayCost(Board, Cost))
+		{
+			return false;
+		}
+
+		int32 RemainingCost = Cost;
+		for (FGCGCardInstance& Resource : Board.ResourceArea)
+		{
+			if (RemainingCost <= 0)
+			{
+				break;
+			}
+
+			if (Resource.bIsActive)
+			{
+				Resource.bIsActive = false;
+				Board.RefreshCardHash(Resource);
+				--RemainingCost;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Active Step: set every rested card in play active
+	 * @return Number of cards activated
+	 */
+	template<typename BoardType>
+	static int32 ActivateAll(BoardType& Board)
+	{
+		int32 ActivatedCount = 0;
+		for (TArray<FGCGCardInstance>* Zone : { &Board.BattleArea, &Board.ResourceArea, &Board.BaseSection })
+		{
+			for (FGCGCardInstance& Card : *Zone)
+			{
+				if (!Card.bIsActive)
+				{
+					Card.bIsActive = true;
+					Board.RefreshCardHash(Card);
+					++ActivatedCount;
+				}
+			}
+		}
+		return ActivatedCount;
+	}
+
+	/**
+	 * Number of Units in the Battle Area (paired Pilots don't take a Unit slot)
+	 */
+	template<typename BoardType>
+	static int32 CountUnits(const FGCGCardCatalog& Catalog, const BoardType& Board)
+	{
+		int32 UnitCount = 0;
+		for (const FGCGCardInstance& Card : Board.BattleArea)
+		{
+			UnitCount += GetCardType(Catalog, Card) != EGCGCardType::Pilot ? 1 : 0;
+		}
+		return UnitCount;
+	}
+
+	/**
+	 * AP a unit adds to an attack or block: its own AP plus Support from its allies
+	 */
+	template<typename BoardType>
+	static int32 GetCombatAP(const FGCGCardCatalog& Catalog, const BoardType& Board, const FGCGCardInstance& Unit)
+	{
+		return GetTotalAP(Catalog, Unit) + GetSupportBuff(Catalog, Board, Unit);
+	}
+
+	/**
+	 * Support X from every other unit in the Battle Area
+	 */
+	template<typename BoardType>
+	static int32 GetSupportBuff(const FGCGCardCatalog& Catalog, const BoardType& Board, const FGCGCardInstance& Unit)
+	{
+		int32 TotalBuff = 0;
+		for (const FGCGCardInstance& Ally : Board.BattleArea)
+		{
+			if (Ally.InstanceID != Unit.InstanceID)
+			{
+				TotalBuff += GetKeywordValue(Catalog, Ally, EGCGKeyword::Support);
+			}
+		}
+		return TotalBuff;
+	}
+
+	/**
+	 * Where the next instance of damage to this player lands (Base → Shield → defeat)
+	 */
+	template<typename BoardType>
+	static EGCGPlayerDamageTarget GetPlayerDamageTarget(const BoardType& Board)
+	{
+		if (Board.BaseSection.Num() > 0)
+		{
+			return EGCGPlayerDamageTarget::Base;
+		}
+		return Board.ShieldStack.Num() > 0 ? EGCGPlayerDamageTarget::Shield : EGCGPlayerDamageTarget::Player;
+	}
+
+	/**
+	 * Repair X: damaged cards in play recover X at end of turn
+	 * @return Total damage removed
+	 */
+	template<typename BoardType>
+	static int32 ApplyRepair(const FGCGCardCatalog& Catalog, BoardType& Board)
+	{
+		int32 TotalHealing = 0;
+		for (TArray<FGCGCardInstance>* Zone : { &Board.BattleArea, &Board.BaseSection })
+		{
+			for (FGCGCardInstance& Card : *Zone)
+			{
+				if (Card.DamageCounters <= 0)
+				{
+					continue;
+				}
+
+				const int32 RepairValue = GetKeywordValue(Catalog, Card, EGCGKeyword::Repair);
+				if (RepairValue > 0)
+				{
+					const int32 Healing = FMath::Min(RepairValue, Card.DamageCounters);
+					Card.DamageCounters -= Healing;
+					Board.RefreshCardHash(Card);
+					TotalHealing += Healing;
+				}
+			}
+		}
+		return TotalHealing;
+	}
+
+	/**
+	 * Cleanup Step: expire "this turn" modifiers and temporary keywords on cards in play
+	 */
+	template<typename BoardType>
+	static void CleanupEndOfTurn(BoardType& Board)
+	{
+		for (TArray<FGCGCardInstance>* Zone : { &Board.BattleArea, &Board.BaseSection })
+		{
+			for (FGCGCardInstance& Card : *Zone)
+			{
+				CleanupExpiredModifiers(Card, true, false);
+				Card.ClearTemporaryKeywords();
+				Card.bHasAttackedThisTurn = false;
+				Card.ActivationCountThisTurn = 0;
+				Board.RefreshCardHash(Card);
+			}
+		}
+	}
+
+	/**
+	 * Hand Step: how many cards must be discarded
+	 */
+	template<typename BoardType>
+	static int32 GetHandExcess(const BoardType& Board)
+	{
+		return FMath::Max(0, Board.Hand.Num() - GCGRules::HandLimit);
+	}
+
+	// ===== ZONE MOVES =====
+	// The only code that moves cards between zones: the rules engine calls these directly,
+	// UGCGZoneSubsystem wraps them with effect registration and its zone-changed event
+
+	/**
+	 * Move cards from one zone to another and keep the board's location index current.
+	 * Exit / entry rules are applied, the source is compacted in one pass and the cards
+	 * are added in one go (cards put into a stacked zone go to the bottom, first card lowest).
+	 * Nothing moves unless every card is in FromZone exactly once; limits are the caller's.
+	 * @param Cards Cards to move, in order (updated with their new state; a card passed in
+	 *   place is moved out of its zone, a copy is copied)
+	 * @return True if the cards moved
+	 */
+	template<typename BoardType>
+	static bool MoveCards(BoardType& Board, TArrayView<FGCGCardInstance> Cards, EGCGCardZone FromZone, EGCGCardZone ToZone)
+	{
+		TArray<FGCGCardInstance>* FromArray = Board.GetZoneArray(FromZone);
+		TArray<FGCGCardInstance>* ToArray = Board.GetZoneArray(ToZone);
+		if (!FromArray || !ToArray || FromZone == ToZone)
+		{
+			return false;
+		}
+
+		if (Cards.Num() == 0)
+		{
+			return true;
+		}
+
+		// Source slots via the location index (no scan); also catches a card listed twice
+		TArray<int32, TInlineAllocator<8>> Slots;
+		TBitArray<> RemovedSlots(false, FromArray->Num());
+		for (const FGCGCardInstance& Card : Cards)
+		{
+			EGCGCardZone FoundZone = EGCGCardZone::None;
+			int32 Slot = INDEX_NONE;
+			if (!Board.FindCard(Card.InstanceID, &FoundZone, &Slot) || FoundZone != FromZone || RemovedSlots[Slot])
+			{
+				return false;
+			}
+			RemovedSlots[Slot] = true;
+			Slots.Add(Slot);
+		}
+
+		TArray<FGCGCardInstance, TInlineAllocator<1>> MovedCards;
+		MovedCards.Reserve(Cards.Num());
+		for (int32 i = 0; i < Cards.Num(); ++i)
+		{
+			FGCGCardInstance& Card = Cards[i];
+			ApplyZoneExitRules(Card, FromZone);
+			Card.CurrentZone = ToZone;
+			ApplyZoneEntryRules(Card, ToZone);
+
+			FGCGCardInstance& SourceCard = (*FromArray)[Slots[i]];
+			if (&Card == &SourceCard)
+			{
+				MovedCards.Add(MoveTemp(SourceCard));
+			}
+			else
+			{
+				MovedCards.Add(Card);
+			}
+		}
+
+		// One compaction pass over the source, starting at the first removed slot
+		const int32 FirstRemovedSlot = RemovedSlots.Find(true);
+		int32 WriteSlot = FirstRemovedSlot;
+		for (int32 ReadSlot = FirstRemovedSlot + 1; ReadSlot < FromArray->Num(); ++ReadSlot)
+		{
+			if (!RemovedSlots[ReadSlot])
+			{
+				(*FromArray)[WriteSlot++] = MoveTemp((*FromArray)[ReadSlot]);
+			}
+		}
+		FromArray->SetNum(WriteSlot, EAllowShrinking::No);
+		Board.IndexZone(FromZone, FirstRemovedSlot);
+
+		if (IsZoneOrdered(ToZone))
+		{
+			// Single shift for the whole batch
+			ToArray->InsertDefaulted(0, MovedCards.Num());
+			for (int32 i = 0; i < MovedCards.Num(); ++i)
+			{
+				(*ToArray)[i] = MoveTemp(MovedCards[i]);
+			}
+			Board.IndexZone(ToZone);
+		}
+		else
+		{
+			const int32 FirstNewSlot = ToArray->Num();
+			for (FGCGCardInstance& Card : MovedCards)
+			{
+				ToArray->Add(MoveTemp(Card));
+			}
+			Board.IndexZone(ToZone, FirstNewSlot);
+		}
+
+		return true;
+	}
+
+	/**
+	 * Move one card, wherever it is, to another zone
+	 * @return True if the card moved
+	 */
+	template<typename BoardType>
+	static bool MoveCard(BoardType& Board, int32 InstanceID, EGCGCardZone ToZone)
+	{
+		EGCGCardZone FromZone = EGCGCardZone::None;
+		FGCGCardInstance* Card = Board.FindCard(InstanceID, &FromZone);
+		return Card && MoveCards(Board, MakeArrayView(Card, 1), FromZone, ToZone);
+	}
+
+	/**
+	 * Move the top card of a stacked zone (stored bottom → top, so the last element)
+	 * @return Instance ID of the card moved, or 0 if the zone is empty
+	 */
+	template<typename BoardType>
+	static int32 MoveTopCard(BoardType& Board, EGCGCardZone FromZone, EGCGCardZone ToZone)
+	{
+		TArray<FGCGCardInstance>* FromArray = Board.GetZoneArray(FromZone);
+		if (!FromArray || FromArray->Num() == 0)
+		{
+			return 0;
+		}
+
+		FGCGCardInstance& TopCard = FromArray->Last();
+		const int32 InstanceID = TopCard.InstanceID;
+		return MoveCards(Board, MakeArrayView(&TopCard, 1), FromZone, ToZone) ? InstanceID : 0;
+	}
+
+	// ===== PLAYING CARDS =====
+
+	/**
+	 * Can a card in hand be played (turn and phase aside)?
+	 * Lv is checked against every resource in play, active or rested.
+	 * @param TargetInstanceID The unpaired Unit a Pilot is played onto (ignored for other types)
+	 */
+	template<typename BoardType>
+	static EGCGRulesResult CanPlayCard(const FGCGCardCatalog& Catalog, const BoardType& Board, int32 CardInstanceID, int32 TargetInstanceID)
+	{
+		const FGCGCardInstance* Card = Board.FindCardInZone(CardInstanceID, EGCGCardZone::Hand);
+		if (!Card)
+		{
+			return EGCGRulesResult::CardNotFound;
+		}
+
+		const FGCGCardView CardView = GetCardView(Catalog, *Card);
+		if (!CardView)
+		{
+			return EGCGRulesResult::UnknownCard;
+		}
+
+		if (CardView.GetLevel() > Board.ResourceArea.Num())
+		{
+			return EGCGRulesResult::LevelTooHigh;
+		}
+
+		if (!CanPayCost(Board, GetTotalCost(Catalog, *Card)))
+		{
+			return EGCGRulesResult::CannotPayCost;
+		}
+
+		switch (CardView.GetCardType())
+		{
+		case EGCGCardType::Unit:
+			return CountUnits(Catalog, Board) < GCGRules::MaxUnits ? EGCGRulesResult::Success : EGCGRulesResult::ZoneFull;
+
+		case EGCGCardType::Pilot:
+		{
+			const FGCGCardInstance* Unit = Board.FindCardInZone(TargetInstanceID, EGCGCardZone::BattleArea);
+			if (!Unit || Unit->PairedCardInstanceID != 0 || GetCardType(Catalog, *Unit) != EGCGCardType::Unit)
+			{
+				return EGCGRulesResult::InvalidTarget;
+			}
+			return EGCGRulesResult::Success;
+		}
+
+		case EGCGCardType::Base:
+		case EGCGCardType::Command:
+			return EGCGRulesResult::Success;
+
+		default:
+			// Resources and tokens are never played from hand
+			return EGCGRulesResult::WrongZone;
+		}
+	}
+
+	/**
+	 * Play a card from hand once CanPlayCard has passed: pay its cost, then
+	 *   Unit    → Battle Area, deployed this turn
+	 *   Pilot   → Battle Area, paired with its Unit and adding its AP / HP to it
+	 *   Base    → Base Section, replacing the current Base (a token is removed, a card trashed)
+	 *   Command → Trash (its effects resolve from there)
+	 * OnDeploy / WhenPaired / OnPlay effects are left to the caller.
+	 * @param MoveFn How the caller moves a card to a zone: FGCGRules::MoveCard, or a wrapper
+	 *   that also keeps its effect listeners current
+	 * @return True if the card was played
+	 */
+	template<typename BoardType>
+	static bool PlayCard(const FGCGCardCatalog& Catalog, BoardType& Board, int32 CardInstanceID, int32 TargetInstanceID,
+		int32 TurnNumber, TFunctionRef<bool(int32 InstanceID, EGCGCardZone ToZone)> MoveFn)
+	{
+		const FGCGCardInstance* Card = Board.FindCardInZone(CardInstanceID, EGCGCardZone::Hand);
+		const FGCGCardView CardView = Card ? GetCardView(Catalog, *Card) : FGCGCardView();
+		if (!CardView || !PayCost(Board, GetTotalCost(Catalog, *Card)))
+		{
+			return false;
+		}
+
+		switch (CardView.GetCardType())
+		{
+		case EGCGCardType::Unit:
+		case EGCGCardType::Base:
+		{
+			const EGCGCardZone Zone = CardView.GetCardType() == EGCGCardType::Unit ? EGCGCardZone::BattleArea : EGCGCardZone::BaseSection;
+
+			// Only one Base: the current one (usually the EX Base) leaves play
+			if (Zone == EGCGCardZone::BaseSection && Board.BaseSection.Num() > 0)
+			{
+				const FGCGCardInstance& OldBase = Board.BaseSection[0];
+				MoveFn(OldBase.InstanceID, OldBase.bIsToken ? EGCGCardZone::Removal : EGCGCardZone::Trash);
+			}
+
+			if (!MoveFn(CardInstanceID, Zone))
+			{
+				return false;
+			}
+
+			FGCGCardInstance& Deployed = *Board.FindCardInZone(CardInstanceID, Zone);
+			Deployed.TurnDeployed = TurnNumber;
+			Board.RefreshCardHash(Deployed);
+			return true;
+		}
+
+		case EGCGCardType::Pilot:
+		{
+			// The Pilot sits with its Unit in the Battle Area and adds its AP / HP to it
+			if (!MoveFn(CardInstanceID, EGCGCardZone::BattleArea))
+			{
+				return false;
+			}
+
+			FGCGCardInstance& Pilot = *Board.FindCardInZone(CardInstanceID, EGCGCardZone::BattleArea);
+			FGCGCardInstance& Unit = *Board.FindCardInZone(TargetInstanceID, EGCGCardZone::BattleArea);
+			Pilot.PairedCardInstanceID = TargetInstanceID;
+			Unit.PairedCardInstanceID = CardInstanceID;
+
+			AddModifier(Unit, EGCGModifierType::AP, CardView.GetAP(), EGCGModifierDuration::WhileInPlay, CardInstanceID, TurnNumber);
+			AddModifier(Unit, EGCGModifierType::HP, CardView.GetHP(), EGCGModifierDuration::WhileInPlay, CardInstanceID, TurnNumber);
+			Board.RefreshCardHash(Pilot);
+			Board.RefreshCardHash(Unit);
+			return true;
+		}
+
+		case EGCGCardType::Command:
+			return MoveFn(CardInstanceID, EGCGCardZone::Trash);
+
+		default:
+			return false;
+		}
+	}
+
+	// ===== COMBAT FLOW =====
+
+	/**
+	 * Can this Unit attack (turn and phase aside)? It must be an active Unit that hasn't
+	 * attacked this turn and wasn't deployed this turn (unless it is a linked Link Unit).
+	 */
+	template<typename BoardType>
+	static EGCGRulesResult CanAttack(const FGCGCardCatalog& Catalog, const BoardType& AttackingBoard, int32 AttackerInstanceID, int32 TurnNumber)
+	{
+		const FGCGCardInstance* Attacker = AttackingBoard.FindCardInZone(AttackerInstanceID, EGCGCardZone::BattleArea);
+		if (!Attacker)
+		{
+			return EGCGRulesResult::CardNotFound;
+		}
+
+		// Deployed this turn only a linked (paired) Unit may attack, as in FGCGCardInstance::CanAttackThisTurn
+		const FGCGCardView AttackerView = GetCardView(Catalog, *Attacker);
+		if (!AttackerView || AttackerView.GetCardType() != EGCGCardType::Unit
+			|| Attacker->bHasAttackedThisTurn || !Attacker->bIsActive
+			|| (Attacker->TurnDeployed == TurnNumber && Attacker->PairedCardInstanceID == 0))
+		{
+			return EGCGRulesResult::CannotAttack;
+		}
+
+		return EGCGRulesResult::Success;
+	}
+
+	/**
+	 * Can this be attacked? Units may only attack the player or rested enemy Units.
+	 * @param TargetInstanceID The enemy Unit attacked, or 0 to attack the player
+	 */
+	template<typename BoardType>
+	static EGCGRulesResult CanBeAttacked(const FGCGCardCatalog& Catalog, const BoardType& DefendingBoard, int32 TargetInstanceID)
+	{
+		if (TargetInstanceID != 0)
+		{
+			const FGCGCardInstance* Target = DefendingBoard.FindCardInZone(TargetInstanceID, EGCGCardZone::BattleArea);
+			if (!Target || Target->bIsActive || GetCardType(Catalog, *Target) != EGCGCardType::Unit)
+			{
+				return EGCGRulesResult::InvalidTarget;
+			}
+		}
+
+		return EGCGRulesResult::Success;
+	}
+
+	/**
+	 * Attacking rests the attacker and uses its attack for the turn
+	 */
+	template<typename BoardType>
+	static void DeclareAttacker(BoardType& Board, int32 AttackerInstanceID)
+	{
+		if (FGCGCardInstance* Attacker = Board.FindCardInZone(AttackerInstanceID, EGCGCardZone::BattleArea))
+		{
+			Attacker->bIsActive = false;
+			Attacker->bHasAttackedThisTurn = true;
+			Board.RefreshCardHash(*Attacker);
+		}
+	}
+
+	/**
+	 * Can this Unit block the attack? It must be an active <Blocker> Unit other than the
+	 * attack's current target, and the attacker must not have High-Maneuver.
+	 */
+	template<typename BoardType>
+	static EGCGRulesResult CanBlock(const FGCGCardCatalog& Catalog, const BoardType& AttackingBoard, const BoardType& DefendingBoard,
+		int32 AttackerInstanceID, int32 CurrentTargetInstanceID, int32 BlockerInstanceID)
+	{
+		const FGCGCardInstance* Blocker = DefendingBoard.FindCardInZone(BlockerInstanceID, EGCGCardZone::BattleArea);
+		if (!Blocker)
+		{
+			return EGCGRulesResult::CardNotFound;
+		}
+
+		if (!Blocker->bIsActive || BlockerInstanceID == CurrentTargetInstanceID
+			|| GetCardType(Catalog, *Blocker) != EGCGCardType::Unit
+			|| !HasKeyword(Catalog, *Blocker, EGCGKeyword::Blocker))
+		{
+			return EGCGRulesResult::CannotBlock;
+		}
+
+		const FGCGCardInstance* Attacker = AttackingBoard.FindCardInZone(AttackerInstanceID, EGCGCardZone::BattleArea);
+		if (Attacker && HasKeyword(Catalog, *Attacker, EGCGKeyword::HighManeuver))
+		{
+			return EGCGRulesResult::CannotBlock;
+		}
+
+		return EGCGRulesResult::Success;
+	}
+
+	/**
+	 * Blocking rests the blocker
+	 */
+	template<typename BoardType>
+	static void DeclareBlocker(BoardType& Board, int32 BlockerInstanceID)
+	{
+		if (FGCGCardInstance* Blocker = Board.FindCardInZone(BlockerInstanceID, EGCGCardZone::BattleArea))
+		{
+			Blocker->bIsActive = false;
+			Board.RefreshCardHash(*Blocker);
+		}
+	}
+
+	/**
+	 * Battle damage between two Units (Support and First Strike included). Damage lands on
+	 * both before either is destroyed: destroying them, Breach and triggers are the caller's.
+	 * @return What happened, with bAttackerDestroyed / bDefenderDestroyed to act on
+	 */
+	template<typename BoardType>
+	static FGCGUnitCombatOutcome ApplyBattleDamage(const FGCGCardCatalog& Catalog, BoardType& AttackingBoard, FGCGCardInstance& Attacker,
+		BoardType& DefendingBoard, FGCGCardInstance& Defender)
+	{
+		const FGCGUnitCombatOutcome Outcome = ResolveUnitCombat(
+			GetCombatAP(Catalog, AttackingBoard, Attacker), GetRemainingHP(Catalog, Attacker),
+			GetCombatAP(Catalog, DefendingBoard, Defender), GetRemainingHP(Catalog, Defender),
+			HasFirstStrikeAdvantage(Catalog, Attacker, Defender));
+
+		Defender.DamageCounters += Outcome.DamageToDefender;
+		Defender.LastDamageSource = EGCGDamageSource::BattleDamage;
+		Attacker.DamageCounters += Outcome.DamageToAttacker;
+		Attacker.LastDamageSource = EGCGDamageSource::BattleDamage;
+		DefendingBoard.RefreshCardHash(Defender);
+		AttackingBoard.RefreshCardHash(Attacker);
+
+		return Outcome;
+	}
+};
@@ -0,0 +1,863 @@
+// GCGRulesEngine.cpp - Headless Rules Engine Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGRulesEngine.h"
+
+FGCGRulesEngine::FGCGRulesEngine(FGCGCardCatalogPtr InCatalog)
+	: Catalog(MoveTemp(InCatalog))
+{
+	check(Catalog.IsValid());
+}
+
+// ===== SETUP =====
+
+void FGCGRulesEngine::SetupMatch(FGCGMatchState& State, const FGCGDeckList& Deck0, const FGCGDeckList& Deck1, uint64 Seed) const
+{
+	State = FGCGMatchState();
+	State.Random.Initialize(Seed);
+
+	const FGCGDeckList* DeckLists[GCGRules::NumPlayers] = { &Deck0, &Deck1 };
+
+	for (int32 PlayerID = 0; PlayerID < GCGRules::NumPlayers; ++PlayerID)
+	{
+		FGCGPlayerBoard& Board = State.GetPlayer(PlayerID);
+		Board.PlayerID = PlayerID;
+
+		// Build and shuffle both decks (each player has their own deck stream)
+		const FGCGDeckList& DeckList = *DeckLists[PlayerID];
+		Board.Deck.Reserve(DeckList.MainDeck.Num());
+		for (const FName& CardNumber : DeckList.MainDeck)
+		{
+			FGCGCardInstance Card = CreateCardInstance(State, CardNumber, PlayerID);
+			Card.CurrentZone = EGCGCardZone::Deck;
+			Board.Deck.Add(MoveTemp(Card));
+		}
+
+		Board.ResourceDeck.Reserve(DeckList.ResourceDeck.Num());
+		for (const FName& CardNumber : DeckList.ResourceDeck)
+		{
+			FGCGCardInstance Card = CreateCardInstance(State, CardNumber, PlayerID);
+			Card.CurrentZone = EGCGCardZone::ResourceDeck;
+			Board.ResourceDeck.Add(MoveTemp(Card));
+		}
+
+		FGCGRandomStream& DeckStream = State.Random.GetStream(EGCGRandomStream::Deck, PlayerID);
+		DeckStream.Shuffle(Board.Deck);
+		DeckStream.Shuffle(Board.ResourceDeck);
+
+		Board.IndexZone(EGCGCardZone::Deck);
+		Board.IndexZone(EGCGCardZone::ResourceDeck);
+
+		// Shields come from the top of the deck
+		for (int32 i = 0; i < GCGRules::StartingShields; ++i)
+		{
+			MoveTopCard(Board, EGCGCardZone::Deck, EGCGCardZone::ShieldStack);
+		}
+
+		AddCardToZone(Board, CreateCardInstance(State, FGCGRules::GetEXBaseTokenName(), PlayerID, true), EGCGCardZone::BaseSection);
+
+		// Player Two starts with an EX Resource to offset going second
+		if (PlayerID == 1)
+		{
+			AddCardToZone(Board, CreateCardInstance(State, FGCGRules::GetEXResourceTokenName(), PlayerID, true), EGCGCardZone::ResourceArea);
+		}
+
+		for (int32 i = 0; i < GCGRules::StartingHandSize; ++i)
+		{
+			MoveTopCard(Board, EGCGCardZone::Deck, EGCGCardZone::Hand);
+		}
+	}
+
+	State.TurnNumber = 0;
+	State.ActivePlayerID = 0;
+	State.CurrentPhase = EGCGTurnPhase::NotStarted;
+}
+
+FGCGCardInstance FGCGRulesEngine::CreateCardInstance(FGCGMatchState& State, FName CardNumber, int32 OwnerPlayerID, bool bIsToken) const
+{
+	FGCGCardInstance Card;
+	Card.InstanceID = State.NextInstanceID++;
+	Card.CardNumber = CardNumber;
+	Card.CardId = Catalog->FindCardId(CardNumber);
+	Card.bIsToken = bIsToken;
+	Card.OwnerPlayerID = OwnerPlayerID;
+	Card.ControllerPlayerID = OwnerPlayerID;
+	return Card;
+}
+
+// ===== TURN FLOW =====
+
+void FGCGRulesEngine::StartTurn(FGCGMatchState& State) const
+{
+	if (State.bGameOver)
+	{
+		return;
+	}
+
+	++State.TurnNumber;
+	if (State.TurnNumber > 1)
+	{
+		State.ActivePlayerID = FGCGMatchState::GetOpponentID(State.ActivePlayerID);
+	}
+
+	FGCGPlayerBoard& Board = State.GetActivePlayer();
+
+	// Start Phase: Active Step, then start-of-turn triggers
+	State.CurrentPhase = EGCGTurnPhase::StartPhase;
+	Board.ResetTurnFlags();
+	FGCGRules::ActivateAll(Board);
+
+	TriggerBoardEffects(State, State.ActivePlayerID, EGCGEffectTiming::StartOfTurn);
+	if (State.bGameOver)
+	{
+		return;
+	}
+
+	// Draw Phase: a player who can't draw loses
+	State.CurrentPhase = EGCGTurnPhase::DrawPhase;
+	if (!MoveTopCard(Board, EGCGCardZone::Deck, EGCGCardZone::Hand))
+	{
+		SetLoser(State, State.ActivePlayerID);
+		return;
+	}
+	Board.bHasDrawnThisTurn = true;
+
+	// Resource Phase
+	State.CurrentPhase = EGCGTurnPhase::ResourcePhase;
+	if (Board.ResourceArea.Num() < GCGRules::MaxResources
+		&& MoveTopCard(Board, EGCGCardZone::ResourceDeck, EGCGCardZone::ResourceArea))
+	{
+		Board.bHasPlacedResourceThisTurn = true;
+	}
+
+	State.CurrentPhase = EGCGTurnPhase::MainPhase;
+}
+
+void FGCGRulesEngine::EndTurn(FGCGMatchState& State, TConstArrayView<int32> DiscardChoices) const
+{
+	if (State.bGameOver)
+	{
+		return;
+	}
+
+	// A pending attack still resolves before the turn can end
+	if (State.IsAttackInProgress())
+	{
+		ResolveAttack(State);
+		if (State.bGameOver)
+		{
+			return;
+		}
+	}
+
+	State.CurrentPhase = EGCGTurnPhase::EndPhase;
+
+	// End Step
+	TriggerBoardEffects(State, State.ActivePlayerID, EGCGEffectTiming::EndOfTurn);
+	if (State.bGameOver)
+	{
+		return;
+	}
+
+	FGCGPlayerBoard& Board = State.GetActivePlayer();
+	FGCGRules::ApplyRepair(*Catalog, Board);
+
+	// Hand Step: chosen cards first, then the most recently drawn
+	int32 Excess = FGCGRules::GetHandExcess(Board);
+	for (int32 i = 0; i < DiscardChoices.Num() && Excess > 0; ++i)
+	{
+		if (Board.FindCardInZone(DiscardChoices[i], EGCGCardZone::Hand) && MoveCard(Board, DiscardChoices[i], EGCGCardZone::Trash))
+		{
+			--Excess;
+		}
+	}
+	for (; Excess > 0; --Excess)
+	{
+		MoveCard(Board, Board.Hand.Last().InstanceID, EGCGCardZone::Trash);
+	}
+
+	// Cleanup Step
+	for (FGCGPlayerBoard& PlayerBoard : State.Players)
+	{
+		FGCGRules::CleanupEndOfTurn(PlayerBoard);
+	}
+
+	StartTurn(State);
+}
+
+// ===== MAIN PHASE ACTIONS =====
+
+EGCGRulesResult FGCGRulesEngine::CanPlayCard(const FGCGMatchState& State, int32 PlayerID, int32 CardInstanceID, int32 TargetInstanceID) const
+{
+	if (State.bGameOver)
+	{
+		return EGCGRulesResult::GameOver;
+	}
+	if (PlayerID != State.ActivePlayerID)
+	{
+		return EGCGRulesResult::NotYourTurn;
+	}
+	if (State.CurrentPhase != EGCGTurnPhase::MainPhase)
+	{
+		return EGCGRulesResult::WrongPhase;
+	}
+	if (State.IsAttackInProgress())
+	{
+		return EGCGRulesResult::AttackInProgress;
+	}
+
+	return FGCGRules::CanPlayCard(*Catalog, State.GetPlayer(PlayerID), CardInstanceID, TargetInstanceID);
+}
+
+EGCGRulesResult FGCGRulesEngine::PlayCard(FGCGMatchState& State, int32 PlayerID, int32 CardInstanceID, int32 TargetInstanceID) const
+{
+	const EGCGRulesResult Result = CanPlayCard(State, PlayerID, CardInstanceID, TargetInstanceID);
+	if (Result != EGCGRulesResult::Success)
+	{
+		return Result;
+	}
+
+	FGCGPlayerBoard& Board = State.GetPlayer(PlayerID);
+	const EGCGCardType CardType = FGCGRules::GetCardType(*Catalog, *Board.FindCardInZone(CardInstanceID, EGCGCardZone::Hand));
+
+	FGCGRules::PlayCard(*Catalog, Board, CardInstanceID, TargetInstanceID, State.TurnNumber,
+		[this, &Board](int32 InstanceID, EGCGCardZone ToZone) { return MoveCard(Board, InstanceID, ToZone); });
+
+	switch (CardType)
+	{
+	case EGCGCardType::Unit:
+	case EGCGCardType::Base:
+		TriggerCardEffects(State, PlayerID, CardInstanceID, EGCGEffectTiming::OnDeploy, TargetInstanceID);
+		break;
+
+	case EGCGCardType::Pilot:
+		TriggerCardEffects(State, PlayerID, CardInstanceID, EGCGEffectTiming::WhenPaired, TargetInstanceID);
+		TriggerCardEffects(State, PlayerID, TargetInstanceID, EGCGEffectTiming::WhenPaired, CardInstanceID);
+		break;
+
+	case EGCGCardType::Command:
+		// Commands resolve from the Trash, so their effects can't target themselves in hand
+		TriggerCardEffects(State, PlayerID, CardInstanceID, EGCGEffectTiming::OnPlay, TargetInstanceID);
+		TriggerCardEffects(State, PlayerID, CardInstanceID, EGCGEffectTiming::ActivateMain, TargetInstanceID);
+		break;
+
+	default:
+		break;
+	}
+
+	return State.bGameOver ? EGCGRulesResult::GameOver : EGCGRulesResult::Success;
+}
+
+EGCGRulesResult FGCGRulesEngine::CanAttack(const FGCGMatchState& State, int32 PlayerID, int32 AttackerInstanceID, int32 TargetInstanceID) const
+{
+	if (State.bGameOver)
+	{
+		return EGCGRulesResult::GameOver;
+	}
+	if (PlayerID != State.ActivePlayerID)
+	{
+		return EGCGRulesResult::NotYourTurn;
+	}
+	if (State.CurrentPhase != EGCGTurnPhase::MainPhase)
+	{
+		return EGCGRulesResult::WrongPhase;
+	}
+	if (State.IsAttackInProgress())
+	{
+		return EGCGRulesResult::AttackInProgress;
+	}
+
+	const EGCGRulesResult Result = FGCGRules::CanAttack(*Catalog, State.GetPlayer(PlayerID), AttackerInstanceID, State.TurnNumber);
+	if (Result != EGCGRulesResult::Success)
+	{
+		return Result;
+	}
+
+	return FGCGRules::CanBeAttacked(*Catalog, State.GetOpponent(PlayerID), TargetInstanceID);
+}
+
+EGCGRulesResult FGCGRulesEngine::DeclareAttack(FGCGMatchState& State, int32 PlayerID, int32 AttackerInstanceID, int32 TargetInstanceID) const
+{
+	const EGCGRulesResult Result = CanAttack(State, PlayerID, AttackerInstanceID, TargetInstanceID);
+	if (Result != EGCGRulesResult::Success)
+	{
+		return Result;
+	}
+
+	FGCGRules::DeclareAttacker(State.GetPlayer(PlayerID), AttackerInstanceID);
+
+	const int32 DefendingPlayerID = FGCGMatchState::GetOpponentID(PlayerID);
+
+	FGCGAttackData& Attack = State.CurrentAttack;
+	Attack = FGCGAttackData();
+	Attack.AttackerInstanceID = AttackerInstanceID;
+	Attack.OriginalTargetInstanceID = TargetInstanceID;
+	Attack.CurrentTargetInstanceID = TargetInstanceID;
+	Attack.bTargetingPlayer = TargetInstanceID == 0;
+	Attack.TargetPlayerID = DefendingPlayerID;
+	Attack.CurrentCombatStep = EGCGCombatStep::BlockStep;
+
+	TriggerCardEffects(State, PlayerID, AttackerInstanceID, EGCGEffectTiming::OnAttack, TargetInstanceID);
+	if (TargetInstanceID != 0)
+	{
+		TriggerCardEffects(State, DefendingPlayerID, TargetInstanceID, EGCGEffectTiming::WhenAttacked, AttackerInstanceID);
+	}
+
+	return State.bGameOver ? EGCGRulesResult::GameOver : EGCGRulesResult::Success;
+}
+
+EGCGRulesResult FGCGRulesEngine::CanBlock(const FGCGMatchState& State, int32 BlockerInstanceID) const
+{
+	if (State.bGameOver)
+	{
+		return EGCGRulesResult::GameOver;
+	}
+	if (!State.IsAttackInProgress())
+	{
+		return EGCGRulesResult::NoAttack;
+	}
+
+	const FGCGAttackData& Attack = State.CurrentAttack;
+	if (Attack.CurrentCombatStep != EGCGCombatStep::BlockStep || Attack.bBlockerActivated)
+	{
+		return EGCGRulesResult::CannotBlock;
+	}
+
+	return FGCGRules::CanBlock(*Catalog, State.GetActivePlayer(), State.GetPlayer(Attack.TargetPlayerID), Attack.AttackerInstanceID,
+		Attack.CurrentTargetInstanceID, BlockerInstanceID);
+}
+
+EGCGRulesResult FGCGRulesEngine::DeclareBlocker(FGCGMatchState& State, int32 BlockerInstanceID) const
+{
+	const EGCGRulesResult Result = CanBlock(State, BlockerInstanceID);
+	if (Result != EGCGRulesResult::Success)
+	{
+		return Result;
+	}
+
+	FGCGAttackData& Attack = State.CurrentAttack;
+	FGCGRules::DeclareBlocker(State.GetPlayer(Attack.TargetPlayerID), BlockerInstanceID);
+
+	Attack.bBlockerActivated = true;
+	Attack.BlockerInstanceID = BlockerInstanceID;
+	Attack.CurrentTargetInstanceID = BlockerInstanceID;
+	Attack.bTargetingPlayer = false;
+	Attack.CurrentCombatStep = EGCGCombatStep::DamageStep;
+
+	TriggerCardEffects(State, Attack.TargetPlayerID, BlockerInstanceID, EGCGEffectTiming::OnBlock, Attack.AttackerInstanceID);
+
+	return State.bGameOver ? EGCGRulesResult::GameOver : EGCGRulesResult::Success;
+}
+
+EGCGRulesResult FGCGRulesEngine::ResolveAttack(FGCGMatchState& State) const
+{
+	if (State.bGameOver)
+	{
+		return EGCGRulesResult::GameOver;
+	}
+	if (!State.IsAttackInProgress())
+	{
+		return EGCGRulesResult::NoAttack;
+	}
+
+	// Effects fired during damage see no attack in progress
+	const FGCGAttackData Attack = State.CurrentAttack;
+	State.CurrentAttack = FGCGAttackData();
+
+	const int32 AttackingPlayerID = State.ActivePlayerID;
+	const int32 DefendingPlayerID = Attack.TargetPlayerID;
+	FGCGPlayerBoard& AttackingBoard = State.GetPlayer(AttackingPlayerID);
+	FGCGPlayerBoard& DefendingBoard = State.GetPlayer(DefendingPlayerID);
+
+	// An attacker that left play before damage deals none
+	FGCGCardInstance* Attacker = AttackingBoard.FindCardInZone(Attack.AttackerInstanceID, EGCGCardZone::BattleArea);
+	if (!Attacker)
+	{
+		CleanupEndOfBattle(State);
+		return EGCGRulesResult::Success;
+	}
+
+	if (Attack.bTargetingPlayer)
+	{
+		const bool bSuppression = FGCGRules::HasKeyword(*Catalog, *Attacker, EGCGKeyword::Suppression);
+		DealDamageToPlayer(State, DefendingPlayerID, FGCGRules::GetCombatAP(*Catalog, AttackingBoard, *Attacker), bSuppression);
+	}
+	else if (FGCGCardInstance* Defender = DefendingBoard.FindCardInZone(Attack.CurrentTargetInstanceID, EGCGCardZone::BattleArea))
+	{
+		const int32 BreachValue = FGCGRules::GetKeywordValue(*Catalog, *Attacker, EGCGKeyword::Breach);
+		const int32 AttackerID = Attacker->InstanceID;
+		const int32 DefenderID = Defender->InstanceID;
+
+		// Damage lands on both units before either is destroyed
+		const FGCGUnitCombatOutcome Outcome = FGCGRules::ApplyBattleDamage(*Catalog, AttackingBoard, *Attacker, DefendingBoard, *Defender);
+
+		// Breach resolves before Destroyed triggers and never defeats a player
+		if (Outcome.bDefenderDestroyed && BreachValue > 0)
+		{
+			DealDamageToPlayer(State, DefendingPlayerID, BreachValue, false, false);
+		}
+
+		if (Outcome.bDefenderDestroyed)
+		{
+			DestroyCard(State, DefenderID);
+			if (AttackingBoard.FindCardInZone(AttackerID, EGCGCardZone::BattleArea))
+			{
+				TriggerCardEffects(State, AttackingPlayerID, AttackerID, EGCGEffectTiming::WhenAttackDestroysUnit, DefenderID);
+			}
+		}
+
+		if (Outcome.bAttackerDestroyed && !State.bGameOver)
+		{
+			DestroyCard(State, AttackerID);
+		}
+	}
+
+	CleanupEndOfBattle(State);
+	return State.bGameOver ? EGCGRulesResult::GameOver : EGCGRulesResult::Success;
+}
+
+// ===== DAMAGE =====
+
+bool FGCGRulesEngine::DealDamageToPlayer(FGCGMatchState& State, int32 PlayerID, int32 Damage, bool bSuppression, bool bCanDefeat) const
+{
+	if (Damage <= 0 || State.bGameOver)
+	{
+		return false;
+	}
+
+	FGCGPlayerBoard& Board = State.GetPlayer(PlayerID);
+
+	switch (FGCGRules::GetPlayerDamageTarget(Board))
+	{
+	case EGCGPlayerDamageTarget::Base:
+		DealDamageToCard(State, Board.BaseSection[0].InstanceID, Damage, EGCGDamageSource::BattleDamage);
+		return false;
+
+	case EGCGPlayerDamageTarget::Shield:
+		BreakShields(State, PlayerID, FGCGRules::GetShieldsToBreak(Damage, bSuppression));
+		return false;
+
+	case EGCGPlayerDamageTarget::Player:
+	default:
+		if (bCanDefeat)
+		{
+			SetLoser(State, PlayerID);
+			return true;
+		}
+		return false;
+	}
+}
+
+bool FGCGRulesEngine::DealDamageToCard(FGCGMatchState& State, int32 InstanceID, int32 Damage, EGCGDamageSource Source) const
+{
+	int32 OwnerPlayerID = INDEX_NONE;
+	EGCGCardZone Zone = EGCGCardZone::None;
+	FGCGCardInstance* Card = State.FindCard(InstanceID, &OwnerPlayerID, &Zone);
+	if (!Card || Damage <= 0 || (Zone != EGCGCardZone::BattleArea && Zone != EGCGCardZone::BaseSection))
+	{
+		return false;
+	}
+
+	Card->DamageCounters += Damage;
+	Card->LastDamageSource = Source;
+	State.GetPlayer(OwnerPlayerID).RefreshCardHash(*Card);
+
+	return FGCGRules::IsDestroyed(*Catalog, *Card) && DestroyCard(State, InstanceID);
+}
+
+bool FGCGRulesEngine::DestroyCard(FGCGMatchState& State, int32 InstanceID) const
+{
+	int32 OwnerPlayerID = INDEX_NONE;
+	EGCGCardZone Zone = EGCGCardZone::None;
+	const FGCGCardInstance* Card = State.FindCard(InstanceID, &OwnerPlayerID, &Zone);
+	if (!Card || (Zone != EGCGCardZone::BattleArea && Zone != EGCGCardZone::BaseSection))
+	{
+		return false;
+	}
+
+	FGCGPlayerBoard& Board = State.GetPlayer(OwnerPlayerID);
+	const int32 PairedInstanceID = Card->PairedCardInstanceID;
+	const bool bWasUnit = FGCGRules::GetCardType(*Catalog, *Card) == EGCGCardType::Unit;
+
+	// Tokens cease to exist rather than going to the Trash
+	MoveCard(Board, InstanceID, Card->bIsToken ? EGCGCardZone::Removal : EGCGCardZone::Trash);
+
+	// A destroyed Unit takes its Pilot with it
+	if (PairedInstanceID != 0)
+	{
+		if (FGCGCardInstance* Paired = Board.FindCardInZone(PairedInstanceID, EGCGCardZone::BattleArea))
+		{
+			Paired->PairedCardInstanceID = 0;
+			Board.RefreshCardHash(*Paired);
+			if (bWasUnit)
+			{
+				MoveCard(Board, PairedInstanceID, EGCGCardZone::Trash);
+			}
+		}
+	}
+
+	TriggerCardEffects(State, OwnerPlayerID, InstanceID, EGCGEffectTiming::OnDestroyed);
+
+	if (bWasUnit)
+	{
+		for (int32 PlayerID = 0; PlayerID < GCGRules::NumPlayers && !State.bGameOver; ++PlayerID)
+		{
+			TriggerBoardEffects(State, PlayerID, EGCGEffectTiming::WhenUnitDestroyed);
+		}
+	}
+
+	return true;
+}
+
+int32 FGCGRulesEngine::BreakShields(FGCGMatchState& State, int32 PlayerID, int32 Count) const
+{
+	FGCGPlayerBoard& Board = State.GetPlayer(PlayerID);
+
+	int32 NumBroken = 0;
+	for (; NumBroken < Count && !State.bGameOver; ++NumBroken)
+	{
+		FGCGCardInstance Shield;
+		if (!MoveTopCard(Board, EGCGCardZone::ShieldStack, EGCGCardZone::Trash, &Shield))
+		{
+			break;
+		}
+
+		TriggerCardEffects(State, PlayerID, Shield.InstanceID, EGCGEffectTiming::Burst);
+	}
+
+	return NumBroken;
+}
+
+// ===== EFFECTS =====
+
+int32 FGCGRulesEngine::TriggerCardEffects(FGCGMatchState& State, int32 SourcePlayerID, int32 SourceInstanceID,
+	EGCGEffectTiming Timing, int32 TargetInstanceID) const
+{
+	const FGCGCardInstance* Card = State.FindCard(SourceInstanceID);
+	if (!Card || !(Catalog->GetEffectTimings(Card->CardId) & GetEffectTimingBit(Timing)))
+	{
+		return 0;
+	}
+
+	// Programs live in the catalog, so they stay valid while effects move the card
+	int32 NumResolved = 0;
+	for (const FGCGCompiledEffect& Effect : Catalog->GetEffects(Card->CardId))
+	{
+		if (Effect.Timing != Timing)
+		{
+			continue;
+		}
+
+		if (ExecuteEffect(State, Catalog->GetEffectCode(Card->CardId, Effect), SourcePlayerID, SourceInstanceID, TargetInstanceID))
+		{
+			++NumResolved;
+		}
+
+		if (State.bGameOver)
+		{
+			break;
+		}
+	}
+
+	return NumResolved;
+}
+
+bool FGCGRulesEngine::ExecuteEffect(FGCGMatchState& State, TConstArrayView<FGCGEffectInstruction> Code, int32 SourcePlayerID,
+	int32 SourceInstanceID, int32 TargetInstanceID) const
+{
+	FGCGPlayerBoard& SourceBoard = State.GetPlayer(SourcePlayerID);
+	const int32 OpponentID = FGCGMatchState::GetOpponentID(SourcePlayerID);
+
+	for (const FGCGEffectInstruction& Instruction : Code)
+	{
+		if (State.bGameOver)
+		{
+			break;
+		}
+
+		// Player target: the compiler only emits SourcePlayer / OpponentPlayer for player operations
+		const int32 TargetPlayerID = Instruction.Target == EGCGEffectTarget::OpponentPlayer ? OpponentID : SourcePlayerID;
+
+		// Unit target: Self, else the given target, else the best enemy / friendly unit
+		int32 TargetUnitID = 0;
+		if (Instruction.Target == EGCGEffectTarget::Self)
+		{
+			TargetUnitID = SourceInstanceID;
+		}
+		else if (Instruction.Target == EGCGEffectTarget::EnemyUnit || Instruction.Target == EGCGEffectTarget::FriendlyUnit)
+		{
+			TargetUnitID = TargetInstanceID != 0
+				? TargetInstanceID
+				: ChooseEffectTarget(State, SourcePlayerID, Instruction.Target == EGCGEffectTarget::EnemyUnit);
+		}
+
+		switch (Instruction.Op)
+		{
+		// ----- Checks (all run before anything is paid) -----
+		case EGCGEffectOp::IfYourTurn:
+			if (State.ActivePlayerID != SourcePlayerID)
+			{
+				return false;
+			}
+			break;
+
+		case EGCGEffectOp::IfOpponentTurn:
+			if (State.ActivePlayerID == SourcePlayerID)
+			{
+				return false;
+			}
+			break;
+
+		case EGCGEffectOp::IfActiveResources:
+			if (FGCGRules::CountActiveResources(SourceBoard) < Instruction.Operand)
+			{
+				return false;
+			}
+			break;
+
+		case EGCGEffectOp::IfNotActivatedThisTurn:
+		{
+			const FGCGCardInstance* SourceCard = SourceBoard.FindCard(SourceInstanceID);
+			if (SourceCard && SourceCard->ActivationCountThisTurn > 0)
+			{
+				return false;
+			}
+			break;
+		}
+
+		case EGCGEffectOp::CanPayResources:
+			if (!FGCGRules::CanPayCost(SourceBoard, Instruction.Operand))
+			{
+				return false;
+			}
+			break;
+
+		case EGCGEffectOp::CanRestSource:
+		{
+			EGCGCardZone Zone = EGCGCardZone::None;
+			const FGCGCardInstance* SourceCard = SourceBoard.FindCard(SourceInstanceID, &Zone);
+			if (!SourceCard || !SourceCard->bIsActive || Zone != EGCGCardZone::BattleArea)
+			{
+				return false;
+			}
+			break;
+		}
+
+		case EGCGEffectOp::CanTrashSource:
+			if (!SourceBoard.FindCard(SourceInstanceID))
+			{
+				return false;
+			}
+			break;
+
+		// ----- Payments -----
+		case EGCGEffectOp::PayResources:
+			FGCGRules::PayCost(SourceBoard, Instruction.Operand);
+			break;
+
+		case EGCGEffectOp::CountActivation:
+			if (FGCGCardInstance* SourceCard = SourceBoard.FindCard(SourceInstanceID))
+			{
+				++SourceCard->ActivationCountThisTurn;
+				SourceBoard.RefreshCardHash(*SourceCard);
+			}
+			break;
+
+		case EGCGEffectOp::RestSource:
+			if (FGCGCardInstance* SourceCard = SourceBoard.FindCard(SourceInstanceID))
+			{
+				SourceCard->bIsActive = false;
+				SourceBoard.RefreshCardHash(*SourceCard);
+			}
+			break;
+
+		case EGCGEffectOp::TrashSource:
+			MoveCard(SourceBoard, SourceInstanceID, EGCGCardZone::Trash);
+			break;
+
+		// ----- Operations -----
+		case EGCGEffectOp::Draw:
+		{
+			FGCGPlayerBoard& DrawBoard = State.GetPlayer(TargetPlayerID);
+			for (int32 i = 0; i < Instruction.Operand; ++i)
+			{
+				if (!MoveTopCard(DrawBoard, EGCGCardZone::Deck, EGCGCardZone::Hand))
+				{
+					break;
+				}
+			}
+			break;
+		}
+
+		case EGCGEffectOp::DealDamageToPlayer:
+			DealDamageToPlayer(State, TargetPlayerID, Instruction.Operand);
+			break;
+
+		case EGCGEffectOp::DealDamageToUnit:
+			DealDamageToCard(State, TargetUnitID, Instruction.Operand, EGCGDamageSource::EffectDamage);
+			break;
+
+		case EGCGEffectOp::DestroyUnit:
+			DestroyCard(State, TargetUnitID);
+			break;
+
+		case EGCGEffectOp::GiveAP:
+		case EGCGEffectOp::GiveHP:
+		{
+			int32 TargetOwnerID = INDEX_NONE;
+			EGCGCardZone Zone = EGCGCardZone::None;
+			FGCGCardInstance* Target = State.FindCard(TargetUnitID, &TargetOwnerID, &Zone);
+			if (Target && Zone == EGCGCardZone::BattleArea)
+			{
+				const EGCGModifierType ModifierType = Instruction.Op == EGCGEffectOp::GiveAP ? EGCGModifierType::AP : EGCGModifierType::HP;
+				FGCGRules::AddModifier(*Target, ModifierType, Instruction.Operand, static_cast<EGCGModifierDuration>(Instruction.Arg),
+					SourceInstanceID, State.TurnNumber);
+				State.GetPlayer(TargetOwnerID).RefreshCardHash(*Target);
+
+				// Losing HP can destroy a damaged unit
+				if (FGCGRules::IsDestroyed(*Catalog, *Target))
+				{
+					DestroyCard(State, TargetUnitID);
+				}
+			}
+			break;
+		}
+
+		case EGCGEffectOp::GrantKeyword:
+		{
+			int32 TargetOwnerID = INDEX_NONE;
+			EGCGCardZone Zone = EGCGCardZone::None;
+			FGCGCardInstance* Target = State.FindCard(TargetUnitID, &TargetOwnerID, &Zone);
+			if (Target && Zone == EGCGCardZone::BattleArea)
+			{
+				Target->AddTemporaryKeyword(FGCGKeywordInstance(static_cast<EGCGKeyword>(Instruction.Arg), Instruction.Operand, SourceInstanceID));
+				State.GetPlayer(TargetOwnerID).RefreshCardHash(*Target);
+			}
+			break;
+		}
+		}
+	}
+
+	return true;
+}
+
+// ===== ZONES =====
+
+bool FGCGRulesEngine::MoveCard(FGCGPlayerBoard& Board, int32 InstanceID, EGCGCardZone ToZone) const
+{
+	return FGCGRules::MoveCard(Board, InstanceID, ToZone);
+}
+
+bool FGCGRulesEngine::MoveTopCard(FGCGPlayerBoard& Board, EGCGCardZone FromZone, EGCGCardZone ToZone, FGCGCardInstance* OutCard) const
+{
+	const int32 InstanceID = FGCGRules::MoveTopCard(Board, FromZone, ToZone);
+	if (InstanceID == 0)
+	{
+		return false;
+	}
+
+	if (OutCard)
+	{
+		*OutCard = *Board.FindCard(InstanceID);
+	}
+	return true;
+}
+
+// ===== INTERNAL =====
+
+void FGCGRulesEngine::AddCardToZone(FGCGPlayerBoard& Board, FGCGCardInstance&& Card, EGCGCardZone Zone) const
+{
+	TArray<FGCGCardInstance>& ZoneArray = *Board.GetZoneArray(Zone);
+
+	Card.CurrentZone = Zone;
+	FGCGRules::ApplyZoneEntryRules(Card, Zone);
+
+	const int32 Slot = ZoneArray.Add(MoveTemp(Card));
+	Board.IndexZone(Zone, Slot);
+}
+
+void FGCGRulesEngine::SetLoser(FGCGMatchState& State, int32 LoserPlayerID) const
+{
+	State.GetPlayer(LoserPlayerID).bHasLost = true;
+	State.bGameOver = true;
+	State.WinnerPlayerID = FGCGMatchState::GetOpponentID(LoserPlayerID);
+	State.CurrentPhase = EGCGTurnPhase::GameOver;
+	State.CurrentAttack = FGCGAttackData();
+}
+
+void FGCGRulesEngine::TriggerBoardEffects(FGCGMatchState& State, int32 PlayerID, EGCGEffectTiming Timing) const
+{
+	// Snapshot the listening cards first: effects can move cards in and out of play.
+	// StartOfTurn, EndOfTurn and WhenUnitDestroyed usually have no listener, so this is usually empty.
+	TArray<int32, TInlineAllocator<GCGRules::MaxUnits * 2 + GCGRules::MaxBases>> ListenerIDs;
+	const uint32 TimingBit = GetEffectTimingBit(Timing);
+	const FGCGPlayerBoard& Board = State.GetPlayer(PlayerID);
+	for (const TArray<FGCGCardInstance>* Zone : { &Board.BattleArea, &Board.BaseSection })
+	{
+		for (const FGCGCardInstance& Card : *Zone)
+		{
+			if (Catalog->GetEffectTimings(Card.CardId) & TimingBit)
+			{
+				ListenerIDs.Add(Card.InstanceID);
+			}
+		}
+	}
+
+	for (const int32 InstanceID : ListenerIDs)
+	{
+		EGCGCardZone Zone = EGCGCardZone::None;
+		if (State.GetPlayer(PlayerID).FindCard(InstanceID, &Zone)
+			&& (Zone == EGCGCardZone::BattleArea || Zone == EGCGCardZone::BaseSection))
+		{
+			TriggerCardEffects(State, PlayerID, InstanceID, Timing);
+		}
+
+		if (State.bGameOver)
+		{
+			return;
+		}
+	}
+}
+
+int32 FGCGRulesEngine::ChooseEffectTarget(const FGCGMatchState& State, int32 SourcePlayerID, bool bEnemy) const
+{
+	const FGCGPlayerBoard& Board = bEnemy ? State.GetOpponent(SourcePlayerID) : State.GetPlayer(SourcePlayerID);
+
+	// Highest AP: the biggest threat to remove, or the best attacker to buff
+	int32 BestInstanceID = 0;
+	int32 BestAP = MIN_int32;
+	for (const FGCGCardInstance& Card : Board.BattleArea)
+	{
+		const FGCGCardView CardView = GetCardView(Card);
+		if (!CardView || CardView.GetCardType() != EGCGCardType::Unit)
+		{
+			continue;
+		}
+
+		const int32 AP = FGCGRules::GetTotalAP(*Catalog, Card);
+		if (AP > BestAP)
+		{
+			BestAP = AP;
+			BestInstanceID = Card.InstanceID;
+		}
+	}
+
+	return BestInstanceID;
+}
+
+void FGCGRulesEngine::CleanupEndOfBattle(FGCGMatchState& State) const
+{
+	for (FGCGPlayerBoard& Board : State.Players)
+	{
+		for (TArray<FGCGCardInstance>* Zone : { &Board.BattleArea, &Board.BaseSection })
+		{
+			for (FGCGCardInstance& Card : *Zone)
+			{
+				if (FGCGRules::CleanupExpiredModifiers(Card, false, true) > 0)
+				{
+					Board.RefreshCardHash(Card);
+				}
+			}
+		}
+	}
+}
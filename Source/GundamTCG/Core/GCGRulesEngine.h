@@ -0,0 +1,203 @@
+// GCGRulesEngine.h - Headless Rules Engine
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Runs complete 1v1 matches on an FGCGMatchState without a world, actors or subsystems
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GundamTCG/Core/GCGMatchState.h"
+
+/**
+ * Rules Engine
+ *
+ * Stateless driver for FGCGMatchState: every call takes the match it acts on,
+ * so one engine serves any number of matches on any number of threads. The
+ * only thing it holds is the (immutable, shared) card catalog generation the
+ * matches were built from.
+ *
+ * Turn structure follows the architecture doc:
+ *   Start (Active Step, start-of-turn triggers) → Draw (empty deck loses)
+ *   → Resource (1 from the Resource Deck) → Main → End (Repair, hand limit, cleanup)
+ *
+ * StartTurn runs automatically up to the Main Phase; the Main Phase is driven
+ * by PlayCard / DeclareAttack / DeclareBlocker / ResolveAttack until EndTurn.
+ *
+ * Card movement, playing cards (Pilot pairing included) and combat are the
+ * FGCGRules flows, run here over FGCGPlayerBoard and in the live game over
+ * AGCGPlayerState by UGCGZoneSubsystem, UGCGPlayerActionSubsystem and
+ * UGCGCombatSubsystem. The engine only adds phase checks and effect triggers.
+ * These flows still exist twice and must be kept in step by hand:
+ *   - Base / Shield damage and Burst: DealDamageToPlayer / BreakShields vs
+ *     UGCGCombatSubsystem::DealDamageToPlayer and UGCGKeywordSubsystem
+ *   - Effects: ExecuteEffect / ChooseEffectTarget vs UGCGEffectSubsystem's interpreter
+ *   - Turn and phase flow: StartTurn / EndTurn vs AGCGGameMode_1v1's timer-driven phases
+ */
+class GUNDAMTCG_API FGCGRulesEngine
+{
+public:
+	/**
+	 * @param InCatalog Catalog generation every card instance's CardId refers to
+	 */
+	explicit FGCGRulesEngine(FGCGCardCatalogPtr InCatalog);
+
+	/** The card catalog the engine resolves card data from */
+	const FGCGCardCatalog& GetCatalog() const { return *Catalog; }
+
+	/** Card definition of an instance, read in place (invalid if unknown) */
+	FGCGCardView GetCardView(const FGCGCardInstance& Card) const { return FGCGRules::GetCardView(*Catalog, Card); }
+
+	// ===== SETUP =====
+
+	/**
+	 * Prepare a new match: build and shuffle both decks, set 6 shields, place
+	 * the EX Base tokens, give Player Two an EX Resource and draw opening hands.
+	 * Does not start turn 1 (call StartTurn).
+	 * @param State The match to (re)initialize
+	 * @param Deck0 Player 0's deck list (goes first)
+	 * @param Deck1 Player 1's deck list
+	 * @param Seed Match seed (shuffles and every other random choice)
+	 */
+	void SetupMatch(FGCGMatchState& State, const FGCGDeckList& Deck0, const FGCGDeckList& Deck1, uint64 Seed) const;
+
+	/**
+	 * Create a card instance with the next instance ID (not placed in any zone)
+	 */
+	FGCGCardInstance CreateCardInstance(FGCGMatchState& State, FName CardNumber, int32 OwnerPlayerID, bool bIsToken = false) const;
+
+	// ===== TURN FLOW =====
+
+	/**
+	 * Begin the next turn: Start, Draw and Resource phases, stopping in the Main Phase
+	 * (or GameOver if the active player could not draw)
+	 */
+	void StartTurn(FGCGMatchState& State) const;
+
+	/**
+	 * End Phase for the active player (end-of-turn triggers, Repair, hand limit,
+	 * cleanup), then start the opponent's turn
+	 * @param DiscardChoices Cards to discard first if the hand is over the limit
+	 *        (remaining excess is discarded from the most recently drawn cards)
+	 */
+	void EndTurn(FGCGMatchState& State, TConstArrayView<int32> DiscardChoices = TConstArrayView<int32>()) const;
+
+	// ===== MAIN PHASE ACTIONS =====
+
+	/**
+	 * Can the player play a card from hand right now?
+	 * @param TargetInstanceID Unit to pair with (Pilots); otherwise the effect target (0 = automatic)
+	 */
+	EGCGRulesResult CanPlayCard(const FGCGMatchState& State, int32 PlayerID, int32 CardInstanceID, int32 TargetInstanceID = 0) const;
+
+	/**
+	 * Play a card from hand: pay its cost, then
+	 * Unit → Battle Area (Deploy), Pilot → paired with a Unit, Base → replaces
+	 * the current Base, Command → resolves and goes to Trash
+	 */
+	EGCGRulesResult PlayCard(FGCGMatchState& State, int32 PlayerID, int32 CardInstanceID, int32 TargetInstanceID = 0) const;
+
+	/**
+	 * Can this unit attack this target?
+	 * @param TargetInstanceID Rested enemy Unit, or 0 to attack the player
+	 */
+	EGCGRulesResult CanAttack(const FGCGMatchState& State, int32 PlayerID, int32 AttackerInstanceID, int32 TargetInstanceID = 0) const;
+
+	/**
+	 * Attack Step: rest the attacker, fire its Attack triggers and wait for a block
+	 */
+	EGCGRulesResult DeclareAttack(FGCGMatchState& State, int32 PlayerID, int32 AttackerInstanceID, int32 TargetInstanceID = 0) const;
+
+	/**
+	 * Can the defending player redirect the current attack to this unit?
+	 * (active Unit with Blocker; High-Maneuver attackers can't be blocked)
+	 */
+	EGCGRulesResult CanBlock(const FGCGMatchState& State, int32 BlockerInstanceID) const;
+
+	/**
+	 * Block Step: redirect the current attack to a Blocker (one per attack)
+	 */
+	EGCGRulesResult DeclareBlocker(FGCGMatchState& State, int32 BlockerInstanceID) const;
+
+	/**
+	 * Damage Step and Battle End Step of the current attack
+	 */
+	EGCGRulesResult ResolveAttack(FGCGMatchState& State) const;
+
+	// ===== DAMAGE =====
+
+	/**
+	 * One instance of damage to a player: Base → Shield (Burst) → defeat
+	 * @param bSuppression Damage to shields destroys one shield per point
+	 * @param bCanDefeat False for Breach damage, which only hits the Base / shields
+	 * @return True if the player was defeated
+	 */
+	bool DealDamageToPlayer(FGCGMatchState& State, int32 PlayerID, int32 Damage, bool bSuppression = false, bool bCanDefeat = true) const;
+
+	/**
+	 * Damage a card in play, destroying it if damage reaches its HP
+	 * @return True if the card was destroyed
+	 */
+	bool DealDamageToCard(FGCGMatchState& State, int32 InstanceID, int32 Damage, EGCGDamageSource Source) const;
+
+	/**
+	 * Destroy a card in play (to its owner's Trash, Destroyed triggers, paired card follows)
+	 */
+	bool DestroyCard(FGCGMatchState& State, int32 InstanceID) const;
+
+	/**
+	 * Destroy shields from the top, resolving Burst effects
+	 * @return Number of shields destroyed
+	 */
+	int32 BreakShields(FGCGMatchState& State, int32 PlayerID, int32 Count) const;
+
+	// ===== EFFECTS =====
+
+	/**
+	 * Resolve every effect of a card with the given timing
+	 * @return Number of effects that resolved
+	 */
+	int32 TriggerCardEffects(FGCGMatchState& State, int32 SourcePlayerID, int32 SourceInstanceID,
+		EGCGEffectTiming Timing, int32 TargetInstanceID = 0) const;
+
+	/**
+	 * Run one compiled effect: checks, then payments, then operations
+	 * @param Code Program from FGCGCardCatalog::GetEffectCode
+	 * @return True if the effect resolved (false if a check failed; nothing was paid)
+	 */
+	bool ExecuteEffect(FGCGMatchState& State, TConstArrayView<FGCGEffectInstruction> Code, int32 SourcePlayerID,
+		int32 SourceInstanceID, int32 TargetInstanceID = 0) const;
+
+	// ===== ZONES =====
+
+	/**
+	 * Move a card between two zones of one board (entry/exit rules applied, index kept in sync)
+	 * Stacked zones receive the card at the bottom, matching UGCGZoneSubsystem::MoveCard.
+	 * @return False if the card isn't in FromZone
+	 */
+	bool MoveCard(FGCGPlayerBoard& Board, int32 InstanceID, EGCGCardZone ToZone) const;
+
+	/**
+	 * Move the top card of a stacked zone
+	 * @param OutCard Optional: receives the moved card
+	 * @return False if the zone was empty
+	 */
+	bool MoveTopCard(FGCGPlayerBoard& Board, EGCGCardZone FromZone, EGCGCardZone ToZone, FGCGCardInstance* OutCard = nullptr) const;
+
+private:
+	/** Place a freshly created card into a zone */
+	void AddCardToZone(FGCGPlayerBoard& Board, FGCGCardInstance&& Card, EGCGCardZone Zone) const;
+
+	/** End the match with a loser */
+	void SetLoser(FGCGMatchState& State, int32 LoserPlayerID) const;
+
+	/** Fire a timing for every card the player has in play */
+	void TriggerBoardEffects(FGCGMatchState& State, int32 PlayerID, EGCGEffectTiming Timing) const;
+
+	/** Pick a unit for an effect that needs one and wasn't given one */
+	int32 ChooseEffectTarget(const FGCGMatchState& State, int32 SourcePlayerID, bool bEnemy) const;
+
+	/** Drop "this battle" modifiers on both boards */
+	void CleanupEndOfBattle(FGCGMatchState& State) const;
+
+	/** Pinned catalog generation */
+	FGCGCardCatalogPtr Catalog;
+};
@@ -0,0 +1,136 @@
+// GCGZobrist.cpp - Match State Hashing Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGZobrist.h"
+#include "GundamTCG/Core/GCGMatchState.h"
+#include "GundamTCG/GameState/GCGGameState.h"
+#include "GundamTCG/PlayerState/GCGPlayerState.h"
+#include "GundamTCG/Subsystems/GCGEffectStackSubsystem.h"
+
+namespace
+{
+	// Distinct seeds per key kind so a card key never collides with a turn or board key by construction
+	constexpr uint64 CardSeed = 0x6A09E667F3BCC908ull;
+	constexpr uint64 BoardSeed = 0xBB67AE8584CAA73Bull;
+	constexpr uint64 TurnSeed = 0x3C6EF372FE94F82Bull;
+}
+
+// ===== KEYS =====
+
+uint64 FGCGZobrist::CardKey(EGCGCardZone Zone, int32 Slot, const FGCGCardInstance& Card)
+{
+	uint64 Hash = Combine(CardSeed, static_cast<uint64>(Card.InstanceID));
+	Hash = Combine(Hash, Card.CardId);
+	Hash = Combine(Hash, static_cast<uint64>(Zone));
+	Hash = Combine(Hash, IsSlotHashed(Zone) ? static_cast<uint64>(Slot) : 0);
+
+	// Flags and small counters packed into one word
+	const uint64 Flags = uint64(Card.bIsActive)
+		| (uint64(Card.bHasAttackedThisTurn) << 1)
+		| (uint64(Card.bIsToken) << 2)
+		| (uint64(Card.ActivationCountThisTurn) << 8)
+		| (uint64(Card.TemporaryKeywordMask) << 16)
+		| (uint64(static_cast<uint8>(Card.LastDamageSource)) << 32);
+	Hash = Combine(Hash, Flags);
+
+	Hash = Combine(Hash, static_cast<uint32>(Card.DamageCounters));
+	Hash = Combine(Hash, (uint64(uint16(Card.ModifierAP)) << 32) | (uint64(uint16(Card.ModifierHP)) << 16) | uint64(uint16(Card.ModifierCost)));
+	Hash = Combine(Hash, (uint64(uint32(Card.OwnerPlayerID)) << 32) | uint32(Card.ControllerPlayerID));
+	Hash = Combine(Hash, (uint64(uint32(Card.PairedCardInstanceID)) << 32) | uint32(Card.TurnDeployed));
+
+	// Modifiers and keywords carry their own expiry and source, which the totals above don't
+	for (const FGCGActiveModifier& Modifier : Card.ActiveModifiers)
+	{
+		Hash = Combine(Hash, (uint64(static_cast<uint8>(Modifier.ModifierType)) << 56)
+			| (uint64(static_cast<uint8>(Modifier.Duration)) << 48)
+			| uint32(Modifier.Amount));
+		Hash = Combine(Hash, (uint64(uint32(Modifier.SourceInstanceID)) << 32) | uint32(Modifier.CreatedOnTurn));
+	}
+
+	for (const FGCGKeywordInstance& Keyword : Card.TemporaryKeywords)
+	{
+		Hash = Combine(Hash, (uint64(static_cast<uint8>(Keyword.Keyword)) << 56) | uint32(Keyword.Value));
+		Hash = Combine(Hash, uint32(Keyword.SourceInstanceID));
+	}
+
+	return Hash;
+}
+
+uint64 FGCGZobrist::BoardKey(int32 PlayerID, uint64 BoardHash)
+{
+	return Combine(Combine(BoardSeed, static_cast<uint64>(PlayerID)), BoardHash);
+}
+
+uint64 FGCGZobrist::TurnKey(int32 TurnNumber, int32 ActivePlayerID, EGCGTurnPhase Phase,
+	const FGCGAttackData& Attack, bool bGameOver, int32 WinnerPlayerID)
+{
+	uint64 Hash = Combine(TurnSeed, (uint64(uint32(TurnNumber)) << 32) | uint32(ActivePlayerID));
+	Hash = Combine(Hash, (uint64(static_cast<uint8>(Phase)) << 8) | (uint64(bGameOver) << 1));
+	Hash = Combine(Hash, static_cast<uint32>(WinnerPlayerID));
+
+	if (Attack.CurrentCombatStep != EGCGCombatStep::None)
+	{
+		Hash = Combine(Hash, (uint64(uint32(Attack.AttackerInstanceID)) << 32) | uint32(Attack.CurrentTargetInstanceID));
+		Hash = Combine(Hash, (uint64(uint32(Attack.BlockerInstanceID)) << 32) | uint32(Attack.TargetPlayerID));
+		Hash = Combine(Hash, uint64(static_cast<uint8>(Attack.CurrentCombatStep))
+			| (uint64(Attack.bTargetingPlayer) << 8)
+			| (uint64(Attack.bBlockerActivated) << 9));
+	}
+
+	return Hash;
+}
+
+// ===== MATCH HASHES =====
+
+uint64 FGCGZobrist::HashMatch(const FGCGMatchState& State)
+{
+	uint64 Hash = TurnKey(State.TurnNumber, State.ActivePlayerID, State.CurrentPhase,
+		State.CurrentAttack, State.bGameOver, State.WinnerPlayerID);
+
+	for (const FGCGPlayerBoard& Board : State.Players)
+	{
+		Hash ^= BoardKey(Board.PlayerID, Board.GetStateHash());
+	}
+
+	return Hash;
+}
+
+uint64 FGCGZobrist::ComputeMatchHash(const FGCGMatchState& State)
+{
+	uint64 Hash = TurnKey(State.TurnNumber, State.ActivePlayerID, State.CurrentPhase,
+		State.CurrentAttack, State.bGameOver, State.WinnerPlayerID);
+
+	for (const FGCGPlayerBoard& Board : State.Players)
+	{
+		Hash ^= BoardKey(Board.PlayerID, ComputeBoardHash(Board));
+	}
+
+	return Hash;
+}
+
+uint64 FGCGZobrist::HashLive(const AGCGGameState* GameState, const UGCGEffectStackSubsystem* EffectStack, bool bRecompute)
+{
+	if (!GameState)
+	{
+		return 0;
+	}
+
+	uint64 Hash = TurnKey(GameState->TurnNumber, GameState->ActivePlayerID, GameState->CurrentPhase,
+		GameState->CurrentAttack, GameState->bGameOver, GameState->WinnerPlayerID);
+
+	for (const TObjectPtr<APlayerState>& PlayerState : GameState->PlayerArray)
+	{
+		if (const AGCGPlayerState* GCGPlayerState = Cast<AGCGPlayerState>(PlayerState))
+		{
+			const uint64 BoardHash = bRecompute ? ComputeBoardHash(*GCGPlayerState) : GCGPlayerState->GetStateHash();
+			Hash ^= BoardKey(GCGPlayerState->GetPlayerID(), BoardHash);
+		}
+	}
+
+	if (EffectStack)
+	{
+		Hash ^= EffectStack->ComputeStateHash();
+	}
+
+	return Hash;
+}
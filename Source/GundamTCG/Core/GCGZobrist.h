@@ -0,0 +1,110 @@
+// GCGZobrist.h - Match State Hashing
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Zobrist-style 64-bit hashes of the rules state for transposition tables and desync checks
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GundamTCG/GCGTypes.h"
+
+struct FGCGMatchState;
+class AGCGGameState;
+class UGCGEffectStackSubsystem;
+
+/**
+ * Zobrist Hashing
+ *
+ * The hash of a match is the XOR of one 64-bit key per card plus keys for the
+ * turn and the effect stack. A card's key covers where it is (zone, and slot in
+ * the stacked zones where order is a rule - Deck, Resource Deck, Shield Stack)
+ * and everything about its state: active/rested, damage, modifiers, temporary
+ * keywords, pairing and per-turn flags. Hand, Battle Area etc. are sets to the
+ * rules, so array order there does not change the hash.
+ *
+ * Keys come from a 64-bit mix of the fields instead of a pre-generated table,
+ * which keeps them identical on every machine and covers any instance ID.
+ *
+ * The per-card keys are maintained incrementally by FGCGCardLocationIndex:
+ * every move already re-indexes the cards it touches, and in-place changes call
+ * RefreshCardHash on the board (rest/activate, damage, modifiers, keywords,
+ * pairing), so keeping the hash costs O(1) per change. The Compute* functions
+ * rebuild a hash from scratch - clients use them on replicated state, and they
+ * verify the incremental hash in development.
+ */
+class GUNDAMTCG_API FGCGZobrist
+{
+public:
+	// ===== KEYS =====
+
+	/** Stir a value into a running hash */
+	static uint64 Combine(uint64 Hash, uint64 Value)
+	{
+		return Mix(Hash ^ (Value + 0x9E3779B97F4A7C15ull + (Hash << 6) + (Hash >> 2)));
+	}
+
+	/** 64-bit finalizer (SplitMix64) */
+	static uint64 Mix(uint64 Value)
+	{
+		Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+		Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+		return Value ^ (Value >> 31);
+	}
+
+	/** Does card order in this zone matter to the rules (and so to the hash)? */
+	static bool IsSlotHashed(EGCGCardZone Zone)
+	{
+		return Zone == EGCGCardZone::Deck || Zone == EGCGCardZone::ResourceDeck || Zone == EGCGCardZone::ShieldStack;
+	}
+
+	/**
+	 * Key of one card at one location
+	 * @param Zone Zone holding the card
+	 * @param Slot Index in the zone array (only used for stacked zones)
+	 * @param Card The card
+	 */
+	static uint64 CardKey(EGCGCardZone Zone, int32 Slot, const FGCGCardInstance& Card);
+
+	/** Key of a player's board from the XOR of its card keys */
+	static uint64 BoardKey(int32 PlayerID, uint64 BoardHash);
+
+	/** Key of the turn: number, active player, phase, attack in progress and result */
+	static uint64 TurnKey(int32 TurnNumber, int32 ActivePlayerID, EGCGTurnPhase Phase,
+		const FGCGAttackData& Attack, bool bGameOver, int32 WinnerPlayerID);
+
+	// ===== MATCH HASHES =====
+
+	/** Hash of a headless match from the boards' incremental hashes - O(1) */
+	static uint64 HashMatch(const FGCGMatchState& State);
+
+	/** Hash of a headless match recomputed from every card */
+	static uint64 ComputeMatchHash(const FGCGMatchState& State);
+
+	/**
+	 * Hash of a live match
+	 * @param EffectStack Effect stack to include, or null (clients: the stack is server-side only)
+	 * @param bRecompute Recompute from every card instead of using the incremental hashes
+	 *        (clients: replicated arrays never go through the location index)
+	 */
+	static uint64 HashLive(const AGCGGameState* GameState, const UGCGEffectStackSubsystem* EffectStack, bool bRecompute = false);
+
+	/**
+	 * XOR of the card keys of every zone of a board (AGCGPlayerState or FGCGPlayerBoard)
+	 */
+	template <typename BoardType>
+	static uint64 ComputeBoardHash(const BoardType& Board)
+	{
+		uint64 Hash = 0;
+		for (uint8 ZoneValue = static_cast<uint8>(EGCGCardZone::Deck); ZoneValue <= static_cast<uint8>(EGCGCardZone::Removal); ++ZoneValue)
+		{
+			const EGCGCardZone Zone = static_cast<EGCGCardZone>(ZoneValue);
+			if (const TArray<FGCGCardInstance>* ZoneArray = Board.GetZoneArray(Zone))
+			{
+				for (int32 Slot = 0; Slot < ZoneArray->Num(); ++Slot)
+				{
+					Hash ^= CardKey(Zone, Slot, (*ZoneArray)[Slot]);
+				}
+			}
+		}
+		return Hash;
+	}
+};
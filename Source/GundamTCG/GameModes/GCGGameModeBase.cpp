@@ -36,6 +36,10 @@ void AGCGGameModeBase::BeginPlay()
 			UE_LOG(LogTemp, Log, TEXT("AGCGGameModeBase: Set card database DataTable on subsystem"));
 		}
 
+		// Pin the current generation - later reloads only affect new matches
+		MatchCatalog = CardDB->AcquireCatalog();
+		UE_LOG(LogTemp, Log, TEXT("AGCGGameModeBase: Pinned card catalog generation %u"), MatchCatalog->GetGeneration());
+
 		UE_LOG(LogTemp, Log, TEXT("AGCGGameModeBase: %s"), *CardDB->GetDatabaseStats());
 	}
 	else
@@ -88,6 +92,17 @@ void AGCGGameModeBase::Logout(AController* Exiting)
 
 const FGCGCardData* AGCGGameModeBase::GetCardData(FName CardNumber) const
 {
+	// Prefer the generation this match pinned
+	if (MatchCatalog.IsValid())
+	{
+		const FGCGCardData* CardData = MatchCatalog->FindCard(CardNumber);
+		if (!CardData)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("AGCGGameModeBase::GetCardData: Card not found: %s"), *CardNumber.ToString());
+		}
+		return CardData;
+	}
+
 	// Use the Card Database subsystem
 	UGCGCardDatabase* CardDB = GetGameInstance()->GetSubsystem<UGCGCardDatabase>();
 	if (!CardDB)
@@ -101,6 +116,11 @@ const FGCGCardData* AGCGGameModeBase::GetCardData(FName CardNumber) const
 
 bool AGCGGameModeBase::CardExists(FName CardNumber) const
 {
+	if (MatchCatalog.IsValid())
+	{
+		return MatchCatalog->FindCardId(CardNumber) != GCG_INVALID_CARD_ID;
+	}
+
 	UGCGCardDatabase* CardDB = GetGameInstance()->GetSubsystem<UGCGCardDatabase>();
 	if (!CardDB)
 	{
@@ -179,49 +199,59 @@ FGCGCardInstance AGCGGameModeBase::CreateCardInstance(FName CardNumber, int32 Ow
 	NewInstance.bIsToken = bIsToken;
 	NewInstance.CurrentZone = EGCGCardZone::None;
 	NewInstance.bIsActive = true;
-	NewInstance.CurrentDamage = 0;
+	NewInstance.DamageCounters = 0;
 	NewInstance.TurnDeployed = 0;
 	NewInstance.bHasAttackedThisTurn = false;
 	NewInstance.ActivationCountThisTurn = 0;
 
-	// Get card data from database
-	const FGCGCardData* CardData = GetCardData(CardNumber);
-	if (CardData)
+	// Reference the card definition by CardId - static data stays in the catalog
+	// Modifiers and temporary keywords are added dynamically during gameplay
+	if (MatchCatalog.IsValid())
 	{
-		// Copy card data to instance
-		NewInstance.CardName = CardData->CardName;
-		NewInstance.CardType = CardData->CardType;
-		NewInstance.Colors = CardData->Colors;
-		NewInstance.Level = CardData->Level;
-		NewInstance.Cost = CardData->Cost;
-		NewInstance.AP = CardData->AP;
-		NewInstance.HP = CardData->HP;
-		NewInstance.Keywords = CardData->Keywords;
-		// Effects and modifiers are added dynamically during gameplay
+		NewInstance.CardId = MatchCatalog->FindCardId(CardNumber);
 	}
-	else
+	else if (UGCGCardDatabase* CardDB = GetGameInstance()->GetSubsystem<UGCGCardDatabase>())
+	{
+		NewInstance.CardId = CardDB->GetCardId(CardNumber);
+	}
+
+	if (NewInstance.CardId == GCG_INVALID_CARD_ID)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("AGCGGameModeBase::CreateCardInstance: Card data not found for '%s'"), *CardNumber.ToString());
 	}
 
-	UE_LOG(LogTemp, Verbose, TEXT("AGCGGameModeBase::CreateCardInstance: Created instance %d for card '%s' (Owner: %d, Token: %d)"),
-		NewInstance.InstanceID, *CardNumber.ToString(), OwnerPlayerID, bIsToken ? 1 : 0);
+	UE_LOG(LogTemp, Verbose, TEXT("AGCGGameModeBase::CreateCardInstance: Created instance %d for card '%s' (CardId: %d, Owner: %d, Token: %d)"),
+		NewInstance.InstanceID, *CardNumber.ToString(), NewInstance.CardId, OwnerPlayerID, bIsToken ? 1 : 0);
 
 	return NewInstance;
 }
 
 FGCGCardInstance AGCGGameModeBase::CreateTokenInstance(FName TokenType, int32 OwnerPlayerID)
 {
-	// Create token instance (stats are loaded from card database token definitions)
+	// Create token instance (stats come from the card database token definitions; CardNumber is the token type)
 	FGCGCardInstance TokenInstance = CreateCardInstance(TokenType, OwnerPlayerID, true);
-	TokenInstance.TokenType = TokenType;
 
+	const FGCGCardData* TokenData = GetCardDataForInstance(TokenInstance);
 	UE_LOG(LogTemp, Log, TEXT("AGCGGameModeBase::CreateTokenInstance: Created %s token (ID: %d, AP: %d, HP: %d)"),
-		*TokenType.ToString(), TokenInstance.InstanceID, TokenInstance.AP, TokenInstance.HP);
+		*TokenType.ToString(), TokenInstance.InstanceID, TokenData ? TokenData->AP : 0, TokenData ? TokenData->HP : 0);
 
 	return TokenInstance;
 }
 
+const FGCGCardData* AGCGGameModeBase::GetCardDataForInstance(const FGCGCardInstance& CardInstance) const
+{
+	// CardIds were assigned from the pinned generation, so this is a plain array index
+	if (MatchCatalog.IsValid())
+	{
+		if (const FGCGCardData* CardData = MatchCatalog->GetCard(CardInstance.CardId))
+		{
+			return CardData;
+		}
+	}
+
+	return GetCardData(CardInstance.CardNumber);
+}
+
 // ===== INSTANCE ID GENERATION =====
 
 int32 AGCGGameModeBase::GenerateInstanceID()
@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/GameMode.h"
 #include "GundamTCG/GCGTypes.h"
+#include "GundamTCG/Cards/GCGCardCatalog.h"
 #include "GCGGameModeBase.generated.h"
 
 // Forward declarations
@@ -19,7 +20,7 @@ class AGCGPlayerController;
  * Base Game Mode for Gundam Card Game
  *
  * This is the base class that provides common functionality for all game modes:
- * - Card database management
+ * - Card database management (the match pins one catalog generation at BeginPlay)
  * - Player management
  * - Game initialization
  *
@@ -47,6 +48,8 @@ public:
 
 	/**
 	 * Lookup card data by card number
+	 * Resolved against this match's pinned catalog generation, so the pointer stays valid
+	 * for the whole match even if the card database is hot-reloaded.
 	 * @param CardNumber The card number to look up (e.g., "GCG-001")
 	 * @return Pointer to card data, or nullptr if not found
 	 */
@@ -61,6 +64,20 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Cards")
 	bool CardExists(FName CardNumber) const;
 
+	/**
+	 * Lookup the static card data behind a card instance (C++ only)
+	 * Uses the instance's CardId (O(1) index into the pinned catalog), falling back to its CardNumber.
+	 * @param CardInstance The card instance
+	 * @return Pointer to card data, or nullptr if not found
+	 */
+	const FGCGCardData* GetCardDataForInstance(const FGCGCardInstance& CardInstance) const;
+
+	/**
+	 * Get the catalog generation this match pinned (C++ only)
+	 * @return The pinned catalog, or nullptr before BeginPlay
+	 */
+	const FGCGCardCatalogPtr& GetMatchCatalog() const { return MatchCatalog; }
+
 	// ===== PLAYER MANAGEMENT =====
 
 	/**
@@ -134,8 +151,19 @@ protected:
 	 */
 	virtual void Logout(AController* Exiting) override;
 
+	// ===== CARD DATABASE =====
+
+	/**
+	 * Catalog generation pinned for the lifetime of this match
+	 * Reloads publish new generations for future matches; this one is released with the game mode.
+	 */
+	FGCGCardCatalogPtr MatchCatalog;
+
 	// ===== INSTANCE ID GENERATION =====
 
+	/** Snapshots save and restore the counter with the rest of the match */
+	friend struct FGCGMatchSnapshot;
+
 	/**
 	 * Next available card instance ID
 	 * This is incremented each time a new card instance is created
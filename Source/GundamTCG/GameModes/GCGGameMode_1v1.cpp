@@ -4,13 +4,18 @@
 #include "GCGGameMode_1v1.h"
 #include "GundamTCG/GameState/GCGGameState.h"
 #include "GundamTCG/PlayerState/GCGPlayerState.h"
+#include "GundamTCG/PlayerState/GCGOrderedZone.h"
+#include "GundamTCG/Core/GCGRules.h"
 #include "GundamTCG/Subsystems/GCGZoneSubsystem.h"
 #include "GundamTCG/Subsystems/GCGPlayerActionSubsystem.h"
 #include "GundamTCG/Subsystems/GCGCombatSubsystem.h"
 #include "GundamTCG/Subsystems/GCGKeywordSubsystem.h"
 #include "GundamTCG/Subsystems/GCGEffectSubsystem.h"
+#include "GundamTCG/Subsystems/GCGEffectStackSubsystem.h"
 #include "GundamTCG/Subsystems/GCGLinkUnitSubsystem.h"
 #include "GundamTCG/Subsystems/GCGCardDatabase.h"
+#include "Algo/Reverse.h"
+#include "Kismet/GameplayStatics.h"
 #include "TimerManager.h"
 #include "Engine/World.h"
 
@@ -24,6 +29,13 @@ void AGCGGameMode_1v1::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Listeners and queued expiries from a previous match refer to its cards and catalog
+	if (UGCGEffectSubsystem* EffectSubsystem = GetGameInstance()->GetSubsystem<UGCGEffectSubsystem>())
+	{
+		EffectSubsystem->ResetTriggers();
+		EffectSubsystem->ResetModifierExpiry();
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::BeginPlay - 1v1 Match Mode initialized"));
 }
 
@@ -62,6 +74,9 @@ void AGCGGameMode_1v1::InitializeGame()
 	GCGGameState->bIsTeamBattle = false;
 	GCGGameState->ActivePlayerID = 0; // Player 1 goes first by default
 
+	// Seed the match (no-op if deck setup already did)
+	SeedMatchRandom(GCGGameState);
+
 	// NOTE: Deck setup must be called externally after deck selection
 	// Once decks are set up, the following initialization sequence applies:
 
@@ -79,11 +94,13 @@ void AGCGGameMode_1v1::InitializeGame()
 				int32 CardsDrawn = ZoneSubsystem->DrawTopCards(EGCGCardZone::Deck, PlayerState, 5, InitialHand);
 
 				// Move cards to hand
+				const int32 FirstHandSlot = PlayerState->Hand.Num();
 				for (FGCGCardInstance& Card : InitialHand)
 				{
 					Card.CurrentZone = EGCGCardZone::Hand;
 					PlayerState->Hand.Add(Card);
 				}
+				PlayerState->IndexZone(EGCGCardZone::Hand, FirstHandSlot);
 
 				UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::InitializeGame - Player %d drew initial hand (%d cards)"),
 					PlayerState->GetPlayerID(), CardsDrawn);
@@ -309,18 +326,14 @@ void AGCGGameMode_1v1::ExecuteDrawPhase()
 
 	// Player draws 1 card (mandatory)
 	FGCGCardInstance DrawnCard;
-	if (ZoneSubsystem->DrawTopCard(EGCGCardZone::Deck, ActivePlayerState, DrawnCard))
+	if (ZoneSubsystem->MoveTopCard(EGCGCardZone::Deck, EGCGCardZone::Hand,
+		ActivePlayerState, GCGGameState, DrawnCard, false))
 	{
-		// Move card to hand
-		if (ZoneSubsystem->MoveCard(DrawnCard, EGCGCardZone::Deck, EGCGCardZone::Hand,
-			ActivePlayerState, GCGGameState, false))
-		{
-			UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::ExecuteDrawPhase - Player %d drew card: %s (ID: %d)"),
-				GCGGameState->ActivePlayerID, *DrawnCard.CardName.ToString(), DrawnCard.InstanceID);
+		UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::ExecuteDrawPhase - Player %d drew card: %s (ID: %d)"),
+			GCGGameState->ActivePlayerID, *DrawnCard.CardNumber.ToString(), DrawnCard.InstanceID);
 
-			// Mark that player has drawn this turn
-			ActivePlayerState->bHasDrawnThisTurn = true;
-		}
+		// Mark that player has drawn this turn
+		ActivePlayerState->bHasDrawnThisTurn = true;
 	}
 
 	// Call Blueprint event
@@ -369,18 +382,14 @@ void AGCGGameMode_1v1::ExecuteResourcePhase()
 	else
 	{
 		FGCGCardInstance ResourceCard;
-		if (ZoneSubsystem->DrawTopCard(EGCGCardZone::ResourceDeck, ActivePlayerState, ResourceCard))
+		if (ZoneSubsystem->MoveTopCard(EGCGCardZone::ResourceDeck, EGCGCardZone::ResourceArea,
+			ActivePlayerState, GCGGameState, ResourceCard, true))
 		{
-			// Move card to Resource Area
-			if (ZoneSubsystem->MoveCard(ResourceCard, EGCGCardZone::ResourceDeck, EGCGCardZone::ResourceArea,
-				ActivePlayerState, GCGGameState, true))
-			{
-				UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::ExecuteResourcePhase - Player %d placed resource: %s (ID: %d)"),
-					GCGGameState->ActivePlayerID, *ResourceCard.CardName.ToString(), ResourceCard.InstanceID);
+			UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::ExecuteResourcePhase - Player %d placed resource: %s (ID: %d)"),
+				GCGGameState->ActivePlayerID, *ResourceCard.CardNumber.ToString(), ResourceCard.InstanceID);
 
-				// Mark that player has placed resource this turn
-				ActivePlayerState->bHasPlacedResourceThisTurn = true;
-			}
+			// Mark that player has placed resource this turn
+			ActivePlayerState->bHasPlacedResourceThisTurn = true;
 		}
 	}
 
@@ -443,33 +452,16 @@ void AGCGGameMode_1v1::ExecuteEndPhase()
 		EffectSubsystem->TriggerEffects(EGCGEffectTiming::EndOfTurn, Context, GCGGameState);
 	}
 
-	// Process Repair keyword for both players (Phase 7)
+	// Repair: only the turn player's cards recover at the end of their turn
 	UGCGKeywordSubsystem* KeywordSubsystem = GetGameInstance()->GetSubsystem<UGCGKeywordSubsystem>();
-	if (KeywordSubsystem)
+	AGCGPlayerState* TurnPlayer = GetPlayerStateByID(GCGGameState->ActivePlayerID);
+	if (KeywordSubsystem && TurnPlayer)
 	{
-		// Process Repair for active player
-		AGCGPlayerState* ActivePlayer = GetPlayerStateByID(GCGGameState->ActivePlayerID);
-		if (ActivePlayer)
+		int32 Healing = KeywordSubsystem->ProcessRepairForPlayer(TurnPlayer);
+		if (Healing > 0)
 		{
-			int32 Healing = KeywordSubsystem->ProcessRepairForPlayer(ActivePlayer);
-			if (Healing > 0)
-			{
-				UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::ExecuteEndPhase - Player %d: Repair healed %d damage"),
-					GCGGameState->ActivePlayerID, Healing);
-			}
-		}
-
-		// Process Repair for non-active player
-		int32 OpponentID = (GCGGameState->ActivePlayerID == 1) ? 2 : 1;
-		AGCGPlayerState* OpponentPlayer = GetPlayerStateByID(OpponentID);
-		if (OpponentPlayer)
-		{
-			int32 Healing = KeywordSubsystem->ProcessRepairForPlayer(OpponentPlayer);
-			if (Healing > 0)
-			{
-				UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::ExecuteEndPhase - Player %d: Repair healed %d damage"),
-					OpponentID, Healing);
-			}
+			UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::ExecuteEndPhase - Player %d: Repair healed %d damage"),
+				GCGGameState->ActivePlayerID, Healing);
 		}
 	}
 
@@ -481,21 +473,10 @@ void AGCGGameMode_1v1::ExecuteEndPhase()
 	GCGGameState->CurrentEndPhaseStep = EGCGEndPhaseStep::CleanupStep;
 	CleanupTurnEffects();
 
-	// Cleanup modifiers for both players (Phase 8)
+	// Cleanup modifiers for both players (Phase 8) - only the cards queued for this turn
 	if (EffectSubsystem)
 	{
-		AGCGPlayerState* ActivePlayer = GetPlayerStateByID(GCGGameState->ActivePlayerID);
-		int32 OpponentID = (GCGGameState->ActivePlayerID == 1) ? 2 : 1;
-		AGCGPlayerState* OpponentPlayer = GetPlayerStateByID(OpponentID);
-
-		if (ActivePlayer)
-		{
-			EffectSubsystem->CleanupAllModifiers(ActivePlayer, GCGGameState, true, false);
-		}
-		if (OpponentPlayer)
-		{
-			EffectSubsystem->CleanupAllModifiers(OpponentPlayer, GCGGameState, true, false);
-		}
+		EffectSubsystem->ExpireModifiers(GCGGameState, true, false);
 	}
 
 	// Reset step
@@ -594,7 +575,7 @@ void AGCGGameMode_1v1::RequestPassPriority(int32 PlayerID)
 	}
 }
 
-bool AGCGGameMode_1v1::RequestPlayCard(int32 PlayerID, int32 CardInstanceID)
+bool AGCGGameMode_1v1::RequestPlayCard(int32 PlayerID, int32 CardInstanceID, int32 TargetInstanceID)
 {
 	AGCGGameState* GCGGameState = GetGCGGameState();
 	if (!GCGGameState)
@@ -620,7 +601,7 @@ bool AGCGGameMode_1v1::RequestPlayCard(int32 PlayerID, int32 CardInstanceID)
 	}
 
 	// Execute play card action
-	FGCGPlayerActionResult Result = ActionSubsystem->PlayCardFromHand(CardInstanceID, PlayerState, GCGGameState);
+	FGCGPlayerActionResult Result = ActionSubsystem->PlayCardFromHand(CardInstanceID, PlayerState, GCGGameState, TargetInstanceID);
 
 	if (!Result.bSuccess)
 	{
@@ -687,7 +668,7 @@ int32 AGCGGameMode_1v1::RequestDiscardCards(int32 PlayerID, const TArray<int32>&
 	}
 
 	// Execute discard action
-	int32 DiscardedCount = ActionSubsystem->DiscardToHandLimit(CardInstanceIDs, PlayerState, 10);
+	int32 DiscardedCount = ActionSubsystem->DiscardToHandLimit(CardInstanceIDs, PlayerState, GCGRules::HandLimit);
 
 	UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::RequestDiscardCards - Player %d discarded %d cards"),
 		PlayerID, DiscardedCount);
@@ -695,7 +676,7 @@ int32 AGCGGameMode_1v1::RequestDiscardCards(int32 PlayerID, const TArray<int32>&
 	return DiscardedCount;
 }
 
-bool AGCGGameMode_1v1::RequestDeclareAttack(int32 PlayerID, int32 AttackerInstanceID)
+bool AGCGGameMode_1v1::RequestDeclareAttack(int32 PlayerID, int32 AttackerInstanceID, int32 TargetUnitInstanceID)
 {
 	AGCGGameState* GCGGameState = GetGCGGameState();
 	if (!GCGGameState)
@@ -730,7 +711,7 @@ bool AGCGGameMode_1v1::RequestDeclareAttack(int32 PlayerID, int32 AttackerInstan
 	}
 
 	// Declare attack
-	FGCGCombatResult Result = CombatSubsystem->DeclareAttack(AttackerInstanceID, AttackingPlayer, DefendingPlayer, GCGGameState);
+	FGCGCombatResult Result = CombatSubsystem->DeclareAttack(AttackerInstanceID, AttackingPlayer, DefendingPlayer, GCGGameState, TargetUnitInstanceID);
 
 	if (!Result.bSuccess)
 	{
@@ -858,24 +839,8 @@ bool AGCGGameMode_1v1::RequestPairPilot(int32 PlayerID, int32 LinkUnitInstanceID
 		return false;
 	}
 
-	// Get Card Database subsystem
-	UGCGCardDatabase* CardDatabase = GetGameInstance()->GetSubsystem<UGCGCardDatabase>();
-	if (!CardDatabase)
-	{
-		UE_LOG(LogTemp, Error, TEXT("AGCGGameMode_1v1::RequestPairPilot - Card database not found"));
-		return false;
-	}
-
 	// Find Link Unit instance in Battle Area
-	FGCGCardInstance* LinkUnitInstance = nullptr;
-	for (FGCGCardInstance& Card : PlayerState->BattleArea)
-	{
-		if (Card.InstanceID == LinkUnitInstanceID)
-		{
-			LinkUnitInstance = &Card;
-			break;
-		}
-	}
+	FGCGCardInstance* LinkUnitInstance = PlayerState->FindCardInZone(LinkUnitInstanceID, EGCGCardZone::BattleArea);
 
 	if (!LinkUnitInstance)
 	{
@@ -884,15 +849,7 @@ bool AGCGGameMode_1v1::RequestPairPilot(int32 PlayerID, int32 LinkUnitInstanceID
 	}
 
 	// Find Pilot instance in Battle Area
-	FGCGCardInstance* PilotInstance = nullptr;
-	for (FGCGCardInstance& Card : PlayerState->BattleArea)
-	{
-		if (Card.InstanceID == PilotInstanceID)
-		{
-			PilotInstance = &Card;
-			break;
-		}
-	}
+	FGCGCardInstance* PilotInstance = PlayerState->FindCardInZone(PilotInstanceID, EGCGCardZone::BattleArea);
 
 	if (!PilotInstance)
 	{
@@ -900,9 +857,9 @@ bool AGCGGameMode_1v1::RequestPairPilot(int32 PlayerID, int32 LinkUnitInstanceID
 		return false;
 	}
 
-	// Get card data
-	const FGCGCardData* LinkUnitData = CardDatabase->GetCardData(LinkUnitInstance->CardNumber);
-	const FGCGCardData* PilotData = CardDatabase->GetCardData(PilotInstance->CardNumber);
+	// Get card data (from this match's pinned catalog generation)
+	const FGCGCardData* LinkUnitData = GetCardDataForInstance(*LinkUnitInstance);
+	const FGCGCardData* PilotData = GetCardDataForInstance(*PilotInstance);
 
 	if (!LinkUnitData || !PilotData)
 	{
@@ -911,7 +868,7 @@ bool AGCGGameMode_1v1::RequestPairPilot(int32 PlayerID, int32 LinkUnitInstanceID
 	}
 
 	// Attempt pairing
-	FGCGLinkResult Result = LinkUnitSubsystem->PairPilotWithUnit(*LinkUnitInstance, *PilotInstance, LinkUnitData, PilotData);
+	FGCGLinkResult Result = LinkUnitSubsystem->PairPilotWithUnit(*LinkUnitInstance, *PilotInstance, LinkUnitData, PilotData, PlayerState);
 
 	if (!Result.bSuccess)
 	{
@@ -926,6 +883,15 @@ bool AGCGGameMode_1v1::RequestPairPilot(int32 PlayerID, int32 LinkUnitInstanceID
 	return true;
 }
 
+bool AGCGGameMode_1v1::RequestPlayPilot(int32 PlayerID, int32 PilotInstanceID, int32 UnitInstanceID)
+{
+	UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::RequestPlayPilot - Player %d requesting to play Pilot %d onto Unit %d"),
+		PlayerID, PilotInstanceID, UnitInstanceID);
+
+	// The shared play rules check the Unit before paying anything, then pair the Pilot with it
+	return RequestPlayCard(PlayerID, PilotInstanceID, UnitInstanceID);
+}
+
 bool AGCGGameMode_1v1::RequestUnpairPilot(int32 PlayerID, int32 LinkUnitInstanceID)
 {
 	UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::RequestUnpairPilot - Player %d requesting to unpair Link Unit %d"),
@@ -948,15 +914,7 @@ bool AGCGGameMode_1v1::RequestUnpairPilot(int32 PlayerID, int32 LinkUnitInstance
 	}
 
 	// Find Link Unit instance in Battle Area
-	FGCGCardInstance* LinkUnitInstance = nullptr;
-	for (FGCGCardInstance& Card : PlayerState->BattleArea)
-	{
-		if (Card.InstanceID == LinkUnitInstanceID)
-		{
-			LinkUnitInstance = &Card;
-			break;
-		}
-	}
+	FGCGCardInstance* LinkUnitInstance = PlayerState->FindCardInZone(LinkUnitInstanceID, EGCGCardZone::BattleArea);
 
 	if (!LinkUnitInstance)
 	{
@@ -965,22 +923,14 @@ bool AGCGGameMode_1v1::RequestUnpairPilot(int32 PlayerID, int32 LinkUnitInstance
 	}
 
 	// Check if paired
-	if (LinkUnitInstance->PairedCardInstanceID == -1)
+	if (LinkUnitInstance->PairedCardInstanceID == 0)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("AGCGGameMode_1v1::RequestUnpairPilot - Link Unit is not paired"));
 		return false;
 	}
 
 	// Find Pilot instance
-	FGCGCardInstance* PilotInstance = nullptr;
-	for (FGCGCardInstance& Card : PlayerState->BattleArea)
-	{
-		if (Card.InstanceID == LinkUnitInstance->PairedCardInstanceID)
-		{
-			PilotInstance = &Card;
-			break;
-		}
-	}
+	FGCGCardInstance* PilotInstance = PlayerState->FindCardInZone(LinkUnitInstance->PairedCardInstanceID, EGCGCardZone::BattleArea);
 
 	if (!PilotInstance)
 	{
@@ -989,7 +939,7 @@ bool AGCGGameMode_1v1::RequestUnpairPilot(int32 PlayerID, int32 LinkUnitInstance
 	}
 
 	// Attempt unpairing
-	FGCGLinkResult Result = LinkUnitSubsystem->UnpairPilot(*LinkUnitInstance, *PilotInstance);
+	FGCGLinkResult Result = LinkUnitSubsystem->UnpairPilot(*LinkUnitInstance, *PilotInstance, PlayerState);
 
 	if (!Result.bSuccess)
 	{
@@ -1004,6 +954,29 @@ bool AGCGGameMode_1v1::RequestUnpairPilot(int32 PlayerID, int32 LinkUnitInstance
 
 // ===== SETUP HELPERS =====
 
+void AGCGGameMode_1v1::SeedMatchRandom(AGCGGameState* GCGGameState) const
+{
+	if (!GCGGameState || GCGGameState->IsMatchRandomInitialized())
+	{
+		return;
+	}
+
+	uint64 Seed = static_cast<uint64>(FixedMatchSeed);
+
+	const FString SeedOption = UGameplayStatics::ParseOption(OptionsString, TEXT("Seed"));
+	if (!SeedOption.IsEmpty())
+	{
+		Seed = FCString::Strtoui64(*SeedOption, nullptr, 10);
+	}
+
+	if (Seed == 0)
+	{
+		Seed = FGCGMatchRandom::MakeSeed();
+	}
+
+	GCGGameState->InitializeMatchRandom(Seed);
+}
+
 void AGCGGameMode_1v1::SetupPlayerDecks(int32 PlayerID, const TArray<FName>& MainDeckList, const TArray<FName>& ResourceDeckList)
 {
 	UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::SetupPlayerDecks - Setting up decks for Player %d (Main: %d cards, Resource: %d cards)"),
@@ -1029,9 +1002,10 @@ void AGCGGameMode_1v1::SetupPlayerDecks(int32 PlayerID, const TArray<FName>& Mai
 	PlayerState->MainDeckList = MainDeckList;
 	PlayerState->ResourceDeckList = ResourceDeckList;
 
-	// Clear existing deck zones
+	// Clear existing deck zones (the shuffles below re-index the new cards)
 	PlayerState->Deck.Empty();
 	PlayerState->ResourceDeck.Empty();
+	PlayerState->MarkCardLocationIndexDirty();
 
 	// Create and add Main Deck cards
 	for (const FName& CardNumber : MainDeckList)
@@ -1049,7 +1023,8 @@ void AGCGGameMode_1v1::SetupPlayerDecks(int32 PlayerID, const TArray<FName>& Mai
 		PlayerState->ResourceDeck.Add(CardInstance);
 	}
 
-	// Shuffle both decks
+	// Shuffle both decks (from this player's deck stream)
+	SeedMatchRandom(GetGCGGameState());
 	ZoneSubsystem->ShuffleZone(EGCGCardZone::Deck, PlayerState);
 	ZoneSubsystem->ShuffleZone(EGCGCardZone::ResourceDeck, PlayerState);
 
@@ -1093,12 +1068,14 @@ void AGCGGameMode_1v1::SetupPlayerShields(int32 PlayerID)
 		UE_LOG(LogTemp, Warning, TEXT("AGCGGameMode_1v1::SetupPlayerShields - Could only draw %d shields (expected 6)"), CardsDrawn);
 	}
 
-	// Move cards to Shield Stack
+	// Move cards to Shield Stack (stacked bottom → top, so the deck's top card ends up as the top shield)
 	for (FGCGCardInstance& ShieldCard : ShieldCards)
 	{
 		ShieldCard.CurrentZone = EGCGCardZone::ShieldStack;
-		PlayerState->ShieldStack.Add(ShieldCard);
 	}
+	Algo::Reverse(ShieldCards);
+	FGCGOrderedZone::PushBottom(PlayerState->ShieldStack, ShieldCards);
+	PlayerState->IndexZone(EGCGCardZone::ShieldStack);
 
 	UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::SetupPlayerShields - Player %d now has %d shields"),
 		PlayerID, PlayerState->ShieldStack.Num());
@@ -1121,6 +1098,12 @@ void AGCGGameMode_1v1::SetupEXBase(int32 PlayerID)
 
 	// Place EX Base in Base section
 	PlayerState->BaseSection.Add(EXBaseToken);
+	PlayerState->IndexZone(EGCGCardZone::BaseSection, PlayerState->BaseSection.Num() - 1);
+
+	if (UGCGEffectSubsystem* EffectSubsystem = GetGameInstance()->GetSubsystem<UGCGEffectSubsystem>())
+	{
+		EffectSubsystem->RegisterCard(PlayerID, EXBaseToken);
+	}
 
 	UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::SetupEXBase - Created EX Base token for Player %d (ID: %d)"),
 		PlayerID, EXBaseToken.InstanceID);
@@ -1143,6 +1126,7 @@ void AGCGGameMode_1v1::SetupEXResource(int32 PlayerID)
 
 	// Place EX Resource in Resource Area
 	PlayerState->ResourceArea.Add(EXResourceToken);
+	PlayerState->IndexZone(EGCGCardZone::ResourceArea, PlayerState->ResourceArea.Num() - 1);
 
 	UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::SetupEXResource - Created EX Resource token for Player %d (ID: %d)"),
 		PlayerID, EXResourceToken.InstanceID);
@@ -1196,10 +1180,10 @@ void AGCGGameMode_1v1::ProcessHandLimit(int32 PlayerID)
 
 	int32 HandSize = PlayerState->GetHandSize();
 
-	// If hand size ≥ 11, player must discard down to 10
-	if (HandSize >= 11)
+	// Over the hand limit, the player must discard down to it
+	const int32 CardsToDiscard = FGCGRules::GetHandExcess(*PlayerState);
+	if (CardsToDiscard > 0)
 	{
-		int32 CardsToDiscard = HandSize - 10;
 		UE_LOG(LogTemp, Warning, TEXT("AGCGGameMode_1v1::ProcessHandLimit - Player %d has %d cards in hand, must discard %d"),
 			PlayerID, HandSize, CardsToDiscard);
 
@@ -1220,8 +1204,14 @@ void AGCGGameMode_1v1::ProcessHandLimit(int32 PlayerID)
 
 void AGCGGameMode_1v1::CleanupTurnEffects()
 {
-	// TODO: Implement effect cleanup (Phase 8: Effect System)
-	// This will remove all "UntilEndOfTurn" modifiers and temporary effects
+	// "UntilEndOfTurn" modifiers and temporary keywords are expired by the effect subsystem (ExpireModifiers)
+	AGCGGameState* GCGGameState = GetGCGGameState();
+	UGCGEffectStackSubsystem* EffectStackSubsystem = GetGameInstance()->GetSubsystem<UGCGEffectStackSubsystem>();
+	if (GCGGameState && EffectStackSubsystem)
+	{
+		// This turn's effects end with it
+		EffectStackSubsystem->CleanupExpiredTurnEffects(GCGGameState->TurnNumber + 1);
+	}
 
 	UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_1v1::CleanupTurnEffects - Cleaning up turn effects"));
 }
@@ -157,10 +157,11 @@ public:
 	 * Player requests to play a card from hand
 	 * @param PlayerID The player making the request
 	 * @param CardInstanceID The card to play
+	 * @param TargetInstanceID The Unit a Pilot is played onto (0 for other cards)
 	 * @return True if action was successful
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Player Actions")
-	bool RequestPlayCard(int32 PlayerID, int32 CardInstanceID);
+	bool RequestPlayCard(int32 PlayerID, int32 CardInstanceID, int32 TargetInstanceID = 0);
 
 	/**
 	 * Player requests to place a card from hand as a resource
@@ -185,10 +186,11 @@ public:
 	 * Player requests to declare an attack
 	 * @param PlayerID The player making the request
 	 * @param AttackerInstanceID The attacking unit
+	 * @param TargetUnitInstanceID Rested enemy Unit to attack (0 to attack the opponent)
 	 * @return True if attack was successfully declared
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Player Actions|Combat")
-	bool RequestDeclareAttack(int32 PlayerID, int32 AttackerInstanceID);
+	bool RequestDeclareAttack(int32 PlayerID, int32 AttackerInstanceID, int32 TargetUnitInstanceID = 0);
 
 	/**
 	 * Player requests to declare a blocker
@@ -217,6 +219,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Player Actions|Link Units")
 	bool RequestPairPilot(int32 PlayerID, int32 LinkUnitInstanceID, int32 PilotInstanceID);
 
+	/**
+	 * Player requests to play a Pilot from hand onto an unpaired Unit
+	 * @param PlayerID The player making the request
+	 * @param PilotInstanceID The Pilot in hand
+	 * @param UnitInstanceID The Unit in the Battle Area to pair it with
+	 * @return True if the Pilot was played and paired
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Player Actions|Link Units")
+	bool RequestPlayPilot(int32 PlayerID, int32 PilotInstanceID, int32 UnitInstanceID);
+
 	/**
 	 * Player requests to unpair a Pilot from a Link Unit (Phase 9)
 	 * @param PlayerID The player making the request
@@ -300,6 +312,21 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Timing")
 	float PhaseAdvanceDelay;
 
+	// ===== MATCH RANDOM =====
+
+	/**
+	 * Seed for the match's random streams (0 = pick a fresh seed per match)
+	 * The "?Seed=<n>" travel option overrides it, so a match can be replayed exactly
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Match")
+	int64 FixedMatchSeed = 0;
+
+	/**
+	 * Seed the game state's random streams once per match, before the first shuffle
+	 * @param GCGGameState The game state to seed
+	 */
+	void SeedMatchRandom(AGCGGameState* GCGGameState) const;
+
 	// ===== BLUEPRINT EVENTS =====
 
 	/**
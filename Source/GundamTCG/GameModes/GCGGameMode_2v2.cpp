@@ -4,6 +4,7 @@
 #include "GCGGameMode_2v2.h"
 #include "GundamTCG/GameState/GCGGameState.h"
 #include "GundamTCG/PlayerState/GCGPlayerState.h"
+#include "GundamTCG/PlayerState/GCGOrderedZone.h"
 #include "GundamTCG/Subsystems/GCGZoneSubsystem.h"
 #include "GundamTCG/Subsystems/GCGCombatSubsystem.h"
 #include "TimerManager.h"
@@ -310,22 +311,25 @@ void AGCGGameMode_2v2::SetupTeamShields(int32 TeamID)
 
 	// Setup shared shield stack (8 shields: 4 from each player, alternating)
 	// Order: P1, P2, P1, P2, P1, P2, P1, P2 (from top to bottom)
+	// Stored bottom → top like every stacked zone, so each pair goes on top P2 first
 	Team->SharedShieldStack.Empty();
 
 	for (int32 i = 0; i < ShieldsPerPlayer; i++)
 	{
 		// Draw from Player 1's deck
 		TArray<FGCGCardInstance> P1Cards = ZoneSubsystem->DrawTopCards(Player1State, EGCGCardZone::Deck, 1);
-		if (P1Cards.Num() > 0)
-		{
-			Team->SharedShieldStack.Add(P1Cards[0]);
-		}
 
 		// Draw from Player 2's deck
 		TArray<FGCGCardInstance> P2Cards = ZoneSubsystem->DrawTopCards(Player2State, EGCGCardZone::Deck, 1);
+
 		if (P2Cards.Num() > 0)
 		{
-			Team->SharedShieldStack.Add(P2Cards[0]);
+			FGCGOrderedZone::PushTop(Team->SharedShieldStack, P2Cards[0]);
+		}
+
+		if (P1Cards.Num() > 0)
+		{
+			FGCGOrderedZone::PushTop(Team->SharedShieldStack, P1Cards[0]);
 		}
 	}
 
@@ -389,6 +393,7 @@ void AGCGGameMode_2v2::SetupTeamEXResources(int32 TeamID)
 
 		// Add to player's Resource Area
 		PlayerState->ResourceArea.Add(EXResource);
+		PlayerState->IndexZone(EGCGCardZone::ResourceArea, PlayerState->ResourceArea.Num() - 1);
 
 		UE_LOG(LogTemp, Log, TEXT("AGCGGameMode_2v2::SetupTeamEXResources - Player %d received EX Resource"), PlayerID);
 	}
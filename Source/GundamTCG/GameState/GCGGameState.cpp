@@ -2,7 +2,16 @@
 // Unreal Engine 5.6 - Gundam TCG Implementation
 
 #include "GCGGameState.h"
+#include "GundamTCG/Core/GCGZobrist.h"
+#include "GundamTCG/PlayerState/GCGPlayerState.h"
 #include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
+
+namespace
+{
+	// Player states replicate on their own schedule; give them time to catch up before comparing
+	constexpr float StateHashCheckDelay = 0.5f;
+}
 
 AGCGGameState::AGCGGameState()
 {
@@ -26,6 +35,11 @@ AGCGGameState::AGCGGameState()
 	TeamA.TeamID = 0;
 	TeamB.TeamID = 1;
 
+	// Initialize desync detection
+	ServerStateHash = 0;
+	StateHashSequence = 0;
+	MismatchedStateHashSequence = INDEX_NONE;
+
 	// Enable replication
 	bReplicates = true;
 	bAlwaysRelevant = true;
@@ -55,6 +69,102 @@ void AGCGGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLif
 	DOREPLIFETIME(AGCGGameState, bIsTeamBattle);
 	DOREPLIFETIME(AGCGGameState, TeamA);
 	DOREPLIFETIME(AGCGGameState, TeamB);
+
+	// Replicate desync detection
+	DOREPLIFETIME(AGCGGameState, ServerStateHash);
+	DOREPLIFETIME(AGCGGameState, StateHashSequence);
+}
+
+void AGCGGameState::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	PublishStateHash();
+
+	Super::PreReplication(ChangedPropertyTracker);
+}
+
+// ===== MATCH RANDOM =====
+
+void AGCGGameState::InitializeMatchRandom(uint64 Seed)
+{
+	MatchRandom.Initialize(Seed);
+
+	UE_LOG(LogTemp, Log, TEXT("AGCGGameState::InitializeMatchRandom - Match seed %llu"), Seed);
+}
+
+FGCGRandomStream& AGCGGameState::GetRandomStream(EGCGRandomStream Stream, int32 PlayerID)
+{
+	if (!MatchRandom.IsInitialized())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AGCGGameState::GetRandomStream - Match was not seeded, picking a seed now"));
+		InitializeMatchRandom(FGCGMatchRandom::MakeSeed());
+	}
+
+	return MatchRandom.GetStream(Stream, PlayerID);
+}
+
+// ===== STATE HASH =====
+
+void AGCGGameState::PublishStateHash()
+{
+	if (!HasAuthority() || !bGameInProgress)
+	{
+		return;
+	}
+
+	const uint64 Hash = FGCGZobrist::HashLive(this, nullptr);
+
+#if !UE_BUILD_SHIPPING
+	// A card changed in place without RefreshCardHash shows up here before it shows up as a client desync.
+	// Don't paper over it: shipping servers would publish the stale hash.
+	for (const TObjectPtr<APlayerState>& PlayerState : PlayerArray)
+	{
+		const AGCGPlayerState* GCGPlayerState = Cast<AGCGPlayerState>(PlayerState);
+		FString Problem;
+		if (GCGPlayerState && !GCGPlayerState->VerifyStateHash(Problem))
+		{
+			ensureMsgf(false, TEXT("AGCGGameState::PublishStateHash - Player %d incremental hash is stale: %s"),
+				GCGPlayerState->GetPlayerID(), *Problem);
+		}
+	}
+#endif
+
+	if (Hash != ServerStateHash)
+	{
+		ServerStateHash = Hash;
+		++StateHashSequence;
+	}
+}
+
+bool AGCGGameState::VerifyStateHash()
+{
+	if (HasAuthority() || StateHashSequence == 0)
+	{
+		return true;
+	}
+
+	// The effect stack is server-side only, so it is left out of the published hash
+	const uint64 LocalHash = FGCGZobrist::HashLive(this, nullptr, true);
+	if (LocalHash == ServerStateHash)
+	{
+		MismatchedStateHashSequence = INDEX_NONE;
+		return true;
+	}
+
+	// First failure: the rest of the update may simply not have arrived yet
+	if (MismatchedStateHashSequence != StateHashSequence)
+	{
+		MismatchedStateHashSequence = StateHashSequence;
+		GetWorldTimerManager().SetTimer(StateHashCheckTimer,
+			FTimerDelegate::CreateWeakLambda(this, [this]() { VerifyStateHash(); }), StateHashCheckDelay, false);
+		return true;
+	}
+
+	UE_LOG(LogTemp, Error, TEXT("AGCGGameState::VerifyStateHash - Desync at hash #%d (turn %d): server %016llx, local %016llx"),
+		StateHashSequence, TurnNumber, ServerStateHash, LocalHash);
+
+	MismatchedStateHashSequence = INDEX_NONE;
+	OnStateDesyncDetected(StateHashSequence);
+	return false;
 }
 
 // ===== REPLICATION CALLBACKS =====
@@ -83,6 +193,14 @@ void AGCGGameState::OnRep_ActivePlayerID()
 	OnActivePlayerChanged(ActivePlayerID);
 }
 
+void AGCGGameState::OnRep_ServerStateHash()
+{
+	// A newer hash replaces any pending check
+	MismatchedStateHashSequence = INDEX_NONE;
+	GetWorldTimerManager().SetTimer(StateHashCheckTimer,
+		FTimerDelegate::CreateWeakLambda(this, [this]() { VerifyStateHash(); }), StateHashCheckDelay, false);
+}
+
 // ===== HELPER FUNCTIONS =====
 
 const FGCGTeamInfo* AGCGGameState::GetTeamForPlayer(int32 PlayerID) const
@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/GameState.h"
 #include "GundamTCG/GCGTypes.h"
+#include "GundamTCG/GameState/GCGMatchRandom.h"
 #include "Net/UnrealNetwork.h"
 #include "GCGGameState.generated.h"
 
@@ -37,6 +38,11 @@ public:
 	 */
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+	/**
+	 * Publish the match state hash ahead of each net update (server)
+	 */
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+
 	// ===== GAME STATUS =====
 
 	/**
@@ -123,6 +129,56 @@ public:
 	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Team Battle")
 	FGCGTeamInfo TeamB;
 
+	// ===== MATCH RANDOM =====
+
+	/**
+	 * Seed this match's random streams (server only, not replicated - the seed
+	 * would let clients predict hidden zones)
+	 * @param Seed The match seed
+	 */
+	void InitializeMatchRandom(uint64 Seed);
+
+	/** Has the match been seeded yet? */
+	bool IsMatchRandomInitialized() const { return MatchRandom.IsInitialized(); }
+
+	/**
+	 * Get the match seed (for replays and desync reports)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Game Status")
+	int64 GetMatchSeed() const { return static_cast<int64>(MatchRandom.GetSeed()); }
+
+	/**
+	 * Get one of the match's random streams (seeds the match on first use if nothing did)
+	 * @param Stream Which stream
+	 * @param PlayerID Owning player
+	 */
+	FGCGRandomStream& GetRandomStream(EGCGRandomStream Stream, int32 PlayerID = 0);
+
+	// ===== STATE HASH (desync detection) =====
+
+	/**
+	 * Server's FGCGZobrist hash of the replicated match state (turn, attack, every
+	 * player's zones). Clients recompute it from what they received and compare.
+	 */
+	UPROPERTY(ReplicatedUsing = OnRep_ServerStateHash)
+	uint64 ServerStateHash;
+
+	/** Bumped each time the server publishes a new hash */
+	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Game Status")
+	int32 StateHashSequence;
+
+	/**
+	 * Hash the current state and publish it if it changed (server; O(1) from the
+	 * incremental hashes). Called before every net update.
+	 */
+	void PublishStateHash();
+
+	/**
+	 * Recompute the hash from the replicated state and compare with the server's
+	 * @return True if they match (or there is nothing to compare yet)
+	 */
+	bool VerifyStateHash();
+
 	// ===== REPLICATION CALLBACKS =====
 
 	/**
@@ -143,6 +199,13 @@ public:
 	UFUNCTION()
 	void OnRep_ActivePlayerID();
 
+	/**
+	 * Called when the server's state hash is replicated (schedules a verification,
+	 * since player states may still be in flight)
+	 */
+	UFUNCTION()
+	void OnRep_ServerStateHash();
+
 	// ===== HELPER FUNCTIONS =====
 
 	/**
@@ -235,4 +298,24 @@ public:
 	 */
 	UFUNCTION(BlueprintImplementableEvent, Category = "Events")
 	void OnGameEnded(int32 WinnerID);
+
+	/**
+	 * Called on a client whose replicated state no longer hashes to the server's
+	 * @param Sequence The server hash that failed to verify
+	 */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Events")
+	void OnStateDesyncDetected(int32 Sequence);
+
+private:
+	/** Snapshots save and restore the random streams with the rest of the match */
+	friend struct FGCGMatchSnapshot;
+
+	/** Per-match random streams (server side) */
+	FGCGMatchRandom MatchRandom;
+
+	/** Client: pending verification of the last received state hash */
+	FTimerHandle StateHashCheckTimer;
+
+	/** Client: sequence that failed once and is being re-checked before it is reported */
+	int32 MismatchedStateHashSequence;
 };
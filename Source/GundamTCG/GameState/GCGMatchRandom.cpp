@@ -0,0 +1,113 @@
+// GCGMatchRandom.cpp - Per-Match Random Streams Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGMatchRandom.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformTLS.h"
+#include <atomic>
+
+namespace
+{
+	FORCEINLINE uint64 RotateLeft(uint64 Value, int32 Shift)
+	{
+		return (Value << Shift) | (Value >> (64 - Shift));
+	}
+}
+
+// ===== RANDOM STREAM =====
+
+uint64 FGCGRandomStream::SplitMix64(uint64& InOutState)
+{
+	uint64 Z = (InOutState += 0x9E3779B97F4A7C15ull);
+	Z = (Z ^ (Z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	Z = (Z ^ (Z >> 27)) * 0x94D049BB133111EBull;
+	return Z ^ (Z >> 31);
+}
+
+void FGCGRandomStream::Initialize(uint64 Seed)
+{
+	// SplitMix64 never produces an all-zero xoshiro state
+	uint64 SeedState = Seed;
+	for (uint64& Word : State)
+	{
+		Word = SplitMix64(SeedState);
+	}
+}
+
+uint64 FGCGRandomStream::Next()
+{
+	const uint64 Result = RotateLeft(State[1] * 5, 7) * 9;
+	const uint64 T = State[1] << 17;
+
+	State[2] ^= State[0];
+	State[3] ^= State[1];
+	State[1] ^= State[2];
+	State[0] ^= State[3];
+	State[2] ^= T;
+	State[3] = RotateLeft(State[3], 45);
+
+	return Result;
+}
+
+int32 FGCGRandomStream::RandRange(int32 Min, int32 Max)
+{
+	if (Max <= Min)
+	{
+		return Min;
+	}
+
+	const uint64 Range = static_cast<uint64>(static_cast<int64>(Max) - Min) + 1;
+
+	// Reject the short tail so every value is equally likely
+	const uint64 Threshold = (0 - Range) % Range;
+	uint64 Value;
+	do
+	{
+		Value = Next();
+	}
+	while (Value < Threshold);
+
+	return static_cast<int32>(Min + static_cast<int64>(Value % Range));
+}
+
+float FGCGRandomStream::FRand()
+{
+	// Top 24 bits -> exactly representable float in [0, 1)
+	return static_cast<float>(Next() >> 40) * (1.0f / 16777216.0f);
+}
+
+// ===== MATCH RANDOM =====
+
+void FGCGMatchRandom::Initialize(uint64 InSeed)
+{
+	Seed = InSeed;
+	bInitialized = true;
+	Streams.Reset();
+}
+
+FGCGRandomStream& FGCGMatchRandom::GetStream(EGCGRandomStream Stream, int32 PlayerID)
+{
+	const uint64 Key = (static_cast<uint64>(Stream) << 32) | static_cast<uint32>(PlayerID);
+
+	if (FGCGRandomStream* Existing = Streams.Find(Key))
+	{
+		return *Existing;
+	}
+
+	// Sub-stream seed: hash of (match seed, key)
+	uint64 KeyState = Key;
+	uint64 StreamSeed = Seed ^ FGCGRandomStream::SplitMix64(KeyState);
+	return Streams.Add(Key, FGCGRandomStream(FGCGRandomStream::SplitMix64(StreamSeed)));
+}
+
+uint64 FGCGMatchRandom::MakeSeed()
+{
+	// Counter keeps matches started in the same tick (parallel simulation) apart
+	static std::atomic<uint64> MatchCounter{0};
+
+	uint64 Mix = FPlatformTime::Cycles64()
+		^ (static_cast<uint64>(FPlatformTLS::GetCurrentThreadId()) << 32)
+		^ (MatchCounter.fetch_add(1, std::memory_order_relaxed) * 0x9E3779B97F4A7C15ull);
+
+	return FGCGRandomStream::SplitMix64(Mix);
+}
@@ -0,0 +1,132 @@
+// GCGMatchRandom.h - Per-Match Random Streams
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Seeded, reproducible random numbers for shuffles, AI and effects
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Independent random streams inside one match
+ * Each stream is further split per player where it makes sense
+ */
+enum class EGCGRandomStream : uint8
+{
+	Deck,		// Deck / Resource Deck shuffles (per player)
+	AI,			// AI score noise and random choices (per player)
+	Effects		// Card effects that pick at random
+};
+
+/**
+ * Random Stream (xoshiro256**)
+ *
+ * Small, fast generator with a 256-bit state; the same seed always yields the
+ * same sequence on every platform. Not thread-safe - each stream belongs to one
+ * match (and one consumer inside it), so parallel matches never contend.
+ */
+class GUNDAMTCG_API FGCGRandomStream
+{
+public:
+	FGCGRandomStream() { Initialize(0); }
+	explicit FGCGRandomStream(uint64 Seed) { Initialize(Seed); }
+
+	/**
+	 * Reset the stream to the start of the sequence for a seed
+	 * @param Seed Any 64-bit value (expanded with SplitMix64)
+	 */
+	void Initialize(uint64 Seed);
+
+	/** Next raw 64-bit value */
+	uint64 Next();
+
+	/**
+	 * Uniform integer in [Min, Max] (inclusive, unbiased)
+	 */
+	int32 RandRange(int32 Min, int32 Max);
+
+	/**
+	 * Uniform float in [0, 1)
+	 */
+	float FRand();
+
+	/**
+	 * Uniform float in [Min, Max)
+	 */
+	float FRandRange(float Min, float Max)
+	{
+		return Min + (Max - Min) * FRand();
+	}
+
+	/**
+	 * Fisher-Yates shuffle
+	 * @param Array The array to shuffle in place
+	 */
+	template<typename ElementType, typename AllocatorType>
+	void Shuffle(TArray<ElementType, AllocatorType>& Array)
+	{
+		for (int32 i = Array.Num() - 1; i > 0; --i)
+		{
+			const int32 Index = RandRange(0, i);
+			if (Index != i)
+			{
+				Array.Swap(i, Index);
+			}
+		}
+	}
+
+	/**
+	 * SplitMix64 step - used to expand seeds and derive sub-stream seeds
+	 * @param State Advanced in place
+	 * @return The mixed output
+	 */
+	static uint64 SplitMix64(uint64& State);
+
+private:
+	uint64 State[4];
+};
+
+/**
+ * Match Random
+ *
+ * All randomness of one match, derived from a single 64-bit seed. Every
+ * (stream, player) pair gets its own generator whose seed is a hash of the
+ * match seed and the pair, so drawing from the AI stream never shifts the deck
+ * shuffles. A match is reproducible from its seed plus its action list.
+ *
+ * Lives on AGCGGameState (server only - the seed would reveal hidden zones).
+ */
+class GUNDAMTCG_API FGCGMatchRandom
+{
+public:
+	/**
+	 * Seed the match and drop every existing stream
+	 * @param InSeed The match seed
+	 */
+	void Initialize(uint64 InSeed);
+
+	/** Has Initialize been called for this match? */
+	bool IsInitialized() const { return bInitialized; }
+
+	/** The match seed (for replays / desync reports) */
+	uint64 GetSeed() const { return Seed; }
+
+	/**
+	 * Get (creating on first use) a stream
+	 * @param Stream Which stream
+	 * @param PlayerID Owning player (0 for streams that aren't per player)
+	 * @return The stream, valid until the next Initialize
+	 */
+	FGCGRandomStream& GetStream(EGCGRandomStream Stream, int32 PlayerID = 0);
+
+	/**
+	 * A fresh, non-reproducible seed for matches that weren't given one
+	 */
+	static uint64 MakeSeed();
+
+private:
+	uint64 Seed = 0;
+	bool bInitialized = false;
+
+	/** Streams keyed by (stream << 32 | player) */
+	TMap<uint64, FGCGRandomStream> Streams;
+};
@@ -0,0 +1,119 @@
+// GCGCardLocationIndex.cpp - Card Location Index Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGCardLocationIndex.h"
+#include "GundamTCG/Core/GCGZobrist.h"
+#include <atomic>
+
+namespace
+{
+	/** Source of zone versions - unique across every index in the process */
+	std::atomic<uint64> NextZoneVersion{1};
+}
+
+FGCGCardLocationIndex::FGCGCardLocationIndex()
+{
+	ZoneVersions[0] = 0;
+	Reset();
+}
+
+void FGCGCardLocationIndex::Set(const FGCGCardInstance& Card, EGCGCardZone Zone, int32 Slot)
+{
+	Record(Card, Zone, Slot);
+	TouchZone(Zone);
+}
+
+void FGCGCardLocationIndex::Record(const FGCGCardInstance& Card, EGCGCardZone Zone, int32 Slot)
+{
+	const int32 InstanceID = Card.InstanceID;
+	if (InstanceID < 0)
+	{
+		return;
+	}
+
+	if (InstanceID >= Locations.Num())
+	{
+		// Grow geometrically; instance IDs are handed out sequentially
+		Locations.SetNum(FMath::Max(InstanceID + 1, Locations.Num() * 2));
+	}
+
+	FGCGCardLocation& Location = Locations[InstanceID];
+	if (!Location.IsValid())
+	{
+		++NumIndexed;
+	}
+	else if (Location.Zone != Zone)
+	{
+		TouchZone(Location.Zone);
+	}
+
+	const uint64 NewKey = FGCGZobrist::CardKey(Zone, Slot, Card);
+	Hash ^= Location.HashKey ^ NewKey;
+
+	Location.Zone = Zone;
+	Location.Slot = Slot;
+	Location.HashKey = NewKey;
+}
+
+void FGCGCardLocationIndex::Refresh(const FGCGCardInstance& Card)
+{
+	if (!Locations.IsValidIndex(Card.InstanceID) || !Locations[Card.InstanceID].IsValid())
+	{
+		return;
+	}
+
+	FGCGCardLocation& Location = Locations[Card.InstanceID];
+	const uint64 NewKey = FGCGZobrist::CardKey(Location.Zone, Location.Slot, Card);
+	Hash ^= Location.HashKey ^ NewKey;
+	Location.HashKey = NewKey;
+	TouchZone(Location.Zone);
+}
+
+void FGCGCardLocationIndex::Remove(int32 InstanceID)
+{
+	if (Locations.IsValidIndex(InstanceID) && Locations[InstanceID].IsValid())
+	{
+		Hash ^= Locations[InstanceID].HashKey;
+		TouchZone(Locations[InstanceID].Zone);
+		Locations[InstanceID] = FGCGCardLocation();
+		--NumIndexed;
+	}
+}
+
+void FGCGCardLocationIndex::IndexZone(EGCGCardZone Zone, const TArray<FGCGCardInstance>& ZoneArray, int32 FirstSlot)
+{
+	for (int32 Slot = FMath::Max(FirstSlot, 0); Slot < ZoneArray.Num(); ++Slot)
+	{
+		Record(ZoneArray[Slot], Zone, Slot);
+	}
+
+	TouchZone(Zone);
+}
+
+void FGCGCardLocationIndex::Reset()
+{
+	Locations.Reset();
+	NumIndexed = 0;
+	Hash = 0;
+
+	for (int32 ZoneValue = 1; ZoneValue < UE_ARRAY_COUNT(ZoneVersions); ++ZoneValue)
+	{
+		TouchZone(static_cast<EGCGCardZone>(ZoneValue));
+	}
+}
+
+void FGCGCardLocationIndex::SetZoneVersion(EGCGCardZone Zone, uint64 Version)
+{
+	if (Zone != EGCGCardZone::None)
+	{
+		ZoneVersions[static_cast<int32>(Zone)] = Version;
+	}
+}
+
+void FGCGCardLocationIndex::TouchZone(EGCGCardZone Zone)
+{
+	if (Zone != EGCGCardZone::None)
+	{
+		ZoneVersions[static_cast<int32>(Zone)] = NextZoneVersion.fetch_add(1, std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,138 @@
+// GCGCardLocationIndex.h - Card Location Index
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// InstanceID → (zone, slot) lookup for a player's zones
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GundamTCG/GCGTypes.h"
+
+/**
+ * Where a card instance currently sits
+ */
+struct FGCGCardLocation
+{
+	/** Zone holding the card (None = not indexed) */
+	EGCGCardZone Zone = EGCGCardZone::None;
+
+	/** Index of the card inside that zone's array */
+	int32 Slot = INDEX_NONE;
+
+	/** The card's FGCGZobrist key as last indexed (part of the index's hash) */
+	uint64 HashKey = 0;
+
+	bool IsValid() const { return Zone != EGCGCardZone::None && Slot != INDEX_NONE; }
+};
+
+/**
+ * Card Location Index
+ *
+ * Dense array addressed by InstanceID (instance IDs are small, sequential per match),
+ * so resolving a card is one bounds check and one array index instead of a scan over
+ * every zone.
+ *
+ * The index is a cache: UGCGZoneSubsystem keeps it in sync on every move, and
+ * AGCGPlayerState verifies each hit against the zone array before trusting it.
+ * Zone arrays changed behind its back (replication, direct edits) simply cause a
+ * rebuild on the next miss.
+ *
+ * It also keeps the XOR of its cards' FGCGZobrist keys: every (re-)indexed card
+ * swaps its old key for the new one, so moves keep the hash current for free and
+ * in-place changes only need Refresh.
+ *
+ * Each zone carries a version that every Set/Refresh/Remove/IndexZone touching it
+ * replaces with a process-wide unique value. Two zones with the same version hold
+ * the same cards (copies of an index included), which lets FGCGMatchSnapshot share
+ * unchanged zones without comparing them.
+ */
+class GUNDAMTCG_API FGCGCardLocationIndex
+{
+public:
+	FGCGCardLocationIndex();
+
+	/**
+	 * Look up a card's location
+	 * @param InstanceID The card instance ID
+	 * @return The recorded location (invalid if never indexed)
+	 */
+	FGCGCardLocation Find(int32 InstanceID) const
+	{
+		return Locations.IsValidIndex(InstanceID) ? Locations[InstanceID] : FGCGCardLocation();
+	}
+
+	/**
+	 * Record a card's location
+	 * @param Card The card
+	 * @param Zone The zone holding the card
+	 * @param Slot The card's index in that zone
+	 */
+	void Set(const FGCGCardInstance& Card, EGCGCardZone Zone, int32 Slot);
+
+	/**
+	 * Re-key a card whose state changed in place (rested, damaged, modified...)
+	 * @param Card The card, at its indexed location
+	 */
+	void Refresh(const FGCGCardInstance& Card);
+
+	/**
+	 * Forget a card (it left this player's zones)
+	 * @param InstanceID The card instance ID
+	 */
+	void Remove(int32 InstanceID);
+
+	/**
+	 * Re-record every card of a zone from a given slot onwards (after inserts, removals or shuffles)
+	 * @param Zone The zone
+	 * @param ZoneArray The zone's card array
+	 * @param FirstSlot First slot whose position may have changed
+	 */
+	void IndexZone(EGCGCardZone Zone, const TArray<FGCGCardInstance>& ZoneArray, int32 FirstSlot = 0);
+
+	/**
+	 * Forget every card
+	 */
+	void Reset();
+
+	/**
+	 * Number of cards currently indexed
+	 */
+	int32 Num() const { return NumIndexed; }
+
+	/**
+	 * XOR of the FGCGZobrist keys of every indexed card
+	 */
+	uint64 GetHash() const { return Hash; }
+
+	/**
+	 * Version of a zone's contents (changes whenever the index sees the zone change)
+	 * @param Zone The zone
+	 * @return The version, or 0 for EGCGCardZone::None
+	 */
+	uint64 GetZoneVersion(EGCGCardZone Zone) const { return Zone != EGCGCardZone::None ? ZoneVersions[static_cast<int32>(Zone)] : 0; }
+
+	/**
+	 * Adopt the version a zone had when its (restored) contents were captured
+	 * @param Zone The zone
+	 * @param Version A version previously returned by GetZoneVersion for the same cards
+	 */
+	void SetZoneVersion(EGCGCardZone Zone, uint64 Version);
+
+private:
+	/** Give a zone a new version */
+	void TouchZone(EGCGCardZone Zone);
+
+	/** Record a location without touching the zone it moves into */
+	void Record(const FGCGCardInstance& Card, EGCGCardZone Zone, int32 Slot);
+
+	/** Location per InstanceID */
+	TArray<FGCGCardLocation> Locations;
+
+	/** Valid entries in Locations */
+	int32 NumIndexed = 0;
+
+	/** XOR of every valid entry's HashKey */
+	uint64 Hash = 0;
+
+	/** Version per zone, addressed by EGCGCardZone (slot 0 unused) */
+	uint64 ZoneVersions[static_cast<int32>(EGCGCardZone::Removal) + 1];
+};
@@ -0,0 +1,55 @@
+// GCGOrderedZone.cpp - Ordered Zone Helpers Implementation
+// Unreal Engine 5.6 - Gundam TCG Implementation
+
+#include "GCGOrderedZone.h"
+
+int32 FGCGOrderedZone::RevealTop(const TArray<FGCGCardInstance>& Zone, int32 Count, TArray<FGCGCardInstance>& OutCards)
+{
+	OutCards.Reset();
+
+	const int32 NumToReveal = FMath::Clamp(Count, 0, Zone.Num());
+	OutCards.Reserve(NumToReveal);
+
+	for (int32 Depth = 0; Depth < NumToReveal; ++Depth)
+	{
+		OutCards.Add(Zone[Zone.Num() - 1 - Depth]);
+	}
+
+	return NumToReveal;
+}
+
+bool FGCGOrderedZone::PopTop(TArray<FGCGCardInstance>& Zone, FGCGCardInstance& OutCard)
+{
+	if (Zone.Num() == 0)
+	{
+		return false;
+	}
+
+	OutCard = Zone.Pop(EAllowShrinking::No);
+	return true;
+}
+
+int32 FGCGOrderedZone::PopTop(TArray<FGCGCardInstance>& Zone, int32 Count, TArray<FGCGCardInstance>& OutCards)
+{
+	const int32 NumToPop = FMath::Clamp(Count, 0, Zone.Num());
+	OutCards.Reserve(OutCards.Num() + NumToPop);
+
+	for (int32 Depth = 0; Depth < NumToPop; ++Depth)
+	{
+		OutCards.Add(MoveTemp(Zone[Zone.Num() - 1 - Depth]));
+	}
+
+	// Drop the moved-from tail in one go
+	Zone.SetNum(Zone.Num() - NumToPop, EAllowShrinking::No);
+
+	return NumToPop;
+}
+
+void FGCGOrderedZone::PushBottom(TArray<FGCGCardInstance>& Zone, TConstArrayView<FGCGCardInstance> Cards)
+{
+	if (Cards.Num() > 0)
+	{
+		// Single shift for the whole batch
+		Zone.Insert(Cards.GetData(), Cards.Num(), 0);
+	}
+}
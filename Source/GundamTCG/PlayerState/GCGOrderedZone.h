@@ -0,0 +1,92 @@
+// GCGOrderedZone.h - Ordered Zone Helpers
+// Unreal Engine 5.6 - Gundam TCG Implementation
+// Top/bottom access for the stacked zones (Deck, Resource Deck, Shield Stack)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GundamTCG/GCGTypes.h"
+
+/**
+ * Ordered Zone
+ *
+ * The stacked zones stay plain replicated TArrays, stored bottom → top:
+ * the top card is the LAST element. Drawing, peeking and revealing from the
+ * top therefore never shift the array, and cards below the top keep their
+ * slots (so the card location index only needs the drawn card removed).
+ *
+ * Slot 0 is the bottom card. Putting cards on the bottom shifts the zone once
+ * per call, however many cards are placed.
+ *
+ * Every function here only edits the array; callers keep the player's card
+ * location index in sync (see UGCGZoneSubsystem).
+ */
+struct GUNDAMTCG_API FGCGOrderedZone
+{
+	/**
+	 * Array slot of the card at a given depth from the top
+	 * @param Zone The zone array
+	 * @param Depth 0 = top card
+	 * @return Slot, or INDEX_NONE if the zone holds fewer cards
+	 */
+	static int32 GetTopSlot(const TArray<FGCGCardInstance>& Zone, int32 Depth = 0)
+	{
+		return (Depth >= 0 && Depth < Zone.Num()) ? Zone.Num() - 1 - Depth : INDEX_NONE;
+	}
+
+	/**
+	 * Card at a given depth from the top, without removing it
+	 * @param Zone The zone array
+	 * @param Depth 0 = top card
+	 * @return The card, or nullptr if the zone holds fewer cards
+	 */
+	static const FGCGCardInstance* PeekTop(const TArray<FGCGCardInstance>& Zone, int32 Depth = 0)
+	{
+		const int32 Slot = GetTopSlot(Zone, Depth);
+		return Slot != INDEX_NONE ? &Zone[Slot] : nullptr;
+	}
+
+	/**
+	 * Copy up to Count cards from the top, top card first (reveal / look at)
+	 * @param Zone The zone array
+	 * @param Count Number of cards wanted
+	 * @param OutCards Receives the cards (emptied first)
+	 * @return Number of cards copied
+	 */
+	static int32 RevealTop(const TArray<FGCGCardInstance>& Zone, int32 Count, TArray<FGCGCardInstance>& OutCards);
+
+	/**
+	 * Remove the top card
+	 * @param Zone The zone array
+	 * @param OutCard Receives the removed card
+	 * @return False if the zone was empty
+	 */
+	static bool PopTop(TArray<FGCGCardInstance>& Zone, FGCGCardInstance& OutCard);
+
+	/**
+	 * Remove up to Count cards from the top, top card first
+	 * @param Zone The zone array
+	 * @param Count Number of cards wanted
+	 * @param OutCards Receives the removed cards (appended)
+	 * @return Number of cards removed
+	 */
+	static int32 PopTop(TArray<FGCGCardInstance>& Zone, int32 Count, TArray<FGCGCardInstance>& OutCards);
+
+	/**
+	 * Put a card on top
+	 * @param Zone The zone array
+	 * @param Card The card
+	 * @return The card's slot
+	 */
+	static int32 PushTop(TArray<FGCGCardInstance>& Zone, const FGCGCardInstance& Card)
+	{
+		return Zone.Add(Card);
+	}
+
+	/**
+	 * Put cards on the bottom, first card lowest
+	 * @param Zone The zone array
+	 * @param Cards The cards
+	 */
+	static void PushBottom(TArray<FGCGCardInstance>& Zone, TConstArrayView<FGCGCardInstance> Cards);
+};
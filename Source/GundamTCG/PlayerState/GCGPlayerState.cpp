@@ -2,6 +2,9 @@
 // Unreal Engine 5.6 - Gundam TCG Implementation
 
 #include "GCGPlayerState.h"
+#include "GundamTCG/Core/GCGRules.h"
+#include "GundamTCG/Core/GCGZobrist.h"
+#include "GundamTCG/PlayerState/GCGOrderedZone.h"
 #include "Net/UnrealNetwork.h"
 
 AGCGPlayerState::AGCGPlayerState()
@@ -51,6 +54,13 @@ void AGCGPlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutL
 	DOREPLIFETIME(AGCGPlayerState, bHasDrawnThisTurn);
 }
 
+void AGCGPlayerState::PostRepNotifies()
+{
+	Super::PostRepNotifies();
+
+	MarkCardLocationIndexDirty();
+}
+
 // ===== PLAYER IDENTIFICATION =====
 
 void AGCGPlayerState::SetPlayerID(int32 NewPlayerID)
@@ -63,17 +73,7 @@ void AGCGPlayerState::SetPlayerID(int32 NewPlayerID)
 
 int32 AGCGPlayerState::GetActiveResourceCount() const
 {
-	int32 ActiveCount = 0;
-
-	for (const FGCGCardInstance& Resource : ResourceArea)
-	{
-		if (Resource.bIsActive)
-		{
-			ActiveCount++;
-		}
-	}
-
-	return ActiveCount;
+	return FGCGRules::CountActiveResources(*this);
 }
 
 int32 AGCGPlayerState::GetTotalResourceCount() const
@@ -106,11 +106,51 @@ int32 AGCGPlayerState::GetResourceDeckSize() const
 	return ResourceDeck.Num();
 }
 
+bool AGCGPlayerState::PeekDeckTop(int32 Depth, FGCGCardInstance& OutCard) const
+{
+	const FGCGCardInstance* Card = FGCGOrderedZone::PeekTop(Deck, Depth);
+	if (Card)
+	{
+		OutCard = *Card;
+	}
+	return Card != nullptr;
+}
+
+bool AGCGPlayerState::PeekResourceDeckTop(int32 Depth, FGCGCardInstance& OutCard) const
+{
+	const FGCGCardInstance* Card = FGCGOrderedZone::PeekTop(ResourceDeck, Depth);
+	if (Card)
+	{
+		OutCard = *Card;
+	}
+	return Card != nullptr;
+}
+
+bool AGCGPlayerState::PeekShieldTop(int32 Depth, FGCGCardInstance& OutCard) const
+{
+	const FGCGCardInstance* Card = FGCGOrderedZone::PeekTop(ShieldStack, Depth);
+	if (Card)
+	{
+		OutCard = *Card;
+	}
+	return Card != nullptr;
+}
+
+TArray<FGCGCardInstance> AGCGPlayerState::GetTopCards(EGCGCardZone Zone, int32 Count) const
+{
+	TArray<FGCGCardInstance> Cards;
+	if (Zone == EGCGCardZone::Deck || Zone == EGCGCardZone::ResourceDeck || Zone == EGCGCardZone::ShieldStack)
+	{
+		FGCGOrderedZone::RevealTop(*GetZoneArray(Zone), Count, Cards);
+	}
+	return Cards;
+}
+
 // ===== ZONE VALIDATION =====
 
 bool AGCGPlayerState::CanPayCost(int32 Cost) const
 {
-	return GetActiveResourceCount() >= Cost;
+	return FGCGRules::CanPayCost(*this, Cost);
 }
 
 bool AGCGPlayerState::CanAddUnitToBattle() const
@@ -118,13 +158,12 @@ bool AGCGPlayerState::CanAddUnitToBattle() const
 	// Max 6 units in battle area
 	// Note: In team battle, this limit is shared across the team
 	// The GameMode or ZoneSubsystem should handle team battle logic
-	return BattleArea.Num() < 6;
+	return BattleArea.Num() < GCGRules::MaxUnits;
 }
 
 bool AGCGPlayerState::CanAddResource() const
 {
-	// Max 15 resources
-	return ResourceArea.Num() < 15;
+	return ResourceArea.Num() < GCGRules::MaxResources;
 }
 
 // ===== HELPER FUNCTIONS =====
@@ -157,78 +196,185 @@ TArray<FGCGCardInstance> AGCGPlayerState::GetAllCards() const
 
 bool AGCGPlayerState::FindCardByInstanceID(int32 InstanceID, FGCGCardInstance& OutCard, EGCGCardZone& OutZone) const
 {
-	// Helper lambda to search a zone
-	auto SearchZone = [InstanceID, &OutCard](const TArray<FGCGCardInstance>& Zone) -> bool
+	const FGCGCardInstance* Found = FindCard(InstanceID, &OutZone);
+	if (Found)
+	{
+		OutCard = *Found;
+		return true;
+	}
+
+	// Card not found in any zone
+	OutZone = EGCGCardZone::None;
+	return false;
+}
+
+// ===== CARD LOOKUP =====
+
+TArray<FGCGCardInstance>* AGCGPlayerState::GetZoneArray(EGCGCardZone Zone)
+{
+	return const_cast<TArray<FGCGCardInstance>*>(static_cast<const AGCGPlayerState*>(this)->GetZoneArray(Zone));
+}
+
+const TArray<FGCGCardInstance>* AGCGPlayerState::GetZoneArray(EGCGCardZone Zone) const
+{
+	switch (Zone)
+	{
+	case EGCGCardZone::Deck:
+		return &Deck;
+	case EGCGCardZone::ResourceDeck:
+		return &ResourceDeck;
+	case EGCGCardZone::Hand:
+		return &Hand;
+	case EGCGCardZone::ResourceArea:
+		return &ResourceArea;
+	case EGCGCardZone::BattleArea:
+		return &BattleArea;
+	case EGCGCardZone::ShieldStack:
+		return &ShieldStack;
+	case EGCGCardZone::BaseSection:
+		return &BaseSection;
+	case EGCGCardZone::Trash:
+		return &Trash;
+	case EGCGCardZone::Removal:
+		return &Removal;
+	default:
+		return nullptr;
+	}
+}
+
+FGCGCardInstance* AGCGPlayerState::FindCard(int32 InstanceID, EGCGCardZone* OutZone, int32* OutSlot)
+{
+	return const_cast<FGCGCardInstance*>(static_cast<const AGCGPlayerState*>(this)->FindCard(InstanceID, OutZone, OutSlot));
+}
+
+const FGCGCardInstance* AGCGPlayerState::FindCard(int32 InstanceID, EGCGCardZone* OutZone, int32* OutSlot) const
+{
+	// Resolve through the index, trusting an entry only if the slot still holds that card
+	auto Resolve = [this, InstanceID, OutZone, OutSlot](bool& bOutStale) -> const FGCGCardInstance*
 	{
-		const FGCGCardInstance* Found = Zone.FindByPredicate([InstanceID](const FGCGCardInstance& Card)
+		const FGCGCardLocation Location = CardLocationIndex.Find(InstanceID);
+		if (!Location.IsValid())
 		{
-			return Card.InstanceID == InstanceID;
-		});
+			return nullptr;
+		}
 
-		if (Found)
+		const TArray<FGCGCardInstance>* ZoneArray = GetZoneArray(Location.Zone);
+		if (!ZoneArray || !ZoneArray->IsValidIndex(Location.Slot) || (*ZoneArray)[Location.Slot].InstanceID != InstanceID)
 		{
-			OutCard = *Found;
-			return true;
+			bOutStale = true;
+			return nullptr;
 		}
-		return false;
+
+		if (OutZone) { *OutZone = Location.Zone; }
+		if (OutSlot) { *OutSlot = Location.Slot; }
+		return &(*ZoneArray)[Location.Slot];
 	};
 
-	// Search each zone
-	if (SearchZone(Deck))
+	bool bStale = false;
+	if (const FGCGCardInstance* Found = Resolve(bStale))
 	{
-		OutZone = EGCGCardZone::Deck;
-		return true;
+		return Found;
 	}
 
-	if (SearchZone(ResourceDeck))
+	// A miss is only authoritative while the index is known to cover the zones;
+	// otherwise the zones were edited directly (or replicated) - rebuild and retry once
+	if (bStale || bCardLocationIndexDirty)
 	{
-		OutZone = EGCGCardZone::ResourceDeck;
-		return true;
-	}
+		RebuildCardLocationIndex();
 
-	if (SearchZone(Hand))
-	{
-		OutZone = EGCGCardZone::Hand;
-		return true;
+		bStale = false;
+		return Resolve(bStale);
 	}
 
-	if (SearchZone(ResourceArea))
-	{
-		OutZone = EGCGCardZone::ResourceArea;
-		return true;
-	}
+	return nullptr;
+}
 
-	if (SearchZone(BattleArea))
-	{
-		OutZone = EGCGCardZone::BattleArea;
-		return true;
-	}
+FGCGCardInstance* AGCGPlayerState::FindCardInZone(int32 InstanceID, EGCGCardZone Zone)
+{
+	EGCGCardZone FoundZone = EGCGCardZone::None;
+	FGCGCardInstance* Found = FindCard(InstanceID, &FoundZone);
+	return (Found && FoundZone == Zone) ? Found : nullptr;
+}
 
-	if (SearchZone(ShieldStack))
-	{
-		OutZone = EGCGCardZone::ShieldStack;
-		return true;
-	}
+const FGCGCardInstance* AGCGPlayerState::FindCardInZone(int32 InstanceID, EGCGCardZone Zone) const
+{
+	EGCGCardZone FoundZone = EGCGCardZone::None;
+	const FGCGCardInstance* Found = FindCard(InstanceID, &FoundZone);
+	return (Found && FoundZone == Zone) ? Found : nullptr;
+}
 
-	if (SearchZone(BaseSection))
+void AGCGPlayerState::IndexZone(EGCGCardZone Zone, int32 FirstSlot)
+{
+	if (const TArray<FGCGCardInstance>* ZoneArray = GetZoneArray(Zone))
 	{
-		OutZone = EGCGCardZone::BaseSection;
-		return true;
+		CardLocationIndex.IndexZone(Zone, *ZoneArray, FirstSlot);
 	}
+}
+
+void AGCGPlayerState::UnindexCard(int32 InstanceID)
+{
+	CardLocationIndex.Remove(InstanceID);
+}
 
-	if (SearchZone(Trash))
+void AGCGPlayerState::RebuildCardLocationIndex() const
+{
+	CardLocationIndex.Reset();
+	bCardLocationIndexDirty = false;
+
+	CardLocationIndex.IndexZone(EGCGCardZone::Deck, Deck);
+	CardLocationIndex.IndexZone(EGCGCardZone::ResourceDeck, ResourceDeck);
+	CardLocationIndex.IndexZone(EGCGCardZone::Hand, Hand);
+	CardLocationIndex.IndexZone(EGCGCardZone::ResourceArea, ResourceArea);
+	CardLocationIndex.IndexZone(EGCGCardZone::BattleArea, BattleArea);
+	CardLocationIndex.IndexZone(EGCGCardZone::ShieldStack, ShieldStack);
+	CardLocationIndex.IndexZone(EGCGCardZone::BaseSection, BaseSection);
+	CardLocationIndex.IndexZone(EGCGCardZone::Trash, Trash);
+	CardLocationIndex.IndexZone(EGCGCardZone::Removal, Removal);
+}
+
+bool AGCGPlayerState::VerifyStateHash(FString& OutProblem) const
+{
+	for (uint8 ZoneValue = static_cast<uint8>(EGCGCardZone::Deck); ZoneValue <= static_cast<uint8>(EGCGCardZone::Removal); ++ZoneValue)
 	{
-		OutZone = EGCGCardZone::Trash;
-		return true;
+		const EGCGCardZone Zone = static_cast<EGCGCardZone>(ZoneValue);
+		const TArray<FGCGCardInstance>* ZoneArray = GetZoneArray(Zone);
+		if (!ZoneArray)
+		{
+			continue;
+		}
+
+		for (int32 Slot = 0; Slot < ZoneArray->Num(); ++Slot)
+		{
+			const FGCGCardInstance& Card = (*ZoneArray)[Slot];
+			const FGCGCardLocation Location = CardLocationIndex.Find(Card.InstanceID);
+			if (Location.Zone != Zone || Location.Slot != Slot)
+			{
+				OutProblem = FString::Printf(TEXT("%s (instance %d) at %s[%d] is not in the location index"),
+					*Card.CardNumber.ToString(), Card.InstanceID, *UEnum::GetValueAsString(Zone), Slot);
+				return false;
+			}
+
+			if (Location.HashKey != FGCGZobrist::CardKey(Zone, Slot, Card))
+			{
+				OutProblem = FString::Printf(TEXT("%s (instance %d) at %s[%d] changed without RefreshCardHash"),
+					*Card.CardNumber.ToString(), Card.InstanceID, *UEnum::GetValueAsString(Zone), Slot);
+				return false;
+			}
+		}
 	}
 
-	if (SearchZone(Removal))
+	if (CardLocationIndex.Num() != GetTotalCardCount())
 	{
-		OutZone = EGCGCardZone::Removal;
-		return true;
+		OutProblem = FString::Printf(TEXT("location index holds %d cards, zones hold %d (a card left without UnindexCard)"),
+			CardLocationIndex.Num(), GetTotalCardCount());
+		return false;
 	}
 
-	// Card not found in any zone
-	OutZone = EGCGCardZone::None;
-	return false;
+	return true;
+}
+
+int32 AGCGPlayerState::GetTotalCardCount() const
+{
+	return Deck.Num() + ResourceDeck.Num() + Hand.Num() + ResourceArea.Num() + BattleArea.Num()
+		+ ShieldStack.Num() + BaseSection.Num() + Trash.Num() + Removal.Num();
 }
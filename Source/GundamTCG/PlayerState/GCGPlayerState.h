@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerState.h"
 #include "GundamTCG/GCGTypes.h"
+#include "GundamTCG/PlayerState/GCGCardLocationIndex.h"
 #include "Net/UnrealNetwork.h"
 #include "GCGPlayerState.generated.h"
 
@@ -21,6 +22,10 @@
  *
  * All zone arrays are replicated so clients stay in sync with the server.
  * The UGCGZoneSubsystem operates on these arrays for all card movements.
+ *
+ * Cards are located by InstanceID through a per-player FGCGCardLocationIndex
+ * (InstanceID → zone, slot) that the zone subsystem keeps in sync, so lookups
+ * by ID do not scan the zones.
  */
 UCLASS()
 class GUNDAMTCG_API AGCGPlayerState : public APlayerState
@@ -37,6 +42,11 @@ public:
 	 */
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+	/**
+	 * Replicated zones arrive without index updates - mark the location index dirty
+	 */
+	virtual void PostRepNotifies() override;
+
 	// ===== PLAYER IDENTIFICATION =====
 
 	/**
@@ -59,14 +69,14 @@ public:
 
 	/**
 	 * Main Deck (50 cards at start, ordered)
-	 * Top card is at index 0
+	 * Stored bottom → top: the top card is the last element (see FGCGOrderedZone)
 	 */
 	UPROPERTY(Replicated, BlueprintReadWrite, Category = "Zones")
 	TArray<FGCGCardInstance> Deck;
 
 	/**
 	 * Resource Deck (10 cards at start, ordered)
-	 * Top card is at index 0
+	 * Stored bottom → top: the top card is the last element
 	 */
 	UPROPERTY(Replicated, BlueprintReadWrite, Category = "Zones")
 	TArray<FGCGCardInstance> ResourceDeck;
@@ -94,7 +104,7 @@ public:
 
 	/**
 	 * Shield Stack (6 shields in 1v1, 8 shields total in 2v2, ordered)
-	 * Top shield is at index 0
+	 * Stored bottom → top: the top shield is the last element
 	 * When taking damage, shields are removed from top
 	 */
 	UPROPERTY(Replicated, BlueprintReadWrite, Category = "Zones")
@@ -218,6 +228,43 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Deck")
 	int32 GetResourceDeckSize() const;
 
+	/**
+	 * Look at a Deck card without drawing it
+	 * Stacked zones are stored bottom → top; read them through these instead of indexing the arrays
+	 * @param Depth 0 = top card
+	 * @param OutCard The card
+	 * @return False if the deck holds Depth cards or fewer
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deck")
+	bool PeekDeckTop(int32 Depth, FGCGCardInstance& OutCard) const;
+
+	/**
+	 * Look at a Resource Deck card without drawing it
+	 * @param Depth 0 = top card
+	 * @param OutCard The card
+	 * @return False if the resource deck holds Depth cards or fewer
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deck")
+	bool PeekResourceDeckTop(int32 Depth, FGCGCardInstance& OutCard) const;
+
+	/**
+	 * Look at a shield without breaking it
+	 * @param Depth 0 = top shield (the next one damage removes)
+	 * @param OutCard The shield
+	 * @return False if the stack holds Depth shields or fewer
+	 */
+	UFUNCTION(BlueprintPure, Category = "Shields")
+	bool PeekShieldTop(int32 Depth, FGCGCardInstance& OutCard) const;
+
+	/**
+	 * Copy up to Count cards from the top of a stacked zone, top card first
+	 * @param Zone Deck, ResourceDeck or ShieldStack
+	 * @param Count Number of cards wanted
+	 * @return The cards, top card first (empty for other zones)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Zones")
+	TArray<FGCGCardInstance> GetTopCards(EGCGCardZone Zone, int32 Count) const;
+
 	// ===== ZONE VALIDATION =====
 
 	/**
@@ -267,6 +314,84 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Zones")
 	bool FindCardByInstanceID(int32 InstanceID, FGCGCardInstance& OutCard, EGCGCardZone& OutZone) const;
 
+	// ===== CARD LOOKUP (C++ only) =====
+
+	/**
+	 * Get a zone's card array
+	 * @param Zone The zone
+	 * @return The zone array, or nullptr for zones a player doesn't own
+	 */
+	TArray<FGCGCardInstance>* GetZoneArray(EGCGCardZone Zone);
+	const TArray<FGCGCardInstance>* GetZoneArray(EGCGCardZone Zone) const;
+
+	/**
+	 * Find a card by instance ID across all zones (O(1) through the location index)
+	 * @param InstanceID The instance ID to find
+	 * @param OutZone Optional: zone holding the card
+	 * @param OutSlot Optional: index of the card in that zone's array
+	 * @return The card in place, or nullptr if this player has no such card
+	 */
+	FGCGCardInstance* FindCard(int32 InstanceID, EGCGCardZone* OutZone = nullptr, int32* OutSlot = nullptr);
+	const FGCGCardInstance* FindCard(int32 InstanceID, EGCGCardZone* OutZone = nullptr, int32* OutSlot = nullptr) const;
+
+	/**
+	 * Find a card by instance ID in one zone
+	 * @param InstanceID The instance ID to find
+	 * @param Zone The zone the card must be in
+	 * @return The card in place, or nullptr if it is not in that zone
+	 */
+	FGCGCardInstance* FindCardInZone(int32 InstanceID, EGCGCardZone Zone);
+	const FGCGCardInstance* FindCardInZone(int32 InstanceID, EGCGCardZone Zone) const;
+
+	/**
+	 * Re-index a zone after its array changed (adds, removals, reorders)
+	 * @param Zone The zone that changed
+	 * @param FirstSlot First slot whose card may have changed position
+	 */
+	void IndexZone(EGCGCardZone Zone, int32 FirstSlot = 0);
+
+	/**
+	 * Drop a card from the location index (it left this player's zones)
+	 * @param InstanceID The instance ID to forget
+	 */
+	void UnindexCard(int32 InstanceID);
+
+	/**
+	 * Rebuild the location index from every zone
+	 */
+	void RebuildCardLocationIndex() const;
+
+	/**
+	 * Flag the location index as out of date after editing zone arrays without
+	 * IndexZone/UnindexCard; the next lookup miss rebuilds it
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Zones")
+	void MarkCardLocationIndexDirty() { bCardLocationIndexDirty = true; }
+
+	// ===== STATE HASH (C++ only) =====
+
+	/**
+	 * Re-key a card after changing it in place - rest/activate, damage, modifiers,
+	 * keywords, pairing (see FGCGZobrist). Also bumps the zone's version so snapshots
+	 * stop sharing it. Moves through UGCGZoneSubsystem need no call.
+	 * @param Card The card, in one of this player's zones
+	 */
+	void RefreshCardHash(const FGCGCardInstance& Card) { CardLocationIndex.Refresh(Card); }
+
+	/**
+	 * XOR of the FGCGZobrist keys of every card in this player's zones (server; kept
+	 * current incrementally by the location index)
+	 */
+	uint64 GetStateHash() const { return CardLocationIndex.GetHash(); }
+
+	/**
+	 * Check every card's indexed key against its current state (development check)
+	 * @param OutProblem The first card whose state changed without RefreshCardHash, or
+	 *        that the index doesn't cover
+	 * @return True if the incremental hash matches the zones
+	 */
+	bool VerifyStateHash(FString& OutProblem) const;
+
 	// ===== BLUEPRINT EVENTS =====
 
 	/**
@@ -300,4 +425,27 @@ protected:
 	 */
 	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Player")
 	int32 PlayerID;
+
+private:
+	/** Snapshots share zones by the index's zone versions */
+	friend struct FGCGMatchSnapshot;
+
+	// ===== CARD LOCATION INDEX =====
+
+	/**
+	 * Total cards across all zones
+	 */
+	int32 GetTotalCardCount() const;
+
+	/**
+	 * InstanceID → (zone, slot) for this player's cards
+	 * Not replicated; clients rebuild it lazily from the replicated zones.
+	 */
+	mutable FGCGCardLocationIndex CardLocationIndex;
+
+	/**
+	 * Set when the zones may hold cards the index doesn't (replication, direct edits);
+	 * while clear, an index miss means the card isn't in this player's zones
+	 */
+	mutable bool bCardLocationIndexDirty = true;
 };
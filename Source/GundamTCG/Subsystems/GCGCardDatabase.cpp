@@ -3,6 +3,9 @@
 
 #include "GCGCardDatabase.h"
 #include "Engine/DataTable.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeRWLock.h"
+#include "GundamTCG/Cards/GCGCardCsvImporter.h"
 
 // ===== SUBSYSTEM LIFECYCLE =====
 
@@ -15,23 +18,26 @@ void UGCGCardDatabase::Initialize(FSubsystemCollectionBase& Collection)
 	// Initialize token definitions
 	InitializeTokenDefinitions();
 
-	// Load card data if DataTable is set
-	if (CardDataTable)
+	// Build the catalog (tokens are always present, DataTable rows if set)
+	// With no DataTable assigned, prefer the cooked catalog when one has been cooked
+	const FString CookedPath = GetDefaultCookedCatalogPath();
+	if (CardDataTable || !FPaths::FileExists(CookedPath) || !LoadCookedCatalog(CookedPath))
 	{
 		ReloadCardData();
 	}
-	else
-	{
-		UE_LOG(LogTemp, Warning, TEXT("UGCGCardDatabase::Initialize - No CardDataTable set, card lookups will only return tokens"));
-	}
 }
 
 void UGCGCardDatabase::Deinitialize()
 {
 	UE_LOG(LogTemp, Log, TEXT("UGCGCardDatabase::Deinitialize - Card Database Subsystem shutdown"));
 
-	// Clear cache
-	CardDataCache.Empty();
+	// Release the current generation (pinned generations die with their last holder)
+	{
+		FWriteScopeLock WriteLock(CatalogLock);
+		Catalog = MakeShared<FGCGCardCatalog, ESPMode::ThreadSafe>();
+	}
+	RetiredCatalogs.Empty();
+	CookedCatalog.Reset();
 	TokenDefinitions.Empty();
 
 	Super::Deinitialize();
@@ -41,26 +47,11 @@ void UGCGCardDatabase::Deinitialize()
 
 const FGCGCardData* UGCGCardDatabase::GetCardData(FName CardNumber) const
 {
-	// Check if this is a token first
-	if (TokenDefinitions.Contains(CardNumber))
-	{
-		return &TokenDefinitions[CardNumber];
-	}
-
-	// Check cache
-	if (CardDataCache.Contains(CardNumber))
+	// Single hash lookup + array index (tokens live in the catalog too)
+	const FGCGCardData* FoundData = Catalog->FindCard(CardNumber);
+	if (FoundData)
 	{
-		return CardDataCache[CardNumber];
-	}
-
-	// If we have a DataTable, try looking it up directly
-	if (CardDataTable)
-	{
-		FGCGCardData* FoundData = CardDataTable->FindRow<FGCGCardData>(CardNumber, TEXT("GetCardData"));
-		if (FoundData)
-		{
-			return FoundData;
-		}
+		return FoundData;
 	}
 
 	// Card not found
@@ -70,41 +61,50 @@ const FGCGCardData* UGCGCardDatabase::GetCardData(FName CardNumber) const
 
 bool UGCGCardDatabase::CardExists(FName CardNumber) const
 {
-	return GetCardData(CardNumber) != nullptr;
+	return Catalog->FindCardId(CardNumber) != GCG_INVALID_CARD_ID;
 }
 
-TArray<FGCGCardData> UGCGCardDatabase::GetAllCards() const
+FGCGCardCatalogPtr UGCGCardDatabase::AcquireCatalog() const
 {
-	TArray<FGCGCardData> AllCards;
+	FReadScopeLock ReadLock(CatalogLock);
+	return Catalog;
+}
 
-	if (CardDataTable)
+int32 UGCGCardDatabase::GetNumRetiredCatalogs() const
+{
+	int32 NumAlive = 0;
+	for (const TWeakPtr<const FGCGCardCatalog, ESPMode::ThreadSafe>& Retired : RetiredCatalogs)
 	{
-		TArray<FGCGCardData*> AllRows;
-		CardDataTable->GetAllRows<FGCGCardData>(TEXT("GetAllCards"), AllRows);
-
-		for (FGCGCardData* Row : AllRows)
+		if (Retired.IsValid())
 		{
-			if (Row)
-			{
-				AllCards.Add(*Row);
-			}
+			++NumAlive;
 		}
 	}
+	return NumAlive;
+}
 
-	return AllCards;
+TArray<FGCGCardData> UGCGCardDatabase::GetAllCards() const
+{
+	// Tokens occupy the front of the catalog and are not part of the card pool
+	TArray<FGCGCardData> PoolCards;
+	PoolCards.SetNum(Catalog->Num() - Catalog->GetNumTokens());
+	for (int32 Index = 0; Index < PoolCards.Num(); ++Index)
+	{
+		Catalog->CopyCard(static_cast<FGCGCardId>(Catalog->GetNumTokens() + Index), PoolCards[Index]);
+	}
+
+	return PoolCards;
 }
 
 TArray<FGCGCardData> UGCGCardDatabase::GetCardsByType(EGCGCardType CardType) const
 {
-	TArray<FGCGCardData> FilteredCards;
-	TArray<FGCGCardData> AllCards = GetAllCards();
+	TConstArrayView<FGCGCardId> CardIds = Catalog->GetCardIdsByType(CardType);
 
-	for (const FGCGCardData& Card : AllCards)
+	TArray<FGCGCardData> FilteredCards;
+	FilteredCards.SetNum(CardIds.Num());
+	for (int32 Index = 0; Index < CardIds.Num(); ++Index)
 	{
-		if (Card.CardType == CardType)
-		{
-			FilteredCards.Add(Card);
-		}
+		Catalog->CopyCard(CardIds[Index], FilteredCards[Index]);
 	}
 
 	return FilteredCards;
@@ -112,15 +112,13 @@ TArray<FGCGCardData> UGCGCardDatabase::GetCardsByType(EGCGCardType CardType) con
 
 TArray<FGCGCardData> UGCGCardDatabase::GetCardsByColor(EGCGCardColor Color) const
 {
-	TArray<FGCGCardData> FilteredCards;
-	TArray<FGCGCardData> AllCards = GetAllCards();
+	TConstArrayView<FGCGCardId> CardIds = Catalog->GetCardIdsByColor(Color);
 
-	for (const FGCGCardData& Card : AllCards)
+	TArray<FGCGCardData> FilteredCards;
+	FilteredCards.SetNum(CardIds.Num());
+	for (int32 Index = 0; Index < CardIds.Num(); ++Index)
 	{
-		if (Card.Colors.Contains(Color))
-		{
-			FilteredCards.Add(Card);
-		}
+		Catalog->CopyCard(CardIds[Index], FilteredCards[Index]);
 	}
 
 	return FilteredCards;
@@ -232,6 +230,7 @@ bool UGCGCardDatabase::ValidateResourceDeck(const TArray<FName>& ResourceDeckLis
 void UGCGCardDatabase::SetCardDataTable(UDataTable* NewDataTable)
 {
 	CardDataTable = NewDataTable;
+	CsvSourcePath.Empty();
 
 	if (CardDataTable)
 	{
@@ -242,50 +241,248 @@ void UGCGCardDatabase::SetCardDataTable(UDataTable* NewDataTable)
 
 void UGCGCardDatabase::ReloadCardData()
 {
-	CardDataCache.Empty();
+	TArray<FGCGCardData> PoolRows;
+	TArray<FString> BuildErrors;
+	bool bPublished = false;
+	bool bCookedSource = false;
 
-	if (!CardDataTable)
+	if (CardDataTable)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGCGCardDatabase::ReloadCardData - No DataTable set"));
-		return;
+		// Get all rows from the DataTable
+		TArray<FGCGCardData*> AllRows;
+		CardDataTable->GetAllRows<FGCGCardData>(TEXT("ReloadCardData"), AllRows);
+
+		PoolRows.Reserve(AllRows.Num());
+		for (const FGCGCardData* Row : AllRows)
+		{
+			if (Row)
+			{
+				PoolRows.Add(*Row);
+			}
+		}
 	}
+	else if (!CsvSourcePath.IsEmpty())
+	{
+		// Re-import the CSV the pool came from
+		FGCGCsvImportResult ImportResult;
+		FGCGCardCsvImporter::ImportFile(CsvSourcePath, ImportResult);
 
-	// Get all rows from the DataTable
-	TArray<FGCGCardData*> AllRows;
-	CardDataTable->GetAllRows<FGCGCardData>(TEXT("ReloadCardData"), AllRows);
+		for (const FGCGCsvImportError& Error : ImportResult.Errors)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UGCGCardDatabase::ReloadCardData - %s: %s"), *CsvSourcePath, *Error.ToString());
+		}
 
-	// Cache them for faster lookups
-	for (FGCGCardData* Row : AllRows)
-	{
-		if (Row)
+		for (const FGCGCsvImportError& Warning : ImportResult.Warnings)
 		{
-			CardDataCache.Add(Row->CardNumber, Row);
+			UE_LOG(LogTemp, Warning, TEXT("UGCGCardDatabase::ReloadCardData - %s: %s"), *CsvSourcePath, *Warning.ToString());
 		}
+
+		PoolRows = MoveTemp(ImportResult.Cards);
+	}
+	else if (CookedCatalog.IsValid())
+	{
+		// Serve the mapped records in place (no parsing, no per-card copies)
+		bPublished = RebuildCatalogFromCooked(BuildErrors);
+		bCookedSource = true;
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UGCGCardDatabase::ReloadCardData - No DataTable set, card lookups will only return tokens"));
+	}
+
+	if (!bCookedSource)
+	{
+		bPublished = RebuildCatalog(MoveTemp(PoolRows), BuildErrors);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("UGCGCardDatabase::ReloadCardData - Loaded %d cards from DataTable"), CardDataCache.Num());
+	for (const FString& Error : BuildErrors)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UGCGCardDatabase::ReloadCardData - %s"), *Error);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("UGCGCardDatabase::ReloadCardData - %s %d cards (%d tokens), catalog generation %u"),
+		bPublished ? TEXT("Loaded") : TEXT("No changes to"), GetCardCount(), Catalog->GetNumTokens(), Catalog->GetGeneration());
+}
+
+bool UGCGCardDatabase::LoadCookedCatalog(const FString& FilePath)
+{
+	// Map a fresh blob - catalog generations built from the previous one keep it alive
+	TSharedRef<FGCGCookedCardCatalog, ESPMode::ThreadSafe> NewCooked = MakeShared<FGCGCookedCardCatalog, ESPMode::ThreadSafe>();
+
+	FString OpenError;
+	if (!NewCooked->Open(FilePath, OpenError))
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGCGCardDatabase::LoadCookedCatalog - %s"), *OpenError);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("UGCGCardDatabase::LoadCookedCatalog - Opened %s (%d cards, %s)"),
+		*FilePath, NewCooked->Num(), NewCooked->IsMapped() ? TEXT("memory-mapped") : TEXT("read into memory"));
+
+	// The cooked blob replaces the DataTable as the card source
+	CookedCatalog = NewCooked;
+	CardDataTable = nullptr;
+	CsvSourcePath.Empty();
+	ReloadCardData();
+
+	return true;
+}
+
+bool UGCGCardDatabase::LoadCardDataFromCsv(const FString& FilePath, TArray<FString>& OutErrors)
+{
+	OutErrors.Empty();
+
+	FGCGCsvImportResult ImportResult;
+	const bool bClean = FGCGCardCsvImporter::ImportFile(FilePath, ImportResult);
+
+	for (const FGCGCsvImportError& Error : ImportResult.Errors)
+	{
+		OutErrors.Add(Error.ToString());
+		UE_LOG(LogTemp, Warning, TEXT("UGCGCardDatabase::LoadCardDataFromCsv - %s: %s"), *FilePath, *Error.ToString());
+	}
+
+	for (const FGCGCsvImportError& Warning : ImportResult.Warnings)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UGCGCardDatabase::LoadCardDataFromCsv - %s: %s"), *FilePath, *Warning.ToString());
+	}
+
+	if (ImportResult.RowsRead == 0 && !bClean)
+	{
+		// Nothing usable (missing file, bad header) - keep the current pool
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("UGCGCardDatabase::LoadCardDataFromCsv - Imported %d/%d rows from %s in %.1f ms"),
+		ImportResult.Cards.Num(), ImportResult.RowsRead, *FilePath, ImportResult.Seconds * 1000.0);
+
+	// The CSV replaces the DataTable / cooked blob as the card source
+	CardDataTable = nullptr;
+	CookedCatalog.Reset();
+	CsvSourcePath = FilePath;
+
+	TArray<FString> BuildErrors;
+	RebuildCatalog(MoveTemp(ImportResult.Cards), BuildErrors);
+
+	for (const FString& Error : BuildErrors)
+	{
+		OutErrors.Add(Error);
+		UE_LOG(LogTemp, Warning, TEXT("UGCGCardDatabase::LoadCardDataFromCsv - %s"), *Error);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("UGCGCardDatabase::LoadCardDataFromCsv - Loaded %d cards into catalog (%d tokens), catalog generation %u"),
+		GetCardCount(), Catalog->GetNumTokens(), Catalog->GetGeneration());
+
+	return OutErrors.Num() == 0;
+}
+
+FString UGCGCardDatabase::GetDefaultCookedCatalogPath()
+{
+	return FPaths::ProjectContentDir() / TEXT("Cards/Data/CardCatalog.gcgcat");
 }
 
 // ===== STATISTICS =====
 
 int32 UGCGCardDatabase::GetCardCount() const
 {
-	return CardDataCache.Num();
+	return Catalog->Num() - Catalog->GetNumTokens();
 }
 
 FString UGCGCardDatabase::GetDatabaseStats() const
 {
 	int32 TotalCards = GetCardCount();
-	int32 UnitCount = GetCardsByType(EGCGCardType::Unit).Num();
-	int32 CommandCount = GetCardsByType(EGCGCardType::Command).Num();
-	int32 BaseCount = GetCardsByType(EGCGCardType::Base).Num();
+	int32 UnitCount = Catalog->GetCardIdsByType(EGCGCardType::Unit).Num();
+	int32 CommandCount = Catalog->GetCardIdsByType(EGCGCardType::Command).Num();
+	int32 BaseCount = Catalog->GetCardIdsByType(EGCGCardType::Base).Num();
 
-	return FString::Printf(TEXT("Card Database: %d total cards (%d Units, %d Commands, %d Bases, %d Tokens)"),
-		TotalCards, UnitCount, CommandCount, BaseCount, TokenDefinitions.Num());
+	return FString::Printf(TEXT("Card Database: %d total cards (%d Units, %d Commands, %d Bases, %d Tokens), generation %u (%d retired still pinned)"),
+		TotalCards, UnitCount, CommandCount, BaseCount, TokenDefinitions.Num(), Catalog->GetGeneration(), GetNumRetiredCatalogs());
 }
 
 // ===== INTERNAL HELPERS =====
 
+bool UGCGCardDatabase::RebuildCatalog(TArray<FGCGCardData>&& PoolRows, TArray<FString>& OutErrors)
+{
+	// Tokens first so their CardIds are stable regardless of the card source
+	TArray<FGCGCardData> Rows = GetTokenRows();
+	const int32 TokenRowCount = Rows.Num();
+
+	Rows.Append(MoveTemp(PoolRows));
+
+	// Build off to the side - the published generation is never touched
+	TSharedRef<FGCGCardCatalog, ESPMode::ThreadSafe> NewCatalog = MakeShared<FGCGCardCatalog, ESPMode::ThreadSafe>();
+	NewCatalog->Build(MoveTemp(Rows), TokenRowCount, OutErrors);
+
+	return PublishIfChanged(NewCatalog);
+}
+
+bool UGCGCardDatabase::RebuildCatalogFromCooked(TArray<FString>& OutErrors)
+{
+	check(CookedCatalog.IsValid());
+
+	// Only the tokens are copied; pool cards stay in the mapped blob
+	TSharedRef<FGCGCardCatalog, ESPMode::ThreadSafe> NewCatalog = MakeShared<FGCGCardCatalog, ESPMode::ThreadSafe>();
+	NewCatalog->BuildFromCooked(GetTokenRows(), CookedCatalog.ToSharedRef(), OutErrors);
+
+	return PublishIfChanged(NewCatalog);
+}
+
+TArray<FGCGCardData> UGCGCardDatabase::GetTokenRows() const
+{
+	TArray<FGCGCardData> Rows;
+	Rows.Reserve(TokenDefinitions.Num());
+	for (const auto& Token : TokenDefinitions)
+	{
+		Rows.Add(Token.Value);
+	}
+	return Rows;
+}
+
+bool UGCGCardDatabase::PublishIfChanged(const TSharedRef<FGCGCardCatalog, ESPMode::ThreadSafe>& NewCatalog)
+{
+	FGCGCardCatalogDiff Diff;
+	FGCGCardCatalog::Diff(*Catalog, *NewCatalog, Diff);
+
+	// Identical rows: keep the current generation so pinned CardIds stay shared
+	if (!Diff.HasChanges() && Catalog->GetGeneration() != 0)
+	{
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("UGCGCardDatabase::PublishIfChanged - Publishing generation %u (%s)"),
+		NextCatalogGeneration, *Diff.ToString());
+
+	NewCatalog->SetGeneration(NextCatalogGeneration++);
+	PublishCatalog(NewCatalog);
+
+	OnCatalogPublished.Broadcast(Catalog, Diff);
+	return true;
+}
+
+void UGCGCardDatabase::PublishCatalog(FGCGCardCatalogPtr NewCatalog)
+{
+	check(NewCatalog.IsValid());
+
+	FGCGCardCatalogPtr OldCatalog;
+	{
+		FWriteScopeLock WriteLock(CatalogLock);
+		OldCatalog = MoveTemp(Catalog);
+		Catalog = MoveTemp(NewCatalog);
+	}
+
+	// Forget generations nobody pins any more, then track the one just superseded
+	RetiredCatalogs.RemoveAllSwap([](const TWeakPtr<const FGCGCardCatalog, ESPMode::ThreadSafe>& Retired)
+	{
+		return !Retired.IsValid();
+	});
+
+	if (OldCatalog.IsValid() && OldCatalog->GetGeneration() != 0)
+	{
+		RetiredCatalogs.Add(OldCatalog);
+	}
+
+	// OldCatalog is freed here unless a match still holds it
+}
+
 void UGCGCardDatabase::InitializeTokenDefinitions()
 {
 	UE_LOG(LogTemp, Log, TEXT("UGCGCardDatabase::InitializeTokenDefinitions - Initializing token definitions"));
@@ -302,7 +499,7 @@ void UGCGCardDatabase::InitializeTokenDefinitions()
 		TokenDefinitions.Num());
 }
 
-FGCGCardData UGCGCardDatabase::CreateEXBaseTokenData() const
+FGCGCardData UGCGCardDatabase::CreateEXBaseTokenData()
 {
 	FGCGCardData EXBase;
 
@@ -340,7 +537,7 @@ FGCGCardData UGCGCardDatabase::CreateEXBaseTokenData() const
 	return EXBase;
 }
 
-FGCGCardData UGCGCardDatabase::CreateEXResourceTokenData() const
+FGCGCardData UGCGCardDatabase::CreateEXResourceTokenData()
 {
 	FGCGCardData EXResource;
 
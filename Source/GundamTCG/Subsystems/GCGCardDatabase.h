@@ -8,8 +8,13 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Engine/DataTable.h"
 #include "GundamTCG/GCGTypes.h"
+#include "GundamTCG/Cards/GCGCardCatalog.h"
+#include "GundamTCG/Cards/GCGCookedCardCatalog.h"
 #include "GCGCardDatabase.generated.h"
 
+/** Broadcast after a reload publishes a new catalog generation (game thread) */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnGCGCardCatalogPublished, const FGCGCardCatalogPtr& /*NewCatalog*/, const FGCGCardCatalogDiff& /*Diff*/);
+
 /**
  * Card Database Subsystem
  *
@@ -21,6 +26,20 @@
  *
  * Card data is stored in a DataTable asset (assigned in Project Settings or GameInstance Blueprint).
  * The DataTable uses FGCGCardData as its row structure.
+ * Without a DataTable, a cooked catalog blob (see UGCGCookCardCatalogCommandlet) is memory-mapped instead,
+ * or card CSVs can be imported directly with LoadCardDataFromCsv().
+ *
+ * On load, tokens and DataTable / CSV rows are copied once into an immutable FGCGCardCatalog;
+ * a cooked blob is not copied at all - the catalog serves its records in place.
+ * Every lookup is served from that catalog: CardNumber → CardId is a single hash lookup,
+ * and CardId → FGCGCardView is a plain array index (rows) or record index (blob).
+ *
+ * Reloads never modify a published catalog. The new rows are built into a fresh catalog,
+ * diffed against the current one, and - only if something changed - published atomically
+ * as the next generation (RCU-style). Older generations stay alive for as long as anyone
+ * holds an FGCGCardCatalogPtr to them, so a running match that pinned its catalog with
+ * AcquireCatalog() keeps valid FGCGCardData pointers and CardIds while new matches pick
+ * up the balance patch.
  */
 UCLASS()
 class GUNDAMTCG_API UGCGCardDatabase : public UGameInstanceSubsystem
@@ -58,6 +77,52 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Card Database")
 	bool CardExists(FName CardNumber) const;
 
+	/**
+	 * Resolve a card number to its dense CardId (C++ only)
+	 * @param CardNumber The card number to resolve
+	 * @return CardId, or GCG_INVALID_CARD_ID if not found
+	 */
+	FGCGCardId GetCardId(FName CardNumber) const { return Catalog->FindCardId(CardNumber); }
+
+	/**
+	 * Get card data by CardId (C++ only, O(1) array index; cooked cards are expanded on first request)
+	 * @param CardId The CardId to look up
+	 * @return Pointer to card data, or nullptr if the id is invalid
+	 */
+	const FGCGCardData* GetCardDataById(FGCGCardId CardId) const { return Catalog->GetCard(CardId); }
+
+	/**
+	 * Get the current card catalog generation (C++ only, game thread)
+	 * The reference is only guaranteed until the next reload; use AcquireCatalog() to hold on to it.
+	 * @return The catalog published by the last ReloadCardData()
+	 */
+	const FGCGCardCatalog& GetCatalog() const { return *Catalog; }
+
+	/**
+	 * Pin the current card catalog generation (C++ only, any thread)
+	 * The returned generation, its CardIds and every FGCGCardData pointer into it stay valid
+	 * until the last pin is released, regardless of later reloads.
+	 * @return Shared handle to the current generation (never null)
+	 */
+	FGCGCardCatalogPtr AcquireCatalog() const;
+
+	/**
+	 * Generation number of the current catalog (bumped by every reload that changes card data)
+	 * @return Current generation
+	 */
+	UFUNCTION(BlueprintPure, Category = "Card Database")
+	int32 GetCatalogGeneration() const { return static_cast<int32>(Catalog->GetGeneration()); }
+
+	/**
+	 * Number of superseded catalog generations still pinned by running matches
+	 * @return Live retired generation count
+	 */
+	UFUNCTION(BlueprintPure, Category = "Card Database")
+	int32 GetNumRetiredCatalogs() const;
+
+	/** Fired after a reload publishes a new catalog generation (C++ only) */
+	FOnGCGCardCatalogPublished OnCatalogPublished;
+
 	/**
 	 * Get all cards in the database
 	 * @return Array of all card data entries
@@ -65,6 +130,15 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Card Database")
 	TArray<FGCGCardData> GetAllCards() const;
 
+	/**
+	 * Query the card pool through the secondary indices (C++ only)
+	 * Returns CardIds instead of copied card data; reuse OutCardIds to avoid allocations.
+	 * @param Query Conjunctive filter (type, colors, traits, keywords, level/cost ranges)
+	 * @param OutCardIds Matching CardIds, sorted ascending
+	 * @return Number of matches
+	 */
+	int32 QueryCards(const FGCGCardQuery& Query, TArray<FGCGCardId>& OutCardIds) const { return Catalog->Query(Query, OutCardIds); }
+
 	/**
 	 * Get all cards of a specific type
 	 * @param CardType The type to filter by
@@ -99,6 +173,18 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Card Database")
 	bool IsToken(FName CardNumber) const;
 
+	/**
+	 * Create EX Base token data (static so offline tools can build a catalog without a game instance)
+	 * @return EX Base token data
+	 */
+	static FGCGCardData CreateEXBaseTokenData();
+
+	/**
+	 * Create EX Resource token data
+	 * @return EX Resource token data
+	 */
+	static FGCGCardData CreateEXResourceTokenData();
+
 	// ===== CARD VALIDATION =====
 
 	/**
@@ -136,7 +222,44 @@ public:
 	UDataTable* GetCardDataTable() const { return CardDataTable; }
 
 	/**
-	 * Reload card data from the data table
+	 * Load card data from a cooked catalog blob instead of the DataTable
+	 * The published FGCGCardCatalog serves card views, indices and compiled effect programs
+	 * straight from the mapped pages; the blob stays mapped until the last catalog generation
+	 * built from it is released. Only GetCardData() expands (and caches) individual cards.
+	 * @param FilePath Path to a .gcgcat file written by the GCGCookCardCatalog commandlet
+	 * @return True if the blob was mapped and the catalog rebuilt from it
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Card Database")
+	bool LoadCookedCatalog(const FString& FilePath);
+
+	/**
+	 * Get the memory-mapped cooked catalog (C++ only)
+	 * Records, strings, effect clauses and compiled programs can be read in place from here.
+	 * @return The open cooked catalog, or nullptr if card data did not come from a blob
+	 */
+	const FGCGCookedCardCatalog* GetCookedCatalog() const { return CookedCatalog.Get(); }
+
+	/**
+	 * Import cards straight from a CSV file (TestCards.csv schema), bypassing the DataTable
+	 * Rows with errors are skipped; the remaining rows become the card pool.
+	 * @param FilePath The CSV file to import
+	 * @param OutErrors Every import error, prefixed with its line number
+	 * @return True if the file imported without errors
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Card Database")
+	bool LoadCardDataFromCsv(const FString& FilePath, TArray<FString>& OutErrors);
+
+	/**
+	 * Default location of the cooked catalog blob
+	 * @return <ProjectContent>/Cards/Data/CardCatalog.gcgcat
+	 */
+	UFUNCTION(BlueprintPure, Category = "Card Database")
+	static FString GetDefaultCookedCatalogPath();
+
+	/**
+	 * Reload card data from the current source (DataTable, else imported CSV, else cooked catalog)
+	 * Builds a new catalog (tokens + card rows) and publishes it as the next generation if any
+	 * row changed. Matches that pinned an older generation are unaffected.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Card Database")
 	void ReloadCardData();
@@ -161,21 +284,46 @@ protected:
 	// ===== INTERNAL HELPERS =====
 
 	/**
-	 * Initialize token definitions
+	 * Build a catalog from a card pool (tokens are prepended) and publish it if it differs
+	 * from the current generation
+	 * @param PoolRows Card rows from the current source
+	 * @param OutErrors Catalog build problems (duplicates, empty card numbers)
+	 * @return True if a new generation was published
 	 */
-	void InitializeTokenDefinitions();
+	bool RebuildCatalog(TArray<FGCGCardData>&& PoolRows, TArray<FString>& OutErrors);
 
 	/**
-	 * Create EX Base token data
-	 * @return EX Base token data
+	 * Build a catalog over the mapped cooked blob (tokens are owned rows) and publish it if it
+	 * differs from the current generation
+	 * @param OutErrors Catalog build problems (tokens shadowing cooked cards)
+	 * @return True if a new generation was published
 	 */
-	FGCGCardData CreateEXBaseTokenData() const;
+	bool RebuildCatalogFromCooked(TArray<FString>& OutErrors);
 
 	/**
-	 * Create EX Resource token data
-	 * @return EX Resource token data
+	 * Token rows in catalog order (they always take the first CardIds)
+	 * @return Copies of the token definitions
+	 */
+	TArray<FGCGCardData> GetTokenRows() const;
+
+	/**
+	 * Diff a freshly built catalog against the current generation and publish it if anything changed
+	 * @param NewCatalog The fully built catalog
+	 * @return True if it was published
 	 */
-	FGCGCardData CreateEXResourceTokenData() const;
+	bool PublishIfChanged(const TSharedRef<FGCGCardCatalog, ESPMode::ThreadSafe>& NewCatalog);
+
+	/**
+	 * Swap in a new catalog generation and retire the previous one
+	 * @param NewCatalog The fully built catalog to publish
+	 */
+	void PublishCatalog(FGCGCardCatalogPtr NewCatalog);
+
+	/**
+	 * Initialize token definitions
+	 */
+	void InitializeTokenDefinitions();
+
 
 private:
 	// ===== DATA STORAGE =====
@@ -195,8 +343,34 @@ private:
 	TMap<FName, FGCGCardData> TokenDefinitions;
 
 	/**
-	 * Cache of card data for faster lookups
-	 * Populated on initialization from DataTable
+	 * Current immutable catalog generation (tokens first, then card rows) with its secondary indices
+	 * Replaced only by PublishCatalog(); never null
+	 */
+	FGCGCardCatalogPtr Catalog = MakeShared<FGCGCardCatalog, ESPMode::ThreadSafe>();
+
+	/**
+	 * Guards the Catalog pointer swap against AcquireCatalog() on other threads
+	 */
+	mutable FRWLock CatalogLock;
+
+	/**
+	 * Superseded generations, tracked weakly (they die with their last pin)
+	 */
+	TArray<TWeakPtr<const FGCGCardCatalog, ESPMode::ThreadSafe>> RetiredCatalogs;
+
+	/**
+	 * Generation number for the next published catalog
+	 */
+	uint32 NextCatalogGeneration = 1;
+
+	/**
+	 * Memory-mapped cooked catalog (set only when card data came from a blob)
+	 * Shared with every catalog generation built from it; each load maps a new one
+	 */
+	TSharedPtr<FGCGCookedCardCatalog, ESPMode::ThreadSafe> CookedCatalog;
+
+	/**
+	 * CSV file the card pool was imported from (empty if not CSV-sourced)
 	 */
-	TMap<FName, FGCGCardData*> CardDataCache;
+	FString CsvSourcePath;
 };
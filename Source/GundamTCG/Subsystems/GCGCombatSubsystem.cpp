@@ -4,9 +4,35 @@
 #include "GCGCombatSubsystem.h"
 #include "GCGKeywordSubsystem.h"
 #include "GCGLinkUnitSubsystem.h"
+#include "GCGEffectSubsystem.h"
 #include "GundamTCG/PlayerState/GCGPlayerState.h"
 #include "GundamTCG/GameState/GCGGameState.h"
 #include "GundamTCG/Subsystems/GCGZoneSubsystem.h"
+#include "GundamTCG/GameModes/GCGGameModeBase.h"
+#include "GundamTCG/Core/GCGRules.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+
+namespace
+{
+	/** A player's state, looked up through the world's game state */
+	const AGCGPlayerState* FindPlayerState(const UWorld* World, int32 PlayerID)
+	{
+		const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+		if (GameState)
+		{
+			for (const APlayerState* PlayerState : GameState->PlayerArray)
+			{
+				const AGCGPlayerState* GCGPlayerState = Cast<AGCGPlayerState>(PlayerState);
+				if (GCGPlayerState && GCGPlayerState->GetPlayerID() == PlayerID)
+				{
+					return GCGPlayerState;
+				}
+			}
+		}
+		return nullptr;
+	}
+}
 
 // ===== SUBSYSTEM LIFECYCLE =====
 
@@ -27,7 +53,8 @@ void UGCGCombatSubsystem::Deinitialize()
 // ===== ATTACK DECLARATION =====
 
 FGCGCombatResult UGCGCombatSubsystem::DeclareAttack(int32 AttackerInstanceID,
-	AGCGPlayerState* AttackingPlayer, AGCGPlayerState* DefendingPlayer, AGCGGameState* GameState)
+	AGCGPlayerState* AttackingPlayer, AGCGPlayerState* DefendingPlayer, AGCGGameState* GameState,
+	int32 TargetUnitInstanceID)
 {
 	if (!AttackingPlayer || !DefendingPlayer || !GameState)
 	{
@@ -35,52 +62,46 @@ FGCGCombatResult UGCGCombatSubsystem::DeclareAttack(int32 AttackerInstanceID,
 	}
 
 	// Find attacker in Battle Area
-	FGCGCardInstance AttackerInstance;
-	EGCGCardZone AttackerZone;
-	if (!AttackingPlayer->FindCardByInstanceID(AttackerInstanceID, AttackerInstance, AttackerZone))
-	{
-		return FGCGCombatResult(false, TEXT("Attacker not found"));
-	}
-
-	if (AttackerZone != EGCGCardZone::BattleArea)
+	const FGCGCardInstance* AttackerInstance = AttackingPlayer->FindCardInZone(AttackerInstanceID, EGCGCardZone::BattleArea);
+	if (!AttackerInstance)
 	{
-		return FGCGCombatResult(false, TEXT("Card is not in Battle Area"));
+		return FGCGCombatResult(false, TEXT("Attacker not found in Battle Area"));
 	}
+	const FName AttackerCardNumber = AttackerInstance->CardNumber;
 
 	// Validate can attack
-	FGCGCombatResult ValidationResult = CanAttack(AttackerInstance, AttackingPlayer, GameState);
+	FGCGCombatResult ValidationResult = CanAttack(*AttackerInstance, AttackingPlayer, GameState);
 	if (!ValidationResult.bSuccess)
 	{
 		return ValidationResult;
 	}
 
+	// Units may only attack rested enemy Units
+	if (TargetUnitInstanceID > 0
+		&& FGCGRules::CanBeAttacked(*GetMatchCatalog(), *DefendingPlayer, TargetUnitInstanceID) != EGCGRulesResult::Success)
+	{
+		return FGCGCombatResult(false, TEXT("Only rested enemy Units in the Battle Area can be attacked"));
+	}
+
 	// Create attack declaration
 	FGCGAttackDeclaration Attack;
 	Attack.AttackerInstanceID = AttackerInstanceID;
 	Attack.AttackingPlayerID = AttackingPlayer->GetPlayerID();
 	Attack.DefendingPlayerID = DefendingPlayer->GetPlayerID();
-	Attack.bTargetingBase = true; // Always target base initially
+	Attack.bTargetingBase = TargetUnitInstanceID <= 0;
 	Attack.BlockerInstanceID = 0; // No blocker yet
+	Attack.TargetUnitInstanceID = FMath::Max(TargetUnitInstanceID, 0);
 	Attack.bResolved = false;
 
 	// Add to current attacks
 	GameState->CurrentAttacks.Add(Attack);
 
-	// Mark attacker as having attacked this turn
-	for (FGCGCardInstance& BattleCard : AttackingPlayer->BattleArea)
-	{
-		if (BattleCard.InstanceID == AttackerInstanceID)
-		{
-			BattleCard.bHasAttackedThisTurn = true;
-			// Rest the attacker (attacking rests the unit)
-			BattleCard.bIsActive = false;
-			break;
-		}
-	}
+	// Attacking rests the attacker and uses its attack for the turn
+	FGCGRules::DeclareAttacker(*AttackingPlayer, AttackerInstanceID);
 
-	UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::DeclareAttack - Player %d declared attack with %s (ID: %d) on Player %d"),
-		AttackingPlayer->GetPlayerID(), *AttackerInstance.CardName.ToString(), AttackerInstanceID,
-		DefendingPlayer->GetPlayerID());
+	UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::DeclareAttack - Player %d declared attack with %s (ID: %d) on Player %d (Unit: %d)"),
+		AttackingPlayer->GetPlayerID(), *AttackerCardNumber.ToString(), AttackerInstanceID,
+		DefendingPlayer->GetPlayerID(), Attack.TargetUnitInstanceID);
 
 	// TODO: Trigger "On Attack" effects (Phase 8)
 
@@ -95,28 +116,17 @@ FGCGCombatResult UGCGCombatSubsystem::CanAttack(const FGCGCardInstance& Attacker
 		return FGCGCombatResult(false, TEXT("Invalid player or game state"));
 	}
 
-	// Must be a Unit
-	if (AttackerInstance.CardType != EGCGCardType::Unit)
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	if (!Catalog)
 	{
-		return FGCGCombatResult(false, TEXT("Only Units can attack"));
+		return FGCGCombatResult(false, TEXT("No match catalog"));
 	}
 
-	// Must be active (not rested)
-	if (!AttackerInstance.bIsActive)
+	// Unit, active, not attacked yet, not deployed this turn unless linked: the rules engine's checks
+	const EGCGRulesResult Result = FGCGRules::CanAttack(*Catalog, *AttackingPlayer, AttackerInstance.InstanceID, GameState->TurnNumber);
+	if (Result != EGCGRulesResult::Success)
 	{
-		return FGCGCombatResult(false, TEXT("Unit is rested"));
-	}
-
-	// Check summoning sickness (can't attack on turn deployed)
-	if (HasSummoningSickness(AttackerInstance, GameState))
-	{
-		return FGCGCombatResult(false, TEXT("Unit has summoning sickness (deployed this turn)"));
-	}
-
-	// Can't attack if already attacked this turn
-	if (AttackerInstance.bHasAttackedThisTurn)
-	{
-		return FGCGCombatResult(false, TEXT("Unit has already attacked this turn"));
+		return FGCGCombatResult(false, FString::Printf(TEXT("Unit %d cannot attack: %s"), AttackerInstance.InstanceID, LexToString(Result)));
 	}
 
 	return FGCGCombatResult(true);
@@ -141,20 +151,15 @@ FGCGCombatResult UGCGCombatSubsystem::DeclareBlocker(int32 AttackIndex, int32 Bl
 	FGCGAttackDeclaration& Attack = GameState->CurrentAttacks[AttackIndex];
 
 	// Find blocker in Battle Area
-	FGCGCardInstance BlockerInstance;
-	EGCGCardZone BlockerZone;
-	if (!DefendingPlayer->FindCardByInstanceID(BlockerInstanceID, BlockerInstance, BlockerZone))
+	const FGCGCardInstance* BlockerInstance = DefendingPlayer->FindCardInZone(BlockerInstanceID, EGCGCardZone::BattleArea);
+	if (!BlockerInstance)
 	{
-		return FGCGCombatResult(false, TEXT("Blocker not found"));
-	}
-
-	if (BlockerZone != EGCGCardZone::BattleArea)
-	{
-		return FGCGCombatResult(false, TEXT("Card is not in Battle Area"));
+		return FGCGCombatResult(false, TEXT("Blocker not found in Battle Area"));
 	}
+	const FName BlockerCardNumber = BlockerInstance->CardNumber;
 
 	// Validate can block
-	FGCGCombatResult ValidationResult = CanBlock(BlockerInstance, Attack, DefendingPlayer);
+	FGCGCombatResult ValidationResult = CanBlock(*BlockerInstance, Attack, DefendingPlayer);
 	if (!ValidationResult.bSuccess)
 	{
 		return ValidationResult;
@@ -164,18 +169,11 @@ FGCGCombatResult UGCGCombatSubsystem::DeclareBlocker(int32 AttackIndex, int32 Bl
 	Attack.BlockerInstanceID = BlockerInstanceID;
 	Attack.bTargetingBase = false; // Attack is now blocked
 
-	// Rest the blocker (blocking rests the unit)
-	for (FGCGCardInstance& BattleCard : DefendingPlayer->BattleArea)
-	{
-		if (BattleCard.InstanceID == BlockerInstanceID)
-		{
-			BattleCard.bIsActive = false;
-			break;
-		}
-	}
+	// Blocking rests the blocker
+	FGCGRules::DeclareBlocker(*DefendingPlayer, BlockerInstanceID);
 
 	UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::DeclareBlocker - Player %d declared blocker %s (ID: %d) for attack index %d"),
-		DefendingPlayer->GetPlayerID(), *BlockerInstance.CardName.ToString(), BlockerInstanceID, AttackIndex);
+		DefendingPlayer->GetPlayerID(), *BlockerCardNumber.ToString(), BlockerInstanceID, AttackIndex);
 
 	// TODO: Trigger "On Block" effects (Phase 8)
 
@@ -190,21 +188,21 @@ FGCGCombatResult UGCGCombatSubsystem::CanBlock(const FGCGCardInstance& BlockerIn
 		return FGCGCombatResult(false, TEXT("Invalid player state"));
 	}
 
-	// Must be a Unit
-	if (BlockerInstance.CardType != EGCGCardType::Unit)
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	const AGCGPlayerState* AttackingPlayer = FindPlayerState(GetWorld(), Attack.AttackingPlayerID);
+	if (!Catalog || !AttackingPlayer)
 	{
-		return FGCGCombatResult(false, TEXT("Only Units can block"));
+		return FGCGCombatResult(false, TEXT("No match catalog or attacking player"));
 	}
 
-	// Must be active (not rested) OR have Blocker keyword
-	bool bHasBlockerKeyword = HasKeyword(BlockerInstance, EGCGKeyword::Blocker);
-	if (!BlockerInstance.bIsActive && !bHasBlockerKeyword)
+	// Active <Blocker> Unit, not the attacked Unit, attacker without High-Maneuver: the rules engine's checks
+	const EGCGRulesResult Result = FGCGRules::CanBlock(*Catalog, *AttackingPlayer, *DefendingPlayer, Attack.AttackerInstanceID,
+		Attack.TargetUnitInstanceID, BlockerInstance.InstanceID);
+	if (Result != EGCGRulesResult::Success)
 	{
-		return FGCGCombatResult(false, TEXT("Unit is rested and does not have Blocker keyword"));
+		return FGCGCombatResult(false, FString::Printf(TEXT("Unit %d cannot block: %s"), BlockerInstance.InstanceID, LexToString(Result)));
 	}
 
-	// TODO: Check for High-Maneuver keyword on attacker (can't be blocked) - Phase 7
-
 	return FGCGCombatResult(true);
 }
 
@@ -218,105 +216,68 @@ FGCGCombatResult UGCGCombatSubsystem::ResolveAttack(FGCGAttackDeclaration& Attac
 		return FGCGCombatResult(false, TEXT("Invalid player or game state"));
 	}
 
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	if (!Catalog)
+	{
+		return FGCGCombatResult(false, TEXT("No match catalog"));
+	}
+
 	FGCGCombatResult Result(true);
 
-	// Find attacker
-	FGCGCardInstance AttackerInstance;
-	EGCGCardZone AttackerZone;
-	if (!AttackingPlayer->FindCardByInstanceID(Attack.AttackerInstanceID, AttackerInstance, AttackerZone))
+	// Find attacker (a copy: destroying units moves cards under any pointer)
+	const FGCGCardInstance* AttackerInPlay = AttackingPlayer->FindCardInZone(Attack.AttackerInstanceID, EGCGCardZone::BattleArea);
+	if (!AttackerInPlay)
 	{
 		return FGCGCombatResult(false, TEXT("Attacker not found"));
 	}
+	const FGCGCardInstance AttackerInstance = *AttackerInPlay;
 
-	// Get Keyword Subsystem for keyword processing
+	// Get Keyword Subsystem for Breach and Suppression
 	UGCGKeywordSubsystem* KeywordSubsystem = GetGameInstance()->GetSubsystem<UGCGKeywordSubsystem>();
 
-	// Calculate Support buffs (Phase 7)
-	int32 AttackerSupportBuff = 0;
-	if (KeywordSubsystem)
-	{
-		AttackerSupportBuff = KeywordSubsystem->CalculateSupportBuff(AttackerInstance, AttackingPlayer);
-	}
+	// A blocker takes the battle; otherwise an attacked Unit fights it out like one
+	const int32 DefendingUnitID = Attack.BlockerInstanceID > 0 ? Attack.BlockerInstanceID : Attack.TargetUnitInstanceID;
+	FGCGCardInstance* DefendingUnit = DefendingUnitID > 0 ? DefendingPlayer->FindCardInZone(DefendingUnitID, EGCGCardZone::BattleArea) : nullptr;
 
-	int32 AttackerAP = AttackerInstance.AP + AttackerSupportBuff;
-
-	// Check if attack is blocked
-	if (Attack.BlockerInstanceID > 0)
+	if (DefendingUnitID > 0 && !DefendingUnit)
 	{
-		// Find blocker
-		FGCGCardInstance BlockerInstance;
-		EGCGCardZone BlockerZone;
-		if (!DefendingPlayer->FindCardByInstanceID(Attack.BlockerInstanceID, BlockerInstance, BlockerZone))
+		if (Attack.BlockerInstanceID > 0)
 		{
 			return FGCGCombatResult(false, TEXT("Blocker not found"));
 		}
 
-		// Calculate blocker's Support buff (Phase 7)
-		int32 BlockerSupportBuff = 0;
-		if (KeywordSubsystem)
-		{
-			BlockerSupportBuff = KeywordSubsystem->CalculateSupportBuff(BlockerInstance, DefendingPlayer);
-		}
-
-		int32 BlockerAP = BlockerInstance.AP + BlockerSupportBuff;
-
-		// Check for First Strike keyword (Phase 7)
-		bool bFirstStrikeResolved = false;
-		bool bBlockerDestroyedByFirstStrike = false;
+		// The attacked Unit left play before damage; the attack deals nothing
+		UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::ResolveAttack - Target Unit %d is gone, no damage dealt"),
+			Attack.TargetUnitInstanceID);
+	}
+	else if (DefendingUnit)
+	{
+		// Support, First Strike and simultaneous damage are the shared battle rules
+		FGCGCardInstance& Attacker = *AttackingPlayer->FindCardInZone(Attack.AttackerInstanceID, EGCGCardZone::BattleArea);
+		const FGCGUnitCombatOutcome Outcome = FGCGRules::ApplyBattleDamage(*Catalog, *AttackingPlayer, Attacker, *DefendingPlayer, *DefendingUnit);
 
-		if (KeywordSubsystem && KeywordSubsystem->HasFirstStrikeAdvantage(AttackerInstance, BlockerInstance))
+		// Breach resolves before the destroyed Unit leaves play
+		if (Outcome.bDefenderDestroyed && KeywordSubsystem && FGCGRules::HasKeyword(*Catalog, AttackerInstance, EGCGKeyword::Breach))
 		{
-			// Process First Strike
-			FGCGKeywordResult FirstStrikeResult = KeywordSubsystem->ProcessFirstStrike(AttackerInstance, BlockerInstance, bBlockerDestroyedByFirstStrike);
-			bFirstStrikeResolved = FirstStrikeResult.bSuccess;
-
-			if (bBlockerDestroyedByFirstStrike)
-			{
-				// Blocker destroyed by First Strike - no retaliation
-				bool bBlockerDestroyed = DealDamageToUnit(Attack.BlockerInstanceID, AttackerAP, DefendingPlayer);
-				Result.bBlockerDestroyed = bBlockerDestroyed;
-
-				UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::ResolveAttack - First Strike destroyed blocker (no retaliation)"));
-
-				// Check for Breach keyword (Phase 7)
-				if (KeywordSubsystem->HasKeyword(AttackerInstance, EGCGKeyword::Breach))
-				{
-					FGCGKeywordResult BreachResult = KeywordSubsystem->ProcessBreach(AttackerInstance, DefendingPlayer, GameState);
-					Result.ShieldsBroken += BreachResult.ShieldsBroken;
-				}
-
-				return Result;
-			}
+			FGCGKeywordResult BreachResult = KeywordSubsystem->ProcessBreach(AttackerInstance, DefendingPlayer, GameState);
+			Result.ShieldsBroken += BreachResult.ShieldsBroken;
 		}
 
-		// Normal combat (both deal damage)
-		if (!bFirstStrikeResolved)
-		{
-			bool bAttackerDestroyed = DealDamageToUnit(Attack.AttackerInstanceID, BlockerAP, AttackingPlayer);
-			bool bBlockerDestroyed = DealDamageToUnit(Attack.BlockerInstanceID, AttackerAP, DefendingPlayer);
-
-			Result.bAttackerDestroyed = bAttackerDestroyed;
-			Result.bBlockerDestroyed = bBlockerDestroyed;
+		Result.bBlockerDestroyed = Outcome.bDefenderDestroyed && DestroyUnit(DefendingUnitID, DefendingPlayer);
+		Result.bAttackerDestroyed = Outcome.bAttackerDestroyed && DestroyUnit(Attack.AttackerInstanceID, AttackingPlayer);
 
-			UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::ResolveAttack - Blocked combat resolved (Attacker destroyed: %d, Blocker destroyed: %d)"),
-				bAttackerDestroyed ? 1 : 0, bBlockerDestroyed ? 1 : 0);
-
-			// Check for Breach keyword if blocker was destroyed (Phase 7)
-			if (bBlockerDestroyed && KeywordSubsystem && KeywordSubsystem->HasKeyword(AttackerInstance, EGCGKeyword::Breach))
-			{
-				FGCGKeywordResult BreachResult = KeywordSubsystem->ProcessBreach(AttackerInstance, DefendingPlayer, GameState);
-				Result.ShieldsBroken += BreachResult.ShieldsBroken;
-			}
-		}
+		UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::ResolveAttack - Unit combat resolved (First Strike: %d, Attacker destroyed: %d, Defender destroyed: %d)"),
+			Outcome.bFirstStrike ? 1 : 0, Result.bAttackerDestroyed ? 1 : 0, Result.bBlockerDestroyed ? 1 : 0);
 	}
 	else
 	{
 		// Unblocked attack - deal damage to player
+		const int32 AttackerAP = FGCGRules::GetCombatAP(*Catalog, *AttackingPlayer, AttackerInstance);
 		int32 ShieldsBroken = 0;
 		bool bPlayerLost = false;
 
 		// Check for Suppression keyword (Phase 7)
-		if (KeywordSubsystem && KeywordSubsystem->HasKeyword(AttackerInstance, EGCGKeyword::Suppression))
+		if (KeywordSubsystem && FGCGRules::HasKeyword(*Catalog, AttackerInstance, EGCGKeyword::Suppression))
 		{
 			// Suppression: Destroy all shields simultaneously
 			FGCGKeywordResult SuppressionResult = KeywordSubsystem->ProcessSuppression(AttackerInstance, DefendingPlayer, GameState);
@@ -349,6 +310,12 @@ FGCGCombatResult UGCGCombatSubsystem::ResolveAttack(FGCGAttackDeclaration& Attac
 		}
 	}
 
+	// End of battle: "until end of battle" modifiers expire
+	if (UGCGEffectSubsystem* EffectSubsystem = GetGameInstance()->GetSubsystem<UGCGEffectSubsystem>())
+	{
+		EffectSubsystem->ExpireModifiers(GameState, false, true);
+	}
+
 	// Mark attack as resolved
 	Attack.bResolved = true;
 
@@ -363,86 +330,98 @@ bool UGCGCombatSubsystem::DealDamageToUnit(int32 TargetInstanceID, int32 Damage,
 	}
 
 	// Find unit in Battle Area
-	for (FGCGCardInstance& BattleCard : PlayerState->BattleArea)
+	FGCGCardInstance* BattleCard = PlayerState->FindCardInZone(TargetInstanceID, EGCGCardZone::BattleArea);
+	if (!BattleCard)
 	{
-		if (BattleCard.InstanceID == TargetInstanceID)
-		{
-			// Add damage
-			BattleCard.CurrentDamage += Damage;
+		return false;
+	}
 
-			// FAQ Q97-99: Track damage source (battle damage vs effect damage)
-			BattleCard.LastDamageSource = EGCGDamageSource::BattleDamage;
+	// Add damage
+	BattleCard->DamageCounters += Damage;
 
-			UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::DealDamageToUnit - Dealt %d damage to %s (Total: %d/%d HP)"),
-				Damage, *BattleCard.CardName.ToString(), BattleCard.CurrentDamage, BattleCard.HP);
+	// FAQ Q97-99: Track damage source (battle damage vs effect damage)
+	BattleCard->LastDamageSource = EGCGDamageSource::BattleDamage;
+	PlayerState->RefreshCardHash(*BattleCard);
 
-			// Check if unit is destroyed
-			if (BattleCard.CurrentDamage >= BattleCard.HP)
-			{
-				UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::DealDamageToUnit - %s destroyed"),
-					*BattleCard.CardName.ToString());
-				return DestroyUnit(TargetInstanceID, PlayerState);
-			}
+	AGCGGameModeBase* GameMode = GetWorld() ? GetWorld()->GetAuthGameMode<AGCGGameModeBase>() : nullptr;
+	const FGCGCardData* CardData = GameMode ? GameMode->GetCardDataForInstance(*BattleCard) : nullptr;
 
-			return false; // Unit survived
-		}
+	UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::DealDamageToUnit - Dealt %d damage to %s (Total: %d/%d HP)"),
+		Damage, *BattleCard->CardNumber.ToString(), BattleCard->DamageCounters, BattleCard->GetTotalHP(CardData));
+
+	// Check if unit is destroyed
+	if (BattleCard->IsDestroyed(CardData))
+	{
+		UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::DealDamageToUnit - %s destroyed"),
+			*BattleCard->CardNumber.ToString());
+		return DestroyUnit(TargetInstanceID, PlayerState);
 	}
 
-	return false;
+	return false; // Unit survived
 }
 
 bool UGCGCombatSubsystem::DealDamageToPlayer(int32 Damage, AGCGPlayerState* DefendingPlayer,
 	AGCGGameState* GameState, int32& OutShieldsBroken)
 {
-	if (!DefendingPlayer || !GameState || Damage <= 0)
-	{
-		OutShieldsBroken = 0;
-		return false;
-	}
-
 	OutShieldsBroken = 0;
 
-	// TODO: Check for Breach keyword to break extra shields (Phase 7)
-	int32 ShieldsToBreak = 1; // Base 1 shield per damage instance
-
-	// Break shields first
-	if (HasShields(DefendingPlayer))
+	if (!DefendingPlayer || !GameState || Damage <= 0)
 	{
-		OutShieldsBroken = BreakShields(ShieldsToBreak, DefendingPlayer);
-
-		UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::DealDamageToPlayer - Player %d shields broken: %d (Remaining: %d)"),
-			DefendingPlayer->GetPlayerID(), OutShieldsBroken, DefendingPlayer->GetShieldCount());
-
-		// TODO: Check for Burst keyword on broken shields (Phase 7)
-
-		// Damage was absorbed by shields
 		return false;
 	}
 
-	// No shields - damage goes to Base
-	if (DefendingPlayer->BaseSection.Num() > 0)
+	// Damage lands on the Base first, then the shields; with neither the player is defeated
+	switch (FGCGRules::GetPlayerDamageTarget(*DefendingPlayer))
+	{
+	case EGCGPlayerDamageTarget::Base:
 	{
 		FGCGCardInstance& Base = DefendingPlayer->BaseSection[0];
-		Base.CurrentDamage += Damage;
+		Base.DamageCounters += Damage;
 
 		// FAQ Q97-99: Track damage source (battle damage from combat)
 		Base.LastDamageSource = EGCGDamageSource::BattleDamage;
+		DefendingPlayer->RefreshCardHash(Base);
+
+		AGCGGameModeBase* GameMode = GetWorld() ? GetWorld()->GetAuthGameMode<AGCGGameModeBase>() : nullptr;
+		const FGCGCardData* BaseData = GameMode ? GameMode->GetCardDataForInstance(Base) : nullptr;
 
-		UE_LOG(LogTemp, Warning, TEXT("UGCGCombatSubsystem::DealDamageToPlayer - Player %d Base took %d damage (Total: %d/%d HP)"),
-			DefendingPlayer->GetPlayerID(), Damage, Base.CurrentDamage, Base.HP);
+		UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::DealDamageToPlayer - Player %d Base took %d damage (Total: %d/%d HP)"),
+			DefendingPlayer->GetPlayerID(), Damage, Base.DamageCounters, Base.GetTotalHP(BaseData));
 
-		// Check if Base is destroyed (player loses)
-		if (Base.CurrentDamage >= Base.HP)
+		// A destroyed Base leaves play; the player only loses once the shields are gone too
+		if (Base.IsDestroyed(BaseData))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("UGCGCombatSubsystem::DealDamageToPlayer - Player %d Base destroyed - GAME OVER"),
-				DefendingPlayer->GetPlayerID());
+			UGCGZoneSubsystem* ZoneSubsystem = GetZoneSubsystem();
+			FGCGCardInstance DestroyedBase = Base;
+			if (ZoneSubsystem)
+			{
+				ZoneSubsystem->MoveCard(DestroyedBase, EGCGCardZone::BaseSection,
+					DestroyedBase.bIsToken ? EGCGCardZone::Removal : EGCGCardZone::Trash, DefendingPlayer, GameState, false);
+			}
 
-			DefendingPlayer->bHasLost = true;
-			return true; // Player lost
+			UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::DealDamageToPlayer - Player %d Base %s destroyed"),
+				DefendingPlayer->GetPlayerID(), *DestroyedBase.CardNumber.ToString());
 		}
+		return false;
 	}
 
-	return false;
+	case EGCGPlayerDamageTarget::Shield:
+		OutShieldsBroken = BreakShields(1, DefendingPlayer);
+
+		UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::DealDamageToPlayer - Player %d shields broken: %d (Remaining: %d)"),
+			DefendingPlayer->GetPlayerID(), OutShieldsBroken, DefendingPlayer->GetShieldCount());
+
+		// TODO: Check for Burst keyword on broken shields (Phase 7)
+		return false;
+
+	case EGCGPlayerDamageTarget::Player:
+	default:
+		UE_LOG(LogTemp, Warning, TEXT("UGCGCombatSubsystem::DealDamageToPlayer - Player %d has no Base or shields - GAME OVER"),
+			DefendingPlayer->GetPlayerID());
+
+		DefendingPlayer->bHasLost = true;
+		return true; // Player lost
+	}
 }
 
 // ===== SHIELD SYSTEM =====
@@ -465,20 +444,14 @@ int32 UGCGCombatSubsystem::BreakShields(int32 Count, AGCGPlayerState* DefendingP
 
 	for (int32 i = 0; i < ShieldsToBreak; ++i)
 	{
-		if (DefendingPlayer->ShieldStack.Num() > 0)
+		// Move top shield to trash
+		FGCGCardInstance ShieldCard;
+		if (ZoneSubsystem->MoveTopCard(EGCGCardZone::ShieldStack, EGCGCardZone::Trash, DefendingPlayer, nullptr, ShieldCard, false))
 		{
-			// Take top shield (index 0)
-			FGCGCardInstance ShieldCard = DefendingPlayer->ShieldStack[0];
-			DefendingPlayer->ShieldStack.RemoveAt(0);
-
-			// Move shield to trash
-			ShieldCard.CurrentZone = EGCGCardZone::Trash;
-			DefendingPlayer->Trash.Add(ShieldCard);
-
 			ShieldsBroken++;
 
 			UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::BreakShields - Broke shield: %s (ID: %d)"),
-				*ShieldCard.CardName.ToString(), ShieldCard.InstanceID);
+				*ShieldCard.CardNumber.ToString(), ShieldCard.InstanceID);
 
 			// TODO: Check for Burst keyword (Phase 7)
 		}
@@ -572,26 +545,14 @@ bool UGCGCombatSubsystem::HasSummoningSickness(const FGCGCardInstance& CardInsta
 
 bool UGCGCombatSubsystem::HasKeyword(const FGCGCardInstance& CardInstance, EGCGKeyword Keyword) const
 {
-	for (const FGCGKeywordInstance& KeywordInstance : CardInstance.Keywords)
-	{
-		if (KeywordInstance.Keyword == Keyword)
-		{
-			return true;
-		}
-	}
-	return false;
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	return Catalog && FGCGRules::HasKeyword(*Catalog, CardInstance, Keyword);
 }
 
 int32 UGCGCombatSubsystem::GetKeywordValue(const FGCGCardInstance& CardInstance, EGCGKeyword Keyword) const
 {
-	for (const FGCGKeywordInstance& KeywordInstance : CardInstance.Keywords)
-	{
-		if (KeywordInstance.Keyword == Keyword)
-		{
-			return KeywordInstance.Value;
-		}
-	}
-	return 0;
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	return Catalog ? FGCGRules::GetKeywordValue(*Catalog, CardInstance, Keyword) : 0;
 }
 
 bool UGCGCombatSubsystem::DestroyUnit(int32 TargetInstanceID, AGCGPlayerState* PlayerState)
@@ -625,7 +586,7 @@ bool UGCGCombatSubsystem::DestroyUnit(int32 TargetInstanceID, AGCGPlayerState* P
 		PlayerState, nullptr, false))
 	{
 		UE_LOG(LogTemp, Log, TEXT("UGCGCombatSubsystem::DestroyUnit - %s destroyed and moved to trash"),
-			*UnitInstance.CardName.ToString());
+			*UnitInstance.CardNumber.ToString());
 
 		// TODO: Trigger "On Destroy" effects (Phase 8)
 
@@ -639,3 +600,9 @@ UGCGZoneSubsystem* UGCGCombatSubsystem::GetZoneSubsystem() const
 {
 	return GetGameInstance()->GetSubsystem<UGCGZoneSubsystem>();
 }
+
+const FGCGCardCatalog* UGCGCombatSubsystem::GetMatchCatalog() const
+{
+	AGCGGameModeBase* GameMode = GetWorld() ? GetWorld()->GetAuthGameMode<AGCGGameModeBase>() : nullptr;
+	return GameMode ? GameMode->GetMatchCatalog().Get() : nullptr;
+}
@@ -13,6 +13,7 @@
 class AGCGPlayerState;
 class AGCGGameState;
 class UGCGZoneSubsystem;
+class FGCGCardCatalog;
 
 /**
  * Combat Attack Declaration
@@ -43,6 +44,10 @@ struct FGCGAttackDeclaration
 	UPROPERTY(BlueprintReadWrite)
 	int32 BlockerInstanceID;
 
+	/** Rested enemy Unit attacked directly (0 if attacking the player) */
+	UPROPERTY(BlueprintReadWrite)
+	int32 TargetUnitInstanceID;
+
 	/** Has this attack been resolved? */
 	UPROPERTY(BlueprintReadWrite)
 	bool bResolved;
@@ -53,6 +58,7 @@ struct FGCGAttackDeclaration
 		, DefendingPlayerID(-1)
 		, bTargetingBase(true)
 		, BlockerInstanceID(0)
+		, TargetUnitInstanceID(0)
 		, bResolved(false)
 	{}
 };
@@ -146,15 +152,16 @@ public:
 	 * @param AttackingPlayer The player declaring the attack
 	 * @param DefendingPlayer The defending player
 	 * @param GameState The current game state
+	 * @param TargetUnitInstanceID Rested enemy Unit to attack (0 to attack the player)
 	 * @return Combat result
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	FGCGCombatResult DeclareAttack(int32 AttackerInstanceID,
 		AGCGPlayerState* AttackingPlayer, AGCGPlayerState* DefendingPlayer,
-		AGCGGameState* GameState);
+		AGCGGameState* GameState, int32 TargetUnitInstanceID = 0);
 
 	/**
-	 * Can this unit attack?
+	 * Can this unit attack? (FGCGRules::CanAttack, the rules engine's check)
 	 * @param AttackerInstance The unit to check
 	 * @param AttackingPlayer The player who would attack
 	 * @param GameState The current game state
@@ -179,7 +186,7 @@ public:
 		AGCGPlayerState* DefendingPlayer, AGCGGameState* GameState);
 
 	/**
-	 * Can this unit block the given attack?
+	 * Can this unit block the given attack? (FGCGRules::CanBlock, the rules engine's check)
 	 * @param BlockerInstance The unit to check
 	 * @param Attack The attack to block
 	 * @param DefendingPlayer The defending player
@@ -305,4 +312,10 @@ private:
 	 * Get zone subsystem
 	 */
 	UGCGZoneSubsystem* GetZoneSubsystem() const;
+
+	/**
+	 * Catalog the running match resolves card data from
+	 * @return The match catalog, or nullptr outside a match
+	 */
+	const FGCGCardCatalog* GetMatchCatalog() const;
 };
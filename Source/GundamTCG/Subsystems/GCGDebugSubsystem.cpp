@@ -208,7 +208,7 @@ void UGCGDebugSubsystem::LogCard(const FGCGCardInstance& Card, bool bDetailed)
 			UE_LOG(LogTemp, Log, TEXT("Modifiers: %d"), Card.ActiveModifiers.Num());
 		}
 
-		if (Card.PairedCardInstanceID != -1)
+		if (Card.PairedCardInstanceID != 0)
 		{
 			UE_LOG(LogTemp, Log, TEXT("Paired With: Card ID %d"), Card.PairedCardInstanceID);
 		}
@@ -403,6 +403,7 @@ bool UGCGDebugSubsystem::CheatSpawnCard(int32 PlayerID, FName CardNumber)
 
 	// Add to hand
 	PlayerState->Hand.Add(NewCard);
+	PlayerState->IndexZone(EGCGCardZone::Hand, PlayerState->Hand.Num() - 1);
 
 	UE_LOG(LogTemp, Warning, TEXT("CHEAT: Spawned %s in Player %d's hand"), *CardData->CardName.ToString(), PlayerID);
 	return true;
@@ -468,6 +469,7 @@ bool UGCGDebugSubsystem::CheatAddResources(int32 PlayerID, int32 Count)
 	}
 
 	// Create dummy resource tokens
+	const int32 FirstNewSlot = PlayerState->ResourceArea.Num();
 	for (int32 i = 0; i < Count; i++)
 	{
 		FGCGCardInstance ResourceToken;
@@ -480,6 +482,7 @@ bool UGCGDebugSubsystem::CheatAddResources(int32 PlayerID, int32 Count)
 
 		PlayerState->ResourceArea.Add(ResourceToken);
 	}
+	PlayerState->IndexZone(EGCGCardZone::ResourceArea, FirstNewSlot);
 
 	UE_LOG(LogTemp, Warning, TEXT("CHEAT: Added %d resources to Player %d"), Count, PlayerID);
 	return true;
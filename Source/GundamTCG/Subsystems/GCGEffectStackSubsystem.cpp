@@ -5,6 +5,8 @@
 #include "GundamTCG/GameState/GCGGameState.h"
 #include "GundamTCG/PlayerState/GCGPlayerState.h"
 #include "GundamTCG/Subsystems/GCGEffectSubsystem.h"
+#include "GundamTCG/GameModes/GCGGameModeBase.h"
+#include "GundamTCG/Core/GCGZobrist.h"
 #include "Engine/World.h"
 
 // ===========================================================================================
@@ -18,6 +20,9 @@ void UGCGEffectStackSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	StackIndexCounter = 0;
 	EffectStack.Empty();
 	DuringThisTurnEffects.Empty();
+	OldestTrackedTurn = MAX_int32;
+	UnitSnapshots.Empty();
+	FreeUnitSnapshots.Empty();
 
 	UE_LOG(LogTemp, Log, TEXT("GCGEffectStackSubsystem initialized"));
 }
@@ -26,6 +31,9 @@ void UGCGEffectStackSubsystem::Deinitialize()
 {
 	EffectStack.Empty();
 	DuringThisTurnEffects.Empty();
+	OldestTrackedTurn = MAX_int32;
+	UnitSnapshots.Empty();
+	FreeUnitSnapshots.Empty();
 
 	Super::Deinitialize();
 }
@@ -35,31 +43,39 @@ void UGCGEffectStackSubsystem::Deinitialize()
 // ===========================================================================================
 
 FGCGEffectStackEntry UGCGEffectStackSubsystem::PushEffect(
-	int32 SourceCardInstanceID,
+	const FGCGCardInstance& SourceCard,
 	int32 OwnerPlayerID,
-	const FGCGEffectData& EffectData,
+	int32 EffectIndex,
 	EGCGEffectPriority Priority,
-	const TArray<int32>& AffectedUnits)
+	int32 UnitSnapshot)
 {
+	AGCGGameModeBase* GameMode = GetWorld() ? GetWorld()->GetAuthGameMode<AGCGGameModeBase>() : nullptr;
+	const FGCGCardData* CardData = GameMode ? GameMode->GetCardDataForInstance(SourceCard) : nullptr;
+	if (!CardData || !CardData->Effects.IsValidIndex(EffectIndex))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Effect Stack] Card %s has no effect %d"), *SourceCard.CardNumber.ToString(), EffectIndex);
+		return FGCGEffectStackEntry();
+	}
+
 	FGCGEffectStackEntry Entry;
-	Entry.SourceCardInstanceID = SourceCardInstanceID;
+	Entry.SourceCardInstanceID = SourceCard.InstanceID;
 	Entry.OwnerPlayerID = OwnerPlayerID;
-	Entry.EffectData = EffectData;
+	Entry.CardNumber = CardData->CardNumber;
+	Entry.CardId = GameMode->GetMatchCatalog()->FindCardId(CardData->CardNumber);
+	Entry.EffectIndex = EffectIndex;
+	Entry.Timing = CardData->Effects[EffectIndex].Timing;
 	Entry.Priority = Priority;
 	Entry.StackIndex = StackIndexCounter++;
 	Entry.bResolved = false;
-	Entry.AffectedUnitInstanceIDs = AffectedUnits;
+	Entry.UnitSnapshot = UnitSnapshot;
 	Entry.Timestamp = GetWorld()->GetTimeSeconds();
 
-	// Add to stack
-	EffectStack.Add(Entry);
-
 	// FAQ Q109: New effects interrupt and resolve first
-	// Sort stack to put higher priority effects on top
-	SortStackByPriority();
+	// The heap puts higher priority effects, then newer ones, on top
+	EffectStack.HeapPush(Entry, &UGCGEffectStackSubsystem::CompareEffectPriority);
 
 	UE_LOG(LogTemp, Log, TEXT("[Effect Stack] Pushed effect from source %d (Priority: %d, Stack size: %d)"),
-		SourceCardInstanceID, static_cast<int32>(Priority), EffectStack.Num());
+		Entry.SourceCardInstanceID, static_cast<int32>(Priority), EffectStack.Num());
 
 	return Entry;
 }
@@ -72,9 +88,9 @@ FGCGEffectStackEntry UGCGEffectStackSubsystem::PopEffect()
 		return FGCGEffectStackEntry();
 	}
 
-	// Pop from end of array (top of stack)
-	FGCGEffectStackEntry TopEntry = EffectStack.Last();
-	EffectStack.RemoveAt(EffectStack.Num() - 1);
+	// Pop the heap top (top of stack)
+	FGCGEffectStackEntry TopEntry;
+	EffectStack.HeapPop(TopEntry, &UGCGEffectStackSubsystem::CompareEffectPriority, EAllowShrinking::No);
 
 	UE_LOG(LogTemp, Log, TEXT("[Effect Stack] Popped effect from source %d (Stack size: %d)"),
 		TopEntry.SourceCardInstanceID, EffectStack.Num());
@@ -89,7 +105,7 @@ FGCGEffectStackEntry UGCGEffectStackSubsystem::PeekTopEffect() const
 		return FGCGEffectStackEntry();
 	}
 
-	return EffectStack.Last();
+	return EffectStack.HeapTop();
 }
 
 bool UGCGEffectStackSubsystem::IsStackEmpty() const
@@ -105,6 +121,7 @@ int32 UGCGEffectStackSubsystem::GetStackSize() const
 void UGCGEffectStackSubsystem::ClearStack()
 {
 	EffectStack.Empty();
+	ReleaseUnusedUnitSnapshots();
 	UE_LOG(LogTemp, Log, TEXT("[Effect Stack] Stack cleared"));
 }
 
@@ -136,6 +153,9 @@ bool UGCGEffectStackSubsystem::ResolveStack(AGCGGameState* GameState)
 		}
 	}
 
+	// Snapshots of the resolved effects are only kept if "during this turn" still uses them
+	ReleaseUnusedUnitSnapshots();
+
 	UE_LOG(LogTemp, Log, TEXT("[Effect Stack] Stack resolution complete"));
 	return true;
 }
@@ -167,7 +187,8 @@ bool UGCGEffectStackSubsystem::ResolveSingleEffect(AGCGGameState* GameState)
 	Entry.bResolved = true;
 
 	// FAQ Q106: Track "during this turn" effects
-	if (Entry.EffectData.Description.ToString().Contains(TEXT("during this turn"), ESearchCase::IgnoreCase))
+	const FGCGEffectData* EffectData = GetEffectData(Entry);
+	if (EffectData && EffectData->Description.ToString().Contains(TEXT("during this turn"), ESearchCase::IgnoreCase))
 	{
 		TrackDuringThisTurnEffect(Entry, GameState->TurnNumber);
 	}
@@ -177,24 +198,23 @@ bool UGCGEffectStackSubsystem::ResolveSingleEffect(AGCGGameState* GameState)
 
 void UGCGEffectStackSubsystem::SortStackByPriority()
 {
-	// Sort by priority (higher priority first) then by stack index (lower index first)
+	// Higher priority first, then newer first
 	// FAQ Q110: Burst effects get priority
 	// FAQ Q112: Negation effects get priority
-	EffectStack.Sort(&UGCGEffectStackSubsystem::CompareEffectPriority);
+	EffectStack.Heapify(&UGCGEffectStackSubsystem::CompareEffectPriority);
 }
 
 TMap<int32, TArray<FGCGEffectStackEntry>> UGCGEffectStackSubsystem::GroupEffectsByPlayer(int32 ActivePlayerID)
 {
 	TMap<int32, TArray<FGCGEffectStackEntry>> GroupedEffects;
 
-	for (const FGCGEffectStackEntry& Entry : EffectStack)
+	// Each player's effects in resolution order
+	TArray<int32> Order;
+	GetResolutionOrder(Order);
+	for (const int32 Index : Order)
 	{
-		if (!GroupedEffects.Contains(Entry.OwnerPlayerID))
-		{
-			GroupedEffects.Add(Entry.OwnerPlayerID, TArray<FGCGEffectStackEntry>());
-		}
-
-		GroupedEffects[Entry.OwnerPlayerID].Add(Entry);
+		const FGCGEffectStackEntry& Entry = EffectStack[Index];
+		GroupedEffects.FindOrAdd(Entry.OwnerPlayerID).Add(Entry);
 	}
 
 	// FAQ Q107-Q108: Active player resolves effects first
@@ -281,17 +301,16 @@ bool UGCGEffectStackSubsystem::IsContinuousEffect(const FGCGEffectData& EffectDa
 // SNAPSHOT MANAGEMENT (FAQ Q105)
 // ===========================================================================================
 
-TArray<int32> UGCGEffectStackSubsystem::TakeUnitSnapshot(const FGCGEffectData& EffectData, AGCGGameState* GameState)
+int32 UGCGEffectStackSubsystem::TakeUnitSnapshot(const FGCGEffectData& EffectData, AGCGGameState* GameState)
 {
-	TArray<int32> Snapshot;
-
 	if (!GameState)
 	{
-		return Snapshot;
+		return INDEX_NONE;
 	}
 
 	// FAQ Q105: "All your Units get AP+2" only affects Units in play NOW
 	// Take snapshot of all Units currently in play that would be affected
+	FGCGUnitSnapshot Snapshot;
 
 	for (APlayerState* PS : GameState->PlayerArray)
 	{
@@ -309,12 +328,26 @@ TArray<int32> UGCGEffectStackSubsystem::TakeUnitSnapshot(const FGCGEffectData& E
 
 	UE_LOG(LogTemp, Log, TEXT("[Effect Stack] Took Unit snapshot: %d Units"), Snapshot.Num());
 
-	return Snapshot;
+	// Reuse a released slot; its generation was bumped on release, so old handles stay dead
+	const int32 Slot = FreeUnitSnapshots.Num() > 0 ? FreeUnitSnapshots.Pop(EAllowShrinking::No) : UnitSnapshots.AddDefaulted();
+	if (Slot > UnitSnapshotSlotMask)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[Effect Stack] Too many live Unit snapshots"));
+		UnitSnapshots.Pop(EAllowShrinking::No);
+		return INDEX_NONE;
+	}
+
+	FGCGUnitSnapshot& Stored = UnitSnapshots[Slot];
+	Stored.Words = MoveTemp(Snapshot.Words);
+	Stored.bInUse = true;
+
+	return (Stored.Generation << UnitSnapshotGenerationShift) | Slot;
 }
 
-bool UGCGEffectStackSubsystem::IsUnitInSnapshot(int32 UnitInstanceID, const FGCGEffectStackEntry& EffectEntry)
+bool UGCGEffectStackSubsystem::IsUnitInSnapshot(int32 UnitInstanceID, const FGCGEffectStackEntry& EffectEntry) const
 {
-	return EffectEntry.AffectedUnitInstanceIDs.Contains(UnitInstanceID);
+	const FGCGUnitSnapshot* Snapshot = GetUnitSnapshot(EffectEntry.UnitSnapshot);
+	return Snapshot && Snapshot->Contains(UnitInstanceID);
 }
 
 // ===========================================================================================
@@ -331,27 +364,46 @@ void UGCGEffectStackSubsystem::TrackDuringThisTurnEffect(const FGCGEffectStackEn
 	}
 
 	DuringThisTurnEffects[TurnNumber].Add(EffectEntry);
+	OldestTrackedTurn = FMath::Min(OldestTrackedTurn, TurnNumber);
 
 	UE_LOG(LogTemp, Log, TEXT("[Effect Stack] Tracked 'during this turn' effect for turn %d"), TurnNumber);
 }
 
 void UGCGEffectStackSubsystem::CleanupExpiredTurnEffects(int32 TurnNumber)
 {
-	// Remove effects from turns that have ended
-	TArray<int32> TurnsToRemove;
+	// Remove effects from turns that have ended - one map removal per elapsed turn
+	int32 NumRemoved = 0;
 
-	for (const TPair<int32, TArray<FGCGEffectStackEntry>>& Pair : DuringThisTurnEffects)
+	for (int32 Turn = OldestTrackedTurn; Turn < TurnNumber && DuringThisTurnEffects.Num() > 0; ++Turn)
 	{
-		if (Pair.Key < TurnNumber)
+		if (DuringThisTurnEffects.Remove(Turn) > 0)
 		{
-			TurnsToRemove.Add(Pair.Key);
+			++NumRemoved;
+			UE_LOG(LogTemp, Log, TEXT("[Effect Stack] Cleaned up expired turn %d effects"), Turn);
 		}
 	}
 
-	for (int32 Turn : TurnsToRemove)
+	if (DuringThisTurnEffects.Num() == 0)
+	{
+		OldestTrackedTurn = MAX_int32;
+	}
+	else
 	{
-		DuringThisTurnEffects.Remove(Turn);
-		UE_LOG(LogTemp, Log, TEXT("[Effect Stack] Cleaned up expired turn %d effects"), Turn);
+		OldestTrackedTurn = FMath::Max(OldestTrackedTurn, TurnNumber);
+	}
+
+	if (NumRemoved > 0)
+	{
+		ReleaseUnusedUnitSnapshots();
+	}
+}
+
+void UGCGEffectStackSubsystem::RefreshOldestTrackedTurn()
+{
+	OldestTrackedTurn = MAX_int32;
+	for (const TPair<int32, TArray<FGCGEffectStackEntry>>& Pair : DuringThisTurnEffects)
+	{
+		OldestTrackedTurn = FMath::Min(OldestTrackedTurn, Pair.Key);
 	}
 }
 
@@ -364,11 +416,15 @@ void UGCGEffectStackSubsystem::PrintStack() const
 	UE_LOG(LogTemp, Log, TEXT("========== EFFECT STACK =========="));
 	UE_LOG(LogTemp, Log, TEXT("Stack size: %d"), EffectStack.Num());
 
-	for (int32 i = EffectStack.Num() - 1; i >= 0; i--)
+	// Top of stack (next to resolve) first
+	TArray<int32> Order;
+	GetResolutionOrder(Order);
+	for (int32 i = 0; i < Order.Num(); i++)
 	{
-		const FGCGEffectStackEntry& Entry = EffectStack[i];
-		UE_LOG(LogTemp, Log, TEXT("[%d] Source: %d, Owner: %d, Priority: %d"),
-			i, Entry.SourceCardInstanceID, Entry.OwnerPlayerID, static_cast<int32>(Entry.Priority));
+		const FGCGEffectStackEntry& Entry = EffectStack[Order[i]];
+		UE_LOG(LogTemp, Log, TEXT("[%d] Source: %d (%s effect %d), Owner: %d, Priority: %d"),
+			i, Entry.SourceCardInstanceID, *Entry.CardNumber.ToString(), Entry.EffectIndex, Entry.OwnerPlayerID,
+			static_cast<int32>(Entry.Priority));
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("=================================="));
@@ -376,7 +432,75 @@ void UGCGEffectStackSubsystem::PrintStack() const
 
 TArray<FGCGEffectStackEntry> UGCGEffectStackSubsystem::GetStackAsArray() const
 {
-	return EffectStack;
+	TArray<int32> Order;
+	GetResolutionOrder(Order);
+
+	TArray<FGCGEffectStackEntry> Ordered;
+	Ordered.Reserve(Order.Num());
+	for (const int32 Index : Order)
+	{
+		Ordered.Add(EffectStack[Index]);
+	}
+
+	return Ordered;
+}
+
+// ===========================================================================================
+// STATE HASH
+// ===========================================================================================
+
+namespace
+{
+	uint64 HashEffectEntry(uint64 Hash, const FGCGEffectStackEntry& Entry, const FGCGUnitSnapshot* Units)
+	{
+		Hash = FGCGZobrist::Combine(Hash, (uint64(uint32(Entry.SourceCardInstanceID)) << 32) | uint32(Entry.OwnerPlayerID));
+		Hash = FGCGZobrist::Combine(Hash, (uint64(uint32(Entry.StackIndex)) << 32)
+			| (uint64(static_cast<uint8>(Entry.Priority)) << 16)
+			| (uint64(static_cast<uint8>(Entry.Timing)) << 8)
+			| uint64(Entry.bResolved));
+		Hash = FGCGZobrist::Combine(Hash, (uint64(Entry.CardId) << 32) | uint32(Entry.EffectIndex));
+
+		// The units, not the handle (released slots are reused under a new generation)
+		if (Units)
+		{
+			for (const uint64 Word : Units->Words)
+			{
+				Hash = FGCGZobrist::Combine(Hash, Word);
+			}
+		}
+
+		return Hash;
+	}
+}
+
+uint64 UGCGEffectStackSubsystem::ComputeStateHash() const
+{
+	uint64 Hash = 0;
+
+	// Resolution order follows from each entry's (Priority, StackIndex), so the
+	// entries are hashed as a set and the heap layout doesn't matter
+	if (EffectStack.Num() > 0)
+	{
+		uint64 StackHash = FGCGZobrist::Combine(0x510E527FADE682D1ull, EffectStack.Num());
+		for (const FGCGEffectStackEntry& Entry : EffectStack)
+		{
+			StackHash ^= HashEffectEntry(0x510E527FADE682D1ull, Entry, GetUnitSnapshot(Entry.UnitSnapshot));
+		}
+		Hash ^= StackHash;
+	}
+
+	// One key per turn bucket; TMap iteration order doesn't matter under XOR
+	for (const TPair<int32, TArray<FGCGEffectStackEntry>>& Pair : DuringThisTurnEffects)
+	{
+		uint64 TurnHash = FGCGZobrist::Combine(0x9B05688C2B3E6C1Full, uint32(Pair.Key));
+		for (const FGCGEffectStackEntry& Entry : Pair.Value)
+		{
+			TurnHash = HashEffectEntry(TurnHash, Entry, GetUnitSnapshot(Entry.UnitSnapshot));
+		}
+		Hash ^= TurnHash;
+	}
+
+	return Hash;
 }
 
 // ===========================================================================================
@@ -391,8 +515,89 @@ bool UGCGEffectStackSubsystem::CompareEffectPriority(const FGCGEffectStackEntry&
 		return static_cast<int32>(A.Priority) > static_cast<int32>(B.Priority);
 	}
 
-	// If same priority, sort by stack index (lower index = added earlier = resolves first)
-	return A.StackIndex < B.StackIndex;
+	// If same priority, by stack index (higher index = added later = resolves first, FAQ Q109)
+	return A.StackIndex > B.StackIndex;
+}
+
+void UGCGEffectStackSubsystem::GetResolutionOrder(TArray<int32>& OutOrder) const
+{
+	OutOrder.Reset(EffectStack.Num());
+	for (int32 Index = 0; Index < EffectStack.Num(); ++Index)
+	{
+		OutOrder.Add(Index);
+	}
+
+	OutOrder.Sort([this](int32 A, int32 B)
+	{
+		return CompareEffectPriority(EffectStack[A], EffectStack[B]);
+	});
+}
+
+const FGCGEffectData* UGCGEffectStackSubsystem::GetEffectData(const FGCGEffectStackEntry& EffectEntry) const
+{
+	AGCGGameModeBase* GameMode = GetWorld() ? GetWorld()->GetAuthGameMode<AGCGGameModeBase>() : nullptr;
+	const FGCGCardCatalog* Catalog = GameMode ? GameMode->GetMatchCatalog().Get() : nullptr;
+	const FGCGCardData* CardData = Catalog ? Catalog->GetCard(EffectEntry.CardId) : nullptr;
+	return CardData && CardData->Effects.IsValidIndex(EffectEntry.EffectIndex) ? &CardData->Effects[EffectEntry.EffectIndex] : nullptr;
+}
+
+void UGCGEffectStackSubsystem::ReleaseUnusedUnitSnapshots()
+{
+	if (UnitSnapshots.Num() == 0)
+	{
+		return;
+	}
+
+	// Mark the slots still referenced; handles themselves never change
+	TBitArray<> Referenced(false, UnitSnapshots.Num());
+
+	auto Visit = [this, &Referenced](FGCGEffectStackEntry& Entry)
+	{
+		if (!GetUnitSnapshot(Entry.UnitSnapshot))
+		{
+			Entry.UnitSnapshot = INDEX_NONE;
+			return;
+		}
+
+		Referenced[Entry.UnitSnapshot & UnitSnapshotSlotMask] = true;
+	};
+
+	for (FGCGEffectStackEntry& Entry : EffectStack)
+	{
+		Visit(Entry);
+	}
+	for (TPair<int32, TArray<FGCGEffectStackEntry>>& Pair : DuringThisTurnEffects)
+	{
+		for (FGCGEffectStackEntry& Entry : Pair.Value)
+		{
+			Visit(Entry);
+		}
+	}
+
+	for (int32 Slot = 0; Slot < UnitSnapshots.Num(); ++Slot)
+	{
+		FGCGUnitSnapshot& Snapshot = UnitSnapshots[Slot];
+		if (Snapshot.bInUse && !Referenced[Slot])
+		{
+			// A new generation invalidates every handle to the old occupant (wraps, skipping 0)
+			Snapshot.Words.Reset();
+			Snapshot.bInUse = false;
+			Snapshot.Generation = Snapshot.Generation < MAX_int16 ? Snapshot.Generation + 1 : 1;
+			FreeUnitSnapshots.Add(Slot);
+		}
+	}
+}
+
+void UGCGEffectStackSubsystem::RefreshFreeUnitSnapshots()
+{
+	FreeUnitSnapshots.Reset();
+	for (int32 Slot = UnitSnapshots.Num() - 1; Slot >= 0; --Slot)
+	{
+		if (!UnitSnapshots[Slot].bInUse)
+		{
+			FreeUnitSnapshots.Add(Slot);
+		}
+	}
 }
 
 bool UGCGEffectStackSubsystem::ExecuteEffectInternal(const FGCGEffectStackEntry& EffectEntry, AGCGGameState* GameState)
@@ -404,25 +609,41 @@ bool UGCGEffectStackSubsystem::ExecuteEffectInternal(const FGCGEffectStackEntry&
 
 	// Get effect subsystem
 	UGCGEffectSubsystem* EffectSubsystem = GetGameInstance()->GetSubsystem<UGCGEffectSubsystem>();
-	if (!EffectSubsystem)
+	AGCGGameModeBase* GameMode = GetWorld() ? GetWorld()->GetAuthGameMode<AGCGGameModeBase>() : nullptr;
+	const FGCGCardCatalog* Catalog = GameMode ? GameMode->GetMatchCatalog().Get() : nullptr;
+	if (!EffectSubsystem || !Catalog)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[Effect Stack] EffectSubsystem not found"));
+		UE_LOG(LogTemp, Error, TEXT("[Effect Stack] EffectSubsystem or match catalog not found"));
 		return false;
 	}
 
-	// Execute the effect using the effect subsystem
-	// TODO: This requires the effect subsystem to expose an ExecuteEffect function
-	// For now, log that we would execute
 	UE_LOG(LogTemp, Log, TEXT("[Effect Stack] Executing effect from source %d (Owner: %d)"),
 		EffectEntry.SourceCardInstanceID, EffectEntry.OwnerPlayerID);
 
 	// FAQ Q105: If continuous effect, only affect Units in snapshot
-	if (IsContinuousEffect(EffectEntry.EffectData))
+	const FGCGEffectData* EffectData = GetEffectData(EffectEntry);
+	if (EffectData && IsContinuousEffect(*EffectData))
 	{
+		const FGCGUnitSnapshot* Snapshot = GetUnitSnapshot(EffectEntry.UnitSnapshot);
 		UE_LOG(LogTemp, Log, TEXT("[Effect Stack] Continuous effect: affecting %d Units from snapshot"),
-			EffectEntry.AffectedUnitInstanceIDs.Num());
+			Snapshot ? Snapshot->Num() : 0);
 		// TODO: Filter execution to only affect Units in snapshot
 	}
 
-	return true;
+	// Run the effect's compiled program (rejected effects have none)
+	for (const FGCGCompiledEffect& Effect : Catalog->GetEffects(EffectEntry.CardId))
+	{
+		if (Effect.EffectIndex == EffectEntry.EffectIndex)
+		{
+			FGCGEffectContext Context;
+			Context.SourceCardInstanceID = EffectEntry.SourceCardInstanceID;
+			Context.SourcePlayerID = EffectEntry.OwnerPlayerID;
+			Context.TurnNumber = GameState->TurnNumber;
+
+			AGCGPlayerState* SourcePlayer = EffectSubsystem->GetPlayerByID(EffectEntry.OwnerPlayerID, GameState);
+			return EffectSubsystem->ExecuteProgram(Catalog->GetEffectCode(EffectEntry.CardId, Effect), Context, SourcePlayer, GameState).bSuccess;
+		}
+	}
+
+	return false;
 }
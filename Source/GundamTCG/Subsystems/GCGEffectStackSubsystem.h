@@ -25,6 +25,78 @@ enum class EGCGEffectPriority : uint8
 	Negation        = 30    UMETA(DisplayName = "Negation")         // Negation effects (Q112)
 };
 
+/**
+ * Unit Snapshot (FAQ Q105)
+ * Set of unit instance IDs as a bitset. Instance IDs are handed out densely per
+ * match (from 1), so bit N is instance N and a board fits in a couple of words.
+ */
+USTRUCT(BlueprintType)
+struct FGCGUnitSnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<uint64> Words;
+
+	// Slot bookkeeping (UGCGEffectStackSubsystem): bumped each time the slot is freed,
+	// so a handle naming an older occupant no longer resolves
+	UPROPERTY()
+	int32 Generation = 1;
+
+	UPROPERTY()
+	bool bInUse = false;
+
+	void Add(int32 InstanceID)
+	{
+		check(InstanceID >= 0);
+		const int32 Word = InstanceID >> 6;
+		if (Word >= Words.Num())
+		{
+			Words.SetNumZeroed(Word + 1);
+		}
+		Words[Word] |= uint64(1) << (InstanceID & 63);
+	}
+
+	bool Contains(int32 InstanceID) const
+	{
+		const int32 Word = InstanceID >> 6;
+		return InstanceID >= 0 && Word < Words.Num() && (Words[Word] & (uint64(1) << (InstanceID & 63))) != 0;
+	}
+
+	/** Keep only the units also in Other */
+	void IntersectWith(const FGCGUnitSnapshot& Other)
+	{
+		Words.SetNum(FMath::Min(Words.Num(), Other.Words.Num()));
+		for (int32 i = 0; i < Words.Num(); ++i)
+		{
+			Words[i] &= Other.Words[i];
+		}
+	}
+
+	/** Add every unit in Other */
+	void UnionWith(const FGCGUnitSnapshot& Other)
+	{
+		if (Other.Words.Num() > Words.Num())
+		{
+			Words.SetNumZeroed(Other.Words.Num());
+		}
+		for (int32 i = 0; i < Other.Words.Num(); ++i)
+		{
+			Words[i] |= Other.Words[i];
+		}
+	}
+
+	int32 Num() const
+	{
+		int32 Count = 0;
+		for (const uint64 Word : Words)
+		{
+			Count += FMath::CountBits(Word);
+		}
+		return Count;
+	}
+};
+
 /**
  * Effect Stack Entry
  * Represents a single effect waiting to resolve
@@ -42,9 +114,21 @@ struct FGCGEffectStackEntry
 	UPROPERTY(BlueprintReadOnly, Category = "Effect Stack")
 	int32 OwnerPlayerID;
 
-	// Effect data
+	// Source card definition
 	UPROPERTY(BlueprintReadOnly, Category = "Effect Stack")
-	FGCGEffectData EffectData;
+	FName CardNumber;
+
+	// FGCGCardId of CardNumber in the match catalog
+	UPROPERTY()
+	uint16 CardId;
+
+	// Handle to the effect: index into the source card's FGCGCardData::Effects (not a copy)
+	UPROPERTY(BlueprintReadOnly, Category = "Effect Stack")
+	int32 EffectIndex;
+
+	// Timing of the effect
+	UPROPERTY(BlueprintReadOnly, Category = "Effect Stack")
+	EGCGEffectTiming Timing;
 
 	// Priority level (higher = resolves first)
 	UPROPERTY(BlueprintReadOnly, Category = "Effect Stack")
@@ -59,8 +143,10 @@ struct FGCGEffectStackEntry
 	bool bResolved;
 
 	// Snapshot of Units affected (FAQ Q105: continuous effects only affect Units in play at activation)
+	// Handle from TakeUnitSnapshot (slot + generation), INDEX_NONE if none; entries copied into
+	// "during this turn" share it. Stays valid while any entry refers to it, never renumbered.
 	UPROPERTY(BlueprintReadOnly, Category = "Effect Stack")
-	TArray<int32> AffectedUnitInstanceIDs;
+	int32 UnitSnapshot;
 
 	// Timestamp when added to stack
 	UPROPERTY(BlueprintReadOnly, Category = "Effect Stack")
@@ -71,6 +157,10 @@ struct FGCGEffectStackEntry
 	{
 		SourceCardInstanceID = -1;
 		OwnerPlayerID = -1;
+		CardId = GCG_INVALID_CARD_ID;
+		EffectIndex = INDEX_NONE;
+		Timing = EGCGEffectTiming::None;
+		UnitSnapshot = INDEX_NONE;
 		Priority = EGCGEffectPriority::Normal;
 		StackIndex = 0;
 		bResolved = false;
@@ -89,6 +179,13 @@ struct FGCGEffectStackEntry
  * - Q110: Burst effects get priority
  * - Q111: Effects resolve even if source leaves field
  * - Q112: Negation effects have priority
+ *
+ * Pending effects are a binary heap keyed on (Priority, StackIndex): the
+ * highest priority resolves first and, within a priority, the newest entry
+ * (Q109). Keys are unique, so the order is total and push/pop are O(log n).
+ * Entries hold a handle to the effect (card and effect index in the match
+ * catalog) rather than a copy of its FGCGEffectData. Ordered views
+ * (GetStackAsArray, PrintStack) are built only when asked for.
  */
 UCLASS()
 class GUNDAMTCG_API UGCGEffectStackSubsystem : public UGameInstanceSubsystem
@@ -108,25 +205,25 @@ public:
 	// ===========================================================================================
 
 	/**
-	 * Push effect onto stack
-	 * @param SourceCardInstanceID - Card that triggered the effect
+	 * Push effect onto stack (O(log n))
+	 * @param SourceCard - Card that triggered the effect
 	 * @param OwnerPlayerID - Player who owns the effect
-	 * @param EffectData - Effect data to execute
+	 * @param EffectIndex - Index of the effect in the source card's FGCGCardData::Effects
 	 * @param Priority - Priority level (Normal, Trigger, Burst, Negation)
-	 * @param AffectedUnits - Snapshot of affected Units (for Q105)
-	 * @return Stack entry that was added
+	 * @param UnitSnapshot - Snapshot of affected Units from TakeUnitSnapshot (for Q105)
+	 * @return Stack entry that was added (SourceCardInstanceID -1 if the effect doesn't exist)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Effect Stack")
 	FGCGEffectStackEntry PushEffect(
-		int32 SourceCardInstanceID,
+		const FGCGCardInstance& SourceCard,
 		int32 OwnerPlayerID,
-		const FGCGEffectData& EffectData,
+		int32 EffectIndex,
 		EGCGEffectPriority Priority = EGCGEffectPriority::Normal,
-		const TArray<int32>& AffectedUnits = TArray<int32>()
+		int32 UnitSnapshot = INDEX_NONE
 	);
 
 	/**
-	 * Pop top effect from stack (LIFO: Last In, First Out)
+	 * Pop top effect from stack (highest priority, newest first; O(log n))
 	 * @return Top effect entry, or invalid entry if stack empty
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Effect Stack")
@@ -179,8 +276,8 @@ public:
 	bool ResolveSingleEffect(AGCGGameState* GameState);
 
 	/**
-	 * Sort stack by priority (FAQ Q110, Q112: Burst and Negation get priority)
-	 * Higher priority effects move to top of stack
+	 * Restore heap order (FAQ Q110, Q112: Burst and Negation get priority)
+	 * Push and pop keep the order themselves; only needed after editing entries directly.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Effect Stack")
 	void SortStackByPriority();
@@ -232,19 +329,35 @@ public:
 	 * Continuous effects only affect Units that were in play at activation
 	 * @param EffectData - Effect being activated
 	 * @param GameState - Current game state
-	 * @return Array of affected Unit instance IDs
+	 * @return Snapshot handle for PushEffect; released once no pending or turn entry refers to it
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Effect Stack")
-	TArray<int32> TakeUnitSnapshot(const FGCGEffectData& EffectData, AGCGGameState* GameState);
+	int32 TakeUnitSnapshot(const FGCGEffectData& EffectData, AGCGGameState* GameState);
 
 	/**
-	 * Check if Unit is in snapshot (still valid target)
+	 * Check if Unit is in snapshot (still valid target), O(1)
 	 * @param UnitInstanceID - Unit to check
 	 * @param EffectEntry - Effect entry with snapshot
 	 * @return True if Unit is in snapshot
 	 */
 	UFUNCTION(BlueprintPure, Category = "Effect Stack")
-	static bool IsUnitInSnapshot(int32 UnitInstanceID, const FGCGEffectStackEntry& EffectEntry);
+	bool IsUnitInSnapshot(int32 UnitInstanceID, const FGCGEffectStackEntry& EffectEntry) const;
+
+	/**
+	 * Snapshot behind a handle (C++ only)
+	 * @return The snapshot, or nullptr for INDEX_NONE / a released handle
+	 */
+	const FGCGUnitSnapshot* GetUnitSnapshot(int32 UnitSnapshot) const
+	{
+		if (UnitSnapshot < 0)
+		{
+			return nullptr;
+		}
+
+		const int32 Slot = UnitSnapshot & UnitSnapshotSlotMask;
+		const FGCGUnitSnapshot* Snapshot = UnitSnapshots.IsValidIndex(Slot) ? &UnitSnapshots[Slot] : nullptr;
+		return Snapshot && Snapshot->bInUse && Snapshot->Generation == (UnitSnapshot >> UnitSnapshotGenerationShift) ? Snapshot : nullptr;
+	}
 
 	// ===========================================================================================
 	// DURATION TRACKING (FAQ Q106)
@@ -261,6 +374,7 @@ public:
 
 	/**
 	 * Clean up expired "during this turn" effects
+	 * Removes the turn buckets before TurnNumber, walking up from the oldest tracked turn.
 	 * @param TurnNumber - Current turn number
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Effect Stack")
@@ -277,38 +391,87 @@ public:
 	void PrintStack() const;
 
 	/**
-	 * Get stack as array (for UI display)
+	 * Get stack as array in resolution order (for UI display; sorted on each call)
 	 */
 	UFUNCTION(BlueprintPure, Category = "Effect Stack")
 	TArray<FGCGEffectStackEntry> GetStackAsArray() const;
 
+	// ===========================================================================================
+	// STATE HASH (C++ only)
+	// ===========================================================================================
+
+	/**
+	 * Hash of the pending stack (in order) and the "during this turn" effects,
+	 * to be XORed into the match hash (see FGCGZobrist). Zero when both are empty.
+	 */
+	uint64 ComputeStateHash() const;
+
 private:
+	// Snapshots save and restore the stack with the rest of the match
+	friend struct FGCGMatchSnapshot;
+
 	// ===========================================================================================
 	// INTERNAL DATA
 	// ===========================================================================================
 
-	// Effect stack (LIFO: Last In, First Out)
+	// Effect stack, a binary heap ordered by CompareEffectPriority (top = next to resolve)
 	UPROPERTY()
 	TArray<FGCGEffectStackEntry> EffectStack;
 
 	// Stack index counter (for ordering effects added at same time)
 	int32 StackIndexCounter;
 
+	// Unit snapshot slots referenced by entries (FGCGEffectStackEntry::UnitSnapshot)
+	// Slots are released when no entry refers to them and reused; handles are never renumbered
+	UPROPERTY()
+	TArray<FGCGUnitSnapshot> UnitSnapshots;
+
+	// Released slots in UnitSnapshots, reused by TakeUnitSnapshot
+	TArray<int32> FreeUnitSnapshots;
+
+	// Handle layout: slot in the low bits, slot generation above
+	static constexpr int32 UnitSnapshotGenerationShift = 16;
+	static constexpr int32 UnitSnapshotSlotMask = (1 << UnitSnapshotGenerationShift) - 1;
+
 	// "During this turn" effects that persist (FAQ Q106)
 	// Map: TurnNumber -> Array of effect entries
 	UPROPERTY()
 	TMap<int32, TArray<FGCGEffectStackEntry>> DuringThisTurnEffects;
 
+	// Lowest turn that may still have an entry in DuringThisTurnEffects (MAX_int32 when empty)
+	int32 OldestTrackedTurn = MAX_int32;
+
 	// ===========================================================================================
 	// INTERNAL HELPERS
 	// ===========================================================================================
 
 	/**
-	 * Compare two effect entries for sorting
+	 * Compare two effect entries (heap predicate)
 	 * @return True if A should resolve before B
 	 */
 	static bool CompareEffectPriority(const FGCGEffectStackEntry& A, const FGCGEffectStackEntry& B);
 
+	/**
+	 * Indices into EffectStack in resolution order
+	 * @param OutOrder - Receives the indices
+	 */
+	void GetResolutionOrder(TArray<int32>& OutOrder) const;
+
+	/**
+	 * Effect an entry refers to, looked up in the match catalog
+	 * @return The effect, or nullptr outside a match
+	 */
+	const FGCGEffectData* GetEffectData(const FGCGEffectStackEntry& EffectEntry) const;
+
+	/** Release unit snapshots no pending or turn entry refers to (their handles stop resolving) */
+	void ReleaseUnusedUnitSnapshots();
+
+	/** Recompute FreeUnitSnapshots from the slots (after UnitSnapshots is replaced wholesale) */
+	void RefreshFreeUnitSnapshots();
+
+	/** Recompute OldestTrackedTurn from DuringThisTurnEffects (after it is replaced wholesale) */
+	void RefreshOldestTrackedTurn();
+
 	/**
 	 * Execute effect operation
 	 * @param EffectEntry - Effect to execute
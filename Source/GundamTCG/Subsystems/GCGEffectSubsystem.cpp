@@ -7,6 +7,7 @@
 #include "../PlayerState/GCGPlayerState.h"
 #include "../GameState/GCGGameState.h"
 #include "../GameModes/GCGGameModeBase.h"
+#include "../Core/GCGRules.h"
 
 // ===========================================================================================
 // SUBSYSTEM LIFECYCLE
@@ -20,6 +21,8 @@ void UGCGEffectSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UGCGEffectSubsystem::Deinitialize()
 {
+	ResetTriggers();
+	ResetModifierExpiry();
 	Super::Deinitialize();
 	UE_LOG(LogTemp, Log, TEXT("[GCGEffectSubsystem] Deinitialized"));
 }
@@ -38,34 +41,39 @@ TArray<FGCGEffectResult> UGCGEffectSubsystem::TriggerEffects(EGCGEffectTiming Ti
 		return Results;
 	}
 
-	// Get all players
-	AGCGPlayerState* Player1 = GetPlayerByID(1, GameState);
-	AGCGPlayerState* Player2 = GetPlayerByID(2, GameState);
+	// Usually nobody listens (StartOfTurn, EndOfTurn, WhenUnitDestroyed fire every turn)
+	const TArray<FGCGTriggerListener>& Listeners = TriggerListeners[static_cast<int32>(Timing)];
+	if (Listeners.Num() == 0)
+	{
+		return Results;
+	}
 
-	if (!Player1 || !Player2)
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	if (!Catalog)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[GCGEffectSubsystem] TriggerEffects: Players not found"));
 		return Results;
 	}
 
-	// Check all cards in play for effects with this timing
-	TArray<AGCGPlayerState*> Players = {Player1, Player2};
+	// Snapshot: effects move cards in and out of play, which edits the listener lists
+	TArray<FGCGTriggerListener, TInlineAllocator<16>> Snapshot(Listeners);
+	Results.Reserve(Snapshot.Num());
 
-	for (AGCGPlayerState* Player : Players)
+	for (const FGCGTriggerListener& Listener : Snapshot)
 	{
-		// Check Battle Area
-		for (const FGCGCardInstance& Card : Player->BattleArea)
+		AGCGPlayerState* Player = GetPlayerByID(Listener.PlayerID, GameState);
+		EGCGCardZone Zone = EGCGCardZone::None;
+		if (!Player || !Player->FindCard(Listener.InstanceID, &Zone)
+			|| (Zone != EGCGCardZone::BattleArea && Zone != EGCGCardZone::BaseSection))
 		{
-			TArray<FGCGEffectResult> CardResults = TriggerCardEffects(Card, Timing, Context, Player, GameState);
-			Results.Append(CardResults);
+			continue;
 		}
 
-		// Check Base Section
-		for (const FGCGCardInstance& Card : Player->BaseSection)
-		{
-			TArray<FGCGEffectResult> CardResults = TriggerCardEffects(Card, Timing, Context, Player, GameState);
-			Results.Append(CardResults);
-		}
+		FGCGEffectContext CardContext = Context;
+		CardContext.SourceCardInstanceID = Listener.InstanceID;
+		CardContext.SourcePlayerID = Listener.PlayerID;
+
+		const FGCGCompiledEffect& Effect = Catalog->GetEffects(Listener.CardId)[Listener.EffectIndex];
+		Results.Add(ExecuteProgram(Catalog->GetEffectCode(Listener.CardId, Effect), CardContext, Player, GameState));
 	}
 
 	return Results;
@@ -81,8 +89,15 @@ TArray<FGCGEffectResult> UGCGEffectSubsystem::TriggerCardEffects(const FGCGCardI
 		return Results;
 	}
 
-	// Check all effects on the card
-	for (const FGCGEffectData& Effect : CardInstance.Effects)
+	// Effects were compiled with the catalog the match pinned
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	if (!Catalog)
+	{
+		return Results;
+	}
+
+	const FGCGCardId CardId = CardInstance.CardId != GCG_INVALID_CARD_ID ? CardInstance.CardId : Catalog->FindCardId(CardInstance.CardNumber);
+	for (const FGCGCompiledEffect& Effect : Catalog->GetEffects(CardId))
 	{
 		// Check if effect timing matches
 		if (Effect.Timing != Timing)
@@ -91,7 +106,12 @@ TArray<FGCGEffectResult> UGCGEffectSubsystem::TriggerCardEffects(const FGCGCardI
 		}
 
 		// Execute the effect
-		FGCGEffectResult Result = ExecuteEffect(Effect, Context, SourcePlayer, GameState);
+		FGCGEffectResult Result = ExecuteProgram(Catalog->GetEffectCode(CardId, Effect), Context, SourcePlayer, GameState);
+		if (Result.bSuccess)
+		{
+			LogEffect(TEXT("TriggerCardEffects"), FString::Printf(TEXT("Effect executed: %s"),
+				*Catalog->GetCardView(CardId).GetEffectDescription(Effect.EffectIndex)));
+		}
 		Results.Add(Result);
 	}
 
@@ -106,263 +126,250 @@ FGCGEffectResult UGCGEffectSubsystem::ExecuteEffect(const FGCGEffectData& Effect
 		return FGCGEffectResult(false, FText::FromString(TEXT("Invalid player or game state")));
 	}
 
-	// Check conditions
-	if (!CheckConditions(Effect.Conditions, Context, SourcePlayer, GameState))
-	{
-		return FGCGEffectResult(false, FText::FromString(TEXT("Conditions not met")));
-	}
-
-	// Check costs
-	if (!CanPayCosts(Effect.Costs, Context, SourcePlayer, GameState))
+	TArray<FGCGEffectInstruction> Code;
+	FString Error;
+	if (!FGCGEffectCompiler::Compile(Effect, Code, Error))
 	{
-		return FGCGEffectResult(false, FText::FromString(TEXT("Cannot pay costs")));
+		UE_LOG(LogTemp, Warning, TEXT("[GCGEffectSubsystem] ExecuteEffect: Malformed effect: %s"), *Error);
+		return FGCGEffectResult(false, FText::FromString(Error));
 	}
 
-	// Pay costs
-	if (!PayCosts(Effect.Costs, Context, SourcePlayer, GameState))
+	FGCGEffectResult Result = ExecuteProgram(Code, Context, SourcePlayer, GameState);
+	if (Result.bSuccess)
 	{
-		return FGCGEffectResult(false, FText::FromString(TEXT("Failed to pay costs")));
+		LogEffect(TEXT("ExecuteEffect"), FString::Printf(TEXT("Effect executed: %s"), *Effect.Description.ToString()));
 	}
 
-	// Execute operations
-	FGCGEffectResult Result = ExecuteOperations(Effect.Operations, Context, SourcePlayer, GameState);
-	Result.bSuccess = true;
-
-	LogEffect(TEXT("ExecuteEffect"), FString::Printf(TEXT("Effect executed: %s"), *Effect.Description.ToString()));
-
 	return Result;
 }
 
 // ===========================================================================================
-// EFFECT VALIDATION
+// TRIGGER REGISTRY
 // ===========================================================================================
 
-bool UGCGEffectSubsystem::CheckConditions(const TArray<FGCGEffectCondition>& Conditions, const FGCGEffectContext& Context,
-	AGCGPlayerState* SourcePlayer, AGCGGameState* GameState)
+void UGCGEffectSubsystem::RegisterCard(int32 PlayerID, const FGCGCardInstance& Card)
 {
-	// No conditions = always true
-	if (Conditions.Num() == 0)
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	if (!Catalog)
 	{
-		return true;
+		return;
 	}
 
-	// All conditions must be met
-	for (const FGCGEffectCondition& Condition : Conditions)
+	const FGCGCardId CardId = Card.CardId != GCG_INVALID_CARD_ID ? Card.CardId : Catalog->FindCardId(Card.CardNumber);
+	const TConstArrayView<FGCGCompiledEffect> Effects = Catalog->GetEffects(CardId);
+	for (int32 EffectIndex = 0; EffectIndex < Effects.Num(); ++EffectIndex)
 	{
-		if (!CheckCondition(Condition, Context, SourcePlayer, GameState))
+		if (Effects[EffectIndex].Timing == EGCGEffectTiming::None)
 		{
-			return false;
+			continue;
 		}
-	}
 
-	return true;
+		FGCGTriggerListener& Listener = TriggerListeners[static_cast<int32>(Effects[EffectIndex].Timing)].AddDefaulted_GetRef();
+		Listener.PlayerID = PlayerID;
+		Listener.InstanceID = Card.InstanceID;
+		Listener.CardId = CardId;
+		Listener.EffectIndex = static_cast<uint16>(EffectIndex);
+	}
 }
 
-bool UGCGEffectSubsystem::CheckCondition(const FGCGEffectCondition& Condition, const FGCGEffectContext& Context,
-	AGCGPlayerState* SourcePlayer, AGCGGameState* GameState)
+void UGCGEffectSubsystem::UnregisterCard(int32 PlayerID, const FGCGCardInstance& Card)
 {
-	if (!SourcePlayer || !GameState)
-	{
-		return false;
-	}
-
-	FName ConditionType = Condition.ConditionType;
-
-	// YourTurn - Check if it's the source player's turn
-	if (ConditionType == FName(TEXT("YourTurn")))
-	{
-		return (GameState->ActivePlayerID == Context.SourcePlayerID);
-	}
-
-	// OpponentTurn - Check if it's opponent's turn
-	if (ConditionType == FName(TEXT("OpponentTurn")))
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	if (!Catalog)
 	{
-		return (GameState->ActivePlayerID != Context.SourcePlayerID);
+		return;
 	}
 
-	// HasActiveResources - Check if player has X active resources
-	if (ConditionType == FName(TEXT("HasActiveResources")))
+	// Only the lists the card can be in
+	const FGCGCardId CardId = Card.CardId != GCG_INVALID_CARD_ID ? Card.CardId : Catalog->FindCardId(Card.CardNumber);
+	const uint32 Timings = Catalog->GetEffectTimings(CardId);
+	for (int32 Timing = 0; Timing < GCGNumEffectTimings; ++Timing)
 	{
-		if (Condition.Parameters.Num() > 0)
+		if (Timings & GetEffectTimingBit(static_cast<EGCGEffectTiming>(Timing)))
 		{
-			int32 RequiredResources = FCString::Atoi(*Condition.Parameters[0]);
-			return (SourcePlayer->GetActiveResourceCount() >= RequiredResources);
+			// Stable removal keeps firing order = entry order
+			TriggerListeners[Timing].RemoveAll([PlayerID, &Card](const FGCGTriggerListener& Listener)
+			{
+				return Listener.InstanceID == Card.InstanceID && Listener.PlayerID == PlayerID;
+			});
 		}
 	}
+}
 
-	// TODO Phase 8: Add more condition types as needed
-	// - HasLessHP, HasMoreHP
-	// - UnitInPlay, UnitNotInPlay
-	// - ShieldsRemaining
-	// etc.
-
-	UE_LOG(LogTemp, Warning, TEXT("[GCGEffectSubsystem] Unknown condition type: %s"), *ConditionType.ToString());
-	return false;
+void UGCGEffectSubsystem::ResetTriggers()
+{
+	for (TArray<FGCGTriggerListener>& Listeners : TriggerListeners)
+	{
+		Listeners.Reset();
+	}
 }
 
 // ===========================================================================================
-// EFFECT COSTS
+// EFFECT PROGRAMS
 // ===========================================================================================
 
-bool UGCGEffectSubsystem::CanPayCosts(const TArray<FGCGEffectCost>& Costs, const FGCGEffectContext& Context,
-	AGCGPlayerState* SourcePlayer, AGCGGameState* GameState)
+FGCGEffectResult UGCGEffectSubsystem::ExecuteProgram(TConstArrayView<FGCGEffectInstruction> Code,
+	const FGCGEffectContext& Context, AGCGPlayerState* SourcePlayer, AGCGGameState* GameState)
 {
-	// No costs = always true
-	if (Costs.Num() == 0)
+	if (!SourcePlayer || !GameState)
 	{
-		return true;
+		return FGCGEffectResult(false, FText::FromString(TEXT("Invalid player or game state")));
 	}
 
-	// Check all costs
-	for (const FGCGEffectCost& Cost : Costs)
-	{
-		FName CostType = Cost.CostType;
+	FGCGEffectResult CombinedResult(true);
 
-		// RestResources - Check if enough active resources
-		if (CostType == FName(TEXT("RestResources")))
+	for (const FGCGEffectInstruction& Instruction : Code)
+	{
+		AGCGPlayerState* TargetPlayer = nullptr;
+		int32 TargetCardID = 0;
+		if (Instruction.Target != EGCGEffectTarget::None
+			&& !ResolveTarget(Instruction.Target, Context, SourcePlayer, GameState, TargetPlayer, TargetCardID))
 		{
-			if (SourcePlayer->GetActiveResourceCount() < Cost.Amount)
-			{
-				return false;
-			}
+			UE_LOG(LogTemp, Warning, TEXT("[GCGEffectSubsystem] %s: No target"), FGCGEffectCompiler::GetOpName(Instruction.Op));
+			continue;
 		}
 
-		// RestThisUnit - Check if source card is active
-		else if (CostType == FName(TEXT("RestThisUnit")))
+		FGCGEffectResult OpResult(true);
+
+		switch (Instruction.Op)
 		{
-			FGCGCardInstance CardInstance;
-			EGCGCardZone Zone;
-			if (SourcePlayer->FindCardByInstanceID(Context.SourceCardInstanceID, CardInstance, Zone))
+		// ----- Checks -----
+		case EGCGEffectOp::IfYourTurn:
+			if (GameState->ActivePlayerID != Context.SourcePlayerID)
 			{
-				if (!CardInstance.bIsActive)
-				{
-					return false; // Card already rested
-				}
+				return FGCGEffectResult(false, FText::FromString(TEXT("Conditions not met")));
 			}
-			else
+			break;
+
+		case EGCGEffectOp::IfOpponentTurn:
+			if (GameState->ActivePlayerID == Context.SourcePlayerID)
 			{
-				return false; // Card not found
+				return FGCGEffectResult(false, FText::FromString(TEXT("Conditions not met")));
 			}
-		}
-
-		// TODO Phase 8: Add more cost types as needed
-	}
-
-	return true;
-}
+			break;
 
-bool UGCGEffectSubsystem::PayCosts(const TArray<FGCGEffectCost>& Costs, const FGCGEffectContext& Context,
-	AGCGPlayerState* SourcePlayer, AGCGGameState* GameState)
-{
-	if (!CanPayCosts(Costs, Context, SourcePlayer, GameState))
-	{
-		return false;
-	}
+		case EGCGEffectOp::IfActiveResources:
+			if (SourcePlayer->GetActiveResourceCount() < Instruction.Operand)
+			{
+				return FGCGEffectResult(false, FText::FromString(TEXT("Conditions not met")));
+			}
+			break;
 
-	// Pay all costs
-	for (const FGCGEffectCost& Cost : Costs)
-	{
-		if (!PayCost(Cost, Context, SourcePlayer, GameState))
+		case EGCGEffectOp::IfNotActivatedThisTurn:
 		{
-			return false;
+			const FGCGCardInstance* SourceCard = SourcePlayer->FindCard(Context.SourceCardInstanceID);
+			if (SourceCard && SourceCard->ActivationCountThisTurn > 0)
+			{
+				return FGCGEffectResult(false, FText::FromString(TEXT("Already activated this turn")));
+			}
+			break;
 		}
-	}
 
-	return true;
-}
-
-bool UGCGEffectSubsystem::PayCost(const FGCGEffectCost& Cost, const FGCGEffectContext& Context,
-	AGCGPlayerState* SourcePlayer, AGCGGameState* GameState)
-{
-	if (!SourcePlayer || !GameState)
-	{
-		return false;
-	}
-
-	FName CostType = Cost.CostType;
-
-	// RestResources - Rest X resources
-	if (CostType == FName(TEXT("RestResources")))
-	{
-		int32 Remaining = Cost.Amount;
-		for (FGCGCardInstance& Resource : SourcePlayer->ResourceArea)
-		{
-			if (Remaining <= 0)
+		case EGCGEffectOp::CanPayResources:
+			if (SourcePlayer->GetActiveResourceCount() < Instruction.Operand)
 			{
-				break;
+				return FGCGEffectResult(false, FText::FromString(TEXT("Cannot pay costs")));
 			}
+			break;
 
-			if (Resource.bIsActive)
+		case EGCGEffectOp::CanRestSource:
+		{
+			const FGCGCardInstance* SourceCard = SourcePlayer->FindCardInZone(Context.SourceCardInstanceID, EGCGCardZone::BattleArea);
+			if (!SourceCard || !SourceCard->bIsActive)
 			{
-				Resource.bIsActive = false; // Rest the resource
-				Remaining--;
+				return FGCGEffectResult(false, FText::FromString(TEXT("Cannot pay costs")));
 			}
+			break;
 		}
 
-		return (Remaining == 0);
-	}
-
-	// RestThisUnit - Rest the source card
-	else if (CostType == FName(TEXT("RestThisUnit")))
-	{
-		FGCGCardInstance* CardInstance = nullptr;
-		EGCGCardZone Zone;
-		FGCGCardInstance TempCard;
+		case EGCGEffectOp::CanTrashSource:
+			if (!SourcePlayer->FindCard(Context.SourceCardInstanceID))
+			{
+				return FGCGEffectResult(false, FText::FromString(TEXT("Cannot pay costs")));
+			}
+			break;
 
-		if (SourcePlayer->FindCardByInstanceID(Context.SourceCardInstanceID, TempCard, Zone))
+		// ----- Payments -----
+		case EGCGEffectOp::PayResources:
 		{
-			// Find and rest the card
-			if (Zone == EGCGCardZone::BattleArea)
+			int32 Remaining = Instruction.Operand;
+			for (FGCGCardInstance& Resource : SourcePlayer->ResourceArea)
 			{
-				for (FGCGCardInstance& Card : SourcePlayer->BattleArea)
+				if (Remaining <= 0)
 				{
-					if (Card.InstanceID == Context.SourceCardInstanceID)
-					{
-						Card.bIsActive = false;
-						return true;
-					}
+					break;
+				}
+
+				if (Resource.bIsActive)
+				{
+					Resource.bIsActive = false; // Rest the resource
+					SourcePlayer->RefreshCardHash(Resource);
+					Remaining--;
 				}
 			}
+			break;
 		}
 
-		return false;
-	}
+		case EGCGEffectOp::CountActivation:
+			if (FGCGCardInstance* SourceCard = SourcePlayer->FindCard(Context.SourceCardInstanceID))
+			{
+				++SourceCard->ActivationCountThisTurn;
+				SourcePlayer->RefreshCardHash(*SourceCard);
+			}
+			break;
 
-	// TrashSelf - Move source card to Trash
-	else if (CostType == FName(TEXT("TrashSelf")))
-	{
-		UGCGZoneSubsystem* ZoneSubsystem = GetGameInstance()->GetSubsystem<UGCGZoneSubsystem>();
-		if (!ZoneSubsystem)
-		{
-			return false;
-		}
+		case EGCGEffectOp::RestSource:
+			if (FGCGCardInstance* SourceCard = SourcePlayer->FindCardInZone(Context.SourceCardInstanceID, EGCGCardZone::BattleArea))
+			{
+				SourceCard->bIsActive = false;
+				SourcePlayer->RefreshCardHash(*SourceCard);
+			}
+			break;
 
-		FGCGCardInstance CardInstance;
-		EGCGCardZone Zone;
-		if (SourcePlayer->FindCardByInstanceID(Context.SourceCardInstanceID, CardInstance, Zone))
+		case EGCGEffectOp::TrashSource:
 		{
-			return ZoneSubsystem->MoveCard(CardInstance, Zone, EGCGCardZone::Trash, SourcePlayer, GameState);
+			UGCGZoneSubsystem* ZoneSubsystem = GetGameInstance()->GetSubsystem<UGCGZoneSubsystem>();
+			FGCGCardInstance CardInstance;
+			EGCGCardZone Zone;
+			if (ZoneSubsystem && SourcePlayer->FindCardByInstanceID(Context.SourceCardInstanceID, CardInstance, Zone))
+			{
+				ZoneSubsystem->MoveCard(CardInstance, Zone, EGCGCardZone::Trash, SourcePlayer, GameState);
+			}
+			break;
 		}
 
-		return false;
-	}
+		// ----- Operations -----
+		case EGCGEffectOp::Draw:
+			OpResult = OP_DrawCards(Instruction.Operand, TargetPlayer, GameState);
+			break;
 
-	UE_LOG(LogTemp, Warning, TEXT("[GCGEffectSubsystem] Unknown cost type: %s"), *CostType.ToString());
-	return false;
-}
+		case EGCGEffectOp::DealDamageToPlayer:
+			OpResult = OP_DealDamageToPlayer(Instruction.Operand, TargetPlayer, GameState);
+			break;
 
-// ===========================================================================================
-// EFFECT OPERATIONS
-// ===========================================================================================
+		case EGCGEffectOp::DealDamageToUnit:
+			OpResult = OP_DealDamageToUnit(Instruction.Operand, TargetCardID, TargetPlayer, GameState);
+			break;
 
-FGCGEffectResult UGCGEffectSubsystem::ExecuteOperations(const TArray<FGCGEffectOperation>& Operations,
-	const FGCGEffectContext& Context, AGCGPlayerState* SourcePlayer, AGCGGameState* GameState)
-{
-	FGCGEffectResult CombinedResult(true);
+		case EGCGEffectOp::DestroyUnit:
+			OpResult = OP_DestroyUnit(TargetCardID, TargetPlayer, GameState);
+			break;
 
-	for (const FGCGEffectOperation& Operation : Operations)
-	{
-		FGCGEffectResult OpResult = ExecuteOperation(Operation, Context, SourcePlayer, GameState);
+		case EGCGEffectOp::GiveAP:
+			OpResult = OP_GiveAP(Instruction.Operand, static_cast<EGCGModifierDuration>(Instruction.Arg), TargetCardID, TargetPlayer,
+				Context.SourceCardInstanceID, GameState);
+			break;
+
+		case EGCGEffectOp::GiveHP:
+			OpResult = OP_GiveHP(Instruction.Operand, static_cast<EGCGModifierDuration>(Instruction.Arg), TargetCardID, TargetPlayer,
+				Context.SourceCardInstanceID, GameState);
+			break;
+
+		case EGCGEffectOp::GrantKeyword:
+			OpResult = OP_GrantKeyword(static_cast<EGCGKeyword>(Instruction.Arg), Instruction.Operand, TargetCardID, TargetPlayer,
+				Context.SourceCardInstanceID);
+			break;
+		}
 
 		// Combine results
 		CombinedResult.CardsDrawn += OpResult.CardsDrawn;
@@ -375,116 +382,6 @@ FGCGEffectResult UGCGEffectSubsystem::ExecuteOperations(const TArray<FGCGEffectO
 	return CombinedResult;
 }
 
-FGCGEffectResult UGCGEffectSubsystem::ExecuteOperation(const FGCGEffectOperation& Operation,
-	const FGCGEffectContext& Context, AGCGPlayerState* SourcePlayer, AGCGGameState* GameState)
-{
-	if (!SourcePlayer || !GameState)
-	{
-		return FGCGEffectResult(false, FText::FromString(TEXT("Invalid player or game state")));
-	}
-
-	FName OperationType = Operation.OperationType;
-
-	// Draw - Draw cards
-	if (OperationType == FName(TEXT("Draw")))
-	{
-		AGCGPlayerState* TargetPlayer = nullptr;
-		int32 TargetCardID = 0;
-		if (ResolveTarget(Operation.Target, Context, SourcePlayer, GameState, TargetPlayer, TargetCardID))
-		{
-			return OP_DrawCards(Operation.Amount, TargetPlayer, GameState);
-		}
-	}
-
-	// DealDamageToUnit - Damage a unit
-	else if (OperationType == FName(TEXT("DealDamageToUnit")))
-	{
-		AGCGPlayerState* TargetPlayer = nullptr;
-		int32 TargetCardID = 0;
-		if (ResolveTarget(Operation.Target, Context, SourcePlayer, GameState, TargetPlayer, TargetCardID))
-		{
-			return OP_DealDamageToUnit(Operation.Amount, TargetCardID, TargetPlayer, GameState);
-		}
-	}
-
-	// DealDamageToPlayer - Damage opponent
-	else if (OperationType == FName(TEXT("DealDamageToPlayer")))
-	{
-		AGCGPlayerState* TargetPlayer = nullptr;
-		int32 TargetCardID = 0;
-		if (ResolveTarget(Operation.Target, Context, SourcePlayer, GameState, TargetPlayer, TargetCardID))
-		{
-			return OP_DealDamageToPlayer(Operation.Amount, TargetPlayer, GameState);
-		}
-	}
-
-	// DestroyUnit - Destroy a unit
-	else if (OperationType == FName(TEXT("DestroyUnit")))
-	{
-		AGCGPlayerState* TargetPlayer = nullptr;
-		int32 TargetCardID = 0;
-		if (ResolveTarget(Operation.Target, Context, SourcePlayer, GameState, TargetPlayer, TargetCardID))
-		{
-			return OP_DestroyUnit(TargetCardID, TargetPlayer, GameState);
-		}
-	}
-
-	// GiveAP - Grant AP buff
-	else if (OperationType == FName(TEXT("GiveAP")))
-	{
-		AGCGPlayerState* TargetPlayer = nullptr;
-		int32 TargetCardID = 0;
-		if (ResolveTarget(Operation.Target, Context, SourcePlayer, GameState, TargetPlayer, TargetCardID))
-		{
-			return OP_GiveAP(Operation.Amount, Operation.Duration, TargetCardID, TargetPlayer,
-				Context.SourceCardInstanceID, GameState);
-		}
-	}
-
-	// GiveHP - Grant HP buff
-	else if (OperationType == FName(TEXT("GiveHP")))
-	{
-		AGCGPlayerState* TargetPlayer = nullptr;
-		int32 TargetCardID = 0;
-		if (ResolveTarget(Operation.Target, Context, SourcePlayer, GameState, TargetPlayer, TargetCardID))
-		{
-			return OP_GiveHP(Operation.Amount, Operation.Duration, TargetCardID, TargetPlayer,
-				Context.SourceCardInstanceID, GameState);
-		}
-	}
-
-	// GrantKeyword - Grant keyword to card
-	else if (OperationType == FName(TEXT("GrantKeyword")))
-	{
-		// Parse keyword from parameters
-		if (Operation.Parameters.Num() > 0)
-		{
-			FString KeywordName = Operation.Parameters[0];
-			EGCGKeyword Keyword = EGCGKeyword::None;
-
-			// Convert string to keyword enum
-			if (KeywordName == TEXT("Blocker")) Keyword = EGCGKeyword::Blocker;
-			else if (KeywordName == TEXT("FirstStrike")) Keyword = EGCGKeyword::FirstStrike;
-			else if (KeywordName == TEXT("Repair")) Keyword = EGCGKeyword::Repair;
-			// TODO: Add more keywords
-
-			if (Keyword != EGCGKeyword::None)
-			{
-				AGCGPlayerState* TargetPlayer = nullptr;
-				int32 TargetCardID = 0;
-				if (ResolveTarget(Operation.Target, Context, SourcePlayer, GameState, TargetPlayer, TargetCardID))
-				{
-					return OP_GrantKeyword(Keyword, Operation.Amount, TargetCardID, TargetPlayer,
-						Context.SourceCardInstanceID);
-				}
-			}
-		}
-	}
-
-	UE_LOG(LogTemp, Warning, TEXT("[GCGEffectSubsystem] Unknown operation type: %s"), *OperationType.ToString());
-	return FGCGEffectResult(false, FText::FromString(TEXT("Unknown operation type")));
-}
-
 // ===========================================================================================
 // SPECIFIC OPERATIONS
 // ===========================================================================================
@@ -518,8 +415,8 @@ FGCGEffectResult UGCGEffectSubsystem::OP_DrawCards(int32 Amount, AGCGPlayerState
 			break;
 		}
 
-		FGCGCardInstance DrawnCard = ZoneSubsystem->DrawTopCard(TargetPlayer);
-		if (DrawnCard.InstanceID != 0)
+		FGCGCardInstance DrawnCard;
+		if (ZoneSubsystem->MoveTopCard(EGCGCardZone::Deck, EGCGCardZone::Hand, TargetPlayer, nullptr, DrawnCard, false))
 		{
 			Result.CardsDrawn++;
 			Result.AffectedCardIDs.Add(DrawnCard.InstanceID);
@@ -544,32 +441,34 @@ FGCGEffectResult UGCGEffectSubsystem::OP_DealDamageToUnit(int32 Amount, int32 Ta
 	}
 
 	// Find unit in Battle Area
-	for (FGCGCardInstance& Unit : TargetPlayer->BattleArea)
+	FGCGCardInstance* Unit = TargetPlayer->FindCardInZone(TargetInstanceID, EGCGCardZone::BattleArea);
+	if (!Unit)
 	{
-		if (Unit.InstanceID == TargetInstanceID)
-		{
-			Unit.CurrentDamage += Amount;
-			Result.DamageDealt = Amount;
-			Result.AffectedCardIDs.Add(TargetInstanceID);
+		Result.bSuccess = false;
+		return Result;
+	}
+
+	Unit->DamageCounters += Amount;
+	Result.DamageDealt = Amount;
+	Result.AffectedCardIDs.Add(TargetInstanceID);
 
-			// FAQ Q97-99: Track damage source (effect damage vs battle damage)
-			Unit.LastDamageSource = EGCGDamageSource::EffectDamage;
+	// FAQ Q97-99: Track damage source (effect damage vs battle damage)
+	Unit->LastDamageSource = EGCGDamageSource::EffectDamage;
+	TargetPlayer->RefreshCardHash(*Unit);
 
-			LogEffect(TEXT("DealDamageToUnit"), FString::Printf(TEXT("Dealt %d damage to %s (%d/%d HP)"),
-				Amount, *Unit.CardName.ToString(), Unit.CurrentDamage, Unit.HP));
+	AGCGGameModeBase* GameMode = GetWorld() ? GetWorld()->GetAuthGameMode<AGCGGameModeBase>() : nullptr;
+	const FGCGCardData* UnitData = GameMode ? GameMode->GetCardDataForInstance(*Unit) : nullptr;
 
-			// Check if unit destroyed
-			if (Unit.IsDestroyed())
-			{
-				Result.UnitsDestroyed = 1;
-				// TODO: Actually destroy the unit (move to Trash)
-			}
+	LogEffect(TEXT("DealDamageToUnit"), FString::Printf(TEXT("Dealt %d damage to %s (%d/%d HP)"),
+		Amount, *Unit->CardNumber.ToString(), Unit->DamageCounters, Unit->GetTotalHP(UnitData)));
 
-			return Result;
-		}
+	// Check if unit destroyed
+	if (Unit->IsDestroyed(UnitData))
+	{
+		Result.UnitsDestroyed = 1;
+		// TODO: Actually destroy the unit (move to Trash)
 	}
 
-	Result.bSuccess = false;
 	return Result;
 }
 
@@ -657,25 +556,16 @@ FGCGEffectResult UGCGEffectSubsystem::OP_GiveAP(int32 Amount, EGCGModifierDurati
 	}
 
 	// Find target card
-	FGCGCardInstance* TargetCard = nullptr;
-
-	for (FGCGCardInstance& Card : TargetPlayer->BattleArea)
-	{
-		if (Card.InstanceID == TargetInstanceID)
-		{
-			TargetCard = &Card;
-			break;
-		}
-	}
+	FGCGCardInstance* TargetCard = TargetPlayer->FindCardInZone(TargetInstanceID, EGCGCardZone::BattleArea);
 
 	if (TargetCard)
 	{
-		AddModifier(*TargetCard, FName(TEXT("AP")), Amount, Duration, SourceInstanceID, GameState);
+		AddModifier(*TargetCard, EGCGModifierType::AP, Amount, Duration, SourceInstanceID, GameState);
 		Result.APGranted = Amount;
 		Result.AffectedCardIDs.Add(TargetInstanceID);
 
 		LogEffect(TEXT("GiveAP"), FString::Printf(TEXT("Granted +%d AP to %s"),
-			Amount, *TargetCard->CardName.ToString()));
+			Amount, *TargetCard->CardNumber.ToString()));
 
 		return Result;
 	}
@@ -696,24 +586,15 @@ FGCGEffectResult UGCGEffectSubsystem::OP_GiveHP(int32 Amount, EGCGModifierDurati
 	}
 
 	// Find target card
-	FGCGCardInstance* TargetCard = nullptr;
-
-	for (FGCGCardInstance& Card : TargetPlayer->BattleArea)
-	{
-		if (Card.InstanceID == TargetInstanceID)
-		{
-			TargetCard = &Card;
-			break;
-		}
-	}
+	FGCGCardInstance* TargetCard = TargetPlayer->FindCardInZone(TargetInstanceID, EGCGCardZone::BattleArea);
 
 	if (TargetCard)
 	{
-		AddModifier(*TargetCard, FName(TEXT("HP")), Amount, Duration, SourceInstanceID, GameState);
+		AddModifier(*TargetCard, EGCGModifierType::HP, Amount, Duration, SourceInstanceID, GameState);
 		Result.AffectedCardIDs.Add(TargetInstanceID);
 
 		LogEffect(TEXT("GiveHP"), FString::Printf(TEXT("Granted +%d HP to %s"),
-			Amount, *TargetCard->CardName.ToString()));
+			Amount, *TargetCard->CardNumber.ToString()));
 
 		return Result;
 	}
@@ -734,26 +615,24 @@ FGCGEffectResult UGCGEffectSubsystem::OP_GrantKeyword(EGCGKeyword Keyword, int32
 	}
 
 	// Find target card
-	FGCGCardInstance* TargetCard = nullptr;
-
-	for (FGCGCardInstance& Card : TargetPlayer->BattleArea)
-	{
-		if (Card.InstanceID == TargetInstanceID)
-		{
-			TargetCard = &Card;
-			break;
-		}
-	}
+	FGCGCardInstance* TargetCard = TargetPlayer->FindCardInZone(TargetInstanceID, EGCGCardZone::BattleArea);
 
 	if (TargetCard)
 	{
 		// Add keyword
 		FGCGKeywordInstance NewKeyword(Keyword, Value, SourceInstanceID);
-		TargetCard->TemporaryKeywords.Add(NewKeyword);
+		TargetCard->AddTemporaryKeyword(NewKeyword);
+		TargetPlayer->RefreshCardHash(*TargetCard);
+
+		// Temporary keywords last until end of turn
+		if (const AGCGGameState* GameState = TargetPlayer->GetWorld() ? TargetPlayer->GetWorld()->GetGameState<AGCGGameState>() : nullptr)
+		{
+			ModifierExpiry.Add(TargetInstanceID, GameState->TurnNumber, EGCGExpiryPoint::EndOfTurn);
+		}
 		Result.AffectedCardIDs.Add(TargetInstanceID);
 
 		LogEffect(TEXT("GrantKeyword"), FString::Printf(TEXT("Granted keyword to %s"),
-			*TargetCard->CardName.ToString()));
+			*TargetCard->CardNumber.ToString()));
 
 		return Result;
 	}
@@ -766,7 +645,7 @@ FGCGEffectResult UGCGEffectSubsystem::OP_GrantKeyword(EGCGKeyword Keyword, int32
 // MODIFIER MANAGEMENT
 // ===========================================================================================
 
-void UGCGEffectSubsystem::AddModifier(FGCGCardInstance& Card, FName ModifierType, int32 Amount,
+void UGCGEffectSubsystem::AddModifier(FGCGCardInstance& Card, EGCGModifierType ModifierType, int32 Amount,
 	EGCGModifierDuration Duration, int32 SourceInstanceID, AGCGGameState* GameState)
 {
 	if (!GameState)
@@ -774,25 +653,35 @@ void UGCGEffectSubsystem::AddModifier(FGCGCardInstance& Card, FName ModifierType
 		return;
 	}
 
-	FGCGActiveModifier Modifier;
-	Modifier.ModifierType = ModifierType;
-	Modifier.Amount = Amount;
-	Modifier.Duration = Duration;
-	Modifier.SourceInstanceID = SourceInstanceID;
-	Modifier.CreatedOnTurn = GameState->TurnNumber;
+	FGCGRules::AddModifier(Card, ModifierType, Amount, Duration, SourceInstanceID, GameState->TurnNumber);
+
+	if (Duration == EGCGModifierDuration::UntilEndOfTurn)
+	{
+		ModifierExpiry.Add(Card.InstanceID, GameState->TurnNumber, EGCGExpiryPoint::EndOfTurn);
+	}
+	else if (Duration == EGCGModifierDuration::UntilEndOfBattle)
+	{
+		ModifierExpiry.Add(Card.InstanceID, GameState->TurnNumber, EGCGExpiryPoint::EndOfBattle);
+	}
 
-	Card.ActiveModifiers.Add(Modifier);
+	RefreshModifiedCard(Card, GameState);
 
 	UE_LOG(LogTemp, Log, TEXT("[GCGEffectSubsystem] Added modifier: %s +%d to card %s (Duration: %d)"),
-		*ModifierType.ToString(), Amount, *Card.CardName.ToString(), (int32)Duration);
+		*UEnum::GetDisplayValueAsText(ModifierType).ToString(), Amount, *Card.CardNumber.ToString(), (int32)Duration);
 }
 
 void UGCGEffectSubsystem::RemoveModifiersBySource(FGCGCardInstance& Card, int32 SourceInstanceID)
 {
-	Card.ActiveModifiers.RemoveAll([SourceInstanceID](const FGCGActiveModifier& Modifier)
+	const int32 NumRemoved = Card.ActiveModifiers.RemoveAll([SourceInstanceID](const FGCGActiveModifier& Modifier)
 	{
 		return Modifier.SourceInstanceID == SourceInstanceID;
 	});
+
+	if (NumRemoved > 0)
+	{
+		Card.RefreshModifierTotals();
+		RefreshModifiedCard(Card, nullptr);
+	}
 }
 
 void UGCGEffectSubsystem::CleanupExpiredModifiers(FGCGCardInstance& Card, AGCGGameState* GameState,
@@ -803,28 +692,7 @@ void UGCGEffectSubsystem::CleanupExpiredModifiers(FGCGCardInstance& Card, AGCGGa
 		return;
 	}
 
-	Card.ActiveModifiers.RemoveAll([bEndOfTurn, bEndOfBattle, GameState](const FGCGActiveModifier& Modifier)
-	{
-		// Remove instant modifiers (shouldn't be in array anyway)
-		if (Modifier.Duration == EGCGModifierDuration::Instant)
-		{
-			return true;
-		}
-
-		// Remove end of turn modifiers
-		if (bEndOfTurn && Modifier.Duration == EGCGModifierDuration::UntilEndOfTurn)
-		{
-			return true;
-		}
-
-		// Remove end of battle modifiers
-		if (bEndOfBattle && Modifier.Duration == EGCGModifierDuration::UntilEndOfBattle)
-		{
-			return true;
-		}
-
-		return false;
-	});
+	FGCGRules::CleanupExpiredModifiers(Card, bEndOfTurn, bEndOfBattle);
 }
 
 void UGCGEffectSubsystem::CleanupAllModifiers(AGCGPlayerState* PlayerState, AGCGGameState* GameState,
@@ -852,15 +720,110 @@ void UGCGEffectSubsystem::CleanupAllModifiers(AGCGPlayerState* PlayerState, AGCG
 	{
 		for (FGCGCardInstance& Card : PlayerState->BattleArea)
 		{
-			Card.TemporaryKeywords.Empty();
+			Card.ClearTemporaryKeywords();
+		}
+	}
+
+	// Modifiers and keywords are part of each card's state hash
+	for (const FGCGCardInstance& Card : PlayerState->BattleArea)
+	{
+		PlayerState->RefreshCardHash(Card);
+	}
+	for (const FGCGCardInstance& Card : PlayerState->BaseSection)
+	{
+		PlayerState->RefreshCardHash(Card);
+	}
+}
+
+int32 UGCGEffectSubsystem::ExpireModifiers(AGCGGameState* GameState, bool bEndOfTurn, bool bEndOfBattle)
+{
+	if (!GameState)
+	{
+		return 0;
+	}
+
+	TArray<int32> DueInstanceIDs;
+	if (bEndOfBattle)
+	{
+		ModifierExpiry.PopDue(GameState->TurnNumber, EGCGExpiryPoint::EndOfBattle, DueInstanceIDs);
+	}
+	if (bEndOfTurn)
+	{
+		ModifierExpiry.PopDue(GameState->TurnNumber, EGCGExpiryPoint::EndOfTurn, DueInstanceIDs);
+	}
+
+	if (DueInstanceIDs.Num() == 0)
+	{
+		return 0;
+	}
+
+	// Instance IDs are unique per match, so the first player holding the card owns it
+	TArray<AGCGPlayerState*, TInlineAllocator<4>> Players;
+	for (APlayerState* PS : GameState->PlayerArray)
+	{
+		if (AGCGPlayerState* PlayerState = Cast<AGCGPlayerState>(PS))
+		{
+			Players.Add(PlayerState);
+		}
+	}
+
+	for (const int32 InstanceID : DueInstanceIDs)
+	{
+		for (AGCGPlayerState* PlayerState : Players)
+		{
+			FGCGCardInstance* Card = PlayerState->FindCard(InstanceID);
+			if (!Card)
+			{
+				continue;
+			}
+
+			CleanupExpiredModifiers(*Card, GameState, bEndOfTurn, bEndOfBattle);
+			if (bEndOfTurn)
+			{
+				Card->ClearTemporaryKeywords();
+			}
+
+			// Modifiers and keywords are part of the card's state hash
+			PlayerState->RefreshCardHash(*Card);
+			break;
 		}
 	}
+
+	return DueInstanceIDs.Num();
 }
 
 // ===========================================================================================
 // UTILITY
 // ===========================================================================================
 
+void UGCGEffectSubsystem::RefreshModifiedCard(const FGCGCardInstance& Card, const AGCGGameState* GameState) const
+{
+	if (!GameState)
+	{
+		GameState = GetWorld() ? GetWorld()->GetGameState<AGCGGameState>() : nullptr;
+	}
+	if (!GameState)
+	{
+		return;
+	}
+
+	// Instance IDs are unique per match, so the first player holding the card owns it
+	for (APlayerState* PS : GameState->PlayerArray)
+	{
+		AGCGPlayerState* PlayerState = Cast<AGCGPlayerState>(PS);
+		const FGCGCardInstance* Held = PlayerState ? PlayerState->FindCard(Card.InstanceID) : nullptr;
+		if (Held)
+		{
+			// Only the card in the zone is hashed; a modified copy changes nothing
+			if (Held == &Card)
+			{
+				PlayerState->RefreshCardHash(Card);
+			}
+			return;
+		}
+	}
+}
+
 AGCGPlayerState* UGCGEffectSubsystem::GetPlayerByID(int32 PlayerID, AGCGGameState* GameState)
 {
 	if (!GameState)
@@ -886,8 +849,20 @@ AGCGPlayerState* UGCGEffectSubsystem::GetPlayerByID(int32 PlayerID, AGCGGameStat
 
 AGCGPlayerState* UGCGEffectSubsystem::GetOpponentPlayer(int32 CurrentPlayerID, AGCGGameState* GameState)
 {
-	int32 OpponentID = (CurrentPlayerID == 1) ? 2 : 1;
-	return GetPlayerByID(OpponentID, GameState);
+	if (!GameState)
+	{
+		return nullptr;
+	}
+
+	for (APlayerState* PS : GameState->PlayerArray)
+	{
+		AGCGPlayerState* Player = Cast<AGCGPlayerState>(PS);
+		if (Player && Player->GetPlayerID() != CurrentPlayerID)
+		{
+			return Player;
+		}
+	}
+	return nullptr;
 }
 
 void UGCGEffectSubsystem::LogEffect(const FString& EffectName, const FString& Message) const
@@ -899,67 +874,115 @@ void UGCGEffectSubsystem::LogEffect(const FString& EffectName, const FString& Me
 // INTERNAL HELPERS
 // ===========================================================================================
 
-bool UGCGEffectSubsystem::ResolveTarget(FName TargetName, const FGCGEffectContext& Context, AGCGPlayerState* SourcePlayer,
+bool UGCGEffectSubsystem::ResolveTarget(EGCGEffectTarget Target, const FGCGEffectContext& Context, AGCGPlayerState* SourcePlayer,
 	AGCGGameState* GameState, AGCGPlayerState*& OutPlayerState, int32& OutCardInstanceID)
 {
 	OutPlayerState = nullptr;
 	OutCardInstanceID = 0;
 
-	// Self - Source card
-	if (TargetName == FName(TEXT("Self")))
+	// TODO Phase 8: Add more target types
+	// - AllFriendlyUnits
+	// - AllEnemyUnits
+	// - RandomUnit
+	// etc.
+	switch (Target)
 	{
+	// Self - Source card
+	case EGCGEffectTarget::Self:
 		OutPlayerState = SourcePlayer;
 		OutCardInstanceID = Context.SourceCardInstanceID;
 		return true;
-	}
 
 	// SourcePlayer - Source player
-	if (TargetName == FName(TEXT("SourcePlayer")))
-	{
+	case EGCGEffectTarget::SourcePlayer:
 		OutPlayerState = SourcePlayer;
 		return true;
-	}
 
 	// OpponentPlayer - Opponent player
-	if (TargetName == FName(TEXT("OpponentPlayer")))
-	{
+	case EGCGEffectTarget::OpponentPlayer:
 		OutPlayerState = GetOpponentPlayer(Context.SourcePlayerID, GameState);
 		return (OutPlayerState != nullptr);
-	}
 
-	// TargetUnit - Specified target
-	if (TargetName == FName(TEXT("TargetUnit")))
+	// EnemyUnit / FriendlyUnit - Specified target, else the best enemy / friendly unit
+	// (same choice as FGCGRulesEngine::ChooseEffectTarget)
+	case EGCGEffectTarget::EnemyUnit:
+	case EGCGEffectTarget::FriendlyUnit:
 	{
+		const bool bEnemy = (Target == EGCGEffectTarget::EnemyUnit);
 		if (Context.TargetCardInstanceID != 0)
 		{
-			// Find which player owns the target
-			AGCGPlayerState* Player1 = GetPlayerByID(1, GameState);
-			AGCGPlayerState* Player2 = GetPlayerByID(2, GameState);
+			// Find which player owns the target; it must be on the side the effect names
+			for (APlayerState* PS : GameState->PlayerArray)
+			{
+				AGCGPlayerState* Player = Cast<AGCGPlayerState>(PS);
+				if (Player && Player->FindCard(Context.TargetCardInstanceID))
+				{
+					if ((Player->GetPlayerID() != Context.SourcePlayerID) != bEnemy)
+					{
+						return false;
+					}
+					OutPlayerState = Player;
+					OutCardInstanceID = Context.TargetCardInstanceID;
+					return true;
+				}
+			}
+			return false;
+		}
 
-			FGCGCardInstance TempCard;
-			EGCGCardZone Zone;
+		OutCardInstanceID = ChooseEffectTarget(Context.SourcePlayerID, GameState, bEnemy, OutPlayerState);
+		return OutCardInstanceID != 0;
+	}
 
-			if (Player1 && Player1->FindCardByInstanceID(Context.TargetCardInstanceID, TempCard, Zone))
+	default:
+		return false;
+	}
+}
+
+int32 UGCGEffectSubsystem::ChooseEffectTarget(int32 SourcePlayerID, AGCGGameState* GameState, bool bEnemy,
+	AGCGPlayerState*& OutPlayerState) const
+{
+	OutPlayerState = nullptr;
+
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	if (!Catalog || !GameState)
+	{
+		return 0;
+	}
+
+	// Highest AP: the biggest threat to remove, or the best attacker to buff
+	int32 BestInstanceID = 0;
+	int32 BestAP = MIN_int32;
+	for (APlayerState* PS : GameState->PlayerArray)
+	{
+		AGCGPlayerState* Player = Cast<AGCGPlayerState>(PS);
+		if (!Player || (Player->GetPlayerID() != SourcePlayerID) != bEnemy)
+		{
+			continue;
+		}
+
+		for (const FGCGCardInstance& Card : Player->BattleArea)
+		{
+			const FGCGCardView CardView = FGCGRules::GetCardView(*Catalog, Card);
+			if (!CardView || CardView.GetCardType() != EGCGCardType::Unit)
 			{
-				OutPlayerState = Player1;
-				OutCardInstanceID = Context.TargetCardInstanceID;
-				return true;
+				continue;
 			}
 
-			if (Player2 && Player2->FindCardByInstanceID(Context.TargetCardInstanceID, TempCard, Zone))
+			const int32 AP = FGCGRules::GetTotalAP(*Catalog, Card);
+			if (AP > BestAP)
 			{
-				OutPlayerState = Player2;
-				OutCardInstanceID = Context.TargetCardInstanceID;
-				return true;
+				BestAP = AP;
+				BestInstanceID = Card.InstanceID;
+				OutPlayerState = Player;
 			}
 		}
 	}
 
-	// TODO Phase 8: Add more target types
-	// - AllFriendlyUnits
-	// - AllEnemyUnits
-	// - RandomUnit
-	// etc.
+	return BestInstanceID;
+}
 
-	return false;
+const FGCGCardCatalog* UGCGEffectSubsystem::GetMatchCatalog() const
+{
+	AGCGGameModeBase* GameMode = GetWorld() ? GetWorld()->GetAuthGameMode<AGCGGameModeBase>() : nullptr;
+	return GameMode ? GameMode->GetMatchCatalog().Get() : nullptr;
 }
@@ -6,11 +6,15 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "OnePieceTCG_V2/GCGTypes.h"
+#include "GundamTCG/Cards/GCGEffectProgram.h"
+#include "GundamTCG/Core/GCGExpiryQueue.h"
+#include "Containers/StaticArray.h"
 #include "GCGEffectSubsystem.generated.h"
 
 // Forward declarations
 class AGCGPlayerState;
 class AGCGGameState;
+class FGCGCardCatalog;
 
 /**
  * Effect Execution Result
@@ -90,6 +94,20 @@ struct FGCGEffectContext
 	TMap<FName, int32> AdditionalData;
 };
 
+/**
+ * Trigger Listener
+ * One compiled effect of a card in play, registered under its timing
+ */
+struct FGCGTriggerListener
+{
+	int32 PlayerID = 0;
+	int32 InstanceID = 0;
+	FGCGCardId CardId = GCG_INVALID_CARD_ID;
+
+	/** Index into the card's FGCGCardCatalog::GetEffects */
+	uint16 EffectIndex = 0;
+};
+
 /**
  * UGCGEffectSubsystem
  *
@@ -97,9 +115,7 @@ struct FGCGEffectContext
  *
  * Responsibilities:
  * - Trigger effects at the right timing (OnDeploy, OnAttack, Burst, etc.)
- * - Validate effect conditions
- * - Pay effect costs
- * - Execute effect operations (Draw, Damage, Buff, etc.)
+ * - Run compiled effect programs: conditions, costs, then operations (Draw, Damage, Buff, etc.)
  * - Manage active modifiers (AP/HP buffs with durations)
  * - Clean up expired modifiers
  *
@@ -125,6 +141,8 @@ public:
 
 	/**
 	 * Trigger all effects with a specific timing
+	 * Visits only the cards registered for the timing (see RegisterCard); each runs with
+	 * its own SourceCardInstanceID and SourcePlayerID, the rest of Context is shared.
 	 * @param Timing - Effect timing to trigger
 	 * @param Context - Effect context (source, target, etc.)
 	 * @param GameState - Current game state
@@ -148,6 +166,8 @@ public:
 
 	/**
 	 * Execute a single effect
+	 * Compiles the effect first (FGCGEffectCompiler); card effects use the programs
+	 * compiled with the match catalog instead, see TriggerCardEffects.
 	 * @param Effect - Effect data to execute
 	 * @param Context - Effect context
 	 * @param SourcePlayer - Player who owns the source card
@@ -159,99 +179,45 @@ public:
 		AGCGPlayerState* SourcePlayer, AGCGGameState* GameState);
 
 	// ===========================================================================================
-	// EFFECT VALIDATION
+	// TRIGGER REGISTRY
 	// ===========================================================================================
 
 	/**
-	 * Check if all conditions for an effect are met
-	 * @param Conditions - Conditions to check
-	 * @param Context - Effect context
-	 * @param SourcePlayer - Player who owns the source card
-	 * @param GameState - Current game state
-	 * @return True if all conditions met
-	 */
-	UFUNCTION(BlueprintCallable, Category = "GCG|Effects")
-	bool CheckConditions(const TArray<FGCGEffectCondition>& Conditions, const FGCGEffectContext& Context,
-		AGCGPlayerState* SourcePlayer, AGCGGameState* GameState);
-
-	/**
-	 * Check a single condition
-	 * @param Condition - Condition to check
-	 * @param Context - Effect context
-	 * @param SourcePlayer - Player who owns the source card
-	 * @param GameState - Current game state
-	 * @return True if condition met
+	 * Register a card's effects under their timings
+	 * Called by UGCGZoneSubsystem when a card enters the Battle Area or Base Section.
+	 * @param PlayerID - Player who controls the card
+	 * @param Card - Card entering play
 	 */
-	UFUNCTION(BlueprintCallable, Category = "GCG|Effects")
-	bool CheckCondition(const FGCGEffectCondition& Condition, const FGCGEffectContext& Context,
-		AGCGPlayerState* SourcePlayer, AGCGGameState* GameState);
-
-	// ===========================================================================================
-	// EFFECT COSTS
-	// ===========================================================================================
+	void RegisterCard(int32 PlayerID, const FGCGCardInstance& Card);
 
 	/**
-	 * Check if player can pay all costs
-	 * @param Costs - Costs to pay
-	 * @param Context - Effect context
-	 * @param SourcePlayer - Player who will pay costs
-	 * @param GameState - Current game state
-	 * @return True if can pay all costs
+	 * Remove a card's listeners
+	 * Called by UGCGZoneSubsystem when a card leaves the Battle Area or Base Section.
+	 * @param PlayerID - Player who controls the card
+	 * @param Card - Card leaving play
 	 */
-	UFUNCTION(BlueprintCallable, Category = "GCG|Effects")
-	bool CanPayCosts(const TArray<FGCGEffectCost>& Costs, const FGCGEffectContext& Context,
-		AGCGPlayerState* SourcePlayer, AGCGGameState* GameState);
+	void UnregisterCard(int32 PlayerID, const FGCGCardInstance& Card);
 
-	/**
-	 * Pay all costs for an effect
-	 * @param Costs - Costs to pay
-	 * @param Context - Effect context
-	 * @param SourcePlayer - Player who will pay costs
-	 * @param GameState - Current game state
-	 * @return True if all costs paid successfully
-	 */
-	UFUNCTION(BlueprintCallable, Category = "GCG|Effects")
-	bool PayCosts(const TArray<FGCGEffectCost>& Costs, const FGCGEffectContext& Context,
-		AGCGPlayerState* SourcePlayer, AGCGGameState* GameState);
+	/** Drop every listener (new match) */
+	void ResetTriggers();
 
-	/**
-	 * Pay a single cost
-	 * @param Cost - Cost to pay
-	 * @param Context - Effect context
-	 * @param SourcePlayer - Player who will pay cost
-	 * @param GameState - Current game state
-	 * @return True if cost paid successfully
-	 */
-	UFUNCTION(BlueprintCallable, Category = "GCG|Effects")
-	bool PayCost(const FGCGEffectCost& Cost, const FGCGEffectContext& Context,
-		AGCGPlayerState* SourcePlayer, AGCGGameState* GameState);
+	/** Number of effects listening for a timing */
+	int32 GetNumListeners(EGCGEffectTiming Timing) const { return TriggerListeners[static_cast<int32>(Timing)].Num(); }
 
 	// ===========================================================================================
-	// EFFECT OPERATIONS
+	// EFFECT PROGRAMS
 	// ===========================================================================================
 
 	/**
-	 * Execute all operations for an effect
-	 * @param Operations - Operations to execute
-	 * @param Context - Effect context
-	 * @param SourcePlayer - Player who owns the source card
-	 * @param GameState - Current game state
-	 * @return Combined effect result
-	 */
-	UFUNCTION(BlueprintCallable, Category = "GCG|Effects")
-	FGCGEffectResult ExecuteOperations(const TArray<FGCGEffectOperation>& Operations, const FGCGEffectContext& Context,
-		AGCGPlayerState* SourcePlayer, AGCGGameState* GameState);
-
-	/**
-	 * Execute a single operation
-	 * @param Operation - Operation to execute
+	 * Run one compiled effect: checks (conditions and costs), payments, then operations
+	 * Nothing is paid unless every check passes.
+	 * @param Code - Program from FGCGCardCatalog::GetEffectCode or FGCGEffectCompiler::Compile
 	 * @param Context - Effect context
 	 * @param SourcePlayer - Player who owns the source card
 	 * @param GameState - Current game state
-	 * @return Effect result
+	 * @return Combined result of the operations
 	 */
-	UFUNCTION(BlueprintCallable, Category = "GCG|Effects")
-	FGCGEffectResult ExecuteOperation(const FGCGEffectOperation& Operation, const FGCGEffectContext& Context,
+	FGCGEffectResult ExecuteProgram(TConstArrayView<FGCGEffectInstruction> Code, const FGCGEffectContext& Context,
 		AGCGPlayerState* SourcePlayer, AGCGGameState* GameState);
 
 	// ===========================================================================================
@@ -347,18 +313,21 @@ public:
 	/**
 	 * Add a modifier to a card
 	 * @param Card - Card to modify
-	 * @param ModifierType - Type of modifier (AP, HP, Cost)
+	 * @param ModifierType - Stat to modify (AP, HP, Cost)
 	 * @param Amount - Modifier amount
 	 * @param Duration - How long the modifier lasts
 	 * @param SourceInstanceID - Card that applied the modifier
 	 * @param GameState - Current game state
+	 * Refreshes the card's state hash in its owning player state (see RefreshModifiedCard).
+	 * UntilEndOfTurn / UntilEndOfBattle modifiers queue the card for ExpireModifiers.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "GCG|Effects|Modifiers")
-	void AddModifier(UPARAM(ref) FGCGCardInstance& Card, FName ModifierType, int32 Amount,
+	void AddModifier(UPARAM(ref) FGCGCardInstance& Card, EGCGModifierType ModifierType, int32 Amount,
 		EGCGModifierDuration Duration, int32 SourceInstanceID, AGCGGameState* GameState);
 
 	/**
 	 * Remove modifiers from a card by source
+	 * Like AddModifier, refreshes the card's cached stat totals and its owner's state hash.
 	 * @param Card - Card to modify
 	 * @param SourceInstanceID - Source card instance ID
 	 */
@@ -378,6 +347,7 @@ public:
 
 	/**
 	 * Clean up all modifiers for a player
+	 * Sweeps every card in play; ExpireModifiers only visits the queued ones.
 	 * @param PlayerState - Player whose cards to clean
 	 * @param GameState - Current game state
 	 * @param bEndOfTurn - True if cleaning at end of turn
@@ -387,6 +357,22 @@ public:
 	void CleanupAllModifiers(AGCGPlayerState* PlayerState, AGCGGameState* GameState,
 		bool bEndOfTurn = false, bool bEndOfBattle = false);
 
+	/**
+	 * Expire the modifiers due now, on every player's cards
+	 * Only the cards queued for this turn's end of battle / end of turn are
+	 * visited (AddModifier, OP_GrantKeyword). End of turn also clears their
+	 * temporary keywords.
+	 * @param GameState - Current game state
+	 * @param bEndOfTurn - True at end of turn
+	 * @param bEndOfBattle - True at end of battle
+	 * @return Number of cards visited
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GCG|Effects|Modifiers")
+	int32 ExpireModifiers(AGCGGameState* GameState, bool bEndOfTurn = false, bool bEndOfBattle = false);
+
+	/** Drop every queued expiry (new match) */
+	void ResetModifierExpiry() { ModifierExpiry.Reset(); }
+
 	// ===========================================================================================
 	// UTILITY
 	// ===========================================================================================
@@ -420,8 +406,8 @@ private:
 	// ===========================================================================================
 
 	/**
-	 * Resolve target for an operation
-	 * @param TargetName - Target name ("Self", "TargetUnit", "OpponentPlayer", etc.)
+	 * Resolve the target of an operation
+	 * @param Target - Compiled target (unit targets use Context.TargetCardInstanceID, else ChooseEffectTarget)
 	 * @param Context - Effect context
 	 * @param SourcePlayer - Source player
 	 * @param GameState - Game state
@@ -429,6 +415,33 @@ private:
 	 * @param OutCardInstanceID - Output card instance ID
 	 * @return True if target resolved
 	 */
-	bool ResolveTarget(FName TargetName, const FGCGEffectContext& Context, AGCGPlayerState* SourcePlayer,
+	bool ResolveTarget(EGCGEffectTarget Target, const FGCGEffectContext& Context, AGCGPlayerState* SourcePlayer,
 		AGCGGameState* GameState, AGCGPlayerState*& OutPlayerState, int32& OutCardInstanceID);
+
+	/**
+	 * Pick the unit an untargeted EnemyUnit / FriendlyUnit operation acts on: the highest-AP unit on that side
+	 * @param SourcePlayerID - Player whose effect is resolving
+	 * @param GameState - Game state
+	 * @param bEnemy - Pick from the opponents' units instead of the source player's
+	 * @param OutPlayerState - Owner of the chosen unit
+	 * @return Instance ID of the chosen unit, or 0 if that side has none
+	 */
+	int32 ChooseEffectTarget(int32 SourcePlayerID, AGCGGameState* GameState, bool bEnemy, AGCGPlayerState*& OutPlayerState) const;
+
+	/** Card catalog the current match pinned (nullptr outside a match) */
+	const FGCGCardCatalog* GetMatchCatalog() const;
+
+	/**
+	 * Re-key a card whose modifiers changed in the player state holding it (a copy outside
+	 * any zone is left alone)
+	 * @param Card - The modified card
+	 * @param GameState - Game state to search (falls back to this world's)
+	 */
+	void RefreshModifiedCard(const FGCGCardInstance& Card, const AGCGGameState* GameState) const;
+
+	/** Listeners per EGCGEffectTiming, in registration order */
+	TStaticArray<TArray<FGCGTriggerListener>, GCGNumEffectTimings> TriggerListeners;
+
+	/** Cards holding modifiers / keywords that run out at end of battle or turn */
+	FGCGExpiryQueue ModifierExpiry;
 };
@@ -5,6 +5,9 @@
 #include "GCGZoneSubsystem.h"
 #include "../PlayerState/GCGPlayerState.h"
 #include "../GameState/GCGGameState.h"
+#include "../GameModes/GCGGameModeBase.h"
+#include "../Core/GCGRules.h"
+#include "Engine/World.h"
 
 // ===========================================================================================
 // SUBSYSTEM LIFECYCLE
@@ -28,29 +31,15 @@ void UGCGKeywordSubsystem::Deinitialize()
 
 bool UGCGKeywordSubsystem::HasKeyword(const FGCGCardInstance& Card, EGCGKeyword Keyword) const
 {
-	for (const FGCGKeywordInstance& KeywordInstance : Card.Keywords)
-	{
-		if (KeywordInstance.Keyword == Keyword)
-		{
-			return true;
-		}
-	}
-	return false;
+	// Printed keywords live on the card data, granted ones on the instance
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	return Catalog ? FGCGRules::HasKeyword(*Catalog, Card, Keyword) : Card.HasTemporaryKeyword(Keyword);
 }
 
 int32 UGCGKeywordSubsystem::GetKeywordValue(const FGCGCardInstance& Card, EGCGKeyword Keyword) const
 {
-	int32 TotalValue = 0;
-
-	for (const FGCGKeywordInstance& KeywordInstance : Card.Keywords)
-	{
-		if (KeywordInstance.Keyword == Keyword)
-		{
-			TotalValue += KeywordInstance.Value;
-		}
-	}
-
-	return TotalValue;
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	return Catalog ? FGCGRules::GetKeywordValue(*Catalog, Card, Keyword) : Card.GetTotalKeywordValue(Keyword, nullptr);
 }
 
 bool UGCGKeywordSubsystem::DoesKeywordStack(EGCGKeyword Keyword) const
@@ -130,28 +119,14 @@ int32 UGCGKeywordSubsystem::ProcessRepairForPlayer(AGCGPlayerState* PlayerState)
 		return 0;
 	}
 
-	int32 TotalHealing = 0;
-
-	// Process Repair for all Units in Battle Area
-	for (FGCGCardInstance& Unit : PlayerState->BattleArea)
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	if (!Catalog)
 	{
-		if (HasKeyword(Unit, EGCGKeyword::Repair))
-		{
-			FGCGKeywordResult Result = ProcessRepair(Unit);
-			TotalHealing += Result.HealingDone;
-		}
+		return 0;
 	}
 
-	// Process Repair for Base (if it has Repair keyword somehow)
-	if (PlayerState->BaseSection.Num() > 0)
-	{
-		FGCGCardInstance& Base = PlayerState->BaseSection[0];
-		if (HasKeyword(Base, EGCGKeyword::Repair))
-		{
-			FGCGKeywordResult Result = ProcessRepair(Base);
-			TotalHealing += Result.HealingDone;
-		}
-	}
+	// Units in the Battle Area and the Base
+	const int32 TotalHealing = FGCGRules::ApplyRepair(*Catalog, *PlayerState);
 
 	if (TotalHealing > 0)
 	{
@@ -211,31 +186,13 @@ FGCGKeywordResult UGCGKeywordSubsystem::ProcessBreach(const FGCGCardInstance& At
 
 int32 UGCGKeywordSubsystem::CalculateSupportBuff(const FGCGCardInstance& Unit, AGCGPlayerState* PlayerState)
 {
-	if (!PlayerState)
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	if (!PlayerState || !Catalog)
 	{
 		return 0;
 	}
 
-	int32 TotalBuff = 0;
-
-	// Check all Units in Battle Area for Support keyword
-	for (const FGCGCardInstance& Ally : PlayerState->BattleArea)
-	{
-		// Don't buff yourself
-		if (Ally.InstanceID == Unit.InstanceID)
-		{
-			continue;
-		}
-
-		// Check if ally has Support
-		if (HasKeyword(Ally, EGCGKeyword::Support))
-		{
-			int32 SupportValue = GetKeywordValue(Ally, EGCGKeyword::Support);
-			TotalBuff += SupportValue;
-		}
-	}
-
-	return TotalBuff;
+	return FGCGRules::GetSupportBuff(*Catalog, *PlayerState, Unit);
 }
 
 TArray<FGCGCardInstance> UGCGKeywordSubsystem::GetUnitsWithSupport(AGCGPlayerState* PlayerState)
@@ -264,11 +221,8 @@ TArray<FGCGCardInstance> UGCGKeywordSubsystem::GetUnitsWithSupport(AGCGPlayerSta
 
 bool UGCGKeywordSubsystem::HasFirstStrikeAdvantage(const FGCGCardInstance& Attacker, const FGCGCardInstance& Defender) const
 {
-	bool bAttackerHasFirstStrike = HasKeyword(Attacker, EGCGKeyword::FirstStrike);
-	bool bDefenderHasFirstStrike = HasKeyword(Defender, EGCGKeyword::FirstStrike);
-
-	// Attacker has advantage if they have FirstStrike and defender doesn't
-	return bAttackerHasFirstStrike && !bDefenderHasFirstStrike;
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	return Catalog && FGCGRules::HasFirstStrikeAdvantage(*Catalog, Attacker, Defender);
 }
 
 FGCGKeywordResult UGCGKeywordSubsystem::ProcessFirstStrike(const FGCGCardInstance& Attacker, FGCGCardInstance& Defender, bool& OutDefenderDestroyed)
@@ -353,6 +307,7 @@ FGCGKeywordResult UGCGKeywordSubsystem::ProcessHighManeuver(const FGCGCardInstan
 		if (Resource.bIsActive)
 		{
 			Resource.bIsActive = false; // Rest the resource
+			PlayerState->RefreshCardHash(Resource);
 			bCostPaid = true;
 			break;
 		}
@@ -673,24 +628,25 @@ int32 UGCGKeywordSubsystem::BreakShields(int32 Count, AGCGPlayerState* PlayerSta
 	// Break shields from top of stack
 	for (int32 i = 0; i < ShieldsToBreak; i++)
 	{
-		if (PlayerState->ShieldStack.Num() > 0)
+		// Move top shield to Trash
+		FGCGCardInstance Shield;
+		if (ZoneSubsystem->MoveTopCard(EGCGCardZone::ShieldStack, EGCGCardZone::Trash, PlayerState, nullptr, Shield))
 		{
-			FGCGCardInstance Shield = PlayerState->ShieldStack[0];
+			ShieldsBroken++;
 
-			// Move shield to Trash
-			bool bMoved = ZoneSubsystem->MoveCard(Shield, EGCGCardZone::ShieldStack, EGCGCardZone::Trash, PlayerState, nullptr);
-			if (bMoved)
-			{
-				ShieldsBroken++;
-
-				// TODO Phase 7: Check for Burst keyword and process if present
-			}
+			// TODO Phase 7: Check for Burst keyword and process if present
 		}
 	}
 
 	return ShieldsBroken;
 }
 
+const FGCGCardCatalog* UGCGKeywordSubsystem::GetMatchCatalog() const
+{
+	AGCGGameModeBase* GameMode = GetWorld() ? GetWorld()->GetAuthGameMode<AGCGGameModeBase>() : nullptr;
+	return GameMode ? GameMode->GetMatchCatalog().Get() : nullptr;
+}
+
 void UGCGKeywordSubsystem::LogKeyword(const FString& KeywordName, const FString& Message) const
 {
 	UE_LOG(LogTemp, Log, TEXT("[GCGKeywordSubsystem] %s: %s"), *KeywordName, *Message);
@@ -11,6 +11,7 @@
 // Forward declarations
 class AGCGPlayerState;
 class AGCGGameState;
+class FGCGCardCatalog;
 
 /**
  * Keyword Processing Result
@@ -339,6 +340,12 @@ private:
 	 */
 	int32 BreakShields(int32 Count, AGCGPlayerState* PlayerState);
 
+	/**
+	 * Catalog the running match resolves printed keywords from
+	 * @return The match catalog, or nullptr outside a match
+	 */
+	const FGCGCardCatalog* GetMatchCatalog() const;
+
 	/**
 	 * Log keyword processing
 	 */
@@ -3,6 +3,8 @@
 #include "GCGLinkUnitSubsystem.h"
 #include "GCGCardDatabase.h"
 #include "../PlayerState/GCGPlayerState.h"
+#include "../GameModes/GCGGameModeBase.h"
+#include "Engine/World.h"
 
 // ===========================================================================================
 // INITIALIZATION
@@ -37,7 +39,8 @@ FGCGLinkResult UGCGLinkUnitSubsystem::PairPilotWithUnit(
 	FGCGCardInstance& LinkUnitInstance,
 	FGCGCardInstance& PilotInstance,
 	const FGCGCardData* LinkUnitData,
-	const FGCGCardData* PilotData)
+	const FGCGCardData* PilotData,
+	AGCGPlayerState* PlayerState)
 {
 	FGCGLinkResult Result;
 	Result.LinkUnitInstanceID = LinkUnitInstance.InstanceID;
@@ -51,11 +54,11 @@ FGCGLinkResult UGCGLinkUnitSubsystem::PairPilotWithUnit(
 		return Result;
 	}
 
-	// Validate that Link Unit is actually a Link Unit
-	if (!LinkUnitData->HasKeyword(EGCGKeyword::LinkUnit))
+	// Any Unit can be piloted; only a Link Unit's requirements decide whether it links
+	if (LinkUnitData->CardType != EGCGCardType::Unit)
 	{
 		Result.bSuccess = false;
-		Result.ErrorMessage = FString::Printf(TEXT("%s is not a Link Unit"), *LinkUnitData->CardName.ToString());
+		Result.ErrorMessage = FString::Printf(TEXT("%s is not a Unit"), *LinkUnitData->CardName.ToString());
 		return Result;
 	}
 
@@ -68,7 +71,7 @@ FGCGLinkResult UGCGLinkUnitSubsystem::PairPilotWithUnit(
 	}
 
 	// Validate that Link Unit is not already paired
-	if (LinkUnitInstance.PairedCardInstanceID != -1)
+	if (LinkUnitInstance.PairedCardInstanceID != 0)
 	{
 		Result.bSuccess = false;
 		Result.ErrorMessage = FString::Printf(TEXT("%s is already paired"), *LinkUnitData->CardName.ToString());
@@ -76,26 +79,30 @@ FGCGLinkResult UGCGLinkUnitSubsystem::PairPilotWithUnit(
 	}
 
 	// Validate that Pilot is not already paired
-	if (PilotInstance.PairedCardInstanceID != -1)
+	if (PilotInstance.PairedCardInstanceID != 0)
 	{
 		Result.bSuccess = false;
 		Result.ErrorMessage = FString::Printf(TEXT("%s is already paired"), *PilotData->CardName.ToString());
 		return Result;
 	}
 
-	// Validate Link requirements
-	FGCGLinkResult ValidationResult = ValidateLinkRequirement(LinkUnitInstance, PilotInstance, LinkUnitData, PilotData);
-	if (!ValidationResult.bSuccess)
-	{
-		return ValidationResult; // Return validation failure
-	}
+	// Validate Link requirements (a Pilot that doesn't meet them still pairs, it just doesn't link)
+	const bool bLinked = LinkUnitData->HasKeyword(EGCGKeyword::LinkUnit) &&
+		ValidateLinkRequirement(LinkUnitInstance, PilotInstance, LinkUnitData, PilotData).bSuccess;
 
 	// Pair the cards
 	LinkUnitInstance.PairedCardInstanceID = PilotInstance.InstanceID;
 	PilotInstance.PairedCardInstanceID = LinkUnitInstance.InstanceID;
 
-	// Link Units can attack on the turn they're deployed when paired
-	Result.bCanAttackThisTurn = true;
+	// Pairing is part of each card's state hash
+	if (PlayerState)
+	{
+		PlayerState->RefreshCardHash(LinkUnitInstance);
+		PlayerState->RefreshCardHash(PilotInstance);
+	}
+
+	// Link Units can attack on the turn they're deployed when linked
+	Result.bCanAttackThisTurn = bLinked;
 
 	Result.bSuccess = true;
 	Result.ErrorMessage = FString::Printf(
@@ -111,7 +118,8 @@ FGCGLinkResult UGCGLinkUnitSubsystem::PairPilotWithUnit(
 
 FGCGLinkResult UGCGLinkUnitSubsystem::UnpairPilot(
 	FGCGCardInstance& LinkUnitInstance,
-	FGCGCardInstance& PilotInstance)
+	FGCGCardInstance& PilotInstance,
+	AGCGPlayerState* PlayerState)
 {
 	FGCGLinkResult Result;
 	Result.LinkUnitInstanceID = LinkUnitInstance.InstanceID;
@@ -127,8 +135,14 @@ FGCGLinkResult UGCGLinkUnitSubsystem::UnpairPilot(
 	}
 
 	// Unpair
-	LinkUnitInstance.PairedCardInstanceID = -1;
-	PilotInstance.PairedCardInstanceID = -1;
+	LinkUnitInstance.PairedCardInstanceID = 0;
+	PilotInstance.PairedCardInstanceID = 0;
+
+	if (PlayerState)
+	{
+		PlayerState->RefreshCardHash(LinkUnitInstance);
+		PlayerState->RefreshCardHash(PilotInstance);
+	}
 
 	Result.bSuccess = true;
 	Result.ErrorMessage = TEXT("Unpaired successfully");
@@ -230,7 +244,7 @@ FGCGLinkResult UGCGLinkUnitSubsystem::ValidateLinkRequirement(
 
 bool UGCGLinkUnitSubsystem::IsPaired(const FGCGCardInstance& UnitInstance) const
 {
-	return UnitInstance.PairedCardInstanceID != -1;
+	return UnitInstance.PairedCardInstanceID != 0;
 }
 
 bool UGCGLinkUnitSubsystem::CanLinkUnitAttackThisTurn(const FGCGCardInstance& LinkUnitInstance, int32 CurrentTurn) const
@@ -251,54 +265,38 @@ bool UGCGLinkUnitSubsystem::CanLinkUnitAttackThisTurn(const FGCGCardInstance& Li
 
 FGCGCardInstance* UGCGLinkUnitSubsystem::GetPairedPilot(const FGCGCardInstance& LinkUnitInstance, AGCGPlayerState* PlayerState) const
 {
-	if (!PlayerState || LinkUnitInstance.PairedCardInstanceID == -1)
+	if (!PlayerState || LinkUnitInstance.PairedCardInstanceID == 0)
 	{
 		return nullptr;
 	}
 
-	// Search BattleArea for the paired Pilot
-	for (FGCGCardInstance& Card : PlayerState->BattleArea)
-	{
-		if (Card.InstanceID == LinkUnitInstance.PairedCardInstanceID)
-		{
-			return &Card;
-		}
-	}
-
-	return nullptr;
+	// Paired Pilot lives in the BattleArea
+	return PlayerState->FindCardInZone(LinkUnitInstance.PairedCardInstanceID, EGCGCardZone::BattleArea);
 }
 
 FGCGCardInstance* UGCGLinkUnitSubsystem::GetPairedLinkUnit(const FGCGCardInstance& PilotInstance, AGCGPlayerState* PlayerState) const
 {
-	if (!PlayerState || PilotInstance.PairedCardInstanceID == -1)
+	if (!PlayerState || PilotInstance.PairedCardInstanceID == 0)
 	{
 		return nullptr;
 	}
 
-	// Search BattleArea for the paired Link Unit
-	for (FGCGCardInstance& Card : PlayerState->BattleArea)
-	{
-		if (Card.InstanceID == PilotInstance.PairedCardInstanceID)
-		{
-			return &Card;
-		}
-	}
-
-	return nullptr;
+	// Paired Link Unit lives in the BattleArea
+	return PlayerState->FindCardInZone(PilotInstance.PairedCardInstanceID, EGCGCardZone::BattleArea);
 }
 
 TArray<FGCGCardInstance*> UGCGLinkUnitSubsystem::GetAllLinkUnits(AGCGPlayerState* PlayerState) const
 {
 	TArray<FGCGCardInstance*> LinkUnits;
 
-	if (!PlayerState || !CardDatabase)
+	if (!PlayerState)
 	{
 		return LinkUnits;
 	}
 
 	for (FGCGCardInstance& Card : PlayerState->BattleArea)
 	{
-		const FGCGCardData* CardData = CardDatabase->GetCardData(Card.CardNumber);
+		const FGCGCardData* CardData = GetCardData(Card, PlayerState);
 		if (CardData && CardData->HasKeyword(EGCGKeyword::LinkUnit))
 		{
 			LinkUnits.Add(&Card);
@@ -312,14 +310,14 @@ TArray<FGCGCardInstance*> UGCGLinkUnitSubsystem::GetAllPilots(AGCGPlayerState* P
 {
 	TArray<FGCGCardInstance*> Pilots;
 
-	if (!PlayerState || !CardDatabase)
+	if (!PlayerState)
 	{
 		return Pilots;
 	}
 
 	for (FGCGCardInstance& Card : PlayerState->BattleArea)
 	{
-		const FGCGCardData* CardData = CardDatabase->GetCardData(Card.CardNumber);
+		const FGCGCardData* CardData = GetCardData(Card, PlayerState);
 		if (CardData && CardData->CardType == EGCGCardType::Pilot)
 		{
 			Pilots.Add(&Card);
@@ -381,3 +379,10 @@ bool UGCGLinkUnitSubsystem::ValidateSpecificCardRequirement(const FGCGLinkRequir
 	// Pilot must be one of the specific cards
 	return Requirements.SpecificCardNumbers.Contains(PilotData->CardNumber);
 }
+
+const FGCGCardData* UGCGLinkUnitSubsystem::GetCardData(const FGCGCardInstance& Card, AGCGPlayerState* PlayerState) const
+{
+	UWorld* World = PlayerState ? PlayerState->GetWorld() : nullptr;
+	AGCGGameModeBase* GameMode = World ? World->GetAuthGameMode<AGCGGameModeBase>() : nullptr;
+	return GameMode ? GameMode->GetCardDataForInstance(Card) : nullptr;
+}
@@ -61,11 +61,13 @@ public:
 
 	/**
 	 * Pair a Pilot with a Link Unit
+	 * Any Unit can be piloted; bCanAttackThisTurn reports whether a Link Unit's requirements were met.
 	 *
 	 * @param LinkUnitInstance - The Link Unit card instance
 	 * @param PilotInstance - The Pilot card instance
 	 * @param LinkUnitData - Static card data for the Link Unit
 	 * @param PilotData - Static card data for the Pilot
+	 * @param PlayerState - Player whose Battle Area holds both cards (refreshes their state hash)
 	 * @return Result with success/failure and pairing details
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Link Unit")
@@ -73,7 +75,8 @@ public:
 		UPARAM(ref) FGCGCardInstance& LinkUnitInstance,
 		UPARAM(ref) FGCGCardInstance& PilotInstance,
 		const FGCGCardData* LinkUnitData,
-		const FGCGCardData* PilotData
+		const FGCGCardData* PilotData,
+		AGCGPlayerState* PlayerState
 	);
 
 	/**
@@ -81,12 +84,14 @@ public:
 	 *
 	 * @param LinkUnitInstance - The Link Unit to unpair
 	 * @param PilotInstance - The Pilot to unpair
+	 * @param PlayerState - Player whose Battle Area holds both cards (refreshes their state hash)
 	 * @return Result with success/failure
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Link Unit")
 	FGCGLinkResult UnpairPilot(
 		UPARAM(ref) FGCGCardInstance& LinkUnitInstance,
-		UPARAM(ref) FGCGCardInstance& PilotInstance
+		UPARAM(ref) FGCGCardInstance& PilotInstance,
+		AGCGPlayerState* PlayerState
 	);
 
 	// ===========================================================================================
@@ -203,6 +208,15 @@ private:
 	 */
 	bool ValidateSpecificCardRequirement(const FGCGLinkRequirement& Requirements, const FGCGCardData* PilotData) const;
 
+	/**
+	 * Resolve a card's static data through the match catalog
+	 *
+	 * @param Card - The card instance
+	 * @param PlayerState - The owning player state (for the world)
+	 * @return Card data, or nullptr without a game mode (clients) or for unknown cards
+	 */
+	const FGCGCardData* GetCardData(const FGCGCardInstance& Card, AGCGPlayerState* PlayerState) const;
+
 	// ===========================================================================================
 	// PROPERTIES
 	// ===========================================================================================
@@ -5,6 +5,10 @@
 #include "GundamTCG/PlayerState/GCGPlayerState.h"
 #include "GundamTCG/GameState/GCGGameState.h"
 #include "GundamTCG/Subsystems/GCGZoneSubsystem.h"
+#include "GundamTCG/Subsystems/GCGEffectSubsystem.h"
+#include "GundamTCG/GameModes/GCGGameModeBase.h"
+#include "GundamTCG/Core/GCGRules.h"
+#include "Engine/World.h"
 
 // ===== SUBSYSTEM LIFECYCLE =====
 
@@ -38,7 +42,7 @@ FGCGPlayerActionResult UGCGPlayerActionSubsystem::ExecuteAction(const FGCGPlayer
 	switch (Request.ActionType)
 	{
 	case EGCGPlayerActionType::PlayCard:
-		return ExecutePlayCard(Request.PrimaryCardInstanceID, PlayerState, GameState);
+		return ExecutePlayCard(Request.PrimaryCardInstanceID, PlayerState, GameState, Request.SecondaryCardInstanceID);
 
 	case EGCGPlayerActionType::DiscardCard:
 		return ExecuteDiscard(Request.PrimaryCardInstanceID, PlayerState);
@@ -86,7 +90,7 @@ FGCGPlayerActionResult UGCGPlayerActionSubsystem::ValidateAction(const FGCGPlaye
 		{
 			return FGCGPlayerActionResult(false, TEXT("Card not found"));
 		}
-		return CanPlayCard(CardInstance, PlayerState, GameState);
+		return CanPlayCard(CardInstance, PlayerState, GameState, Request.SecondaryCardInstanceID);
 	}
 
 	case EGCGPlayerActionType::DiscardCard:
@@ -115,7 +119,7 @@ FGCGPlayerActionResult UGCGPlayerActionSubsystem::ValidateAction(const FGCGPlaye
 // ===== PLAY CARD =====
 
 FGCGPlayerActionResult UGCGPlayerActionSubsystem::PlayCardFromHand(int32 CardInstanceID,
-	AGCGPlayerState* PlayerState, AGCGGameState* GameState)
+	AGCGPlayerState* PlayerState, AGCGGameState* GameState, int32 TargetInstanceID)
 {
 	if (!PlayerState || !GameState)
 	{
@@ -136,18 +140,18 @@ FGCGPlayerActionResult UGCGPlayerActionSubsystem::PlayCardFromHand(int32 CardIns
 	}
 
 	// Validate can play
-	FGCGPlayerActionResult ValidationResult = CanPlayCard(CardInstance, PlayerState, GameState);
+	FGCGPlayerActionResult ValidationResult = CanPlayCard(CardInstance, PlayerState, GameState, TargetInstanceID);
 	if (!ValidationResult.bSuccess)
 	{
 		return ValidationResult;
 	}
 
 	// Execute play
-	return ExecutePlayCard(CardInstanceID, PlayerState, GameState);
+	return ExecutePlayCard(CardInstanceID, PlayerState, GameState, TargetInstanceID);
 }
 
 FGCGPlayerActionResult UGCGPlayerActionSubsystem::CanPlayCard(const FGCGCardInstance& CardInstance,
-	AGCGPlayerState* PlayerState, AGCGGameState* GameState) const
+	AGCGPlayerState* PlayerState, AGCGGameState* GameState, int32 TargetInstanceID) const
 {
 	if (!PlayerState || !GameState)
 	{
@@ -161,30 +165,17 @@ FGCGPlayerActionResult UGCGPlayerActionSubsystem::CanPlayCard(const FGCGCardInst
 		return TimingResult;
 	}
 
-	// Check cost
-	if (!CanPayCost(CardInstance.Cost, PlayerState))
-	{
-		return FGCGPlayerActionResult(false,
-			FString::Printf(TEXT("Insufficient resources (need %d, have %d)"),
-				CardInstance.Cost, PlayerState->GetActiveResourceCount()));
-	}
-
-	// Check zone capacity for Units
-	if (CardInstance.CardType == EGCGCardType::Unit)
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	if (!Catalog)
 	{
-		if (!PlayerState->CanAddUnitToBattle())
-		{
-			return FGCGPlayerActionResult(false, TEXT("Battle Area is full (max 6 Units)"));
-		}
+		return FGCGPlayerActionResult(false, TEXT("No match catalog"));
 	}
 
-	// Check Base limit
-	if (CardInstance.CardType == EGCGCardType::Base)
+	// Lv, cost, Unit limit and Pilot target: the same checks the rules engine makes
+	const EGCGRulesResult Result = FGCGRules::CanPlayCard(*Catalog, *PlayerState, CardInstance.InstanceID, TargetInstanceID);
+	if (Result != EGCGRulesResult::Success)
 	{
-		if (PlayerState->BaseSection.Num() > 0)
-		{
-			return FGCGPlayerActionResult(false, TEXT("Can only have 1 Base (replace EX Base first)"));
-		}
+		return FGCGPlayerActionResult(false, FString::Printf(TEXT("Cannot play card %d: %s"), CardInstance.InstanceID, LexToString(Result)));
 	}
 
 	return FGCGPlayerActionResult(true);
@@ -208,28 +199,7 @@ bool UGCGPlayerActionSubsystem::PayCost(int32 Cost, AGCGPlayerState* PlayerState
 	}
 
 	// Rest resources to pay cost
-	int32 RemainingCost = Cost;
-	for (FGCGCardInstance& Resource : PlayerState->ResourceArea)
-	{
-		if (RemainingCost <= 0)
-		{
-			break;
-		}
-
-		if (Resource.bIsActive)
-		{
-			Resource.bIsActive = false; // Rest the resource
-			RemainingCost--;
-			UE_LOG(LogTemp, Verbose, TEXT("UGCGPlayerActionSubsystem::PayCost - Rested resource %s (ID: %d)"),
-				*Resource.CardName.ToString(), Resource.InstanceID);
-		}
-	}
-
-	if (RemainingCost > 0)
-	{
-		UE_LOG(LogTemp, Error, TEXT("UGCGPlayerActionSubsystem::PayCost - Failed to pay full cost (remaining: %d)"), RemainingCost);
-		return false;
-	}
+	FGCGRules::PayCost(*PlayerState, Cost);
 
 	UE_LOG(LogTemp, Log, TEXT("UGCGPlayerActionSubsystem::PayCost - Successfully paid cost of %d"), Cost);
 	return true;
@@ -242,7 +212,7 @@ bool UGCGPlayerActionSubsystem::CanPayCost(int32 Cost, AGCGPlayerState* PlayerSt
 		return false;
 	}
 
-	return PlayerState->GetActiveResourceCount() >= Cost;
+	return FGCGRules::CanPayCost(*PlayerState, Cost);
 }
 
 // ===== RESOURCE PLACEMENT =====
@@ -386,7 +356,7 @@ FGCGPlayerActionResult UGCGPlayerActionSubsystem::ValidatePlayerPriority(int32 P
 // ===== INTERNAL EXECUTION =====
 
 FGCGPlayerActionResult UGCGPlayerActionSubsystem::ExecutePlayCard(int32 CardInstanceID,
-	AGCGPlayerState* PlayerState, AGCGGameState* GameState)
+	AGCGPlayerState* PlayerState, AGCGGameState* GameState, int32 TargetInstanceID)
 {
 	if (!PlayerState || !GameState)
 	{
@@ -394,80 +364,40 @@ FGCGPlayerActionResult UGCGPlayerActionSubsystem::ExecutePlayCard(int32 CardInst
 	}
 
 	UGCGZoneSubsystem* ZoneSubsystem = GetZoneSubsystem();
-	if (!ZoneSubsystem)
+	const FGCGCardCatalog* Catalog = GetMatchCatalog();
+	if (!ZoneSubsystem || !Catalog)
 	{
-		return FGCGPlayerActionResult(false, TEXT("Zone subsystem not found"));
+		return FGCGPlayerActionResult(false, TEXT("Zone subsystem or match catalog not found"));
 	}
 
-	// Find card in hand
-	FGCGCardInstance CardInstance;
-	EGCGCardZone CardZone;
-	if (!PlayerState->FindCardByInstanceID(CardInstanceID, CardInstance, CardZone))
-	{
-		return FGCGPlayerActionResult(false, TEXT("Card not found"));
-	}
-
-	// Pay cost
-	if (!PayCost(CardInstance.Cost, PlayerState))
+	const FGCGCardInstance* CardInstance = PlayerState->FindCardInZone(CardInstanceID, EGCGCardZone::Hand);
+	if (!CardInstance)
 	{
-		return FGCGPlayerActionResult(false, TEXT("Failed to pay cost"));
+		return FGCGPlayerActionResult(false, TEXT("Card not in hand"));
 	}
+	const FName CardNumber = CardInstance->CardNumber;
 
-	// Determine destination zone based on card type
-	EGCGCardZone DestinationZone = EGCGCardZone::None;
-	switch (CardInstance.CardType)
-	{
-	case EGCGCardType::Unit:
-		DestinationZone = EGCGCardZone::BattleArea;
-		break;
-
-	case EGCGCardType::Base:
-		DestinationZone = EGCGCardZone::BaseSection;
-		// If there's an EX Base, remove it first
-		if (PlayerState->BaseSection.Num() > 0 && PlayerState->BaseSection[0].bIsToken)
+	// Cost, destination, Base replacement and Pilot pairing are the shared rules; moves go
+	// through the zone subsystem so effect listeners and OnZoneChanged stay current
+	const bool bPlayed = FGCGRules::PlayCard(*Catalog, *PlayerState, CardInstanceID, TargetInstanceID, GameState->TurnNumber,
+		[ZoneSubsystem, PlayerState, GameState](int32 InstanceID, EGCGCardZone ToZone)
 		{
-			PlayerState->BaseSection.RemoveAt(0);
-			UE_LOG(LogTemp, Log, TEXT("UGCGPlayerActionSubsystem::ExecutePlayCard - Removed EX Base token"));
-		}
-		break;
-
-	case EGCGCardType::Command:
-		// Commands go to trash after resolution (for now, just move to trash)
-		// TODO: Implement command resolution and effect execution (Phase 8)
-		DestinationZone = EGCGCardZone::Trash;
-		UE_LOG(LogTemp, Warning, TEXT("UGCGPlayerActionSubsystem::ExecutePlayCard - Command effects not yet implemented"));
-		break;
+			EGCGCardZone FromZone = EGCGCardZone::None;
+			FGCGCardInstance* Card = PlayerState->FindCard(InstanceID, &FromZone);
+			return Card && ZoneSubsystem->MoveCard(*Card, FromZone, ToZone, PlayerState, GameState, false);
+		});
 
-	default:
-		return FGCGPlayerActionResult(false, TEXT("Unknown card type"));
-	}
-
-	// Move card to destination zone
-	if (!ZoneSubsystem->MoveCard(CardInstance, EGCGCardZone::Hand, DestinationZone,
-		PlayerState, GameState, true))
+	if (!bPlayed)
 	{
-		return FGCGPlayerActionResult(false, TEXT("Failed to move card to play area"));
+		return FGCGPlayerActionResult(false, TEXT("Failed to play card"));
 	}
 
-	// Set turn deployed for Units
-	if (CardInstance.CardType == EGCGCardType::Unit)
-	{
-		// Update the card in the BattleArea
-		for (FGCGCardInstance& BattleCard : PlayerState->BattleArea)
-		{
-			if (BattleCard.InstanceID == CardInstanceID)
-			{
-				BattleCard.TurnDeployed = GameState->TurnNumber;
-				break;
-			}
-		}
-	}
-
-	// TODO: Trigger "On Deploy" effects (Phase 8)
+	// TODO: Trigger "On Deploy" / "When Paired" / "On Play" effects (Phase 8)
 
-	UE_LOG(LogTemp, Log, TEXT("UGCGPlayerActionSubsystem::ExecutePlayCard - Player %d played %s (ID: %d, Cost: %d) to %s"),
-		PlayerState->GetPlayerID(), *CardInstance.CardName.ToString(), CardInstanceID,
-		CardInstance.Cost, *ZoneSubsystem->GetZoneName(DestinationZone));
+	EGCGCardZone Zone = EGCGCardZone::None;
+	PlayerState->FindCard(CardInstanceID, &Zone);
+	UE_LOG(LogTemp, Log, TEXT("UGCGPlayerActionSubsystem::ExecutePlayCard - Player %d played %s (ID: %d) to %s"),
+		PlayerState->GetPlayerID(), *CardNumber.ToString(), CardInstanceID, *ZoneSubsystem->GetZoneName(Zone));
 
 	return FGCGPlayerActionResult(true);
 }
@@ -518,3 +448,9 @@ UGCGZoneSubsystem* UGCGPlayerActionSubsystem::GetZoneSubsystem() const
 {
 	return GetGameInstance()->GetSubsystem<UGCGZoneSubsystem>();
 }
+
+const FGCGCardCatalog* UGCGPlayerActionSubsystem::GetMatchCatalog() const
+{
+	AGCGGameModeBase* GameMode = GetWorld() ? GetWorld()->GetAuthGameMode<AGCGGameModeBase>() : nullptr;
+	return GameMode ? GameMode->GetMatchCatalog().Get() : nullptr;
+}
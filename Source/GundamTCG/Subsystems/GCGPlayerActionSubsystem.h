@@ -13,6 +13,7 @@
 class AGCGPlayerState;
 class AGCGGameState;
 class UGCGZoneSubsystem;
+class FGCGCardCatalog;
 
 /**
  * Player Action Request Types
@@ -156,22 +157,24 @@ public:
 	 * @param CardInstanceID The card to play
 	 * @param PlayerState The player playing the card
 	 * @param GameState The current game state
+	 * @param TargetInstanceID The Unit a Pilot is played onto (0 for other cards)
 	 * @return Action result
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Player Actions")
 	FGCGPlayerActionResult PlayCardFromHand(int32 CardInstanceID,
-		AGCGPlayerState* PlayerState, AGCGGameState* GameState);
+		AGCGPlayerState* PlayerState, AGCGGameState* GameState, int32 TargetInstanceID = 0);
 
 	/**
-	 * Validate if player can play a card
+	 * Validate if player can play a card (timing here, the rest is FGCGRules::CanPlayCard)
 	 * @param CardInstance The card to validate
 	 * @param PlayerState The player
 	 * @param GameState The current game state
+	 * @param TargetInstanceID The Unit a Pilot is played onto (0 for other cards)
 	 * @return Validation result
 	 */
 	UFUNCTION(BlueprintPure, Category = "Player Actions")
 	FGCGPlayerActionResult CanPlayCard(const FGCGCardInstance& CardInstance,
-		AGCGPlayerState* PlayerState, AGCGGameState* GameState) const;
+		AGCGPlayerState* PlayerState, AGCGGameState* GameState, int32 TargetInstanceID = 0) const;
 
 	// ===== COST PAYMENT =====
 
@@ -250,14 +253,15 @@ protected:
 	// ===== INTERNAL EXECUTION =====
 
 	/**
-	 * Execute play card action
+	 * Execute play card action (FGCGRules::PlayCard, moving cards through the zone subsystem)
 	 * @param CardInstanceID The card to play
 	 * @param PlayerState The player
 	 * @param GameState The current game state
+	 * @param TargetInstanceID The Unit a Pilot is played onto (0 for other cards)
 	 * @return Action result
 	 */
 	FGCGPlayerActionResult ExecutePlayCard(int32 CardInstanceID,
-		AGCGPlayerState* PlayerState, AGCGGameState* GameState);
+		AGCGPlayerState* PlayerState, AGCGGameState* GameState, int32 TargetInstanceID = 0);
 
 	/**
 	 * Execute discard action
@@ -272,4 +276,10 @@ private:
 	 * Get zone subsystem
 	 */
 	UGCGZoneSubsystem* GetZoneSubsystem() const;
+
+	/**
+	 * Catalog the running match resolves card data from
+	 * @return The match catalog, or nullptr outside a match
+	 */
+	const FGCGCardCatalog* GetMatchCatalog() const;
 };
@@ -358,20 +358,34 @@ FGCGValidationResult UGCGValidationSubsystem::ValidateCardModifiers(const FGCGCa
 	for (const FGCGActiveModifier& Modifier : CardInstance.ActiveModifiers)
 	{
 		// Validate modifier source
-		if (Modifier.SourceCardInstanceID < 0)
+		if (Modifier.SourceInstanceID < 0)
 		{
 			Result.AddWarning(FString::Printf(TEXT("Invalid modifier source ID: %d (Card: %s)"),
-				Modifier.SourceCardInstanceID, *CardInstance.CardName.ToString()));
+				Modifier.SourceInstanceID, *CardInstance.CardNumber.ToString()));
 		}
 
 		// Validate modifier turn
-		if (Modifier.AppliedOnTurn < 0)
+		if (Modifier.CreatedOnTurn < 0)
 		{
 			Result.AddWarning(FString::Printf(TEXT("Invalid modifier turn: %d (Card: %s)"),
-				Modifier.AppliedOnTurn, *CardInstance.CardName.ToString()));
+				Modifier.CreatedOnTurn, *CardInstance.CardNumber.ToString()));
 		}
 	}
 
+	// Cached totals must match the modifier list (something edited ActiveModifiers directly)
+	FGCGCardInstance Recomputed = CardInstance;
+	Recomputed.RefreshModifierTotals();
+	if (Recomputed.ModifierAP != CardInstance.ModifierAP ||
+		Recomputed.ModifierHP != CardInstance.ModifierHP ||
+		Recomputed.ModifierCost != CardInstance.ModifierCost)
+	{
+		Result.AddError(FString::Printf(TEXT("Stale modifier totals (Card: %s, ID: %d): AP %d/%d, HP %d/%d, Cost %d/%d"),
+			*CardInstance.CardNumber.ToString(), CardInstance.InstanceID,
+			CardInstance.ModifierAP, Recomputed.ModifierAP,
+			CardInstance.ModifierHP, Recomputed.ModifierHP,
+			CardInstance.ModifierCost, Recomputed.ModifierCost));
+	}
+
 	return Result;
 }
 
@@ -513,7 +527,7 @@ FGCGValidationResult UGCGValidationSubsystem::ValidateAttackDeclaration(
 	}
 
 	// Check summoning sickness (unless Link Unit paired)
-	if (AttackerInstance.TurnDeployed == GameState->TurnNumber && AttackerInstance.PairedCardInstanceID == -1)
+	if (AttackerInstance.TurnDeployed == GameState->TurnNumber && AttackerInstance.PairedCardInstanceID == 0)
 	{
 		Result.AddError(FString::Printf(TEXT("Attacker has summoning sickness: %s (deployed turn %d, current turn %d)"),
 			*AttackerInstance.CardName.ToString(), AttackerInstance.TurnDeployed, GameState->TurnNumber));
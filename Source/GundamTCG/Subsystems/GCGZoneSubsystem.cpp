@@ -3,7 +3,12 @@
 
 #include "GCGZoneSubsystem.h"
 #include "GundamTCG/PlayerState/GCGPlayerState.h"
+#include "GundamTCG/PlayerState/GCGOrderedZone.h"
+#include "GundamTCG/Core/GCGRules.h"
 #include "GundamTCG/GameState/GCGGameState.h"
+#include "GundamTCG/GameModes/GCGGameModeBase.h"
+#include "GundamTCG/Subsystems/GCGEffectSubsystem.h"
+#include "Engine/World.h"
 
 // ===== SUBSYSTEM LIFECYCLE =====
 
@@ -25,26 +30,36 @@ void UGCGZoneSubsystem::Deinitialize()
 
 bool UGCGZoneSubsystem::MoveCard(FGCGCardInstance& Card, EGCGCardZone FromZone, EGCGCardZone ToZone,
 	AGCGPlayerState* PlayerState, AGCGGameState* GameState, bool bValidateLimits)
+{
+	return MoveCardsInternal(MakeArrayView(&Card, 1), FromZone, ToZone, PlayerState, GameState, bValidateLimits);
+}
+
+int32 UGCGZoneSubsystem::MoveCards(TArray<FGCGCardInstance>& Cards, EGCGCardZone FromZone, EGCGCardZone ToZone,
+	AGCGPlayerState* PlayerState, AGCGGameState* GameState, bool bValidateLimits)
+{
+	// All or nothing
+	return MoveCardsInternal(Cards, FromZone, ToZone, PlayerState, GameState, bValidateLimits) ? Cards.Num() : 0;
+}
+
+bool UGCGZoneSubsystem::MoveCardsInternal(TArrayView<FGCGCardInstance> Cards, EGCGCardZone FromZone, EGCGCardZone ToZone,
+	AGCGPlayerState* PlayerState, AGCGGameState* GameState, bool bValidateLimits)
 {
 	if (!PlayerState)
 	{
-		UE_LOG(LogTemp, Error, TEXT("UGCGZoneSubsystem::MoveCard - PlayerState is null"));
+		UE_LOG(LogTemp, Error, TEXT("UGCGZoneSubsystem::MoveCards - PlayerState is null"));
 		return false;
 	}
 
-	// Validate zone transition
-	if (!ValidateZoneTransition(FromZone, ToZone, Card))
+	if (Cards.Num() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGCGZoneSubsystem::MoveCard - Invalid zone transition from %s to %s"),
-			*GetZoneName(FromZone), *GetZoneName(ToZone));
-		return false;
+		return true;
 	}
 
-	// Check if destination zone can accept this card
-	if (bValidateLimits && !CanAddToZone(ToZone, PlayerState, GameState, Card.CardType))
+	// Validate zone transition (depends only on the zones)
+	if (!ValidateZoneTransition(FromZone, ToZone, Cards[0]))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGCGZoneSubsystem::MoveCard - Cannot add card to zone %s (at capacity or invalid)"),
-			*GetZoneName(ToZone));
+		UE_LOG(LogTemp, Warning, TEXT("UGCGZoneSubsystem::MoveCards - Invalid zone transition from %s to %s"),
+			*GetZoneName(FromZone), *GetZoneName(ToZone));
 		return false;
 	}
 
@@ -54,61 +69,91 @@ bool UGCGZoneSubsystem::MoveCard(FGCGCardInstance& Card, EGCGCardZone FromZone,
 
 	if (!FromZoneArray || !ToZoneArray)
 	{
-		UE_LOG(LogTemp, Error, TEXT("UGCGZoneSubsystem::MoveCard - Failed to get zone arrays"));
+		UE_LOG(LogTemp, Error, TEXT("UGCGZoneSubsystem::MoveCards - Failed to get zone arrays"));
 		return false;
 	}
 
-	// Find card in source zone
-	int32 CardIndex = FromZoneArray->IndexOfByPredicate([&Card](const FGCGCardInstance& Instance)
-	{
-		return Instance.InstanceID == Card.InstanceID;
-	});
+	// ----- Validation pass: nothing changes until every card checks out -----
 
-	if (CardIndex == INDEX_NONE)
+	// Capacity against the final count, not once per card
+	if (bValidateLimits)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGCGZoneSubsystem::MoveCard - Card not found in source zone %s"),
-			*GetZoneName(FromZone));
-		return false;
-	}
-
-	// Apply zone exit rules
-	ApplyZoneExitRules(Card, FromZone);
-
-	// Remove from source zone
-	FromZoneArray->RemoveAt(CardIndex);
-
-	// Update card's current zone
-	Card.CurrentZone = ToZone;
-
-	// Apply zone entry rules
-	ApplyZoneEntryRules(Card, ToZone);
+		const int32 MaxCapacity = GetZoneMaxCapacity(ToZone);
+		if (MaxCapacity != -1 && ToZoneArray->Num() + Cards.Num() > MaxCapacity)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UGCGZoneSubsystem::MoveCards - %s cannot take %d more cards (%d/%d)"),
+				*GetZoneName(ToZone), Cards.Num(), ToZoneArray->Num(), MaxCapacity);
+			return false;
+		}
 
-	// Add to destination zone
-	ToZoneArray->Add(Card);
+		for (const FGCGCardInstance& Card : Cards)
+		{
+			const FGCGCardData* CardData = GetCardData(Card, PlayerState);
+			if (CardData && !IsCardTypeAllowedInZone(ToZone, CardData->CardType))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("UGCGZoneSubsystem::MoveCards - Card %s (ID: %d) cannot enter %s"),
+					*Card.CardNumber.ToString(), Card.InstanceID, *GetZoneName(ToZone));
+				return false;
+			}
+		}
+	}
 
-	UE_LOG(LogTemp, Log, TEXT("UGCGZoneSubsystem::MoveCard - Moved card %s (ID: %d) from %s to %s"),
-		*Card.CardName.ToString(), Card.InstanceID, *GetZoneName(FromZone), *GetZoneName(ToZone));
+	// ----- Commit (shared with the rules engine) -----
 
-	return true;
-}
+	// IDs first: Cards may point into the source zone, which the move compacts
+	TArray<int32> MovedInstanceIDs;
+	MovedInstanceIDs.Reserve(Cards.Num());
+	for (const FGCGCardInstance& Card : Cards)
+	{
+		MovedInstanceIDs.Add(Card.InstanceID);
+	}
 
-int32 UGCGZoneSubsystem::MoveCards(TArray<FGCGCardInstance>& Cards, EGCGCardZone FromZone, EGCGCardZone ToZone,
-	AGCGPlayerState* PlayerState, AGCGGameState* GameState, bool bValidateLimits)
-{
-	int32 SuccessfulMoves = 0;
+	if (!FGCGRules::MoveCards(*PlayerState, Cards, FromZone, ToZone))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UGCGZoneSubsystem::MoveCards - Cards not all in source zone %s (or listed twice)"),
+			*GetZoneName(FromZone));
+		return false;
+	}
 
-	for (FGCGCardInstance& Card : Cards)
+	// Cards in play listen for their effect timings
+	const bool bLeavesPlay = FromZone == EGCGCardZone::BattleArea || FromZone == EGCGCardZone::BaseSection;
+	const bool bEntersPlay = ToZone == EGCGCardZone::BattleArea || ToZone == EGCGCardZone::BaseSection;
+	UGCGEffectSubsystem* EffectSubsystem = (bLeavesPlay || bEntersPlay) ? GetGameInstance()->GetSubsystem<UGCGEffectSubsystem>() : nullptr;
+	if (EffectSubsystem)
 	{
-		if (MoveCard(Card, FromZone, ToZone, PlayerState, GameState, bValidateLimits))
+		for (const int32 InstanceID : MovedInstanceIDs)
 		{
-			SuccessfulMoves++;
+			const FGCGCardInstance* MovedCard = PlayerState->FindCard(InstanceID);
+			if (!MovedCard)
+			{
+				continue;
+			}
+
+			if (bLeavesPlay)
+			{
+				EffectSubsystem->UnregisterCard(PlayerState->GetPlayerID(), *MovedCard);
+			}
+			if (bEntersPlay)
+			{
+				EffectSubsystem->RegisterCard(PlayerState->GetPlayerID(), *MovedCard);
+			}
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("UGCGZoneSubsystem::MoveCards - Moved %d/%d cards from %s to %s"),
-		SuccessfulMoves, Cards.Num(), *GetZoneName(FromZone), *GetZoneName(ToZone));
+	if (MovedInstanceIDs.Num() == 1)
+	{
+		UE_LOG(LogTemp, Log, TEXT("UGCGZoneSubsystem::MoveCard - Moved card ID %d from %s to %s"),
+			MovedInstanceIDs[0], *GetZoneName(FromZone), *GetZoneName(ToZone));
+	}
+	else
+	{
+		UE_LOG(LogTemp, Log, TEXT("UGCGZoneSubsystem::MoveCards - Moved %d cards from %s to %s"),
+			MovedInstanceIDs.Num(), *GetZoneName(FromZone), *GetZoneName(ToZone));
+	}
+
+	OnZoneChanged.Broadcast(PlayerState, FromZone, ToZone, MovedInstanceIDs);
 
-	return SuccessfulMoves;
+	return true;
 }
 
 // ===== ZONE VALIDATION =====
@@ -126,33 +171,12 @@ bool UGCGZoneSubsystem::CanAddToZone(EGCGCardZone Zone, AGCGPlayerState* PlayerS
 		return false;
 	}
 
-	// Zone-specific validation
-	switch (Zone)
-	{
-	case EGCGCardZone::BattleArea:
-		// Only Units can be in Battle Area
-		return CardType == EGCGCardType::Unit;
-
-	case EGCGCardZone::ResourceArea:
-		// Any card can be a resource (face-up or face-down)
-		return true;
-
-	case EGCGCardZone::BaseSection:
-		// Only Base cards (or EX Base tokens)
-		return CardType == EGCGCardType::Base;
-
-	case EGCGCardZone::Hand:
-	case EGCGCardZone::Deck:
-	case EGCGCardZone::ResourceDeck:
-	case EGCGCardZone::ShieldStack:
-	case EGCGCardZone::Trash:
-	case EGCGCardZone::Removal:
-		// These zones accept any card type
-		return true;
+	return IsCardTypeAllowedInZone(Zone, CardType);
+}
 
-	default:
-		return false;
-	}
+bool UGCGZoneSubsystem::IsCardTypeAllowedInZone(EGCGCardZone Zone, EGCGCardType CardType)
+{
+	return FGCGRules::IsCardTypeAllowedInZone(Zone, CardType);
 }
 
 int32 UGCGZoneSubsystem::GetZoneCount(EGCGCardZone Zone, AGCGPlayerState* PlayerState) const
@@ -168,32 +192,7 @@ int32 UGCGZoneSubsystem::GetZoneCount(EGCGCardZone Zone, AGCGPlayerState* Player
 
 int32 UGCGZoneSubsystem::GetZoneMaxCapacity(EGCGCardZone Zone, EGCGCardType CardType) const
 {
-	switch (Zone)
-	{
-	case EGCGCardZone::BattleArea:
-		// Max 6 Units in Battle Area
-		return 6;
-
-	case EGCGCardZone::ResourceArea:
-		// Max 15 Resources
-		return 15;
-
-	case EGCGCardZone::BaseSection:
-		// Max 1 Base
-		return 1;
-
-	case EGCGCardZone::Hand:
-	case EGCGCardZone::Deck:
-	case EGCGCardZone::ResourceDeck:
-	case EGCGCardZone::ShieldStack:
-	case EGCGCardZone::Trash:
-	case EGCGCardZone::Removal:
-		// Unlimited capacity
-		return -1;
-
-	default:
-		return -1;
-	}
+	return FGCGRules::GetZoneMaxCapacity(Zone);
 }
 
 bool UGCGZoneSubsystem::IsZoneAtCapacity(EGCGCardZone Zone, AGCGPlayerState* PlayerState, AGCGGameState* GameState, EGCGCardType CardType) const
@@ -250,17 +249,7 @@ bool UGCGZoneSubsystem::FindCardInZone(EGCGCardZone Zone, AGCGPlayerState* Playe
 		return false;
 	}
 
-	const TArray<FGCGCardInstance>* ZoneArray = GetZoneArray(Zone, PlayerState);
-	if (!ZoneArray)
-	{
-		return false;
-	}
-
-	const FGCGCardInstance* FoundCard = ZoneArray->FindByPredicate([InstanceID](const FGCGCardInstance& Card)
-	{
-		return Card.InstanceID == InstanceID;
-	});
-
+	const FGCGCardInstance* FoundCard = PlayerState->FindCardInZone(InstanceID, Zone);
 	if (FoundCard)
 	{
 		OutCard = *FoundCard;
@@ -270,6 +259,11 @@ bool UGCGZoneSubsystem::FindCardInZone(EGCGCardZone Zone, AGCGPlayerState* Playe
 	return false;
 }
 
+FGCGCardInstance* UGCGZoneSubsystem::FindCardByInstanceID(AGCGPlayerState* PlayerState, int32 InstanceID) const
+{
+	return PlayerState ? PlayerState->FindCard(InstanceID) : nullptr;
+}
+
 // ===== ZONE MANIPULATION =====
 
 bool UGCGZoneSubsystem::ShuffleZone(EGCGCardZone Zone, AGCGPlayerState* PlayerState)
@@ -292,17 +286,20 @@ bool UGCGZoneSubsystem::ShuffleZone(EGCGCardZone Zone, AGCGPlayerState* PlayerSt
 		return false;
 	}
 
-	// Fisher-Yates shuffle
-	int32 LastIndex = ZoneArray->Num() - 1;
-	for (int32 i = 0; i <= LastIndex; ++i)
+	// Fisher-Yates shuffle from the owner's deck stream, so the order only depends on the match seed
+	AGCGGameState* GameState = PlayerState->GetWorld() ? PlayerState->GetWorld()->GetGameState<AGCGGameState>() : nullptr;
+	if (GameState)
 	{
-		int32 Index = FMath::RandRange(i, LastIndex);
-		if (i != Index)
-		{
-			ZoneArray->Swap(i, Index);
-		}
+		GameState->GetRandomStream(EGCGRandomStream::Deck, PlayerState->GetPlayerID()).Shuffle(*ZoneArray);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UGCGZoneSubsystem::ShuffleZone - No game state, shuffle is not reproducible"));
+		FGCGRandomStream(FGCGMatchRandom::MakeSeed()).Shuffle(*ZoneArray);
 	}
 
+	PlayerState->IndexZone(Zone);
+
 	UE_LOG(LogTemp, Log, TEXT("UGCGZoneSubsystem::ShuffleZone - Shuffled %s (%d cards)"),
 		*GetZoneName(Zone), ZoneArray->Num());
 
@@ -323,12 +320,12 @@ bool UGCGZoneSubsystem::DrawTopCard(EGCGCardZone Zone, AGCGPlayerState* PlayerSt
 		return false;
 	}
 
-	// Top card is at index 0
-	OutCard = (*ZoneArray)[0];
-	ZoneArray->RemoveAt(0);
+	// Top card is the last element - nothing below it moves
+	FGCGOrderedZone::PopTop(*ZoneArray, OutCard);
+	PlayerState->UnindexCard(OutCard.InstanceID);
 
 	UE_LOG(LogTemp, Log, TEXT("UGCGZoneSubsystem::DrawTopCard - Drew card %s (ID: %d) from %s"),
-		*OutCard.CardName.ToString(), OutCard.InstanceID, *GetZoneName(Zone));
+		*OutCard.CardNumber.ToString(), OutCard.InstanceID, *GetZoneName(Zone));
 
 	return true;
 }
@@ -337,17 +334,21 @@ int32 UGCGZoneSubsystem::DrawTopCards(EGCGCardZone Zone, AGCGPlayerState* Player
 {
 	OutCards.Empty();
 
-	for (int32 i = 0; i < Count; ++i)
+	if (!PlayerState)
 	{
-		FGCGCardInstance DrawnCard;
-		if (DrawTopCard(Zone, PlayerState, DrawnCard))
-		{
-			OutCards.Add(DrawnCard);
-		}
-		else
-		{
-			break;
-		}
+		return 0;
+	}
+
+	TArray<FGCGCardInstance>* ZoneArray = GetZoneArray(Zone, PlayerState);
+	if (!ZoneArray)
+	{
+		return 0;
+	}
+
+	FGCGOrderedZone::PopTop(*ZoneArray, Count, OutCards);
+	for (const FGCGCardInstance& DrawnCard : OutCards)
+	{
+		PlayerState->UnindexCard(DrawnCard.InstanceID);
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("UGCGZoneSubsystem::DrawTopCards - Drew %d/%d cards from %s"),
@@ -364,16 +365,42 @@ bool UGCGZoneSubsystem::PeekTopCard(EGCGCardZone Zone, AGCGPlayerState* PlayerSt
 	}
 
 	const TArray<FGCGCardInstance>* ZoneArray = GetZoneArray(Zone, PlayerState);
-	if (!ZoneArray || ZoneArray->Num() == 0)
+	const FGCGCardInstance* TopCard = ZoneArray ? FGCGOrderedZone::PeekTop(*ZoneArray) : nullptr;
+	if (!TopCard)
 	{
 		return false;
 	}
 
-	// Top card is at index 0
-	OutCard = (*ZoneArray)[0];
+	OutCard = *TopCard;
 	return true;
 }
 
+int32 UGCGZoneSubsystem::PeekTopCards(EGCGCardZone Zone, AGCGPlayerState* PlayerState, int32 Count, TArray<FGCGCardInstance>& OutCards) const
+{
+	OutCards.Empty();
+
+	if (!PlayerState)
+	{
+		return 0;
+	}
+
+	const TArray<FGCGCardInstance>* ZoneArray = GetZoneArray(Zone, PlayerState);
+	return ZoneArray ? FGCGOrderedZone::RevealTop(*ZoneArray, Count, OutCards) : 0;
+}
+
+bool UGCGZoneSubsystem::MoveTopCard(EGCGCardZone FromZone, EGCGCardZone ToZone, AGCGPlayerState* PlayerState,
+	AGCGGameState* GameState, FGCGCardInstance& OutCard, bool bValidateLimits)
+{
+	if (!PeekTopCard(FromZone, PlayerState, OutCard))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UGCGZoneSubsystem::MoveTopCard - Zone %s is empty"), *GetZoneName(FromZone));
+		return false;
+	}
+
+	// The top card is the last slot, so MoveCard's removal shifts nothing
+	return MoveCard(OutCard, FromZone, ToZone, PlayerState, GameState, bValidateLimits);
+}
+
 // ===== SPECIAL ZONE OPERATIONS =====
 
 int32 UGCGZoneSubsystem::ActivateAllCards(AGCGPlayerState* PlayerState, EGCGCardZone Zone)
@@ -404,6 +431,7 @@ int32 UGCGZoneSubsystem::ActivateAllCards(AGCGPlayerState* PlayerState, EGCGCard
 		if (!Card.bIsActive)
 		{
 			Card.bIsActive = true;
+			PlayerState->RefreshCardHash(Card);
 			ActivatedCount++;
 		}
 	}
@@ -434,6 +462,7 @@ int32 UGCGZoneSubsystem::RestAllCards(AGCGPlayerState* PlayerState, EGCGCardZone
 		if (Card.bIsActive)
 		{
 			Card.bIsActive = false;
+			PlayerState->RefreshCardHash(Card);
 			RestedCount++;
 		}
 	}
@@ -461,9 +490,10 @@ int32 UGCGZoneSubsystem::ClearAllDamage(AGCGPlayerState* PlayerState, EGCGCardZo
 
 	for (FGCGCardInstance& Card : *ZoneArray)
 	{
-		if (Card.CurrentDamage > 0)
+		if (Card.DamageCounters > 0)
 		{
-			Card.CurrentDamage = 0;
+			Card.DamageCounters = 0;
+			PlayerState->RefreshCardHash(Card);
 			ClearedCount++;
 		}
 	}
@@ -529,58 +559,21 @@ bool UGCGZoneSubsystem::IsZonePublic(EGCGCardZone Zone)
 
 bool UGCGZoneSubsystem::IsZoneOrdered(EGCGCardZone Zone)
 {
-	switch (Zone)
-	{
-	case EGCGCardZone::Deck:
-	case EGCGCardZone::ResourceDeck:
-	case EGCGCardZone::ShieldStack:
-		return true;
-
-	case EGCGCardZone::Hand:
-	case EGCGCardZone::BattleArea:
-	case EGCGCardZone::ResourceArea:
-	case EGCGCardZone::BaseSection:
-	case EGCGCardZone::Trash:
-	case EGCGCardZone::Removal:
-		return false;
-
-	default:
-		return false;
-	}
+	return FGCGRules::IsZoneOrdered(Zone);
 }
 
 // ===== INTERNAL HELPERS =====
 
 TArray<FGCGCardInstance>* UGCGZoneSubsystem::GetZoneArray(EGCGCardZone Zone, AGCGPlayerState* PlayerState) const
 {
-	if (!PlayerState)
-	{
-		return nullptr;
-	}
+	return PlayerState ? PlayerState->GetZoneArray(Zone) : nullptr;
+}
 
-	switch (Zone)
-	{
-	case EGCGCardZone::Deck:
-		return &PlayerState->Deck;
-	case EGCGCardZone::ResourceDeck:
-		return &PlayerState->ResourceDeck;
-	case EGCGCardZone::Hand:
-		return &PlayerState->Hand;
-	case EGCGCardZone::ResourceArea:
-		return &PlayerState->ResourceArea;
-	case EGCGCardZone::BattleArea:
-		return &PlayerState->BattleArea;
-	case EGCGCardZone::ShieldStack:
-		return &PlayerState->ShieldStack;
-	case EGCGCardZone::BaseSection:
-		return &PlayerState->BaseSection;
-	case EGCGCardZone::Trash:
-		return &PlayerState->Trash;
-	case EGCGCardZone::Removal:
-		return &PlayerState->Removal;
-	default:
-		return nullptr;
-	}
+const FGCGCardData* UGCGZoneSubsystem::GetCardData(const FGCGCardInstance& Card, AGCGPlayerState* PlayerState) const
+{
+	UWorld* World = PlayerState ? PlayerState->GetWorld() : nullptr;
+	AGCGGameModeBase* GameMode = World ? World->GetAuthGameMode<AGCGGameModeBase>() : nullptr;
+	return GameMode ? GameMode->GetCardDataForInstance(Card) : nullptr;
 }
 
 bool UGCGZoneSubsystem::ValidateZoneTransition(EGCGCardZone FromZone, EGCGCardZone ToZone, const FGCGCardInstance& Card) const
@@ -607,56 +600,3 @@ bool UGCGZoneSubsystem::ValidateZoneTransition(EGCGCardZone FromZone, EGCGCardZo
 	// All other transitions are valid
 	return true;
 }
-
-void UGCGZoneSubsystem::ApplyZoneEntryRules(FGCGCardInstance& Card, EGCGCardZone Zone)
-{
-	switch (Zone)
-	{
-	case EGCGCardZone::BattleArea:
-		// Units enter battle area rested (unless effect says otherwise)
-		Card.bIsActive = false;
-		break;
-
-	case EGCGCardZone::ResourceArea:
-		// Resources enter active
-		Card.bIsActive = true;
-		break;
-
-	case EGCGCardZone::Hand:
-		// Cards in hand are always active (conceptually)
-		Card.bIsActive = true;
-		break;
-
-	case EGCGCardZone::Trash:
-	case EGCGCardZone::Removal:
-		// Clear all state when going to trash/removal
-		Card.bIsActive = false;
-		Card.CurrentDamage = 0;
-		Card.Counters.Empty();
-		Card.AttachedCards.Empty();
-		break;
-
-	default:
-		// No special rules
-		break;
-	}
-}
-
-void UGCGZoneSubsystem::ApplyZoneExitRules(FGCGCardInstance& Card, EGCGCardZone Zone)
-{
-	// Remove attached cards when leaving play zones
-	if (Zone == EGCGCardZone::BattleArea || Zone == EGCGCardZone::ResourceArea || Zone == EGCGCardZone::BaseSection)
-	{
-		if (Card.AttachedCards.Num() > 0)
-		{
-			UE_LOG(LogTemp, Log, TEXT("UGCGZoneSubsystem::ApplyZoneExitRules - Card %s leaving %s with %d attached cards"),
-				*Card.CardName.ToString(), *GetZoneName(Zone), Card.AttachedCards.Num());
-
-			// TODO: Move attached cards to appropriate zone (typically Trash)
-			// For now, just clear the array
-			Card.AttachedCards.Empty();
-		}
-	}
-
-	// No other special exit rules for now
-}
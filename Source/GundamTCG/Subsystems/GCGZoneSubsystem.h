@@ -13,6 +13,15 @@
 class AGCGPlayerState;
 class AGCGGameState;
 
+/**
+ * Broadcast once per successful MoveCard / MoveCards call
+ * @param PlayerState Owner of both zones
+ * @param FromZone Zone the cards left
+ * @param ToZone Zone the cards entered
+ * @param InstanceIDs Every card that moved, in request order
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnGCGZoneChanged, AGCGPlayerState*, PlayerState, EGCGCardZone, FromZone, EGCGCardZone, ToZone, const TArray<int32>&, InstanceIDs);
+
 /**
  * Zone Management Subsystem
  *
@@ -23,6 +32,9 @@ class AGCGGameState;
  * - Zone queries (get cards in zone, count, etc.)
  *
  * All zone operations go through this subsystem to ensure consistency and proper replication.
+ * Every move also updates the player's card location index (InstanceID → zone, slot).
+ * Stacked zones keep their top card last, so drawing, peeking and breaking shields
+ * never shift the array; cards moved into a stacked zone go to the bottom.
  */
 UCLASS()
 class GUNDAMTCG_API UGCGZoneSubsystem : public UGameInstanceSubsystem
@@ -59,19 +71,28 @@ public:
 		AGCGPlayerState* PlayerState, AGCGGameState* GameState, bool bValidateLimits = true);
 
 	/**
-	 * Move multiple cards from one zone to another
-	 * @param Cards Array of card instances to move
+	 * Move multiple cards from one zone to another as one transaction
+	 * Capacity is checked once against the final count and every card is validated
+	 * before anything moves: either all cards move or none do. Linear in the zone sizes,
+	 * with a single OnZoneChanged broadcast.
+	 * @param Cards Array of card instances to move (updated with their new state)
 	 * @param FromZone The zone the cards are currently in
 	 * @param ToZone The zone to move the cards to
 	 * @param PlayerState The player state that owns these cards
 	 * @param GameState The current game state
 	 * @param bValidateLimits Should zone limits be validated?
-	 * @return Number of cards successfully moved
+	 * @return Number of cards moved (Cards.Num() or 0)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Zone Management")
 	int32 MoveCards(UPARAM(ref) TArray<FGCGCardInstance>& Cards, EGCGCardZone FromZone, EGCGCardZone ToZone,
 		AGCGPlayerState* PlayerState, AGCGGameState* GameState, bool bValidateLimits = true);
 
+	/**
+	 * Fired once per successful MoveCard / MoveCards call
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Zone Management|Events")
+	FOnGCGZoneChanged OnZoneChanged;
+
 	// ===== ZONE VALIDATION =====
 
 	/**
@@ -136,10 +157,18 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Zone Management")
 	bool FindCardInZone(EGCGCardZone Zone, AGCGPlayerState* PlayerState, int32 InstanceID, FGCGCardInstance& OutCard) const;
 
+	/**
+	 * Find a card in any of a player's zones by instance ID (C++ only, O(1))
+	 * @param PlayerState The player state
+	 * @param InstanceID The instance ID to find
+	 * @return The card in place, or nullptr if not found
+	 */
+	FGCGCardInstance* FindCardByInstanceID(AGCGPlayerState* PlayerState, int32 InstanceID) const;
+
 	// ===== ZONE MANIPULATION =====
 
 	/**
-	 * Shuffle a zone (Deck or Resource Deck)
+	 * Shuffle a zone (Deck or Resource Deck) with the owner's seeded deck stream
 	 * @param Zone The zone to shuffle (must be Deck or ResourceDeck)
 	 * @param PlayerState The player state
 	 * @return True if shuffle was successful
@@ -148,7 +177,7 @@ public:
 	bool ShuffleZone(EGCGCardZone Zone, AGCGPlayerState* PlayerState);
 
 	/**
-	 * Draw the top card from a zone
+	 * Draw the top card from a zone (removes it; the caller places it)
 	 * @param Zone The zone to draw from (usually Deck)
 	 * @param PlayerState The player state
 	 * @param OutCard The drawn card
@@ -178,6 +207,31 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Zone Management")
 	bool PeekTopCard(EGCGCardZone Zone, AGCGPlayerState* PlayerState, FGCGCardInstance& OutCard) const;
 
+	/**
+	 * Look at the top cards of a zone without removing them (reveal / look at effects)
+	 * @param Zone The zone to peek at
+	 * @param PlayerState The player state
+	 * @param Count Number of cards to look at
+	 * @param OutCards The cards, top card first
+	 * @return Number of cards returned (fewer if the zone is smaller)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Zone Management")
+	int32 PeekTopCards(EGCGCardZone Zone, AGCGPlayerState* PlayerState, int32 Count, TArray<FGCGCardInstance>& OutCards) const;
+
+	/**
+	 * Move the top card of a zone into another zone (draw to hand, place resource, break shield)
+	 * @param FromZone The stacked zone to take from
+	 * @param ToZone The zone to move the card to
+	 * @param PlayerState The player state
+	 * @param GameState The current game state
+	 * @param OutCard The moved card
+	 * @param bValidateLimits Should zone limits be validated?
+	 * @return True if a card was moved
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Zone Management")
+	bool MoveTopCard(EGCGCardZone FromZone, EGCGCardZone ToZone, AGCGPlayerState* PlayerState,
+		AGCGGameState* GameState, FGCGCardInstance& OutCard, bool bValidateLimits = true);
+
 	// ===== SPECIAL ZONE OPERATIONS =====
 
 	/**
@@ -245,25 +299,35 @@ private:
 	TArray<FGCGCardInstance>* GetZoneArray(EGCGCardZone Zone, AGCGPlayerState* PlayerState) const;
 
 	/**
-	 * Validate zone transition (some zones have special rules)
-	 * @param FromZone Source zone
-	 * @param ToZone Destination zone
-	 * @param Card The card being moved
-	 * @return True if transition is valid
+	 * Resolve a card's static data through the match catalog
+	 * @param Card The card instance
+	 * @param PlayerState The owning player state (for the world)
+	 * @return Card data, or nullptr without a game mode (clients) or for unknown cards
 	 */
-	bool ValidateZoneTransition(EGCGCardZone FromZone, EGCGCardZone ToZone, const FGCGCardInstance& Card) const;
+	const FGCGCardData* GetCardData(const FGCGCardInstance& Card, AGCGPlayerState* PlayerState) const;
 
 	/**
-	 * Apply zone-specific rules when card enters a zone
-	 * @param Card The card entering the zone
-	 * @param Zone The zone being entered
+	 * Can a card of this type sit in a zone? (capacity not included)
+	 * @param Zone The zone
+	 * @param CardType The card's type
+	 * @return True if allowed
 	 */
-	void ApplyZoneEntryRules(FGCGCardInstance& Card, EGCGCardZone Zone);
+	static bool IsCardTypeAllowedInZone(EGCGCardZone Zone, EGCGCardType CardType);
 
 	/**
-	 * Apply zone-specific rules when card leaves a zone
-	 * @param Card The card leaving the zone
-	 * @param Zone The zone being left
+	 * Shared implementation of MoveCard / MoveCards: validate limits, move through
+	 * FGCGRules::MoveCards, then keep effect listeners and OnZoneChanged current
+	 * @return True if every card moved (false = nothing changed)
+	 */
+	bool MoveCardsInternal(TArrayView<FGCGCardInstance> Cards, EGCGCardZone FromZone, EGCGCardZone ToZone,
+		AGCGPlayerState* PlayerState, AGCGGameState* GameState, bool bValidateLimits);
+
+	/**
+	 * Validate zone transition (some zones have special rules)
+	 * @param FromZone Source zone
+	 * @param ToZone Destination zone
+	 * @param Card The card being moved
+	 * @return True if transition is valid
 	 */
-	void ApplyZoneExitRules(FGCGCardInstance& Card, EGCGCardZone Zone);
+	bool ValidateZoneTransition(EGCGCardZone FromZone, EGCGCardZone ToZone, const FGCGCardInstance& Card) const;
 };
@@ -92,7 +92,7 @@ struct FGCGUICardData
 		Keywords = CardInstance.ActiveKeywords;
 		bIsActive = CardInstance.bIsActive;
 		bHasAttackedThisTurn = CardInstance.bHasAttackedThisTurn;
-		bIsPaired = (CardInstance.PairedCardInstanceID != -1);
+		bIsPaired = (CardInstance.PairedCardInstanceID != 0);
 		// CardArt and CardFrame would be loaded separately
 	}
 };
@@ -349,7 +349,7 @@ bool UGCGUIHelpers::CanUnitAttack(AGCGPlayerState* PlayerState, const FGCGCardIn
 	if (UnitInstance.TurnDeployed >= GameState->TurnNumber)
 	{
 		// Check for Link Unit exception
-		if (!UnitInstance.ActiveKeywords.Contains(EGCGKeyword::LinkUnit) || UnitInstance.PairedCardInstanceID == -1)
+		if (!UnitInstance.ActiveKeywords.Contains(EGCGKeyword::LinkUnit) || UnitInstance.PairedCardInstanceID == 0)
 		{
 			return false;
 		}
@@ -186,6 +186,18 @@ enum class EGCGModifierDuration : uint8
     Permanent               UMETA(DisplayName = "Permanent")
 };
 
+/**
+ * Modifier Type (which stat a modifier changes)
+ */
+UENUM(BlueprintType)
+enum class EGCGModifierType : uint8
+{
+    None                    UMETA(DisplayName = "None"),
+    AP                      UMETA(DisplayName = "AP"),
+    HP                      UMETA(DisplayName = "HP"),
+    Cost                    UMETA(DisplayName = "Cost")
+};
+
 /**
  * Damage Source (FAQ Q97-99: Battle damage vs Effect damage)
  * Used to track what type of damage was dealt for effect triggers
@@ -223,6 +235,20 @@ enum class EGCGTargetScope : uint8
 struct FGCGCardData;
 struct FGCGCardInstance;
 
+// ===========================================================================================
+// CARD IDS
+// ===========================================================================================
+
+/**
+ * Card ID (dense handle into the card catalog)
+ * Index of a card definition inside FGCGCardCatalog's contiguous card array.
+ * Only valid for the catalog that issued it - resolve by CardNumber across reloads.
+ */
+using FGCGCardId = uint16;
+
+// Sentinel for "no catalog entry"
+inline constexpr FGCGCardId GCG_INVALID_CARD_ID = MAX_uint16;
+
 // ===========================================================================================
 // CORE DATA STRUCTURES
 // ===========================================================================================
@@ -404,9 +430,9 @@ struct FGCGActiveModifier
 {
     GENERATED_BODY()
 
-    // What stat is being modified? ("AP", "HP", "Cost")
+    // What stat is being modified?
     UPROPERTY(BlueprintReadWrite, Category = "Modifier")
-    FName ModifierType;
+    EGCGModifierType ModifierType;
 
     // Modifier amount (can be negative)
     UPROPERTY(BlueprintReadWrite, Category = "Modifier")
@@ -426,7 +452,7 @@ struct FGCGActiveModifier
 
     FGCGActiveModifier()
     {
-        ModifierType = NAME_None;
+        ModifierType = EGCGModifierType::None;
         Amount = 0;
         Duration = EGCGModifierDuration::Instant;
         SourceInstanceID = 0;
@@ -640,31 +666,77 @@ struct FGCGCardData : public FTableRowBase
 /**
  * Card Instance (runtime card state)
  * This represents a specific copy of a card in a game
+ * It references its definition (CardNumber / CardId) instead of copying it, so zone arrays
+ * stay small and cheap to move, copy, snapshot and replicate
  */
 USTRUCT(BlueprintType)
 struct FGCGCardInstance
 {
     GENERATED_BODY()
 
+    // Layout: identity and small state first, then the ints, then the (usually empty) arrays.
+    // Static card data (name, type, colors, stats, printed keywords, effects) is never copied
+    // here - resolve it through CardId / CardNumber in the match's card catalog.
+
     // ===== IDENTITY =====
 
     // Unique runtime instance ID
     UPROPERTY(BlueprintReadWrite, Category = "Instance")
     int32 InstanceID;
 
-    // Reference to static card definition
+    // Reference to static card definition (stable across catalog generations)
     UPROPERTY(BlueprintReadWrite, Category = "Instance")
     FName CardNumber;
 
+    // FGCGCardId of CardNumber in the catalog generation the match pinned (GCG_INVALID_CARD_ID if unresolved)
+    UPROPERTY()
+    uint16 CardId;
+
     // ===== ZONE & STATE =====
 
     // Current zone
     UPROPERTY(BlueprintReadWrite, Category = "Zone")
     EGCGCardZone CurrentZone;
 
+    // Last damage source (FAQ Q97-99: for "destroyed with damage" effects)
+    UPROPERTY(BlueprintReadWrite, Category = "Tracking")
+    EGCGDamageSource LastDamageSource;
+
     // Is this card active (false = rested/exhausted)?
     UPROPERTY(BlueprintReadWrite, Category = "State")
-    bool bIsActive;
+    uint8 bIsActive : 1;
+
+    // Is this a token? (EX Base, EX Resource, etc. - CardNumber is the token type)
+    UPROPERTY(BlueprintReadWrite, Category = "Token")
+    uint8 bIsToken : 1;
+
+    // Has this Unit attacked this turn?
+    UPROPERTY(BlueprintReadWrite, Category = "Tracking")
+    uint8 bHasAttackedThisTurn : 1;
+
+    // Number of times activated this turn (for once-per-turn abilities)
+    UPROPERTY(BlueprintReadWrite, Category = "Tracking")
+    uint8 ActivationCountThisTurn;
+
+    // ===== CACHED MODIFIER TOTALS =====
+    // Derived from ActiveModifiers / TemporaryKeywords by RefreshModifierTotals() and the
+    // temporary keyword helpers. Replicated with the instance so clients read the same values.
+
+    // Bit per EGCGKeyword present in TemporaryKeywords (see GetKeywordBit)
+    UPROPERTY()
+    uint16 TemporaryKeywordMask;
+
+    // Sum of AP modifiers
+    UPROPERTY()
+    int16 ModifierAP;
+
+    // Sum of HP modifiers
+    UPROPERTY()
+    int16 ModifierHP;
+
+    // Sum of Cost modifiers
+    UPROPERTY()
+    int16 ModifierCost;
 
     // Accumulated damage
     UPROPERTY(BlueprintReadWrite, Category = "State")
@@ -686,17 +758,14 @@ struct FGCGCardInstance
     UPROPERTY(BlueprintReadWrite, Category = "Pairing")
     int32 PairedCardInstanceID;
 
-    // ===== TOKEN =====
-
-    // Is this a token? (EX Base, EX Resource, etc.)
-    UPROPERTY(BlueprintReadWrite, Category = "Token")
-    bool bIsToken;
+    // ===== TRACKING =====
 
-    // Token type (if token)
-    UPROPERTY(BlueprintReadWrite, Category = "Token")
-    FName TokenType;
+    // Turn this card was deployed
+    UPROPERTY(BlueprintReadWrite, Category = "Tracking")
+    int32 TurnDeployed;
 
     // ===== RUNTIME MODIFIERS =====
+    // Empty arrays own no heap memory; most cards never get either.
 
     // Active stat modifiers
     UPROPERTY(BlueprintReadWrite, Category = "Modifiers")
@@ -706,100 +775,91 @@ struct FGCGCardInstance
     UPROPERTY(BlueprintReadWrite, Category = "Modifiers")
     TArray<FGCGKeywordInstance> TemporaryKeywords;
 
-    // ===== TRACKING =====
-
-    // Turn this card was deployed
-    UPROPERTY(BlueprintReadWrite, Category = "Tracking")
-    int32 TurnDeployed;
-
-    // Has this Unit attacked this turn?
-    UPROPERTY(BlueprintReadWrite, Category = "Tracking")
-    bool bHasAttackedThisTurn;
-
-    // Number of times activated this turn (for once-per-turn abilities)
-    UPROPERTY(BlueprintReadWrite, Category = "Tracking")
-    int32 ActivationCountThisTurn;
-
-    // Last damage source (FAQ Q97-99: for "destroyed with damage" effects)
-    UPROPERTY(BlueprintReadWrite, Category = "Tracking")
-    EGCGDamageSource LastDamageSource;
-
     // Default constructor
     FGCGCardInstance()
     {
         InstanceID = 0;
         CardNumber = NAME_None;
+        CardId = GCG_INVALID_CARD_ID;
         CurrentZone = EGCGCardZone::None;
+        LastDamageSource = EGCGDamageSource::None;
         bIsActive = true;
+        bIsToken = false;
+        bHasAttackedThisTurn = false;
+        ActivationCountThisTurn = 0;
+        TemporaryKeywordMask = 0;
+        ModifierAP = 0;
+        ModifierHP = 0;
+        ModifierCost = 0;
         DamageCounters = 0;
         OwnerPlayerID = 0;
         ControllerPlayerID = 0;
         PairedCardInstanceID = 0;
-        bIsToken = false;
-        TokenType = NAME_None;
         TurnDeployed = 0;
-        bHasAttackedThisTurn = false;
-        ActivationCountThisTurn = 0;
-        LastDamageSource = EGCGDamageSource::None;
+    }
+
+    // Token type (the token's card number, NAME_None for regular cards)
+    FName GetTokenType() const
+    {
+        return bIsToken ? CardNumber : NAME_None;
     }
 
     // ===== HELPER FUNCTIONS =====
 
-    // Calculate total AP (including modifiers)
-    int32 GetTotalAP(const FGCGCardData* CardData) const
+    // Recompute the cached modifier totals (call whenever ActiveModifiers changes)
+    void RefreshModifierTotals()
     {
-        if (!CardData) return 0;
-
-        int32 TotalAP = CardData->AP;
+        int32 TotalAP = 0;
+        int32 TotalHP = 0;
+        int32 TotalCost = 0;
 
-        // Add modifiers
         for (const FGCGActiveModifier& Mod : ActiveModifiers)
         {
-            if (Mod.ModifierType == FName("AP"))
+            switch (Mod.ModifierType)
             {
-                TotalAP += Mod.Amount;
+            case EGCGModifierType::AP:   TotalAP += Mod.Amount; break;
+            case EGCGModifierType::HP:   TotalHP += Mod.Amount; break;
+            case EGCGModifierType::Cost: TotalCost += Mod.Amount; break;
+            default: break;
             }
         }
 
-        return FMath::Max(0, TotalAP);
+        ModifierAP = static_cast<int16>(FMath::Clamp(TotalAP, (int32)MIN_int16, (int32)MAX_int16));
+        ModifierHP = static_cast<int16>(FMath::Clamp(TotalHP, (int32)MIN_int16, (int32)MAX_int16));
+        ModifierCost = static_cast<int16>(FMath::Clamp(TotalCost, (int32)MIN_int16, (int32)MAX_int16));
     }
 
-    // Calculate total HP (including modifiers)
-    int32 GetTotalHP(const FGCGCardData* CardData) const
+    // Cached sum of all modifiers of one type
+    int32 GetModifierTotal(EGCGModifierType ModifierType) const
     {
-        if (!CardData) return 0;
-
-        int32 TotalHP = CardData->HP;
-
-        // Add modifiers
-        for (const FGCGActiveModifier& Mod : ActiveModifiers)
+        switch (ModifierType)
         {
-            if (Mod.ModifierType == FName("HP"))
-            {
-                TotalHP += Mod.Amount;
-            }
+        case EGCGModifierType::AP:   return ModifierAP;
+        case EGCGModifierType::HP:   return ModifierHP;
+        case EGCGModifierType::Cost: return ModifierCost;
+        default:                     return 0;
         }
+    }
 
-        return FMath::Max(0, TotalHP);
+    // Calculate total AP (including modifiers)
+    int32 GetTotalAP(const FGCGCardData* CardData) const
+    {
+        if (!CardData) return 0;
+        return FMath::Max(0, CardData->AP + ModifierAP);
+    }
+
+    // Calculate total HP (including modifiers)
+    int32 GetTotalHP(const FGCGCardData* CardData) const
+    {
+        if (!CardData) return 0;
+        return FMath::Max(0, CardData->HP + ModifierHP);
     }
 
     // Calculate total Cost (including modifiers)
     int32 GetTotalCost(const FGCGCardData* CardData) const
     {
         if (!CardData) return 0;
-
-        int32 TotalCost = CardData->Cost;
-
-        // Add modifiers
-        for (const FGCGActiveModifier& Mod : ActiveModifiers)
-        {
-            if (Mod.ModifierType == FName("Cost"))
-            {
-                TotalCost += Mod.Amount;
-            }
-        }
-
-        return FMath::Max(0, TotalCost);
+        return FMath::Max(0, CardData->Cost + ModifierCost);
     }
 
     // Is this card destroyed? (damage >= HP)
@@ -835,19 +895,50 @@ struct FGCGCardInstance
         return true;
     }
 
-    // Get combined keywords (base + temporary)
-    TArray<FGCGKeywordInstance> GetAllKeywords(const FGCGCardData* CardData) const
+    // Bit for a keyword in TemporaryKeywordMask
+    static uint16 GetKeywordBit(EGCGKeyword Keyword)
     {
-        TArray<FGCGKeywordInstance> AllKeywords;
+        static_assert((int32)EGCGKeyword::LinkUnit < 16, "EGCGKeyword no longer fits TemporaryKeywordMask");
+        return static_cast<uint16>(1u << static_cast<uint32>(Keyword));
+    }
+
+    // Grant a temporary keyword (keeps TemporaryKeywordMask in sync)
+    void AddTemporaryKeyword(const FGCGKeywordInstance& KeywordInstance)
+    {
+        TemporaryKeywords.Add(KeywordInstance);
+        TemporaryKeywordMask |= GetKeywordBit(KeywordInstance.Keyword);
+    }
+
+    // Remove every temporary keyword (keeps TemporaryKeywordMask in sync)
+    void ClearTemporaryKeywords()
+    {
+        TemporaryKeywords.Reset();
+        TemporaryKeywordMask = 0;
+    }
+
+    // Does this card have a keyword granted by an effect? (O(1))
+    bool HasTemporaryKeyword(EGCGKeyword Keyword) const
+    {
+        return (TemporaryKeywordMask & GetKeywordBit(Keyword)) != 0;
+    }
+
+    // Does this card have a keyword (printed or temporary)?
+    bool HasKeyword(EGCGKeyword Keyword, const FGCGCardData* CardData) const
+    {
+        return HasTemporaryKeyword(Keyword) || (CardData && CardData->HasKeyword(Keyword));
+    }
+
+    // Get combined keywords (base + temporary) into a caller-owned buffer
+    void GetAllKeywords(const FGCGCardData* CardData, TArray<FGCGKeywordInstance>& OutKeywords) const
+    {
+        OutKeywords.Reset();
 
         if (CardData)
         {
-            AllKeywords.Append(CardData->Keywords);
+            OutKeywords.Append(CardData->Keywords);
         }
 
-        AllKeywords.Append(TemporaryKeywords);
-
-        return AllKeywords;
+        OutKeywords.Append(TemporaryKeywords);
     }
 
     // Get total keyword value (stacking)
@@ -860,10 +951,13 @@ struct FGCGCardInstance
             Total += CardData->GetTotalKeywordValue(Keyword);
         }
 
-        for (const FGCGKeywordInstance& KW : TemporaryKeywords)
+        if (HasTemporaryKeyword(Keyword))
         {
-            if (KW.Keyword == Keyword)
-                Total += KW.Value;
+            for (const FGCGKeywordInstance& KW : TemporaryKeywords)
+            {
+                if (KW.Keyword == Keyword)
+                    Total += KW.Value;
+            }
         }
 
         return Total;
@@ -959,7 +1053,7 @@ struct FGCGTeamInfo
     UPROPERTY(BlueprintReadWrite, Category = "Team")
     FGCGCardInstance SharedBase;
 
-    // Shared Shield Stack (8 shields total, 4 per player)
+    // Shared Shield Stack (8 shields total, 4 per player), stored bottom → top: the top shield is the last element
     UPROPERTY(BlueprintReadWrite, Category = "Team")
     TArray<FGCGCardInstance> SharedShieldStack;
 